@@ -0,0 +1,15038 @@
+/* generated by tools/chibi-aot, do not edit */
+
+static sexp_sint_t sexp_aot_srfi_1_0 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 81: goto L81;
+  case 90: goto L90;
+  case 99: goto L99;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_NULLP_JUMP_UNLESS(9, L36);
+ L18:
+  _AOT_PUSH(18);
+ L27:
+  _AOT_JUMP(27, L99);
+ L36:
+  _AOT_LOCAL_REF(36, 0);
+ L45:
+  _AOT_PAIRP_JUMP_UNLESS(45, L90);
+ L54:
+  _AOT_LOCAL_REF_CDR(54, 0);
+ L63:
+  _AOT_GLOBAL_KNOWN_REF(63);
+ L72:
+  _AOT_TAIL_CALL(72, 1);
+ L81:
+  _AOT_JUMP(81, L99);
+ L90:
+  _AOT_PUSH(90);
+ L99:
+  _AOT_RET(99);
+  _AOT_EXIT(100);
+}
+
+static const unsigned char sexp_aot_srfi_1_0_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 90, 26, 0, 0, 0, 0, 0,
+  0, 0, 15, 78, 0, 0, 0, 0, 0, 0, 0, 14, 71, 0, 0, 0,
+  0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 91, 44, 0,
+  0, 0, 0, 0, 0, 0, 82, 0, 0, 0, 0, 0, 0, 0, 0, 19,
+  0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0,
+  0, 14, 17, 0, 0, 0, 0, 0, 0, 0, 15, 14, 0, 0, 0, 0,
+  0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_1 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 17: goto L17;
+  case 26: goto L26;
+  case 35: goto L35;
+  case 44: goto L44;
+  case 53: goto L53;
+  case 62: goto L62;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 81: goto L81;
+  case 82: goto L82;
+  case 91: goto L91;
+  case 116: goto L116;
+  case 125: goto L125;
+  case 134: goto L134;
+  case 143: goto L143;
+  case 152: goto L152;
+  case 161: goto L161;
+  case 170: goto L170;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF_JUMP_UNLESS(0, 0, L35);
+ L17:
+  _AOT_LOCAL_REF(17, 0);
+ L26:
+  _AOT_JUMP(26, L170);
+ L35:
+  _AOT_CLOSURE_REF(35, 0);
+ L44:
+  _AOT_PAIRP_JUMP_UNLESS(44, L161);
+ L53:
+  _AOT_CLOSURE_REF(53, 0);
+ L62:
+  _AOT_CDR(62);
+ L63:
+  _AOT_PAIRP_JUMP_UNLESS(63, L143);
+ L72:
+  _AOT_CLOSURE_REF(72, 2);
+ L81:
+  _AOT_CDR(81);
+ L82:
+  _AOT_CLOSURE_REF(82, 0);
+ L91:
+  _AOT_GLOBAL_KNOWN_CALL(91, 1);
+ L116:
+  _AOT_CLOSURE_REF_CDR(116, 1);
+ L125:
+  _AOT_TAIL_CALL(125, 2);
+ L134:
+  _AOT_JUMP(134, L152);
+ L143:
+  _AOT_PUSH(143);
+ L152:
+  _AOT_JUMP(152, L170);
+ L161:
+  _AOT_PUSH(161);
+ L170:
+  _AOT_RET(170);
+  _AOT_EXIT(171);
+}
+
+static const unsigned char sexp_aot_srfi_1_1_shape[] = {
+  84, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0, 0, 0,
+  0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 14, 143, 0, 0, 0, 0,
+  0, 0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 91, 116, 0, 0,
+  0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 55, 91,
+  79, 0, 0, 0, 0, 0, 0, 0, 24, 2, 0, 0, 0, 0, 0, 0,
+  0, 55, 24, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 83, 1, 0, 0, 0, 0, 0, 0, 0, 5, 9, 0,
+  0, 0, 0, 0, 0, 0, 14, 17, 0, 0, 0, 0, 0, 0, 0, 15,
+  14, 0, 0, 0, 0, 0, 0, 0, 14, 17, 0, 0, 0, 0, 0, 0,
+  0, 15, 14, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_2 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 19: goto L19;
+  case 28: goto L28;
+  case 37: goto L37;
+  case 38: goto L38;
+  case 47: goto L47;
+  case 56: goto L56;
+  case 65: goto L65;
+  case 66: goto L66;
+  case 75: goto L75;
+  case 84: goto L84;
+  case 93: goto L93;
+  case 94: goto L94;
+  case 103: goto L103;
+  case 112: goto L112;
+  case 121: goto L121;
+  case 122: goto L122;
+  case 147: goto L147;
+  case 156: goto L156;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 1);
+ L9:
+  _AOT_LOCAL_REF(9, 0);
+ L18:
+  _AOT_EQ(18);
+ L19:
+  _AOT_PUSH(19);
+ L28:
+  _AOT_PUSH(28);
+ L37:
+  _AOT_EXIT(37);
+  /* MAKE-VECTOR */
+ L38:
+  _AOT_LOCAL_REF(38, 0);
+ L47:
+  _AOT_PUSH(47);
+ L56:
+  _AOT_STACK_REF(56, 3);
+ L65:
+  _AOT_EXIT(65);
+  /* VECTOR-SET */
+ L66:
+  _AOT_CLOSURE_REF(66, 0);
+ L75:
+  _AOT_PUSH(75);
+ L84:
+  _AOT_STACK_REF(84, 3);
+ L93:
+  _AOT_EXIT(93);
+  /* VECTOR-SET */
+ L94:
+  _AOT_LOCAL_REF(94, 1);
+ L103:
+  _AOT_PUSH(103);
+ L112:
+  _AOT_STACK_REF(112, 3);
+ L121:
+  _AOT_EXIT(121);
+  /* VECTOR-SET */
+ L122:
+  _AOT_EXIT(122);
+  /* MAKE-PROCEDURE */
+ L147:
+  _AOT_TAIL_CALL(147, 1);
+ L156:
+  _AOT_RET(156);
+  _AOT_EXIT(157);
+}
+
+static const unsigned char sexp_aot_srfi_1_2_shape[] = {
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 68, 15, 14, 1, 0, 0, 0, 0, 0, 0, 15, 13, 0, 0,
+  0, 0, 0, 0, 0, 39, 22, 0, 0, 0, 0, 0, 0, 0, 0, 15,
+  1, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0,
+  0, 27, 24, 0, 0, 0, 0, 0, 0, 0, 0, 15, 5, 0, 0, 0,
+  0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 22, 1,
+  0, 0, 0, 0, 0, 0, 0, 15, 9, 0, 0, 0, 0, 0, 0, 0,
+  21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 38, 1, 0, 0, 0, 0,
+  0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_3 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 81: goto L81;
+  case 90: goto L90;
+  case 99: goto L99;
+  case 108: goto L108;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_PAIRP_JUMP_UNLESS(9, L99);
+ L18:
+  _AOT_LOCAL_REF_CDR(18, 0);
+ L27:
+  _AOT_PAIRP_JUMP_UNLESS(27, L81);
+ L36:
+  _AOT_LOCAL_REF(36, 0);
+ L45:
+  _AOT_LOCAL_REF_CDR(45, 0);
+ L54:
+  _AOT_PUSH(54);
+ L63:
+  _AOT_TAIL_CALL(63, 2);
+ L72:
+  _AOT_JUMP(72, L90);
+ L81:
+  _AOT_PUSH(81);
+ L90:
+  _AOT_JUMP(90, L108);
+ L99:
+  _AOT_PUSH(99);
+ L108:
+  _AOT_RET(108);
+  _AOT_EXIT(109);
+}
+
+static const unsigned char sexp_aot_srfi_1_3_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 91, 89, 0, 0, 0, 0, 0,
+  0, 0, 82, 0, 0, 0, 0, 0, 0, 0, 0, 91, 53, 0, 0, 0,
+  0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 82, 0, 0,
+  0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+  9, 0, 0, 0, 0, 0, 0, 0, 14, 17, 0, 0, 0, 0, 0, 0,
+  0, 15, 14, 0, 0, 0, 0, 0, 0, 0, 14, 17, 0, 0, 0, 0,
+  0, 0, 0, 15, 14, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_4 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 34: goto L34;
+  case 43: goto L43;
+  case 52: goto L52;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_GLOBAL_KNOWN_CALL(9, 1);
+ L34:
+  _AOT_GLOBAL_KNOWN_REF(34);
+ L43:
+  _AOT_TAIL_CALL(43, 1);
+ L52:
+  _AOT_RET(52);
+  _AOT_EXIT(53);
+}
+
+static const unsigned char sexp_aot_srfi_1_4_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0,
+  0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0,
+  0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_5 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_TYPEP(9, 6);
+ L18:
+  _AOT_GLOBAL_KNOWN_REF(18);
+ L27:
+  _AOT_TAIL_CALL(27, 1);
+ L36:
+  _AOT_RET(36);
+  _AOT_EXIT(37);
+}
+
+static const unsigned char sexp_aot_srfi_1_5_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 47, 6, 0, 0, 0, 0, 0,
+  0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0,
+  0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_6 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 10: goto L10;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_NULLP(9);
+ L10:
+  _AOT_RET(10);
+  _AOT_EXIT(11);
+}
+
+static const unsigned char sexp_aot_srfi_1_6_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 42, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_7 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 46: goto L46;
+  case 55: goto L55;
+  case 64: goto L64;
+  case 73: goto L73;
+  case 82: goto L82;
+  case 91: goto L91;
+  case 100: goto L100;
+  case 109: goto L109;
+  case 118: goto L118;
+  case 127: goto L127;
+  case 136: goto L136;
+  case 145: goto L145;
+  case 154: goto L154;
+  case 163: goto L163;
+  case 172: goto L172;
+  case 181: goto L181;
+  case 190: goto L190;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_NULLP_JUMP_UNLESS(9, L91);
+ L18:
+  _AOT_LOCAL_REF(18, 1);
+ L27:
+  _AOT_NULLP_JUMP_UNLESS(27, L73);
+ L36:
+  _AOT_CLOSURE_REF(36, 1);
+ L45:
+  _AOT_CDR(45);
+ L46:
+  _AOT_CLOSURE_REF_CDR(46, 0);
+ L55:
+  _AOT_TAIL_CALL(55, 1);
+ L64:
+  _AOT_JUMP(64, L82);
+ L73:
+  _AOT_PUSH(73);
+ L82:
+  _AOT_JUMP(82, L190);
+ L91:
+  _AOT_LOCAL_REF_CAR(91, 1);
+ L100:
+  _AOT_LOCAL_REF_CAR(100, 0);
+ L109:
+  _AOT_CLOSURE_REF(109, 2);
+ L118:
+  _AOT_CALL(118, 2);
+ L127:
+  _AOT_JUMP_UNLESS(127, L181);
+ L136:
+  _AOT_LOCAL_REF_CDR(136, 1);
+ L145:
+  _AOT_LOCAL_REF_CDR(145, 0);
+ L154:
+  _AOT_CLOSURE_REF_CDR(154, 3);
+ L163:
+  _AOT_TAIL_CALL(163, 2);
+ L172:
+  _AOT_JUMP(172, L190);
+ L181:
+  _AOT_PUSH(181);
+ L190:
+  _AOT_RET(190);
+  _AOT_EXIT(191);
+}
+
+static const unsigned char sexp_aot_srfi_1_7_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 90, 81, 0, 0, 0, 0, 0,
+  0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 90, 45, 0, 0, 0,
+  0, 0, 0, 0, 24, 1, 0, 0, 0, 0, 0, 0, 0, 55, 83, 0,
+  0, 0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0,
+  14, 17, 0, 0, 0, 0, 0, 0, 0, 15, 14, 0, 0, 0, 0, 0,
+  0, 0, 14, 107, 0, 0, 0, 0, 0, 0, 0, 81, 1, 0, 0, 0,
+  0, 0, 0, 0, 81, 0, 0, 0, 0, 0, 0, 0, 0, 24, 2, 0,
+  0, 0, 0, 0, 0, 0, 6, 9, 0, 0, 0, 0, 0, 0, 0, 13,
+  53, 0, 0, 0, 0, 0, 0, 0, 82, 1, 0, 0, 0, 0, 0, 0,
+  0, 82, 0, 0, 0, 0, 0, 0, 0, 0, 83, 3, 0, 0, 0, 0,
+  0, 0, 0, 5, 9, 0, 0, 0, 0, 0, 0, 0, 14, 17, 0, 0,
+  0, 0, 0, 0, 0, 15, 14, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_8 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 17: goto L17;
+  case 26: goto L26;
+  case 35: goto L35;
+  case 44: goto L44;
+  case 69: goto L69;
+  case 78: goto L78;
+  case 79: goto L79;
+  case 88: goto L88;
+  case 97: goto L97;
+  case 98: goto L98;
+  case 107: goto L107;
+  case 116: goto L116;
+  case 125: goto L125;
+  case 126: goto L126;
+  case 135: goto L135;
+  case 144: goto L144;
+  case 153: goto L153;
+  case 154: goto L154;
+  case 163: goto L163;
+  case 172: goto L172;
+  case 181: goto L181;
+  case 182: goto L182;
+  case 207: goto L207;
+  case 216: goto L216;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF_JUMP_UNLESS(0, 0, L35);
+ L17:
+  _AOT_LOCAL_REF(17, 0);
+ L26:
+  _AOT_JUMP(26, L216);
+ L35:
+  _AOT_CLOSURE_REF(35, 1);
+ L44:
+  _AOT_GLOBAL_KNOWN_CALL(44, 1);
+ L69:
+  _AOT_CLOSURE_REF(69, 1);
+ L78:
+  _AOT_CAR(78);
+ L79:
+  _AOT_PUSH(79);
+ L88:
+  _AOT_PUSH(88);
+ L97:
+  _AOT_EXIT(97);
+  /* MAKE-VECTOR */
+ L98:
+  _AOT_CLOSURE_REF(98, 0);
+ L107:
+  _AOT_PUSH(107);
+ L116:
+  _AOT_STACK_REF(116, 3);
+ L125:
+  _AOT_EXIT(125);
+  /* VECTOR-SET */
+ L126:
+  _AOT_CLOSURE_REF(126, 1);
+ L135:
+  _AOT_PUSH(135);
+ L144:
+  _AOT_STACK_REF(144, 3);
+ L153:
+  _AOT_EXIT(153);
+  /* VECTOR-SET */
+ L154:
+  _AOT_CLOSURE_REF(154, 2);
+ L163:
+  _AOT_PUSH(163);
+ L172:
+  _AOT_STACK_REF(172, 3);
+ L181:
+  _AOT_EXIT(181);
+  /* VECTOR-SET */
+ L182:
+  _AOT_EXIT(182);
+  /* MAKE-PROCEDURE */
+ L207:
+  _AOT_TAIL_CALL(207, 2);
+ L216:
+  _AOT_RET(216);
+  _AOT_EXIT(217);
+}
+
+static const unsigned char sexp_aot_srfi_1_8_shape[] = {
+  84, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0, 0, 0,
+  0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 14, 189, 0, 0, 0, 0,
+  0, 0, 0, 24, 1, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0,
+  0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 24, 1, 0, 0, 0, 0, 0, 0, 0, 54, 15,
+  14, 1, 0, 0, 0, 0, 0, 0, 15, 13, 0, 0, 0, 0, 0, 0,
+  0, 39, 24, 0, 0, 0, 0, 0, 0, 0, 0, 15, 1, 0, 0, 0,
+  0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 24, 1,
+  0, 0, 0, 0, 0, 0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0,
+  21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 24, 2, 0, 0, 0, 0,
+  0, 0, 0, 15, 9, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0,
+  0, 0, 0, 0, 0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 9,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+  9, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_9 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 17: goto L17;
+  case 26: goto L26;
+  case 35: goto L35;
+  case 44: goto L44;
+  case 45: goto L45;
+  case 46: goto L46;
+  case 55: goto L55;
+  case 64: goto L64;
+  case 65: goto L65;
+  case 74: goto L74;
+  case 83: goto L83;
+  case 92: goto L92;
+  case 93: goto L93;
+  case 102: goto L102;
+  case 111: goto L111;
+  case 120: goto L120;
+  case 121: goto L121;
+  case 130: goto L130;
+  case 139: goto L139;
+  case 148: goto L148;
+  case 149: goto L149;
+  case 174: goto L174;
+  case 183: goto L183;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF_JUMP_UNLESS(0, 0, L35);
+ L17:
+  _AOT_LOCAL_REF(17, 0);
+ L26:
+  _AOT_JUMP(26, L183);
+ L35:
+  _AOT_CLOSURE_REF(35, 1);
+ L44:
+  _AOT_CDR(44);
+ L45:
+  _AOT_NULLP(45);
+ L46:
+  _AOT_PUSH(46);
+ L55:
+  _AOT_PUSH(55);
+ L64:
+  _AOT_EXIT(64);
+  /* MAKE-VECTOR */
+ L65:
+  _AOT_CLOSURE_REF(65, 0);
+ L74:
+  _AOT_PUSH(74);
+ L83:
+  _AOT_STACK_REF(83, 3);
+ L92:
+  _AOT_EXIT(92);
+  /* VECTOR-SET */
+ L93:
+  _AOT_CLOSURE_REF(93, 1);
+ L102:
+  _AOT_PUSH(102);
+ L111:
+  _AOT_STACK_REF(111, 3);
+ L120:
+  _AOT_EXIT(120);
+  /* VECTOR-SET */
+ L121:
+  _AOT_CLOSURE_REF(121, 2);
+ L130:
+  _AOT_PUSH(130);
+ L139:
+  _AOT_STACK_REF(139, 3);
+ L148:
+  _AOT_EXIT(148);
+  /* VECTOR-SET */
+ L149:
+  _AOT_EXIT(149);
+  /* MAKE-PROCEDURE */
+ L174:
+  _AOT_TAIL_CALL(174, 1);
+ L183:
+  _AOT_RET(183);
+  _AOT_EXIT(184);
+}
+
+static const unsigned char sexp_aot_srfi_1_9_shape[] = {
+  84, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0, 0, 0,
+  0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 14, 156, 0, 0, 0, 0,
+  0, 0, 0, 24, 1, 0, 0, 0, 0, 0, 0, 0, 55, 42, 15, 14,
+  1, 0, 0, 0, 0, 0, 0, 15, 13, 0, 0, 0, 0, 0, 0, 0,
+  39, 24, 0, 0, 0, 0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0,
+  0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 24, 1, 0,
+  0, 0, 0, 0, 0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 21,
+  3, 0, 0, 0, 0, 0, 0, 0, 27, 24, 2, 0, 0, 0, 0, 0,
+  0, 0, 15, 9, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0,
+  0, 0, 0, 0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 5, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5,
+  0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_10 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 10: goto L10;
+  case 19: goto L19;
+  case 28: goto L28;
+  case 29: goto L29;
+  case 38: goto L38;
+  case 47: goto L47;
+  case 56: goto L56;
+  case 57: goto L57;
+  case 66: goto L66;
+  case 75: goto L75;
+  case 84: goto L84;
+  case 85: goto L85;
+  case 94: goto L94;
+  case 103: goto L103;
+  case 112: goto L112;
+  case 113: goto L113;
+  case 138: goto L138;
+  case 147: goto L147;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_NULLP(9);
+ L10:
+  _AOT_PUSH(10);
+ L19:
+  _AOT_PUSH(19);
+ L28:
+  _AOT_EXIT(28);
+  /* MAKE-VECTOR */
+ L29:
+  _AOT_CLOSURE_REF(29, 1);
+ L38:
+  _AOT_PUSH(38);
+ L47:
+  _AOT_STACK_REF(47, 3);
+ L56:
+  _AOT_EXIT(56);
+  /* VECTOR-SET */
+ L57:
+  _AOT_LOCAL_REF(57, 0);
+ L66:
+  _AOT_PUSH(66);
+ L75:
+  _AOT_STACK_REF(75, 3);
+ L84:
+  _AOT_EXIT(84);
+  /* VECTOR-SET */
+ L85:
+  _AOT_CLOSURE_REF(85, 0);
+ L94:
+  _AOT_PUSH(94);
+ L103:
+  _AOT_STACK_REF(103, 3);
+ L112:
+  _AOT_EXIT(112);
+  /* VECTOR-SET */
+ L113:
+  _AOT_EXIT(113);
+  /* MAKE-PROCEDURE */
+ L138:
+  _AOT_TAIL_CALL(138, 1);
+ L147:
+  _AOT_RET(147);
+  _AOT_EXIT(148);
+}
+
+static const unsigned char sexp_aot_srfi_1_10_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 42, 15, 14, 1, 0, 0, 0,
+  0, 0, 0, 15, 13, 0, 0, 0, 0, 0, 0, 0, 39, 24, 1, 0,
+  0, 0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0, 21,
+  3, 0, 0, 0, 0, 0, 0, 0, 27, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0,
+  0, 0, 0, 0, 27, 24, 0, 0, 0, 0, 0, 0, 0, 0, 15, 9,
+  0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0,
+  27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0,
+  0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_11 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 19: goto L19;
+  case 44: goto L44;
+  case 53: goto L53;
+  case 62: goto L62;
+  case 71: goto L71;
+  case 80: goto L80;
+  case 89: goto L89;
+  case 114: goto L114;
+  case 123: goto L123;
+  case 132: goto L132;
+  case 141: goto L141;
+  case 142: goto L142;
+  case 151: goto L151;
+  case 160: goto L160;
+  case 169: goto L169;
+  case 170: goto L170;
+  case 179: goto L179;
+  case 188: goto L188;
+  case 213: goto L213;
+  case 222: goto L222;
+  case 231: goto L231;
+  case 240: goto L240;
+  case 249: goto L249;
+  case 258: goto L258;
+  case 267: goto L267;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 1);
+ L9:
+  _AOT_LOCAL_REF(9, 0);
+ L18:
+  _AOT_EQ(18);
+ L19:
+  _AOT_GLOBAL_KNOWN_CALL(19, 1);
+ L44:
+  _AOT_JUMP_UNLESS(44, L258);
+ L53:
+  _AOT_LOCAL_REF(53, 0);
+ L62:
+  _AOT_PAIRP_JUMP_UNLESS(62, L240);
+ L71:
+  _AOT_LOCAL_REF_CDR(71, 0);
+ L80:
+  _AOT_TYPEP(80, 6);
+ L89:
+  _AOT_GLOBAL_KNOWN_CALL(89, 1);
+ L114:
+  _AOT_JUMP_UNLESS(114, L151);
+ L123:
+  _AOT_PUSH(123);
+ L132:
+  _AOT_LOCAL_REF(132, 2);
+ L141:
+  _AOT_ADD(141);
+ L142:
+  _AOT_JUMP(142, L231);
+ L151:
+  _AOT_PUSH(151);
+ L160:
+  _AOT_LOCAL_REF(160, 2);
+ L169:
+  _AOT_ADD(169);
+ L170:
+  _AOT_LOCAL_REF_CDR(170, 1);
+ L179:
+  _AOT_LOCAL_REF(179, 0);
+ L188:
+  _AOT_GLOBAL_KNOWN_CALL(188, 1);
+ L213:
+  _AOT_CLOSURE_REF_CDR(213, 0);
+ L222:
+  _AOT_TAIL_CALL(222, 3);
+ L231:
+  _AOT_JUMP(231, L249);
+ L240:
+  _AOT_LOCAL_REF(240, 2);
+ L249:
+  _AOT_JUMP(249, L267);
+ L258:
+  _AOT_PUSH(258);
+ L267:
+  _AOT_RET(267);
+  _AOT_EXIT(268);
+}
+
+static const unsigned char sexp_aot_srfi_1_11_shape[] = {
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 68, 85, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 213, 0, 0,
+  0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 91, 177,
+  0, 0, 0, 0, 0, 0, 0, 82, 0, 0, 0, 0, 0, 0, 0, 0,
+  47, 6, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0,
+  0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 13, 36, 0, 0, 0, 0, 0, 0, 0, 15, 5, 0, 0, 0,
+  0, 0, 0, 0, 22, 2, 0, 0, 0, 0, 0, 0, 0, 59, 14, 88,
+  0, 0, 0, 0, 0, 0, 0, 15, 9, 0, 0, 0, 0, 0, 0, 0,
+  22, 2, 0, 0, 0, 0, 0, 0, 0, 59, 82, 1, 0, 0, 0, 0,
+  0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0,
+  0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 83, 0, 0, 0, 0, 0, 0, 0, 0, 5, 13,
+  0, 0, 0, 0, 0, 0, 0, 14, 17, 0, 0, 0, 0, 0, 0, 0,
+  22, 2, 0, 0, 0, 0, 0, 0, 0, 14, 17, 0, 0, 0, 0, 0,
+  0, 0, 15, 14, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_12 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 43: goto L43;
+  case 52: goto L52;
+  case 61: goto L61;
+  case 70: goto L70;
+  case 79: goto L79;
+  case 88: goto L88;
+  case 97: goto L97;
+  case 106: goto L106;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_TYPEP(9, 6);
+ L18:
+  _AOT_GLOBAL_KNOWN_CALL(18, 1);
+ L43:
+  _AOT_JUMP_UNLESS(43, L70);
+ L52:
+  _AOT_PUSH(52);
+ L61:
+  _AOT_JUMP(61, L106);
+ L70:
+  _AOT_LOCAL_REF(70, 0);
+ L79:
+  _AOT_LOCAL_REF_CDR(79, 0);
+ L88:
+  _AOT_PUSH(88);
+ L97:
+  _AOT_TAIL_CALL(97, 2);
+ L106:
+  _AOT_RET(106);
+  _AOT_EXIT(107);
+}
+
+static const unsigned char sexp_aot_srfi_1_12_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 47, 6, 0, 0, 0, 0, 0,
+  0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 26, 0, 0, 0,
+  0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0, 14, 44, 0,
+  0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 82,
+  0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0,
+  0, 5, 9, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_13 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 10: goto L10;
+  case 11: goto L11;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF_CDR(0, 0);
+ L9:
+  _AOT_CDR(9);
+ L10:
+  _AOT_CAR(10);
+ L11:
+  _AOT_RET(11);
+  _AOT_EXIT(12);
+}
+
+static const unsigned char sexp_aot_srfi_1_13_shape[] = {
+  82, 0, 0, 0, 0, 0, 0, 0, 0, 55, 54, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_14 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 10: goto L10;
+  case 11: goto L11;
+  case 12: goto L12;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF_CDR(0, 0);
+ L9:
+  _AOT_CDR(9);
+ L10:
+  _AOT_CDR(10);
+ L11:
+  _AOT_CAR(11);
+ L12:
+  _AOT_RET(12);
+  _AOT_EXIT(13);
+}
+
+static const unsigned char sexp_aot_srfi_1_14_shape[] = {
+  82, 0, 0, 0, 0, 0, 0, 0, 0, 55, 55, 54, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_15 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 10: goto L10;
+  case 11: goto L11;
+  case 12: goto L12;
+  case 13: goto L13;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF_CDR(0, 0);
+ L9:
+  _AOT_CDR(9);
+ L10:
+  _AOT_CDR(10);
+ L11:
+  _AOT_CDR(11);
+ L12:
+  _AOT_CAR(12);
+ L13:
+  _AOT_RET(13);
+  _AOT_EXIT(14);
+}
+
+static const unsigned char sexp_aot_srfi_1_15_shape[] = {
+  82, 0, 0, 0, 0, 0, 0, 0, 0, 55, 55, 55, 54, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_16 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 10: goto L10;
+  case 11: goto L11;
+  case 12: goto L12;
+  case 13: goto L13;
+  case 14: goto L14;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF_CDR(0, 0);
+ L9:
+  _AOT_CDR(9);
+ L10:
+  _AOT_CDR(10);
+ L11:
+  _AOT_CDR(11);
+ L12:
+  _AOT_CDR(12);
+ L13:
+  _AOT_CAR(13);
+ L14:
+  _AOT_RET(14);
+  _AOT_EXIT(15);
+}
+
+static const unsigned char sexp_aot_srfi_1_16_shape[] = {
+  82, 0, 0, 0, 0, 0, 0, 0, 0, 55, 55, 55, 55, 54, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_17 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 10: goto L10;
+  case 11: goto L11;
+  case 12: goto L12;
+  case 13: goto L13;
+  case 14: goto L14;
+  case 15: goto L15;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF_CDR(0, 0);
+ L9:
+  _AOT_CDR(9);
+ L10:
+  _AOT_CDR(10);
+ L11:
+  _AOT_CDR(11);
+ L12:
+  _AOT_CDR(12);
+ L13:
+  _AOT_CDR(13);
+ L14:
+  _AOT_CAR(14);
+ L15:
+  _AOT_RET(15);
+  _AOT_EXIT(16);
+}
+
+static const unsigned char sexp_aot_srfi_1_17_shape[] = {
+  82, 0, 0, 0, 0, 0, 0, 0, 0, 55, 55, 55, 55, 55, 54, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_18 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 10: goto L10;
+  case 11: goto L11;
+  case 12: goto L12;
+  case 13: goto L13;
+  case 14: goto L14;
+  case 15: goto L15;
+  case 16: goto L16;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF_CDR(0, 0);
+ L9:
+  _AOT_CDR(9);
+ L10:
+  _AOT_CDR(10);
+ L11:
+  _AOT_CDR(11);
+ L12:
+  _AOT_CDR(12);
+ L13:
+  _AOT_CDR(13);
+ L14:
+  _AOT_CDR(14);
+ L15:
+  _AOT_CAR(15);
+ L16:
+  _AOT_RET(16);
+  _AOT_EXIT(17);
+}
+
+static const unsigned char sexp_aot_srfi_1_18_shape[] = {
+  82, 0, 0, 0, 0, 0, 0, 0, 0, 55, 55, 55, 55, 55, 55, 54,
+  79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_19 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 10: goto L10;
+  case 11: goto L11;
+  case 12: goto L12;
+  case 13: goto L13;
+  case 14: goto L14;
+  case 15: goto L15;
+  case 16: goto L16;
+  case 17: goto L17;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF_CDR(0, 0);
+ L9:
+  _AOT_CDR(9);
+ L10:
+  _AOT_CDR(10);
+ L11:
+  _AOT_CDR(11);
+ L12:
+  _AOT_CDR(12);
+ L13:
+  _AOT_CDR(13);
+ L14:
+  _AOT_CDR(14);
+ L15:
+  _AOT_CDR(15);
+ L16:
+  _AOT_CAR(16);
+ L17:
+  _AOT_RET(17);
+  _AOT_EXIT(18);
+}
+
+static const unsigned char sexp_aot_srfi_1_19_shape[] = {
+  82, 0, 0, 0, 0, 0, 0, 0, 0, 55, 55, 55, 55, 55, 55, 55,
+  54, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_20 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF_CDR(0, 0);
+ L9:
+  _AOT_LOCAL_REF_CAR(9, 0);
+ L18:
+  _AOT_GLOBAL_KNOWN_REF(18);
+ L27:
+  _AOT_TAIL_CALL(27, 2);
+ L36:
+  _AOT_RET(36);
+  _AOT_EXIT(37);
+}
+
+static const unsigned char sexp_aot_srfi_1_20_shape[] = {
+  82, 0, 0, 0, 0, 0, 0, 0, 0, 81, 0, 0, 0, 0, 0, 0,
+  0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 5, 9, 0, 0, 0,
+  0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_21 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 73: goto L73;
+  case 82: goto L82;
+  case 91: goto L91;
+  case 100: goto L100;
+  case 101: goto L101;
+  case 110: goto L110;
+  case 119: goto L119;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_PUSH(0);
+ L9:
+  _AOT_LOCAL_REF(9, 0);
+ L18:
+  _AOT_LE_JUMP_UNLESS(18, L54);
+ L27:
+  _AOT_LOCAL_REF(27, 2);
+ L36:
+  _AOT_EXIT(36);
+  /* FCALL1 */
+ L45:
+  _AOT_JUMP(45, L119);
+ L54:
+  _AOT_LOCAL_REF(54, 2);
+ L63:
+  _AOT_LOCAL_REF_CAR(63, 1);
+ L72:
+  _AOT_CONS(72);
+ L73:
+  _AOT_LOCAL_REF_CDR(73, 1);
+ L82:
+  _AOT_PUSH(82);
+ L91:
+  _AOT_LOCAL_REF(91, 0);
+ L100:
+  _AOT_SUB(100);
+ L101:
+  _AOT_CLOSURE_REF_CDR(101, 0);
+ L110:
+  _AOT_TAIL_CALL(110, 3);
+ L119:
+  _AOT_RET(119);
+  _AOT_EXIT(120);
+}
+
+static const unsigned char sexp_aot_srfi_1_21_shape[] = {
+  15, 1, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 87, 35, 0, 0, 0, 0, 0, 0, 0, 22, 2, 0, 0, 0,
+  0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 14, 73, 0,
+  0, 0, 0, 0, 0, 0, 22, 2, 0, 0, 0, 0, 0, 0, 0, 81,
+  1, 0, 0, 0, 0, 0, 0, 0, 58, 82, 1, 0, 0, 0, 0, 0,
+  0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0,
+  0, 0, 0, 0, 60, 83, 0, 0, 0, 0, 0, 0, 0, 0, 5, 13,
+  0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_22 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 19: goto L19;
+  case 28: goto L28;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_PUSH(0);
+ L9:
+  _AOT_LOCAL_REF(9, 0);
+ L18:
+  _AOT_EXIT(18);
+  /* SET-CDR */
+ L19:
+  _AOT_CLOSURE_REF(19, 0);
+ L28:
+  _AOT_RET(28);
+  _AOT_EXIT(29);
+}
+
+static const unsigned char sexp_aot_srfi_1_22_shape[] = {
+  15, 142, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 57, 24, 0, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_23 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 64: goto L64;
+  case 73: goto L73;
+  case 98: goto L98;
+  case 107: goto L107;
+  case 116: goto L116;
+  case 117: goto L117;
+  case 126: goto L126;
+  case 135: goto L135;
+  case 144: goto L144;
+  case 145: goto L145;
+  case 170: goto L170;
+  case 179: goto L179;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_PUSH(0);
+ L9:
+  _AOT_LOCAL_REF(9, 1);
+ L18:
+  _AOT_LE_JUMP_UNLESS(18, L45);
+ L27:
+  _AOT_PUSH(27);
+ L36:
+  _AOT_JUMP(36, L179);
+ L45:
+  _AOT_PUSH(45);
+ L54:
+  _AOT_LOCAL_REF(54, 1);
+ L63:
+  _AOT_SUB(63);
+ L64:
+  _AOT_LOCAL_REF(64, 0);
+ L73:
+  _AOT_GLOBAL_KNOWN_CALL(73, 2);
+ L98:
+  _AOT_PUSH(98);
+ L107:
+  _AOT_PUSH(107);
+ L116:
+  _AOT_EXIT(116);
+  /* MAKE-VECTOR */
+ L117:
+  _AOT_LOCAL_REF(117, 0);
+ L126:
+  _AOT_PUSH(126);
+ L135:
+  _AOT_STACK_REF(135, 3);
+ L144:
+  _AOT_EXIT(144);
+  /* VECTOR-SET */
+ L145:
+  _AOT_EXIT(145);
+  /* MAKE-PROCEDURE */
+ L170:
+  _AOT_TAIL_CALL(170, 1);
+ L179:
+  _AOT_RET(179);
+  _AOT_EXIT(180);
+}
+
+static const unsigned char sexp_aot_srfi_1_23_shape[] = {
+  15, 1, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0, 0, 0,
+  0, 0, 87, 26, 0, 0, 0, 0, 0, 0, 0, 15, 142, 0, 0, 0,
+  0, 0, 0, 0, 14, 142, 0, 0, 0, 0, 0, 0, 0, 15, 5, 0,
+  0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 60,
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0,
+  0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 15, 14, 1, 0, 0, 0, 0, 0, 0, 15, 5, 0, 0, 0,
+  0, 0, 0, 0, 39, 22, 0, 0, 0, 0, 0, 0, 0, 0, 15, 1,
+  0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0,
+  27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0,
+  0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_24 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 64: goto L64;
+  case 73: goto L73;
+  case 82: goto L82;
+  case 91: goto L91;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_PUSH(0);
+ L9:
+  _AOT_LOCAL_REF(9, 1);
+ L18:
+  _AOT_LE_JUMP_UNLESS(18, L45);
+ L27:
+  _AOT_LOCAL_REF(27, 0);
+ L36:
+  _AOT_JUMP(36, L91);
+ L45:
+  _AOT_PUSH(45);
+ L54:
+  _AOT_LOCAL_REF(54, 1);
+ L63:
+  _AOT_SUB(63);
+ L64:
+  _AOT_LOCAL_REF_CDR(64, 0);
+ L73:
+  _AOT_GLOBAL_KNOWN_REF(73);
+ L82:
+  _AOT_TAIL_CALL(82, 2);
+ L91:
+  _AOT_RET(91);
+  _AOT_EXIT(92);
+}
+
+static const unsigned char sexp_aot_srfi_1_24_shape[] = {
+  15, 1, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0, 0, 0,
+  0, 0, 87, 26, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0,
+  0, 0, 0, 0, 14, 54, 0, 0, 0, 0, 0, 0, 0, 15, 5, 0,
+  0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 60,
+  82, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0,
+  0, 0, 5, 9, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_25 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 43: goto L43;
+  case 44: goto L44;
+  case 53: goto L53;
+  case 62: goto L62;
+  case 71: goto L71;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 1);
+ L9:
+  _AOT_LOCAL_REF(9, 0);
+ L18:
+  _AOT_GLOBAL_KNOWN_CALL(18, 1);
+ L43:
+  _AOT_SUB(43);
+ L44:
+  _AOT_LOCAL_REF(44, 0);
+ L53:
+  _AOT_GLOBAL_KNOWN_REF(53);
+ L62:
+  _AOT_TAIL_CALL(62, 2);
+ L71:
+  _AOT_RET(71);
+  _AOT_EXIT(72);
+}
+
+static const unsigned char sexp_aot_srfi_1_25_shape[] = {
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 22, 0, 0, 0,
+  0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 5, 9,
+  0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_26 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 81: goto L81;
+  case 90: goto L90;
+  case 99: goto L99;
+  case 100: goto L100;
+  case 109: goto L109;
+  case 118: goto L118;
+  case 127: goto L127;
+  case 128: goto L128;
+  case 137: goto L137;
+  case 146: goto L146;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_PUSH(0);
+ L9:
+  _AOT_LOCAL_REF(9, 0);
+ L18:
+  _AOT_LE_JUMP_UNLESS(18, L81);
+ L27:
+  _AOT_LOCAL_REF(27, 1);
+ L36:
+  _AOT_LOCAL_REF(36, 2);
+ L45:
+  _AOT_EXIT(45);
+  /* FCALL1 */
+ L54:
+  _AOT_GLOBAL_KNOWN_REF(54);
+ L63:
+  _AOT_TAIL_CALL(63, 2);
+ L72:
+  _AOT_JUMP(72, L146);
+ L81:
+  _AOT_LOCAL_REF(81, 2);
+ L90:
+  _AOT_LOCAL_REF_CAR(90, 1);
+ L99:
+  _AOT_CONS(99);
+ L100:
+  _AOT_LOCAL_REF_CDR(100, 1);
+ L109:
+  _AOT_PUSH(109);
+ L118:
+  _AOT_LOCAL_REF(118, 0);
+ L127:
+  _AOT_SUB(127);
+ L128:
+  _AOT_CLOSURE_REF_CDR(128, 0);
+ L137:
+  _AOT_TAIL_CALL(137, 3);
+ L146:
+  _AOT_RET(146);
+  _AOT_EXIT(147);
+}
+
+static const unsigned char sexp_aot_srfi_1_26_shape[] = {
+  15, 1, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 87, 62, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0,
+  0, 0, 0, 0, 22, 2, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0,
+  0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+  9, 0, 0, 0, 0, 0, 0, 0, 14, 73, 0, 0, 0, 0, 0, 0,
+  0, 22, 2, 0, 0, 0, 0, 0, 0, 0, 81, 1, 0, 0, 0, 0,
+  0, 0, 0, 58, 82, 1, 0, 0, 0, 0, 0, 0, 0, 15, 5, 0,
+  0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 60,
+  83, 0, 0, 0, 0, 0, 0, 0, 0, 5, 13, 0, 0, 0, 0, 0,
+  0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_27 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 19: goto L19;
+  case 28: goto L28;
+  case 37: goto L37;
+  case 46: goto L46;
+  case 55: goto L55;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_PUSH(0);
+ L9:
+  _AOT_CLOSURE_REF(9, 0);
+ L18:
+  _AOT_EXIT(18);
+  /* SET-CDR */
+ L19:
+  _AOT_CLOSURE_REF(19, 2);
+ L28:
+  _AOT_CLOSURE_REF(28, 1);
+ L37:
+  _AOT_GLOBAL_KNOWN_REF(37);
+ L46:
+  _AOT_TAIL_CALL(46, 2);
+ L55:
+  _AOT_RET(55);
+  _AOT_EXIT(56);
+}
+
+static const unsigned char sexp_aot_srfi_1_27_shape[] = {
+  15, 142, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0,
+  0, 0, 57, 24, 2, 0, 0, 0, 0, 0, 0, 0, 24, 1, 0, 0,
+  0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 5, 9,
+  0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_28 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 28: goto L28;
+  case 37: goto L37;
+  case 46: goto L46;
+  case 55: goto L55;
+  case 56: goto L56;
+  case 65: goto L65;
+  case 74: goto L74;
+  case 83: goto L83;
+  case 84: goto L84;
+  case 109: goto L109;
+  case 118: goto L118;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF_CDR(0, 0);
+ L9:
+  _AOT_PUSH(9);
+ L18:
+  _AOT_PUSH(18);
+ L27:
+  _AOT_EXIT(27);
+  /* MAKE-VECTOR */
+ L28:
+  _AOT_CLOSURE_REF(28, 0);
+ L37:
+  _AOT_PUSH(37);
+ L46:
+  _AOT_STACK_REF(46, 3);
+ L55:
+  _AOT_EXIT(55);
+  /* VECTOR-SET */
+ L56:
+  _AOT_LOCAL_REF(56, 0);
+ L65:
+  _AOT_PUSH(65);
+ L74:
+  _AOT_STACK_REF(74, 3);
+ L83:
+  _AOT_EXIT(83);
+  /* VECTOR-SET */
+ L84:
+  _AOT_EXIT(84);
+  /* MAKE-PROCEDURE */
+ L109:
+  _AOT_TAIL_CALL(109, 1);
+ L118:
+  _AOT_RET(118);
+  _AOT_EXIT(119);
+}
+
+static const unsigned char sexp_aot_srfi_1_28_shape[] = {
+  82, 0, 0, 0, 0, 0, 0, 0, 0, 15, 14, 1, 0, 0, 0, 0,
+  0, 0, 15, 9, 0, 0, 0, 0, 0, 0, 0, 39, 24, 0, 0, 0,
+  0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0, 21, 3,
+  0, 0, 0, 0, 0, 0, 0, 27, 22, 0, 0, 0, 0, 0, 0, 0,
+  0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0,
+  0, 0, 0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 0,
+  0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_29 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 81: goto L81;
+  case 90: goto L90;
+  case 91: goto L91;
+  case 100: goto L100;
+  case 125: goto L125;
+  case 134: goto L134;
+  case 143: goto L143;
+  case 144: goto L144;
+  case 153: goto L153;
+  case 162: goto L162;
+  case 171: goto L171;
+  case 172: goto L172;
+  case 197: goto L197;
+  case 206: goto L206;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_PUSH(0);
+ L9:
+  _AOT_LOCAL_REF(9, 1);
+ L18:
+  _AOT_LE_JUMP_UNLESS(18, L72);
+ L27:
+  _AOT_LOCAL_REF(27, 0);
+ L36:
+  _AOT_PUSH(36);
+ L45:
+  _AOT_GLOBAL_KNOWN_REF(45);
+ L54:
+  _AOT_TAIL_CALL(54, 2);
+ L63:
+  _AOT_JUMP(63, L206);
+ L72:
+  _AOT_PUSH(72);
+ L81:
+  _AOT_LOCAL_REF(81, 1);
+ L90:
+  _AOT_SUB(90);
+ L91:
+  _AOT_LOCAL_REF(91, 0);
+ L100:
+  _AOT_GLOBAL_KNOWN_CALL(100, 2);
+ L125:
+  _AOT_PUSH(125);
+ L134:
+  _AOT_PUSH(134);
+ L143:
+  _AOT_EXIT(143);
+  /* MAKE-VECTOR */
+ L144:
+  _AOT_LOCAL_REF(144, 0);
+ L153:
+  _AOT_PUSH(153);
+ L162:
+  _AOT_STACK_REF(162, 3);
+ L171:
+  _AOT_EXIT(171);
+  /* VECTOR-SET */
+ L172:
+  _AOT_EXIT(172);
+  /* MAKE-PROCEDURE */
+ L197:
+  _AOT_TAIL_CALL(197, 1);
+ L206:
+  _AOT_RET(206);
+  _AOT_EXIT(207);
+}
+
+static const unsigned char sexp_aot_srfi_1_29_shape[] = {
+  15, 1, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0, 0, 0,
+  0, 0, 87, 53, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0,
+  0, 0, 0, 0, 15, 142, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0,
+  0, 0, 0, 0, 0, 0, 5, 9, 0, 0, 0, 0, 0, 0, 0, 14,
+  142, 0, 0, 0, 0, 0, 0, 0, 15, 5, 0, 0, 0, 0, 0, 0,
+  0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 60, 22, 0, 0, 0, 0,
+  0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 14, 1,
+  0, 0, 0, 0, 0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 39,
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0,
+  0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 38, 1, 0, 0,
+  0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_30 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF_CDR(0, 0);
+ L9:
+  _AOT_NULLP_JUMP_UNLESS(9, L36);
+ L18:
+  _AOT_LOCAL_REF_CAR(18, 0);
+ L27:
+  _AOT_JUMP(27, L63);
+ L36:
+  _AOT_LOCAL_REF_CDR(36, 0);
+ L45:
+  _AOT_GLOBAL_KNOWN_REF(45);
+ L54:
+  _AOT_TAIL_CALL(54, 1);
+ L63:
+  _AOT_RET(63);
+  _AOT_EXIT(64);
+}
+
+static const unsigned char sexp_aot_srfi_1_30_shape[] = {
+  82, 0, 0, 0, 0, 0, 0, 0, 0, 90, 26, 0, 0, 0, 0, 0,
+  0, 0, 81, 0, 0, 0, 0, 0, 0, 0, 0, 14, 35, 0, 0, 0,
+  0, 0, 0, 0, 82, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0,
+  0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_31 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF_CDR(0, 0);
+ L9:
+  _AOT_NULLP_JUMP_UNLESS(9, L36);
+ L18:
+  _AOT_LOCAL_REF(18, 0);
+ L27:
+  _AOT_JUMP(27, L63);
+ L36:
+  _AOT_LOCAL_REF_CDR(36, 0);
+ L45:
+  _AOT_GLOBAL_KNOWN_REF(45);
+ L54:
+  _AOT_TAIL_CALL(54, 1);
+ L63:
+  _AOT_RET(63);
+  _AOT_EXIT(64);
+}
+
+static const unsigned char sexp_aot_srfi_1_31_shape[] = {
+  82, 0, 0, 0, 0, 0, 0, 0, 0, 90, 26, 0, 0, 0, 0, 0,
+  0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 14, 35, 0, 0, 0,
+  0, 0, 0, 0, 82, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0,
+  0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_32 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 81: goto L81;
+  case 90: goto L90;
+  case 91: goto L91;
+  case 100: goto L100;
+  case 109: goto L109;
+  case 118: goto L118;
+  case 127: goto L127;
+  case 136: goto L136;
+  case 145: goto L145;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_PAIRP_JUMP_UNLESS(9, L54);
+ L18:
+  _AOT_LOCAL_REF_CAR(18, 0);
+ L27:
+  _AOT_CLOSURE_REF(27, 0);
+ L36:
+  _AOT_CALL(36, 1);
+ L45:
+  _AOT_JUMP(45, L63);
+ L54:
+  _AOT_PUSH(54);
+ L63:
+  _AOT_JUMP_UNLESS(63, L127);
+ L72:
+  _AOT_LOCAL_REF(72, 1);
+ L81:
+  _AOT_LOCAL_REF_CAR(81, 0);
+ L90:
+  _AOT_CONS(90);
+ L91:
+  _AOT_LOCAL_REF_CDR(91, 0);
+ L100:
+  _AOT_CLOSURE_REF_CDR(100, 1);
+ L109:
+  _AOT_TAIL_CALL(109, 2);
+ L118:
+  _AOT_JUMP(118, L145);
+ L127:
+  _AOT_LOCAL_REF(127, 1);
+ L136:
+  _AOT_EXIT(136);
+  /* FCALL1 */
+ L145:
+  _AOT_RET(145);
+  _AOT_EXIT(146);
+}
+
+static const unsigned char sexp_aot_srfi_1_32_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 91, 44, 0, 0, 0, 0, 0,
+  0, 0, 81, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0,
+  0, 0, 0, 0, 6, 5, 0, 0, 0, 0, 0, 0, 0, 14, 17, 0,
+  0, 0, 0, 0, 0, 0, 15, 14, 0, 0, 0, 0, 0, 0, 0, 13,
+  63, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0, 0, 0, 0,
+  0, 81, 0, 0, 0, 0, 0, 0, 0, 0, 58, 82, 0, 0, 0, 0,
+  0, 0, 0, 0, 83, 1, 0, 0, 0, 0, 0, 0, 0, 5, 9, 0,
+  0, 0, 0, 0, 0, 0, 14, 26, 0, 0, 0, 0, 0, 0, 0, 22,
+  1, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0,
+  0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_33 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_CLOSURE_REF(9, 0);
+ L18:
+  _AOT_CALL(18, 1);
+ L27:
+  _AOT_GLOBAL_KNOWN_REF(27);
+ L36:
+  _AOT_TAIL_CALL(36, 1);
+ L45:
+  _AOT_RET(45);
+  _AOT_EXIT(46);
+}
+
+static const unsigned char sexp_aot_srfi_1_33_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0,
+  0, 0, 6, 5, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_34 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 28: goto L28;
+  case 37: goto L37;
+  case 46: goto L46;
+  case 55: goto L55;
+  case 56: goto L56;
+  case 81: goto L81;
+  case 106: goto L106;
+  case 115: goto L115;
+  case 124: goto L124;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 1);
+ L9:
+  _AOT_PUSH(9);
+ L18:
+  _AOT_PUSH(18);
+ L27:
+  _AOT_EXIT(27);
+  /* MAKE-VECTOR */
+ L28:
+  _AOT_LOCAL_REF(28, 0);
+ L37:
+  _AOT_PUSH(37);
+ L46:
+  _AOT_STACK_REF(46, 3);
+ L55:
+  _AOT_EXIT(55);
+  /* VECTOR-SET */
+ L56:
+  _AOT_EXIT(56);
+  /* MAKE-PROCEDURE */
+ L81:
+  _AOT_GLOBAL_KNOWN_CALL(81, 2);
+ L106:
+  _AOT_PUSH(106);
+ L115:
+  _AOT_TAIL_CALL(115, 1);
+ L124:
+  _AOT_RET(124);
+  _AOT_EXIT(125);
+}
+
+static const unsigned char sexp_aot_srfi_1_34_shape[] = {
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 15, 14, 1, 0, 0, 0, 0,
+  0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 39, 22, 0, 0, 0,
+  0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0, 21, 3,
+  0, 0, 0, 0, 0, 0, 0, 27, 38, 1, 0, 0, 0, 0, 0, 0,
+  0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0,
+  0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_35 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 81: goto L81;
+  case 90: goto L90;
+  case 91: goto L91;
+  case 100: goto L100;
+  case 109: goto L109;
+  case 118: goto L118;
+  case 127: goto L127;
+  case 136: goto L136;
+  case 145: goto L145;
+  case 154: goto L154;
+  case 163: goto L163;
+  case 172: goto L172;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_PAIRP_JUMP_UNLESS(9, L54);
+ L18:
+  _AOT_LOCAL_REF_CAR(18, 0);
+ L27:
+  _AOT_CLOSURE_REF(27, 0);
+ L36:
+  _AOT_CALL(36, 1);
+ L45:
+  _AOT_JUMP(45, L63);
+ L54:
+  _AOT_PUSH(54);
+ L63:
+  _AOT_JUMP_UNLESS(63, L127);
+ L72:
+  _AOT_LOCAL_REF(72, 1);
+ L81:
+  _AOT_LOCAL_REF_CAR(81, 0);
+ L90:
+  _AOT_CONS(90);
+ L91:
+  _AOT_LOCAL_REF_CDR(91, 0);
+ L100:
+  _AOT_CLOSURE_REF_CDR(100, 1);
+ L109:
+  _AOT_TAIL_CALL(109, 2);
+ L118:
+  _AOT_JUMP(118, L172);
+ L127:
+  _AOT_LOCAL_REF(127, 0);
+ L136:
+  _AOT_LOCAL_REF(136, 1);
+ L145:
+  _AOT_EXIT(145);
+  /* FCALL1 */
+ L154:
+  _AOT_GLOBAL_KNOWN_REF(154);
+ L163:
+  _AOT_TAIL_CALL(163, 2);
+ L172:
+  _AOT_RET(172);
+  _AOT_EXIT(173);
+}
+
+static const unsigned char sexp_aot_srfi_1_35_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 91, 44, 0, 0, 0, 0, 0,
+  0, 0, 81, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0,
+  0, 0, 0, 0, 6, 5, 0, 0, 0, 0, 0, 0, 0, 14, 17, 0,
+  0, 0, 0, 0, 0, 0, 15, 14, 0, 0, 0, 0, 0, 0, 0, 13,
+  63, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0, 0, 0, 0,
+  0, 81, 0, 0, 0, 0, 0, 0, 0, 0, 58, 82, 0, 0, 0, 0,
+  0, 0, 0, 0, 83, 1, 0, 0, 0, 0, 0, 0, 0, 5, 9, 0,
+  0, 0, 0, 0, 0, 0, 14, 53, 0, 0, 0, 0, 0, 0, 0, 22,
+  0, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0, 0, 0, 0,
+  0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0,
+  0, 0, 0, 5, 9, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_36 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 28: goto L28;
+  case 37: goto L37;
+  case 46: goto L46;
+  case 55: goto L55;
+  case 56: goto L56;
+  case 81: goto L81;
+  case 90: goto L90;
+  case 99: goto L99;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 1);
+ L9:
+  _AOT_PUSH(9);
+ L18:
+  _AOT_PUSH(18);
+ L27:
+  _AOT_EXIT(27);
+  /* MAKE-VECTOR */
+ L28:
+  _AOT_LOCAL_REF(28, 0);
+ L37:
+  _AOT_PUSH(37);
+ L46:
+  _AOT_STACK_REF(46, 3);
+ L55:
+  _AOT_EXIT(55);
+  /* VECTOR-SET */
+ L56:
+  _AOT_EXIT(56);
+  /* MAKE-PROCEDURE */
+ L81:
+  _AOT_GLOBAL_KNOWN_REF(81);
+ L90:
+  _AOT_TAIL_CALL(90, 2);
+ L99:
+  _AOT_RET(99);
+  _AOT_EXIT(100);
+}
+
+static const unsigned char sexp_aot_srfi_1_36_shape[] = {
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 15, 14, 1, 0, 0, 0, 0,
+  0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 39, 22, 0, 0, 0,
+  0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0, 21, 3,
+  0, 0, 0, 0, 0, 0, 0, 27, 38, 1, 0, 0, 0, 0, 0, 0,
+  0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 5, 9, 0, 0, 0, 0,
+  0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_37 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 43: goto L43;
+  case 52: goto L52;
+  case 61: goto L61;
+  case 70: goto L70;
+  case 95: goto L95;
+  case 104: goto L104;
+  case 129: goto L129;
+  case 138: goto L138;
+  case 147: goto L147;
+  case 156: goto L156;
+  case 165: goto L165;
+  case 174: goto L174;
+  case 175: goto L175;
+  case 184: goto L184;
+  case 193: goto L193;
+  case 218: goto L218;
+  case 227: goto L227;
+  case 236: goto L236;
+  case 245: goto L245;
+  case 254: goto L254;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_GLOBAL_KNOWN_REF(9);
+ L18:
+  _AOT_GLOBAL_KNOWN_CALL(18, 2);
+ L43:
+  _AOT_JUMP_UNLESS(43, L245);
+ L52:
+  _AOT_LOCAL_REF(52, 0);
+ L61:
+  _AOT_GLOBAL_KNOWN_REF(61);
+ L70:
+  _AOT_GLOBAL_KNOWN_CALL(70, 2);
+ L95:
+  _AOT_CLOSURE_REF(95, 0);
+ L104:
+  _AOT_GLOBAL_KNOWN_CALL(104, 2);
+ L129:
+  _AOT_JUMP_UNLESS(129, L156);
+ L138:
+  _AOT_LOCAL_REF(138, 1);
+ L147:
+  _AOT_JUMP(147, L236);
+ L156:
+  _AOT_PUSH(156);
+ L165:
+  _AOT_LOCAL_REF(165, 1);
+ L174:
+  _AOT_ADD(174);
+ L175:
+  _AOT_LOCAL_REF(175, 0);
+ L184:
+  _AOT_GLOBAL_KNOWN_REF(184);
+ L193:
+  _AOT_GLOBAL_KNOWN_CALL(193, 2);
+ L218:
+  _AOT_CLOSURE_REF_CDR(218, 1);
+ L227:
+  _AOT_TAIL_CALL(227, 2);
+ L236:
+  _AOT_JUMP(236, L254);
+ L245:
+  _AOT_PUSH(245);
+ L254:
+  _AOT_RET(254);
+  _AOT_EXIT(255);
+}
+
+static const unsigned char sexp_aot_srfi_1_37_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0,
+  0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 201, 0, 0, 0,
+  0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0,
+  0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24,
+  0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0,
+  0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 13, 26, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0, 0,
+  0, 0, 0, 14, 88, 0, 0, 0, 0, 0, 0, 0, 15, 5, 0, 0,
+  0, 0, 0, 0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 59, 22,
+  0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0,
+  0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 83, 1, 0, 0, 0, 0,
+  0, 0, 0, 5, 9, 0, 0, 0, 0, 0, 0, 0, 14, 17, 0, 0,
+  0, 0, 0, 0, 0, 15, 14, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_38 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 81: goto L81;
+  case 90: goto L90;
+  case 91: goto L91;
+  case 100: goto L100;
+  case 109: goto L109;
+  case 118: goto L118;
+  case 127: goto L127;
+  case 136: goto L136;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_PAIRP_JUMP_UNLESS(9, L127);
+ L18:
+  _AOT_LOCAL_REF_CAR(18, 0);
+ L27:
+  _AOT_CLOSURE_REF(27, 0);
+ L36:
+  _AOT_CALL(36, 1);
+ L45:
+  _AOT_JUMP_UNLESS(45, L72);
+ L54:
+  _AOT_LOCAL_REF(54, 1);
+ L63:
+  _AOT_JUMP(63, L118);
+ L72:
+  _AOT_PUSH(72);
+ L81:
+  _AOT_LOCAL_REF(81, 1);
+ L90:
+  _AOT_ADD(90);
+ L91:
+  _AOT_LOCAL_REF_CDR(91, 0);
+ L100:
+  _AOT_CLOSURE_REF_CDR(100, 1);
+ L109:
+  _AOT_TAIL_CALL(109, 2);
+ L118:
+  _AOT_JUMP(118, L136);
+ L127:
+  _AOT_PUSH(127);
+ L136:
+  _AOT_RET(136);
+  _AOT_EXIT(137);
+}
+
+static const unsigned char sexp_aot_srfi_1_38_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 91, 117, 0, 0, 0, 0, 0,
+  0, 0, 81, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0,
+  0, 0, 0, 0, 6, 5, 0, 0, 0, 0, 0, 0, 0, 13, 26, 0,
+  0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 14,
+  54, 0, 0, 0, 0, 0, 0, 0, 15, 5, 0, 0, 0, 0, 0, 0,
+  0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 59, 82, 0, 0, 0, 0,
+  0, 0, 0, 0, 83, 1, 0, 0, 0, 0, 0, 0, 0, 5, 9, 0,
+  0, 0, 0, 0, 0, 0, 14, 17, 0, 0, 0, 0, 0, 0, 0, 15,
+  14, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_39 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 46: goto L46;
+  case 55: goto L55;
+  case 64: goto L64;
+  case 73: goto L73;
+  case 74: goto L74;
+  case 99: goto L99;
+  case 108: goto L108;
+  case 117: goto L117;
+  case 126: goto L126;
+  case 135: goto L135;
+  case 136: goto L136;
+  case 145: goto L145;
+  case 154: goto L154;
+  case 155: goto L155;
+  case 164: goto L164;
+  case 173: goto L173;
+  case 182: goto L182;
+  case 183: goto L183;
+  case 208: goto L208;
+  case 217: goto L217;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 2);
+ L9:
+  _AOT_NULLP_JUMP_UNLESS(9, L117);
+ L18:
+  _AOT_LOCAL_REF(18, 1);
+ L27:
+  _AOT_PUSH(27);
+ L36:
+  _AOT_PUSH(36);
+ L45:
+  _AOT_EXIT(45);
+  /* MAKE-VECTOR */
+ L46:
+  _AOT_LOCAL_REF(46, 0);
+ L55:
+  _AOT_PUSH(55);
+ L64:
+  _AOT_STACK_REF(64, 3);
+ L73:
+  _AOT_EXIT(73);
+  /* VECTOR-SET */
+ L74:
+  _AOT_EXIT(74);
+  /* MAKE-PROCEDURE */
+ L99:
+  _AOT_TAIL_CALL(99, 1);
+ L108:
+  _AOT_JUMP(108, L217);
+ L117:
+  _AOT_LOCAL_REF(117, 2);
+ L126:
+  _AOT_LOCAL_REF(126, 1);
+ L135:
+  _AOT_CONS(135);
+ L136:
+  _AOT_PUSH(136);
+ L145:
+  _AOT_PUSH(145);
+ L154:
+  _AOT_EXIT(154);
+  /* MAKE-VECTOR */
+ L155:
+  _AOT_LOCAL_REF(155, 0);
+ L164:
+  _AOT_PUSH(164);
+ L173:
+  _AOT_STACK_REF(173, 3);
+ L182:
+  _AOT_EXIT(182);
+  /* VECTOR-SET */
+ L183:
+  _AOT_EXIT(183);
+  /* MAKE-PROCEDURE */
+ L208:
+  _AOT_TAIL_CALL(208, 1);
+ L217:
+  _AOT_RET(217);
+  _AOT_EXIT(218);
+}
+
+static const unsigned char sexp_aot_srfi_1_39_shape[] = {
+  22, 2, 0, 0, 0, 0, 0, 0, 0, 90, 107, 0, 0, 0, 0, 0,
+  0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 15, 14, 1, 0, 0,
+  0, 0, 0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 39, 22, 0,
+  0, 0, 0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0,
+  21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 38, 1, 0, 0, 0, 0,
+  0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 14, 108, 0, 0,
+  0, 0, 0, 0, 0, 22, 2, 0, 0, 0, 0, 0, 0, 0, 22, 1,
+  0, 0, 0, 0, 0, 0, 0, 58, 15, 14, 1, 0, 0, 0, 0, 0,
+  0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 39, 22, 0, 0, 0, 0,
+  0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0,
+  0, 0, 0, 0, 0, 0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0,
+  5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  5, 5, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_40 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 73: goto L73;
+  case 82: goto L82;
+  case 91: goto L91;
+  case 100: goto L100;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_NULLP_JUMP_UNLESS(9, L36);
+ L18:
+  _AOT_LOCAL_REF(18, 1);
+ L27:
+  _AOT_JUMP(27, L100);
+ L36:
+  _AOT_LOCAL_REF(36, 1);
+ L45:
+  _AOT_LOCAL_REF_CAR(45, 0);
+ L54:
+  _AOT_CLOSURE_REF(54, 1);
+ L63:
+  _AOT_CALL(63, 1);
+ L72:
+  _AOT_CONS(72);
+ L73:
+  _AOT_LOCAL_REF_CDR(73, 0);
+ L82:
+  _AOT_CLOSURE_REF_CDR(82, 0);
+ L91:
+  _AOT_TAIL_CALL(91, 2);
+ L100:
+  _AOT_RET(100);
+  _AOT_EXIT(101);
+}
+
+static const unsigned char sexp_aot_srfi_1_40_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 90, 26, 0, 0, 0, 0, 0,
+  0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 14, 72, 0, 0, 0,
+  0, 0, 0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 81, 0, 0,
+  0, 0, 0, 0, 0, 0, 24, 1, 0, 0, 0, 0, 0, 0, 0, 6,
+  5, 0, 0, 0, 0, 0, 0, 0, 58, 82, 0, 0, 0, 0, 0, 0,
+  0, 0, 83, 0, 0, 0, 0, 0, 0, 0, 0, 5, 9, 0, 0, 0,
+  0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_41 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 46: goto L46;
+  case 55: goto L55;
+  case 64: goto L64;
+  case 73: goto L73;
+  case 74: goto L74;
+  case 99: goto L99;
+  case 108: goto L108;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 2);
+ L9:
+  _AOT_LOCAL_REF(9, 1);
+ L18:
+  _AOT_EXIT(18);
+  /* FCALL1 */
+ L27:
+  _AOT_PUSH(27);
+ L36:
+  _AOT_PUSH(36);
+ L45:
+  _AOT_EXIT(45);
+  /* MAKE-VECTOR */
+ L46:
+  _AOT_LOCAL_REF(46, 0);
+ L55:
+  _AOT_PUSH(55);
+ L64:
+  _AOT_STACK_REF(64, 3);
+ L73:
+  _AOT_EXIT(73);
+  /* VECTOR-SET */
+ L74:
+  _AOT_EXIT(74);
+  /* MAKE-PROCEDURE */
+ L99:
+  _AOT_TAIL_CALL(99, 2);
+ L108:
+  _AOT_RET(108);
+  _AOT_EXIT(109);
+}
+
+static const unsigned char sexp_aot_srfi_1_41_shape[] = {
+  22, 2, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0, 0, 0,
+  0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 15, 14, 1, 0, 0,
+  0, 0, 0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 39, 22, 0,
+  0, 0, 0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0,
+  21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 38, 1, 0, 0, 0, 0,
+  0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 5, 9, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_42 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_GLOBAL_REF(9);
+ L18:
+  _AOT_TAIL_CALL(18, 1);
+ L27:
+  _AOT_RET(27);
+  _AOT_EXIT(28);
+}
+
+static const unsigned char sexp_aot_srfi_1_42_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0,
+  0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_43 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 43: goto L43;
+  case 52: goto L52;
+  case 61: goto L61;
+  case 62: goto L62;
+  case 71: goto L71;
+  case 80: goto L80;
+  case 105: goto L105;
+  case 114: goto L114;
+  case 139: goto L139;
+  case 140: goto L140;
+  case 149: goto L149;
+  case 158: goto L158;
+  case 167: goto L167;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF_CDR(0, 0);
+ L9:
+  _AOT_TYPEP(9, 6);
+ L18:
+  _AOT_GLOBAL_KNOWN_CALL(18, 1);
+ L43:
+  _AOT_JUMP_UNLESS(43, L71);
+ L52:
+  _AOT_CLOSURE_REF(52, 0);
+ L61:
+  _AOT_CAR(61);
+ L62:
+  _AOT_JUMP(62, L167);
+ L71:
+  _AOT_LOCAL_REF(71, 0);
+ L80:
+  _AOT_GLOBAL_KNOWN_CALL(80, 1);
+ L105:
+  _AOT_LOCAL_REF_CAR(105, 0);
+ L114:
+  _AOT_GLOBAL_KNOWN_CALL(114, 1);
+ L139:
+  _AOT_EXIT(139);
+  /* SET-CDR */
+ L140:
+  _AOT_LOCAL_REF_CDR(140, 0);
+ L149:
+  _AOT_CLOSURE_REF_CDR(149, 1);
+ L158:
+  _AOT_TAIL_CALL(158, 1);
+ L167:
+  _AOT_RET(167);
+  _AOT_EXIT(168);
+}
+
+static const unsigned char sexp_aot_srfi_1_43_shape[] = {
+  82, 0, 0, 0, 0, 0, 0, 0, 0, 47, 6, 0, 0, 0, 0, 0,
+  0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 27, 0, 0, 0,
+  0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 54, 14, 104,
+  0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0,
+  85, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 81, 0, 0, 0, 0, 0, 0,
+  0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 57, 82, 0, 0, 0,
+  0, 0, 0, 0, 0, 83, 1, 0, 0, 0, 0, 0, 0, 0, 5, 5,
+  0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_44 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 64: goto L64;
+  case 73: goto L73;
+  case 82: goto L82;
+  case 91: goto L91;
+  case 92: goto L92;
+  case 117: goto L117;
+  case 126: goto L126;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_NULLP_JUMP_UNLESS(9, L36);
+ L18:
+  _AOT_PUSH(18);
+ L27:
+  _AOT_JUMP(27, L126);
+ L36:
+  _AOT_LOCAL_REF(36, 0);
+ L45:
+  _AOT_PUSH(45);
+ L54:
+  _AOT_PUSH(54);
+ L63:
+  _AOT_EXIT(63);
+  /* MAKE-VECTOR */
+ L64:
+  _AOT_LOCAL_REF(64, 0);
+ L73:
+  _AOT_PUSH(73);
+ L82:
+  _AOT_STACK_REF(82, 3);
+ L91:
+  _AOT_EXIT(91);
+  /* VECTOR-SET */
+ L92:
+  _AOT_EXIT(92);
+  /* MAKE-PROCEDURE */
+ L117:
+  _AOT_TAIL_CALL(117, 1);
+ L126:
+  _AOT_RET(126);
+  _AOT_EXIT(127);
+}
+
+static const unsigned char sexp_aot_srfi_1_44_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 90, 26, 0, 0, 0, 0, 0,
+  0, 0, 15, 142, 0, 0, 0, 0, 0, 0, 0, 14, 98, 0, 0, 0,
+  0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 15, 14, 1,
+  0, 0, 0, 0, 0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 39,
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0,
+  0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 38, 1, 0, 0,
+  0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_45 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 79: goto L79;
+  case 88: goto L88;
+  case 97: goto L97;
+  case 106: goto L106;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_NULLP_JUMP_UNLESS(9, L36);
+ L18:
+  _AOT_LOCAL_REF(18, 1);
+ L27:
+  _AOT_JUMP(27, L106);
+ L36:
+  _AOT_LOCAL_REF(36, 1);
+ L45:
+  _AOT_LOCAL_REF_CAR(45, 0);
+ L54:
+  _AOT_GLOBAL_KNOWN_CALL(54, 2);
+ L79:
+  _AOT_LOCAL_REF_CDR(79, 0);
+ L88:
+  _AOT_CLOSURE_REF_CDR(88, 0);
+ L97:
+  _AOT_TAIL_CALL(97, 2);
+ L106:
+  _AOT_RET(106);
+  _AOT_EXIT(107);
+}
+
+static const unsigned char sexp_aot_srfi_1_45_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 90, 26, 0, 0, 0, 0, 0,
+  0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 14, 78, 0, 0, 0,
+  0, 0, 0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 81, 0, 0,
+  0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 82,
+  0, 0, 0, 0, 0, 0, 0, 0, 83, 0, 0, 0, 0, 0, 0, 0,
+  0, 5, 9, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_46 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_EXIT(9);
+  /* FCALL1 */
+ L18:
+  _AOT_PUSH(18);
+ L27:
+  _AOT_TAIL_CALL(27, 1);
+ L36:
+  _AOT_RET(36);
+  _AOT_EXIT(37);
+}
+
+static const unsigned char sexp_aot_srfi_1_46_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0,
+  0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0,
+  0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_47 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 55: goto L55;
+  case 64: goto L64;
+  case 73: goto L73;
+  case 82: goto L82;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_NULLP_JUMP_UNLESS(9, L36);
+ L18:
+  _AOT_LOCAL_REF(18, 1);
+ L27:
+  _AOT_JUMP(27, L82);
+ L36:
+  _AOT_LOCAL_REF(36, 1);
+ L45:
+  _AOT_LOCAL_REF_CAR(45, 0);
+ L54:
+  _AOT_CONS(54);
+ L55:
+  _AOT_LOCAL_REF_CDR(55, 0);
+ L64:
+  _AOT_GLOBAL_KNOWN_REF(64);
+ L73:
+  _AOT_TAIL_CALL(73, 2);
+ L82:
+  _AOT_RET(82);
+  _AOT_EXIT(83);
+}
+
+static const unsigned char sexp_aot_srfi_1_47_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 90, 26, 0, 0, 0, 0, 0,
+  0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 14, 54, 0, 0, 0,
+  0, 0, 0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 81, 0, 0,
+  0, 0, 0, 0, 0, 0, 58, 82, 0, 0, 0, 0, 0, 0, 0, 0,
+  19, 0, 0, 0, 0, 0, 0, 0, 0, 5, 9, 0, 0, 0, 0, 0,
+  0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_48 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 19: goto L19;
+  case 28: goto L28;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_CLOSURE_REF(0, 1);
+ L9:
+  _AOT_CLOSURE_REF(9, 0);
+ L18:
+  _AOT_EXIT(18);
+  /* SET-CDR */
+ L19:
+  _AOT_LOCAL_REF(19, 0);
+ L28:
+  _AOT_RET(28);
+  _AOT_EXIT(29);
+}
+
+static const unsigned char sexp_aot_srfi_1_48_shape[] = {
+  24, 1, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0,
+  0, 0, 57, 22, 0, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_49 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 73: goto L73;
+  case 82: goto L82;
+  case 91: goto L91;
+  case 100: goto L100;
+  case 101: goto L101;
+  case 110: goto L110;
+  case 119: goto L119;
+  case 128: goto L128;
+  case 129: goto L129;
+  case 154: goto L154;
+  case 163: goto L163;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_NULLP_JUMP_UNLESS(9, L36);
+ L18:
+  _AOT_LOCAL_REF(18, 1);
+ L27:
+  _AOT_JUMP(27, L163);
+ L36:
+  _AOT_LOCAL_REF(36, 0);
+ L45:
+  _AOT_EXIT(45);
+  /* FCALL1 */
+ L54:
+  _AOT_PUSH(54);
+ L63:
+  _AOT_PUSH(63);
+ L72:
+  _AOT_EXIT(72);
+  /* MAKE-VECTOR */
+ L73:
+  _AOT_LOCAL_REF(73, 0);
+ L82:
+  _AOT_PUSH(82);
+ L91:
+  _AOT_STACK_REF(91, 3);
+ L100:
+  _AOT_EXIT(100);
+  /* VECTOR-SET */
+ L101:
+  _AOT_LOCAL_REF(101, 1);
+ L110:
+  _AOT_PUSH(110);
+ L119:
+  _AOT_STACK_REF(119, 3);
+ L128:
+  _AOT_EXIT(128);
+  /* VECTOR-SET */
+ L129:
+  _AOT_EXIT(129);
+  /* MAKE-PROCEDURE */
+ L154:
+  _AOT_TAIL_CALL(154, 1);
+ L163:
+  _AOT_RET(163);
+  _AOT_EXIT(164);
+}
+
+static const unsigned char sexp_aot_srfi_1_49_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 90, 26, 0, 0, 0, 0, 0,
+  0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 14, 135, 0, 0, 0,
+  0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0,
+  0, 0, 0, 0, 0, 0, 15, 14, 1, 0, 0, 0, 0, 0, 0, 15,
+  9, 0, 0, 0, 0, 0, 0, 0, 39, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0,
+  0, 0, 0, 0, 27, 22, 1, 0, 0, 0, 0, 0, 0, 0, 15, 5,
+  0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0,
+  27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0,
+  0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_50 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_GLOBAL_KNOWN_REF(9);
+ L18:
+  _AOT_GLOBAL_KNOWN_REF(18);
+ L27:
+  _AOT_GLOBAL_KNOWN_REF(27);
+ L36:
+  _AOT_TAIL_CALL(36, 3);
+ L45:
+  _AOT_RET(45);
+  _AOT_EXIT(46);
+}
+
+static const unsigned char sexp_aot_srfi_1_50_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0,
+  0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 13, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_51 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_GLOBAL_KNOWN_REF(9);
+ L18:
+  _AOT_GLOBAL_KNOWN_REF(18);
+ L27:
+  _AOT_TAIL_CALL(27, 2);
+ L36:
+  _AOT_RET(36);
+  _AOT_EXIT(37);
+}
+
+static const unsigned char sexp_aot_srfi_1_51_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0,
+  0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 5, 9, 0, 0, 0,
+  0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_52 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 43: goto L43;
+  case 52: goto L52;
+  case 61: goto L61;
+  case 86: goto L86;
+  case 95: goto L95;
+  case 104: goto L104;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_GLOBAL_KNOWN_REF(9);
+ L18:
+  _AOT_GLOBAL_KNOWN_CALL(18, 2);
+ L43:
+  _AOT_LOCAL_REF(43, 0);
+ L52:
+  _AOT_GLOBAL_KNOWN_REF(52);
+ L61:
+  _AOT_GLOBAL_KNOWN_CALL(61, 2);
+ L86:
+  _AOT_GLOBAL_KNOWN_REF(86);
+ L95:
+  _AOT_TAIL_CALL(95, 2);
+ L104:
+  _AOT_RET(104);
+  _AOT_EXIT(105);
+}
+
+static const unsigned char sexp_aot_srfi_1_52_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0,
+  0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0,
+  0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0,
+  0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+  9, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_53 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 43: goto L43;
+  case 52: goto L52;
+  case 61: goto L61;
+  case 86: goto L86;
+  case 95: goto L95;
+  case 104: goto L104;
+  case 129: goto L129;
+  case 138: goto L138;
+  case 147: goto L147;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_GLOBAL_KNOWN_REF(9);
+ L18:
+  _AOT_GLOBAL_KNOWN_CALL(18, 2);
+ L43:
+  _AOT_LOCAL_REF(43, 0);
+ L52:
+  _AOT_GLOBAL_KNOWN_REF(52);
+ L61:
+  _AOT_GLOBAL_KNOWN_CALL(61, 2);
+ L86:
+  _AOT_LOCAL_REF(86, 0);
+ L95:
+  _AOT_GLOBAL_KNOWN_REF(95);
+ L104:
+  _AOT_GLOBAL_KNOWN_CALL(104, 2);
+ L129:
+  _AOT_GLOBAL_KNOWN_REF(129);
+ L138:
+  _AOT_TAIL_CALL(138, 3);
+ L147:
+  _AOT_RET(147);
+  _AOT_EXIT(148);
+}
+
+static const unsigned char sexp_aot_srfi_1_53_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0,
+  0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0,
+  0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0,
+  0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 19,
+  0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0,
+  0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 5, 13, 0, 0, 0, 0,
+  0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_54 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 43: goto L43;
+  case 52: goto L52;
+  case 61: goto L61;
+  case 86: goto L86;
+  case 95: goto L95;
+  case 104: goto L104;
+  case 129: goto L129;
+  case 138: goto L138;
+  case 147: goto L147;
+  case 172: goto L172;
+  case 181: goto L181;
+  case 190: goto L190;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_GLOBAL_KNOWN_REF(9);
+ L18:
+  _AOT_GLOBAL_KNOWN_CALL(18, 2);
+ L43:
+  _AOT_LOCAL_REF(43, 0);
+ L52:
+  _AOT_GLOBAL_KNOWN_REF(52);
+ L61:
+  _AOT_GLOBAL_KNOWN_CALL(61, 2);
+ L86:
+  _AOT_LOCAL_REF(86, 0);
+ L95:
+  _AOT_GLOBAL_KNOWN_REF(95);
+ L104:
+  _AOT_GLOBAL_KNOWN_CALL(104, 2);
+ L129:
+  _AOT_LOCAL_REF(129, 0);
+ L138:
+  _AOT_GLOBAL_KNOWN_REF(138);
+ L147:
+  _AOT_GLOBAL_KNOWN_CALL(147, 2);
+ L172:
+  _AOT_GLOBAL_KNOWN_REF(172);
+ L181:
+  _AOT_TAIL_CALL(181, 4);
+ L190:
+  _AOT_RET(190);
+  _AOT_EXIT(191);
+}
+
+static const unsigned char sexp_aot_srfi_1_54_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0,
+  0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0,
+  0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0,
+  0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 19,
+  0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0,
+  0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0,
+  0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0,
+  0, 0, 0, 0, 0, 5, 17, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_55 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 43: goto L43;
+  case 52: goto L52;
+  case 61: goto L61;
+  case 86: goto L86;
+  case 95: goto L95;
+  case 104: goto L104;
+  case 129: goto L129;
+  case 138: goto L138;
+  case 147: goto L147;
+  case 172: goto L172;
+  case 181: goto L181;
+  case 190: goto L190;
+  case 215: goto L215;
+  case 224: goto L224;
+  case 233: goto L233;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_GLOBAL_KNOWN_REF(9);
+ L18:
+  _AOT_GLOBAL_KNOWN_CALL(18, 2);
+ L43:
+  _AOT_LOCAL_REF(43, 0);
+ L52:
+  _AOT_GLOBAL_KNOWN_REF(52);
+ L61:
+  _AOT_GLOBAL_KNOWN_CALL(61, 2);
+ L86:
+  _AOT_LOCAL_REF(86, 0);
+ L95:
+  _AOT_GLOBAL_KNOWN_REF(95);
+ L104:
+  _AOT_GLOBAL_KNOWN_CALL(104, 2);
+ L129:
+  _AOT_LOCAL_REF(129, 0);
+ L138:
+  _AOT_GLOBAL_KNOWN_REF(138);
+ L147:
+  _AOT_GLOBAL_KNOWN_CALL(147, 2);
+ L172:
+  _AOT_LOCAL_REF(172, 0);
+ L181:
+  _AOT_GLOBAL_KNOWN_REF(181);
+ L190:
+  _AOT_GLOBAL_KNOWN_CALL(190, 2);
+ L215:
+  _AOT_GLOBAL_KNOWN_REF(215);
+ L224:
+  _AOT_TAIL_CALL(224, 5);
+ L233:
+  _AOT_RET(233);
+  _AOT_EXIT(234);
+}
+
+static const unsigned char sexp_aot_srfi_1_55_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0,
+  0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0,
+  0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0,
+  0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 19,
+  0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0,
+  0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0,
+  0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0,
+  0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0,
+  0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0,
+  5, 21, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_56 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 43: goto L43;
+  case 52: goto L52;
+  case 61: goto L61;
+  case 70: goto L70;
+  case 95: goto L95;
+  case 104: goto L104;
+  case 129: goto L129;
+  case 138: goto L138;
+  case 147: goto L147;
+  case 156: goto L156;
+  case 157: goto L157;
+  case 166: goto L166;
+  case 175: goto L175;
+  case 184: goto L184;
+  case 193: goto L193;
+  case 218: goto L218;
+  case 227: goto L227;
+  case 236: goto L236;
+  case 245: goto L245;
+  case 254: goto L254;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_GLOBAL_KNOWN_REF(9);
+ L18:
+  _AOT_GLOBAL_KNOWN_CALL(18, 2);
+ L43:
+  _AOT_JUMP_UNLESS(43, L245);
+ L52:
+  _AOT_LOCAL_REF(52, 0);
+ L61:
+  _AOT_GLOBAL_KNOWN_REF(61);
+ L70:
+  _AOT_GLOBAL_KNOWN_CALL(70, 2);
+ L95:
+  _AOT_CLOSURE_REF(95, 1);
+ L104:
+  _AOT_GLOBAL_KNOWN_CALL(104, 2);
+ L129:
+  _AOT_JUMP_UNLESS(129, L166);
+ L138:
+  _AOT_PUSH(138);
+ L147:
+  _AOT_LOCAL_REF(147, 1);
+ L156:
+  _AOT_ADD(156);
+ L157:
+  _AOT_JUMP(157, L175);
+ L166:
+  _AOT_LOCAL_REF(166, 1);
+ L175:
+  _AOT_LOCAL_REF(175, 0);
+ L184:
+  _AOT_GLOBAL_KNOWN_REF(184);
+ L193:
+  _AOT_GLOBAL_KNOWN_CALL(193, 2);
+ L218:
+  _AOT_CLOSURE_REF_CDR(218, 0);
+ L227:
+  _AOT_TAIL_CALL(227, 2);
+ L236:
+  _AOT_JUMP(236, L254);
+ L245:
+  _AOT_LOCAL_REF(245, 1);
+ L254:
+  _AOT_RET(254);
+  _AOT_EXIT(255);
+}
+
+static const unsigned char sexp_aot_srfi_1_56_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0,
+  0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 201, 0, 0, 0,
+  0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0,
+  0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24,
+  1, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0,
+  0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 13, 36, 0, 0, 0, 0, 0, 0, 0, 15, 5, 0, 0, 0, 0,
+  0, 0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 59, 14, 17, 0,
+  0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 22,
+  0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0,
+  0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 83, 0, 0, 0, 0, 0,
+  0, 0, 0, 5, 9, 0, 0, 0, 0, 0, 0, 0, 14, 17, 0, 0,
+  0, 0, 0, 0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_57 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 73: goto L73;
+  case 82: goto L82;
+  case 91: goto L91;
+  case 100: goto L100;
+  case 109: goto L109;
+  case 118: goto L118;
+  case 127: goto L127;
+  case 136: goto L136;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_PAIRP_JUMP_UNLESS(9, L127);
+ L18:
+  _AOT_LOCAL_REF_CAR(18, 0);
+ L27:
+  _AOT_CLOSURE_REF(27, 1);
+ L36:
+  _AOT_CALL(36, 1);
+ L45:
+  _AOT_JUMP_UNLESS(45, L82);
+ L54:
+  _AOT_PUSH(54);
+ L63:
+  _AOT_LOCAL_REF(63, 1);
+ L72:
+  _AOT_ADD(72);
+ L73:
+  _AOT_JUMP(73, L91);
+ L82:
+  _AOT_LOCAL_REF(82, 1);
+ L91:
+  _AOT_LOCAL_REF_CDR(91, 0);
+ L100:
+  _AOT_CLOSURE_REF_CDR(100, 0);
+ L109:
+  _AOT_TAIL_CALL(109, 2);
+ L118:
+  _AOT_JUMP(118, L136);
+ L127:
+  _AOT_LOCAL_REF(127, 1);
+ L136:
+  _AOT_RET(136);
+  _AOT_EXIT(137);
+}
+
+static const unsigned char sexp_aot_srfi_1_57_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 91, 117, 0, 0, 0, 0, 0,
+  0, 0, 81, 0, 0, 0, 0, 0, 0, 0, 0, 24, 1, 0, 0, 0,
+  0, 0, 0, 0, 6, 5, 0, 0, 0, 0, 0, 0, 0, 13, 36, 0,
+  0, 0, 0, 0, 0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 22,
+  1, 0, 0, 0, 0, 0, 0, 0, 59, 14, 17, 0, 0, 0, 0, 0,
+  0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 82, 0, 0, 0, 0,
+  0, 0, 0, 0, 83, 0, 0, 0, 0, 0, 0, 0, 0, 5, 9, 0,
+  0, 0, 0, 0, 0, 0, 14, 17, 0, 0, 0, 0, 0, 0, 0, 22,
+  1, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_58 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 19: goto L19;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_LOCAL_REF(9, 1);
+ L18:
+  _AOT_CONS(18);
+ L19:
+  _AOT_RET(19);
+  _AOT_EXIT(20);
+}
+
+static const unsigned char sexp_aot_srfi_1_58_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0, 0, 0,
+  0, 0, 58, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_59 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 81: goto L81;
+  case 90: goto L90;
+  case 99: goto L99;
+  case 100: goto L100;
+  case 109: goto L109;
+  case 118: goto L118;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 2);
+ L9:
+  _AOT_NULLP_JUMP_UNLESS(9, L63);
+ L18:
+  _AOT_LOCAL_REF(18, 1);
+ L27:
+  _AOT_LOCAL_REF(27, 0);
+ L36:
+  _AOT_GLOBAL_KNOWN_REF(36);
+ L45:
+  _AOT_TAIL_CALL(45, 2);
+ L54:
+  _AOT_JUMP(54, L118);
+ L63:
+  _AOT_LOCAL_REF_CDR(63, 2);
+ L72:
+  _AOT_LOCAL_REF_CAR(72, 2);
+ L81:
+  _AOT_LOCAL_REF(81, 0);
+ L90:
+  _AOT_LOCAL_REF(90, 1);
+ L99:
+  _AOT_CONS(99);
+ L100:
+  _AOT_CLOSURE_REF_CDR(100, 0);
+ L109:
+  _AOT_TAIL_CALL(109, 3);
+ L118:
+  _AOT_RET(118);
+  _AOT_EXIT(119);
+}
+
+static const unsigned char sexp_aot_srfi_1_59_shape[] = {
+  22, 2, 0, 0, 0, 0, 0, 0, 0, 90, 53, 0, 0, 0, 0, 0,
+  0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0,
+  0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 5, 9, 0,
+  0, 0, 0, 0, 0, 0, 14, 63, 0, 0, 0, 0, 0, 0, 0, 82,
+  2, 0, 0, 0, 0, 0, 0, 0, 81, 2, 0, 0, 0, 0, 0, 0,
+  0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0, 0,
+  0, 0, 0, 58, 83, 0, 0, 0, 0, 0, 0, 0, 0, 5, 13, 0,
+  0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_60 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 81: goto L81;
+  case 82: goto L82;
+  case 91: goto L91;
+  case 100: goto L100;
+  case 101: goto L101;
+  case 110: goto L110;
+  case 119: goto L119;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_PUSH(0);
+ L9:
+  _AOT_LOCAL_REF(9, 0);
+ L18:
+  _AOT_LT_JUMP_UNLESS(18, L45);
+ L27:
+  _AOT_LOCAL_REF(27, 1);
+ L36:
+  _AOT_JUMP(36, L119);
+ L45:
+  _AOT_LOCAL_REF(45, 1);
+ L54:
+  _AOT_LOCAL_REF(54, 0);
+ L63:
+  _AOT_CLOSURE_REF(63, 1);
+ L72:
+  _AOT_CALL(72, 1);
+ L81:
+  _AOT_CONS(81);
+ L82:
+  _AOT_PUSH(82);
+ L91:
+  _AOT_LOCAL_REF(91, 0);
+ L100:
+  _AOT_SUB(100);
+ L101:
+  _AOT_CLOSURE_REF_CDR(101, 0);
+ L110:
+  _AOT_TAIL_CALL(110, 2);
+ L119:
+  _AOT_RET(119);
+  _AOT_EXIT(120);
+}
+
+static const unsigned char sexp_aot_srfi_1_60_shape[] = {
+  15, 1, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 86, 26, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0,
+  0, 0, 0, 0, 14, 82, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0,
+  0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 24,
+  1, 0, 0, 0, 0, 0, 0, 0, 6, 5, 0, 0, 0, 0, 0, 0,
+  0, 58, 15, 5, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0,
+  0, 0, 0, 0, 60, 83, 0, 0, 0, 0, 0, 0, 0, 0, 5, 9,
+  0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_61 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 19: goto L19;
+  case 28: goto L28;
+  case 37: goto L37;
+  case 38: goto L38;
+  case 47: goto L47;
+  case 56: goto L56;
+  case 65: goto L65;
+  case 66: goto L66;
+  case 91: goto L91;
+  case 100: goto L100;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_PUSH(0);
+ L9:
+  _AOT_LOCAL_REF(9, 0);
+ L18:
+  _AOT_SUB(18);
+ L19:
+  _AOT_PUSH(19);
+ L28:
+  _AOT_PUSH(28);
+ L37:
+  _AOT_EXIT(37);
+  /* MAKE-VECTOR */
+ L38:
+  _AOT_LOCAL_REF(38, 1);
+ L47:
+  _AOT_PUSH(47);
+ L56:
+  _AOT_STACK_REF(56, 3);
+ L65:
+  _AOT_EXIT(65);
+  /* VECTOR-SET */
+ L66:
+  _AOT_EXIT(66);
+  /* MAKE-PROCEDURE */
+ L91:
+  _AOT_TAIL_CALL(91, 1);
+ L100:
+  _AOT_RET(100);
+  _AOT_EXIT(101);
+}
+
+static const unsigned char sexp_aot_srfi_1_61_shape[] = {
+  15, 5, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 60, 15, 14, 1, 0, 0, 0, 0, 0, 0, 15, 5, 0, 0,
+  0, 0, 0, 0, 0, 39, 22, 1, 0, 0, 0, 0, 0, 0, 0, 15,
+  1, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0,
+  0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0,
+  0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_62 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 43: goto L43;
+  case 44: goto L44;
+  case 53: goto L53;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_LOCAL_REF(9, 0);
+ L18:
+  _AOT_GLOBAL_KNOWN_CALL(18, 1);
+ L43:
+  _AOT_EXIT(43);
+  /* SET-CDR */
+ L44:
+  _AOT_LOCAL_REF(44, 0);
+ L53:
+  _AOT_RET(53);
+  _AOT_EXIT(54);
+}
+
+static const unsigned char sexp_aot_srfi_1_62_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 57, 22, 0, 0, 0,
+  0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_63 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 19: goto L19;
+  case 28: goto L28;
+  case 37: goto L37;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 1);
+ L9:
+  _AOT_LOCAL_REF(9, 0);
+ L18:
+  _AOT_CONS(18);
+ L19:
+  _AOT_PUSH(19);
+ L28:
+  _AOT_TAIL_CALL(28, 1);
+ L37:
+  _AOT_RET(37);
+  _AOT_EXIT(38);
+}
+
+static const unsigned char sexp_aot_srfi_1_63_shape[] = {
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 58, 15, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 0, 0,
+  0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_64 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 81: goto L81;
+  case 90: goto L90;
+  case 107: goto L107;
+  case 108: goto L108;
+  case 117: goto L117;
+  case 126: goto L126;
+  case 127: goto L127;
+  case 136: goto L136;
+  case 145: goto L145;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_PUSH(0);
+ L9:
+  _AOT_LOCAL_REF(9, 0);
+ L18:
+  _AOT_LE_JUMP_UNLESS(18, L45);
+ L27:
+  _AOT_LOCAL_REF(27, 1);
+ L36:
+  _AOT_JUMP(36, L145);
+ L45:
+  _AOT_LOCAL_REF(45, 1);
+ L54:
+  _AOT_CLOSURE_REF(54, 2);
+ L63:
+  _AOT_PUSH(63);
+ L72:
+  _AOT_LOCAL_REF(72, 0);
+ L81:
+  _AOT_CLOSURE_REF(81, 1);
+ L90:
+  _AOT_EXIT(90);
+  /* FLONUM-ARITH */
+ L107:
+  _AOT_CONS(107);
+ L108:
+  _AOT_PUSH(108);
+ L117:
+  _AOT_LOCAL_REF(117, 0);
+ L126:
+  _AOT_SUB(126);
+ L127:
+  _AOT_CLOSURE_REF_CDR(127, 0);
+ L136:
+  _AOT_TAIL_CALL(136, 2);
+ L145:
+  _AOT_RET(145);
+  _AOT_EXIT(146);
+}
+
+static const unsigned char sexp_aot_srfi_1_64_shape[] = {
+  15, 1, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 87, 26, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0,
+  0, 0, 0, 0, 14, 108, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0,
+  0, 0, 0, 0, 0, 0, 24, 2, 0, 0, 0, 0, 0, 0, 0, 15,
+  5, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0,
+  0, 24, 1, 0, 0, 0, 0, 0, 0, 0, 92, 4, 0, 0, 0, 0,
+  0, 0, 0, 73, 198, 8, 0, 0, 0, 0, 0, 58, 15, 5, 0, 0,
+  0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 60, 83,
+  0, 0, 0, 0, 0, 0, 0, 0, 5, 9, 0, 0, 0, 0, 0, 0,
+  0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_65 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 97: goto L97;
+  case 106: goto L106;
+  case 115: goto L115;
+  case 124: goto L124;
+  case 133: goto L133;
+  case 142: goto L142;
+  case 151: goto L151;
+  case 160: goto L160;
+  case 169: goto L169;
+  case 178: goto L178;
+  case 179: goto L179;
+  case 188: goto L188;
+  case 197: goto L197;
+  case 206: goto L206;
+  case 207: goto L207;
+  case 232: goto L232;
+  case 241: goto L241;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 1);
+ L9:
+  _AOT_PAIRP_JUMP_UNLESS(9, L45);
+ L18:
+  _AOT_LOCAL_REF_CDR(18, 1);
+ L27:
+  _AOT_TYPEP(27, 6);
+ L36:
+  _AOT_JUMP(36, L54);
+ L45:
+  _AOT_PUSH(45);
+ L54:
+  _AOT_JUMP_UNLESS(54, L106);
+ L63:
+  _AOT_LOCAL_REF(63, 1);
+ L72:
+  _AOT_GLOBAL_KNOWN_CALL(72, 1);
+ L97:
+  _AOT_JUMP(97, L115);
+ L106:
+  _AOT_PUSH(106);
+ L115:
+  _AOT_LOCAL_REF(115, 1);
+ L124:
+  _AOT_PAIRP_JUMP_UNLESS(124, L151);
+ L133:
+  _AOT_LOCAL_REF_CAR(133, 1);
+ L142:
+  _AOT_JUMP(142, L160);
+ L151:
+  _AOT_PUSH(151);
+ L160:
+  _AOT_PUSH(160);
+ L169:
+  _AOT_PUSH(169);
+ L178:
+  _AOT_EXIT(178);
+  /* MAKE-VECTOR */
+ L179:
+  _AOT_LOCAL_REF(179, 0);
+ L188:
+  _AOT_PUSH(188);
+ L197:
+  _AOT_STACK_REF(197, 3);
+ L206:
+  _AOT_EXIT(206);
+  /* VECTOR-SET */
+ L207:
+  _AOT_EXIT(207);
+  /* MAKE-PROCEDURE */
+ L232:
+  _AOT_TAIL_CALL(232, 2);
+ L241:
+  _AOT_RET(241);
+  _AOT_EXIT(242);
+}
+
+static const unsigned char sexp_aot_srfi_1_65_shape[] = {
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 91, 35, 0, 0, 0, 0, 0,
+  0, 0, 82, 1, 0, 0, 0, 0, 0, 0, 0, 47, 6, 0, 0, 0,
+  0, 0, 0, 0, 14, 17, 0, 0, 0, 0, 0, 0, 0, 15, 14, 0,
+  0, 0, 0, 0, 0, 0, 13, 51, 0, 0, 0, 0, 0, 0, 0, 22,
+  1, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0,
+  0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 14, 17, 0, 0, 0, 0, 0, 0, 0, 15, 5, 0, 0, 0, 0,
+  0, 0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 91, 26, 0, 0,
+  0, 0, 0, 0, 0, 81, 1, 0, 0, 0, 0, 0, 0, 0, 14, 17,
+  0, 0, 0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0,
+  15, 14, 1, 0, 0, 0, 0, 0, 0, 15, 5, 0, 0, 0, 0, 0,
+  0, 0, 39, 22, 0, 0, 0, 0, 0, 0, 0, 0, 15, 1, 0, 0,
+  0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 38,
+  1, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 5, 9, 0, 0, 0, 0, 0, 0,
+  0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_66 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 43: goto L43;
+  case 52: goto L52;
+  case 61: goto L61;
+  case 86: goto L86;
+  case 95: goto L95;
+  case 104: goto L104;
+  case 129: goto L129;
+  case 138: goto L138;
+  case 163: goto L163;
+  case 172: goto L172;
+  case 181: goto L181;
+  case 206: goto L206;
+  case 215: goto L215;
+  case 224: goto L224;
+  case 233: goto L233;
+  case 242: goto L242;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_GLOBAL_KNOWN_REF(9);
+ L18:
+  _AOT_GLOBAL_KNOWN_CALL(18, 2);
+ L43:
+  _AOT_JUMP_UNLESS(43, L233);
+ L52:
+  _AOT_LOCAL_REF(52, 1);
+ L61:
+  _AOT_GLOBAL_KNOWN_CALL(61, 1);
+ L86:
+  _AOT_LOCAL_REF(86, 0);
+ L95:
+  _AOT_GLOBAL_KNOWN_REF(95);
+ L104:
+  _AOT_GLOBAL_KNOWN_CALL(104, 3);
+ L129:
+  _AOT_CLOSURE_REF(129, 1);
+ L138:
+  _AOT_GLOBAL_KNOWN_CALL(138, 2);
+ L163:
+  _AOT_LOCAL_REF(163, 0);
+ L172:
+  _AOT_GLOBAL_KNOWN_REF(172);
+ L181:
+  _AOT_GLOBAL_KNOWN_CALL(181, 2);
+ L206:
+  _AOT_CLOSURE_REF_CDR(206, 0);
+ L215:
+  _AOT_TAIL_CALL(215, 2);
+ L224:
+  _AOT_JUMP(224, L242);
+ L233:
+  _AOT_LOCAL_REF(233, 1);
+ L242:
+  _AOT_RET(242);
+  _AOT_EXIT(243);
+}
+
+static const unsigned char sexp_aot_srfi_1_66_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0,
+  0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 189, 0, 0, 0,
+  0, 0, 0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0,
+  0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 19,
+  0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0,
+  0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 24, 1, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0,
+  0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0,
+  0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 83, 0,
+  0, 0, 0, 0, 0, 0, 0, 5, 9, 0, 0, 0, 0, 0, 0, 0,
+  14, 17, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0, 0, 0,
+  0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_67 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 81: goto L81;
+  case 90: goto L90;
+  case 99: goto L99;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_PAIRP_JUMP_UNLESS(9, L90);
+ L18:
+  _AOT_LOCAL_REF(18, 1);
+ L27:
+  _AOT_LOCAL_REF_CAR(27, 0);
+ L36:
+  _AOT_CLOSURE_REF(36, 1);
+ L45:
+  _AOT_CALL(45, 2);
+ L54:
+  _AOT_LOCAL_REF_CDR(54, 0);
+ L63:
+  _AOT_CLOSURE_REF_CDR(63, 0);
+ L72:
+  _AOT_TAIL_CALL(72, 2);
+ L81:
+  _AOT_JUMP(81, L99);
+ L90:
+  _AOT_LOCAL_REF(90, 1);
+ L99:
+  _AOT_RET(99);
+  _AOT_EXIT(100);
+}
+
+static const unsigned char sexp_aot_srfi_1_67_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 91, 80, 0, 0, 0, 0, 0,
+  0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 81, 0, 0, 0, 0,
+  0, 0, 0, 0, 24, 1, 0, 0, 0, 0, 0, 0, 0, 6, 9, 0,
+  0, 0, 0, 0, 0, 0, 82, 0, 0, 0, 0, 0, 0, 0, 0, 83,
+  0, 0, 0, 0, 0, 0, 0, 0, 5, 9, 0, 0, 0, 0, 0, 0,
+  0, 14, 17, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0, 0,
+  0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_68 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 55: goto L55;
+  case 64: goto L64;
+  case 73: goto L73;
+  case 82: goto L82;
+  case 83: goto L83;
+  case 108: goto L108;
+  case 117: goto L117;
+  case 126: goto L126;
+  case 135: goto L135;
+  case 144: goto L144;
+  case 153: goto L153;
+  case 154: goto L154;
+  case 163: goto L163;
+  case 172: goto L172;
+  case 173: goto L173;
+  case 182: goto L182;
+  case 191: goto L191;
+  case 200: goto L200;
+  case 201: goto L201;
+  case 226: goto L226;
+  case 235: goto L235;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 3);
+ L9:
+  _AOT_NULLP_JUMP_UNLESS(9, L126);
+ L18:
+  _AOT_LOCAL_REF(18, 1);
+ L27:
+  _AOT_LOCAL_REF(27, 2);
+ L36:
+  _AOT_PUSH(36);
+ L45:
+  _AOT_PUSH(45);
+ L54:
+  _AOT_EXIT(54);
+  /* MAKE-VECTOR */
+ L55:
+  _AOT_LOCAL_REF(55, 0);
+ L64:
+  _AOT_PUSH(64);
+ L73:
+  _AOT_STACK_REF(73, 3);
+ L82:
+  _AOT_EXIT(82);
+  /* VECTOR-SET */
+ L83:
+  _AOT_EXIT(83);
+  /* MAKE-PROCEDURE */
+ L108:
+  _AOT_TAIL_CALL(108, 2);
+ L117:
+  _AOT_JUMP(117, L235);
+ L126:
+  _AOT_LOCAL_REF(126, 1);
+ L135:
+  _AOT_LOCAL_REF(135, 3);
+ L144:
+  _AOT_LOCAL_REF(144, 2);
+ L153:
+  _AOT_CONS(153);
+ L154:
+  _AOT_PUSH(154);
+ L163:
+  _AOT_PUSH(163);
+ L172:
+  _AOT_EXIT(172);
+  /* MAKE-VECTOR */
+ L173:
+  _AOT_LOCAL_REF(173, 0);
+ L182:
+  _AOT_PUSH(182);
+ L191:
+  _AOT_STACK_REF(191, 3);
+ L200:
+  _AOT_EXIT(200);
+  /* VECTOR-SET */
+ L201:
+  _AOT_EXIT(201);
+  /* MAKE-PROCEDURE */
+ L226:
+  _AOT_TAIL_CALL(226, 2);
+ L235:
+  _AOT_RET(235);
+  _AOT_EXIT(236);
+}
+
+static const unsigned char sexp_aot_srfi_1_68_shape[] = {
+  22, 3, 0, 0, 0, 0, 0, 0, 0, 90, 116, 0, 0, 0, 0, 0,
+  0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 22, 2, 0, 0, 0,
+  0, 0, 0, 0, 15, 14, 1, 0, 0, 0, 0, 0, 0, 15, 5, 0,
+  0, 0, 0, 0, 0, 0, 39, 22, 0, 0, 0, 0, 0, 0, 0, 0,
+  15, 1, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0,
+  0, 0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 9, 0, 0,
+  0, 0, 0, 0, 0, 14, 117, 0, 0, 0, 0, 0, 0, 0, 22, 1,
+  0, 0, 0, 0, 0, 0, 0, 22, 3, 0, 0, 0, 0, 0, 0, 0,
+  22, 2, 0, 0, 0, 0, 0, 0, 0, 58, 15, 14, 1, 0, 0, 0,
+  0, 0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 39, 22, 0, 0,
+  0, 0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0, 21,
+  3, 0, 0, 0, 0, 0, 0, 0, 27, 38, 1, 0, 0, 0, 0, 0,
+  0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 5, 9, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_69 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 43: goto L43;
+  case 52: goto L52;
+  case 61: goto L61;
+  case 70: goto L70;
+  case 95: goto L95;
+  case 104: goto L104;
+  case 113: goto L113;
+  case 138: goto L138;
+  case 147: goto L147;
+  case 156: goto L156;
+  case 181: goto L181;
+  case 190: goto L190;
+  case 199: goto L199;
+  case 208: goto L208;
+  case 217: goto L217;
+  case 226: goto L226;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_GLOBAL_KNOWN_REF(9);
+ L18:
+  _AOT_GLOBAL_KNOWN_CALL(18, 2);
+ L43:
+  _AOT_JUMP_UNLESS(43, L217);
+ L52:
+  _AOT_LOCAL_REF(52, 0);
+ L61:
+  _AOT_GLOBAL_KNOWN_REF(61);
+ L70:
+  _AOT_GLOBAL_KNOWN_CALL(70, 2);
+ L95:
+  _AOT_CLOSURE_REF_CDR(95, 1);
+ L104:
+  _AOT_CALL(104, 1);
+ L113:
+  _AOT_GLOBAL_KNOWN_CALL(113, 1);
+ L138:
+  _AOT_LOCAL_REF(138, 0);
+ L147:
+  _AOT_GLOBAL_KNOWN_REF(147);
+ L156:
+  _AOT_GLOBAL_KNOWN_CALL(156, 3);
+ L181:
+  _AOT_CLOSURE_REF(181, 0);
+ L190:
+  _AOT_GLOBAL_KNOWN_REF(190);
+ L199:
+  _AOT_TAIL_CALL(199, 2);
+ L208:
+  _AOT_JUMP(208, L226);
+ L217:
+  _AOT_CLOSURE_REF(217, 2);
+ L226:
+  _AOT_RET(226);
+  _AOT_EXIT(227);
+}
+
+static const unsigned char sexp_aot_srfi_1_69_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0,
+  0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 173, 0, 0, 0,
+  0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0,
+  0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 83,
+  1, 0, 0, 0, 0, 0, 0, 0, 6, 5, 0, 0, 0, 0, 0, 0,
+  0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0,
+  0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0,
+  0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0,
+  0, 0, 0, 0, 0, 0, 0, 5, 9, 0, 0, 0, 0, 0, 0, 0,
+  14, 17, 0, 0, 0, 0, 0, 0, 0, 24, 2, 0, 0, 0, 0, 0,
+  0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_70 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 81: goto L81;
+  case 90: goto L90;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_PAIRP_JUMP_UNLESS(9, L81);
+ L18:
+  _AOT_LOCAL_REF_CDR(18, 0);
+ L27:
+  _AOT_CLOSURE_REF_CDR(27, 1);
+ L36:
+  _AOT_CALL(36, 1);
+ L45:
+  _AOT_LOCAL_REF_CAR(45, 0);
+ L54:
+  _AOT_CLOSURE_REF(54, 0);
+ L63:
+  _AOT_TAIL_CALL(63, 2);
+ L72:
+  _AOT_JUMP(72, L90);
+ L81:
+  _AOT_CLOSURE_REF(81, 2);
+ L90:
+  _AOT_RET(90);
+  _AOT_EXIT(91);
+}
+
+static const unsigned char sexp_aot_srfi_1_70_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 91, 71, 0, 0, 0, 0, 0,
+  0, 0, 82, 0, 0, 0, 0, 0, 0, 0, 0, 83, 1, 0, 0, 0,
+  0, 0, 0, 0, 6, 5, 0, 0, 0, 0, 0, 0, 0, 81, 0, 0,
+  0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+  9, 0, 0, 0, 0, 0, 0, 0, 14, 17, 0, 0, 0, 0, 0, 0,
+  0, 24, 2, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_71 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 46: goto L46;
+  case 55: goto L55;
+  case 64: goto L64;
+  case 73: goto L73;
+  case 74: goto L74;
+  case 83: goto L83;
+  case 92: goto L92;
+  case 101: goto L101;
+  case 102: goto L102;
+  case 127: goto L127;
+  case 136: goto L136;
+  case 145: goto L145;
+  case 154: goto L154;
+  case 163: goto L163;
+  case 164: goto L164;
+  case 173: goto L173;
+  case 182: goto L182;
+  case 183: goto L183;
+  case 192: goto L192;
+  case 201: goto L201;
+  case 210: goto L210;
+  case 211: goto L211;
+  case 220: goto L220;
+  case 229: goto L229;
+  case 238: goto L238;
+  case 239: goto L239;
+  case 264: goto L264;
+  case 273: goto L273;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 3);
+ L9:
+  _AOT_NULLP_JUMP_UNLESS(9, L145);
+ L18:
+  _AOT_LOCAL_REF(18, 2);
+ L27:
+  _AOT_PUSH(27);
+ L36:
+  _AOT_PUSH(36);
+ L45:
+  _AOT_EXIT(45);
+  /* MAKE-VECTOR */
+ L46:
+  _AOT_LOCAL_REF(46, 0);
+ L55:
+  _AOT_PUSH(55);
+ L64:
+  _AOT_STACK_REF(64, 3);
+ L73:
+  _AOT_EXIT(73);
+  /* VECTOR-SET */
+ L74:
+  _AOT_LOCAL_REF(74, 1);
+ L83:
+  _AOT_PUSH(83);
+ L92:
+  _AOT_STACK_REF(92, 3);
+ L101:
+  _AOT_EXIT(101);
+  /* VECTOR-SET */
+ L102:
+  _AOT_EXIT(102);
+  /* MAKE-PROCEDURE */
+ L127:
+  _AOT_TAIL_CALL(127, 1);
+ L136:
+  _AOT_JUMP(136, L273);
+ L145:
+  _AOT_LOCAL_REF(145, 3);
+ L154:
+  _AOT_LOCAL_REF(154, 2);
+ L163:
+  _AOT_CONS(163);
+ L164:
+  _AOT_PUSH(164);
+ L173:
+  _AOT_PUSH(173);
+ L182:
+  _AOT_EXIT(182);
+  /* MAKE-VECTOR */
+ L183:
+  _AOT_LOCAL_REF(183, 0);
+ L192:
+  _AOT_PUSH(192);
+ L201:
+  _AOT_STACK_REF(201, 3);
+ L210:
+  _AOT_EXIT(210);
+  /* VECTOR-SET */
+ L211:
+  _AOT_LOCAL_REF(211, 1);
+ L220:
+  _AOT_PUSH(220);
+ L229:
+  _AOT_STACK_REF(229, 3);
+ L238:
+  _AOT_EXIT(238);
+  /* VECTOR-SET */
+ L239:
+  _AOT_EXIT(239);
+  /* MAKE-PROCEDURE */
+ L264:
+  _AOT_TAIL_CALL(264, 1);
+ L273:
+  _AOT_RET(273);
+  _AOT_EXIT(274);
+}
+
+static const unsigned char sexp_aot_srfi_1_71_shape[] = {
+  22, 3, 0, 0, 0, 0, 0, 0, 0, 90, 135, 0, 0, 0, 0, 0,
+  0, 0, 22, 2, 0, 0, 0, 0, 0, 0, 0, 15, 14, 1, 0, 0,
+  0, 0, 0, 0, 15, 9, 0, 0, 0, 0, 0, 0, 0, 39, 22, 0,
+  0, 0, 0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0,
+  21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 22, 1, 0, 0, 0, 0,
+  0, 0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0,
+  0, 0, 0, 0, 0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 5,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+  5, 0, 0, 0, 0, 0, 0, 0, 14, 136, 0, 0, 0, 0, 0, 0,
+  0, 22, 3, 0, 0, 0, 0, 0, 0, 0, 22, 2, 0, 0, 0, 0,
+  0, 0, 0, 58, 15, 14, 1, 0, 0, 0, 0, 0, 0, 15, 9, 0,
+  0, 0, 0, 0, 0, 0, 39, 22, 0, 0, 0, 0, 0, 0, 0, 0,
+  15, 1, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0,
+  0, 0, 27, 22, 1, 0, 0, 0, 0, 0, 0, 0, 15, 5, 0, 0,
+  0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 38,
+  1, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0,
+  0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_72 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 43: goto L43;
+  case 52: goto L52;
+  case 61: goto L61;
+  case 86: goto L86;
+  case 95: goto L95;
+  case 120: goto L120;
+  case 129: goto L129;
+  case 154: goto L154;
+  case 163: goto L163;
+  case 172: goto L172;
+  case 197: goto L197;
+  case 206: goto L206;
+  case 215: goto L215;
+  case 224: goto L224;
+  case 233: goto L233;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_GLOBAL_KNOWN_REF(9);
+ L18:
+  _AOT_GLOBAL_KNOWN_CALL(18, 2);
+ L43:
+  _AOT_JUMP_UNLESS(43, L224);
+ L52:
+  _AOT_LOCAL_REF(52, 1);
+ L61:
+  _AOT_GLOBAL_KNOWN_CALL(61, 1);
+ L86:
+  _AOT_LOCAL_REF(86, 0);
+ L95:
+  _AOT_GLOBAL_KNOWN_CALL(95, 2);
+ L120:
+  _AOT_CLOSURE_REF(120, 1);
+ L129:
+  _AOT_GLOBAL_KNOWN_CALL(129, 2);
+ L154:
+  _AOT_LOCAL_REF(154, 0);
+ L163:
+  _AOT_GLOBAL_KNOWN_REF(163);
+ L172:
+  _AOT_GLOBAL_KNOWN_CALL(172, 2);
+ L197:
+  _AOT_CLOSURE_REF_CDR(197, 0);
+ L206:
+  _AOT_TAIL_CALL(206, 2);
+ L215:
+  _AOT_JUMP(215, L233);
+ L224:
+  _AOT_LOCAL_REF(224, 1);
+ L233:
+  _AOT_RET(233);
+  _AOT_EXIT(234);
+}
+
+static const unsigned char sexp_aot_srfi_1_72_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0,
+  0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 180, 0, 0, 0,
+  0, 0, 0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0,
+  0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 85,
+  0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 24, 1, 0, 0, 0, 0, 0, 0,
+  0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0,
+  0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0,
+  0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 83, 0, 0, 0, 0, 0, 0, 0, 0, 5, 9,
+  0, 0, 0, 0, 0, 0, 0, 14, 17, 0, 0, 0, 0, 0, 0, 0,
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_73 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 81: goto L81;
+  case 90: goto L90;
+  case 99: goto L99;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_PAIRP_JUMP_UNLESS(9, L90);
+ L18:
+  _AOT_LOCAL_REF(18, 1);
+ L27:
+  _AOT_LOCAL_REF(27, 0);
+ L36:
+  _AOT_CLOSURE_REF(36, 1);
+ L45:
+  _AOT_CALL(45, 2);
+ L54:
+  _AOT_LOCAL_REF_CDR(54, 0);
+ L63:
+  _AOT_CLOSURE_REF_CDR(63, 0);
+ L72:
+  _AOT_TAIL_CALL(72, 2);
+ L81:
+  _AOT_JUMP(81, L99);
+ L90:
+  _AOT_LOCAL_REF(90, 1);
+ L99:
+  _AOT_RET(99);
+  _AOT_EXIT(100);
+}
+
+static const unsigned char sexp_aot_srfi_1_73_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 91, 80, 0, 0, 0, 0, 0,
+  0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0,
+  0, 0, 0, 0, 24, 1, 0, 0, 0, 0, 0, 0, 0, 6, 9, 0,
+  0, 0, 0, 0, 0, 0, 82, 0, 0, 0, 0, 0, 0, 0, 0, 83,
+  0, 0, 0, 0, 0, 0, 0, 0, 5, 9, 0, 0, 0, 0, 0, 0,
+  0, 14, 17, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0, 0,
+  0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_74 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 43: goto L43;
+  case 52: goto L52;
+  case 61: goto L61;
+  case 70: goto L70;
+  case 95: goto L95;
+  case 104: goto L104;
+  case 113: goto L113;
+  case 138: goto L138;
+  case 147: goto L147;
+  case 172: goto L172;
+  case 181: goto L181;
+  case 190: goto L190;
+  case 199: goto L199;
+  case 208: goto L208;
+  case 217: goto L217;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_GLOBAL_KNOWN_REF(9);
+ L18:
+  _AOT_GLOBAL_KNOWN_CALL(18, 2);
+ L43:
+  _AOT_JUMP_UNLESS(43, L208);
+ L52:
+  _AOT_LOCAL_REF(52, 0);
+ L61:
+  _AOT_GLOBAL_KNOWN_REF(61);
+ L70:
+  _AOT_GLOBAL_KNOWN_CALL(70, 2);
+ L95:
+  _AOT_CLOSURE_REF_CDR(95, 1);
+ L104:
+  _AOT_CALL(104, 1);
+ L113:
+  _AOT_GLOBAL_KNOWN_CALL(113, 1);
+ L138:
+  _AOT_LOCAL_REF(138, 0);
+ L147:
+  _AOT_GLOBAL_KNOWN_CALL(147, 2);
+ L172:
+  _AOT_CLOSURE_REF(172, 0);
+ L181:
+  _AOT_GLOBAL_KNOWN_REF(181);
+ L190:
+  _AOT_TAIL_CALL(190, 2);
+ L199:
+  _AOT_JUMP(199, L217);
+ L208:
+  _AOT_CLOSURE_REF(208, 2);
+ L217:
+  _AOT_RET(217);
+  _AOT_EXIT(218);
+}
+
+static const unsigned char sexp_aot_srfi_1_74_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0,
+  0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 164, 0, 0, 0,
+  0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0,
+  0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 83,
+  1, 0, 0, 0, 0, 0, 0, 0, 6, 5, 0, 0, 0, 0, 0, 0,
+  0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0,
+  0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0,
+  0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 5, 9,
+  0, 0, 0, 0, 0, 0, 0, 14, 17, 0, 0, 0, 0, 0, 0, 0,
+  24, 2, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_75 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 81: goto L81;
+  case 90: goto L90;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_PAIRP_JUMP_UNLESS(9, L81);
+ L18:
+  _AOT_LOCAL_REF_CDR(18, 0);
+ L27:
+  _AOT_CLOSURE_REF_CDR(27, 1);
+ L36:
+  _AOT_CALL(36, 1);
+ L45:
+  _AOT_LOCAL_REF(45, 0);
+ L54:
+  _AOT_CLOSURE_REF(54, 0);
+ L63:
+  _AOT_TAIL_CALL(63, 2);
+ L72:
+  _AOT_JUMP(72, L90);
+ L81:
+  _AOT_CLOSURE_REF(81, 2);
+ L90:
+  _AOT_RET(90);
+  _AOT_EXIT(91);
+}
+
+static const unsigned char sexp_aot_srfi_1_75_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 91, 71, 0, 0, 0, 0, 0,
+  0, 0, 82, 0, 0, 0, 0, 0, 0, 0, 0, 83, 1, 0, 0, 0,
+  0, 0, 0, 0, 6, 5, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0,
+  0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+  9, 0, 0, 0, 0, 0, 0, 0, 14, 17, 0, 0, 0, 0, 0, 0,
+  0, 24, 2, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_76 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 81: goto L81;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 2);
+ L9:
+  _AOT_NULLP_JUMP_UNLESS(9, L36);
+ L18:
+  _AOT_LOCAL_REF(18, 1);
+ L27:
+  _AOT_JUMP(27, L81);
+ L36:
+  _AOT_LOCAL_REF_CDR(36, 2);
+ L45:
+  _AOT_LOCAL_REF_CAR(45, 2);
+ L54:
+  _AOT_LOCAL_REF(54, 0);
+ L63:
+  _AOT_GLOBAL_KNOWN_REF(63);
+ L72:
+  _AOT_TAIL_CALL(72, 3);
+ L81:
+  _AOT_RET(81);
+  _AOT_EXIT(82);
+}
+
+static const unsigned char sexp_aot_srfi_1_76_shape[] = {
+  22, 2, 0, 0, 0, 0, 0, 0, 0, 90, 26, 0, 0, 0, 0, 0,
+  0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 14, 53, 0, 0, 0,
+  0, 0, 0, 0, 82, 2, 0, 0, 0, 0, 0, 0, 0, 81, 2, 0,
+  0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 19,
+  0, 0, 0, 0, 0, 0, 0, 0, 5, 13, 0, 0, 0, 0, 0, 0,
+  0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_77 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 73: goto L73;
+  case 82: goto L82;
+  case 91: goto L91;
+  case 100: goto L100;
+  case 109: goto L109;
+  case 118: goto L118;
+  case 127: goto L127;
+  case 136: goto L136;
+  case 145: goto L145;
+  case 154: goto L154;
+  case 163: goto L163;
+  case 172: goto L172;
+  case 181: goto L181;
+  case 182: goto L182;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_CLOSURE_REF(9, 0);
+ L18:
+  _AOT_CALL(18, 1);
+ L27:
+  _AOT_JUMP_UNLESS(27, L109);
+ L36:
+  _AOT_CLOSURE_REF(36, 1);
+ L45:
+  _AOT_PAIRP_JUMP_UNLESS(45, L91);
+ L54:
+  _AOT_LOCAL_REF(54, 0);
+ L63:
+  _AOT_CLOSURE_REF(63, 1);
+ L72:
+  _AOT_CAR(72);
+ L73:
+  _AOT_TAIL_CALL(73, 1);
+ L82:
+  _AOT_JUMP(82, L100);
+ L91:
+  _AOT_PUSH(91);
+ L100:
+  _AOT_JUMP(100, L182);
+ L109:
+  _AOT_LOCAL_REF(109, 0);
+ L118:
+  _AOT_CLOSURE_REF(118, 4);
+ L127:
+  _AOT_CALL(127, 1);
+ L136:
+  _AOT_CLOSURE_REF_CDR(136, 3);
+ L145:
+  _AOT_CALL(145, 1);
+ L154:
+  _AOT_LOCAL_REF(154, 0);
+ L163:
+  _AOT_CLOSURE_REF(163, 2);
+ L172:
+  _AOT_CALL(172, 1);
+ L181:
+  _AOT_CONS(181);
+ L182:
+  _AOT_RET(182);
+  _AOT_EXIT(183);
+}
+
+static const unsigned char sexp_aot_srfi_1_77_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0,
+  0, 0, 6, 5, 0, 0, 0, 0, 0, 0, 0, 13, 81, 0, 0, 0,
+  0, 0, 0, 0, 24, 1, 0, 0, 0, 0, 0, 0, 0, 91, 45, 0,
+  0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 24,
+  1, 0, 0, 0, 0, 0, 0, 0, 54, 5, 5, 0, 0, 0, 0, 0,
+  0, 0, 14, 17, 0, 0, 0, 0, 0, 0, 0, 15, 142, 0, 0, 0,
+  0, 0, 0, 0, 14, 81, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0,
+  0, 0, 0, 0, 0, 0, 24, 4, 0, 0, 0, 0, 0, 0, 0, 6,
+  5, 0, 0, 0, 0, 0, 0, 0, 83, 3, 0, 0, 0, 0, 0, 0,
+  0, 6, 5, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0,
+  0, 0, 0, 24, 2, 0, 0, 0, 0, 0, 0, 0, 6, 5, 0, 0,
+  0, 0, 0, 0, 0, 58, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_78 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 81: goto L81;
+  case 90: goto L90;
+  case 91: goto L91;
+  case 100: goto L100;
+  case 109: goto L109;
+  case 118: goto L118;
+  case 127: goto L127;
+  case 136: goto L136;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_CLOSURE_REF(9, 0);
+ L18:
+  _AOT_CALL(18, 1);
+ L27:
+  _AOT_JUMP_UNLESS(27, L54);
+ L36:
+  _AOT_LOCAL_REF(36, 1);
+ L45:
+  _AOT_JUMP(45, L136);
+ L54:
+  _AOT_LOCAL_REF(54, 1);
+ L63:
+  _AOT_LOCAL_REF(63, 0);
+ L72:
+  _AOT_CLOSURE_REF(72, 3);
+ L81:
+  _AOT_CALL(81, 1);
+ L90:
+  _AOT_CONS(90);
+ L91:
+  _AOT_LOCAL_REF(91, 0);
+ L100:
+  _AOT_CLOSURE_REF(100, 2);
+ L109:
+  _AOT_CALL(109, 1);
+ L118:
+  _AOT_CLOSURE_REF_CDR(118, 1);
+ L127:
+  _AOT_TAIL_CALL(127, 2);
+ L136:
+  _AOT_RET(136);
+  _AOT_EXIT(137);
+}
+
+static const unsigned char sexp_aot_srfi_1_78_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0,
+  0, 0, 6, 5, 0, 0, 0, 0, 0, 0, 0, 13, 26, 0, 0, 0,
+  0, 0, 0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 14, 90, 0,
+  0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 22,
+  0, 0, 0, 0, 0, 0, 0, 0, 24, 3, 0, 0, 0, 0, 0, 0,
+  0, 6, 5, 0, 0, 0, 0, 0, 0, 0, 58, 22, 0, 0, 0, 0,
+  0, 0, 0, 0, 24, 2, 0, 0, 0, 0, 0, 0, 0, 6, 5, 0,
+  0, 0, 0, 0, 0, 0, 83, 1, 0, 0, 0, 0, 0, 0, 0, 5,
+  9, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_79 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 73: goto L73;
+  case 82: goto L82;
+  case 91: goto L91;
+  case 100: goto L100;
+  case 101: goto L101;
+  case 110: goto L110;
+  case 119: goto L119;
+  case 128: goto L128;
+  case 129: goto L129;
+  case 138: goto L138;
+  case 147: goto L147;
+  case 156: goto L156;
+  case 157: goto L157;
+  case 182: goto L182;
+  case 191: goto L191;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 4);
+ L9:
+  _AOT_PAIRP_JUMP_UNLESS(9, L36);
+ L18:
+  _AOT_LOCAL_REF_CAR(18, 4);
+ L27:
+  _AOT_JUMP(27, L45);
+ L36:
+  _AOT_PUSH(36);
+ L45:
+  _AOT_LOCAL_REF(45, 3);
+ L54:
+  _AOT_PUSH(54);
+ L63:
+  _AOT_PUSH(63);
+ L72:
+  _AOT_EXIT(72);
+  /* MAKE-VECTOR */
+ L73:
+  _AOT_LOCAL_REF(73, 0);
+ L82:
+  _AOT_PUSH(82);
+ L91:
+  _AOT_STACK_REF(91, 3);
+ L100:
+  _AOT_EXIT(100);
+  /* VECTOR-SET */
+ L101:
+  _AOT_LOCAL_REF(101, 2);
+ L110:
+  _AOT_PUSH(110);
+ L119:
+  _AOT_STACK_REF(119, 3);
+ L128:
+  _AOT_EXIT(128);
+  /* VECTOR-SET */
+ L129:
+  _AOT_LOCAL_REF(129, 1);
+ L138:
+  _AOT_PUSH(138);
+ L147:
+  _AOT_STACK_REF(147, 3);
+ L156:
+  _AOT_EXIT(156);
+  /* VECTOR-SET */
+ L157:
+  _AOT_EXIT(157);
+  /* MAKE-PROCEDURE */
+ L182:
+  _AOT_TAIL_CALL(182, 2);
+ L191:
+  _AOT_RET(191);
+  _AOT_EXIT(192);
+}
+
+static const unsigned char sexp_aot_srfi_1_79_shape[] = {
+  22, 4, 0, 0, 0, 0, 0, 0, 0, 91, 26, 0, 0, 0, 0, 0,
+  0, 0, 81, 4, 0, 0, 0, 0, 0, 0, 0, 14, 17, 0, 0, 0,
+  0, 0, 0, 0, 15, 142, 0, 0, 0, 0, 0, 0, 0, 22, 3, 0,
+  0, 0, 0, 0, 0, 0, 15, 14, 1, 0, 0, 0, 0, 0, 0, 15,
+  13, 0, 0, 0, 0, 0, 0, 0, 39, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0,
+  0, 0, 0, 0, 27, 22, 2, 0, 0, 0, 0, 0, 0, 0, 15, 5,
+  0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0,
+  27, 22, 1, 0, 0, 0, 0, 0, 0, 0, 15, 9, 0, 0, 0, 0,
+  0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 38, 1, 0,
+  0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 5, 9, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_80 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 43: goto L43;
+  case 52: goto L52;
+  case 61: goto L61;
+  case 70: goto L70;
+  case 79: goto L79;
+  case 88: goto L88;
+  case 97: goto L97;
+  case 106: goto L106;
+  case 115: goto L115;
+  case 124: goto L124;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 1);
+ L9:
+  _AOT_GLOBAL_KNOWN_REF(9);
+ L18:
+  _AOT_GLOBAL_KNOWN_CALL(18, 2);
+ L43:
+  _AOT_JUMP_UNLESS(43, L115);
+ L52:
+  _AOT_LOCAL_REF(52, 1);
+ L61:
+  _AOT_CLOSURE_REF_CDR(61, 1);
+ L70:
+  _AOT_CALL(70, 1);
+ L79:
+  _AOT_LOCAL_REF(79, 0);
+ L88:
+  _AOT_CLOSURE_REF(88, 0);
+ L97:
+  _AOT_TAIL_CALL(97, 2);
+ L106:
+  _AOT_JUMP(106, L124);
+ L115:
+  _AOT_LOCAL_REF(115, 0);
+ L124:
+  _AOT_RET(124);
+  _AOT_EXIT(125);
+}
+
+static const unsigned char sexp_aot_srfi_1_80_shape[] = {
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0,
+  0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 71, 0, 0, 0,
+  0, 0, 0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 83, 1, 0,
+  0, 0, 0, 0, 0, 0, 6, 5, 0, 0, 0, 0, 0, 0, 0, 22,
+  0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0, 0,
+  0, 5, 9, 0, 0, 0, 0, 0, 0, 0, 14, 17, 0, 0, 0, 0,
+  0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_81 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 43: goto L43;
+  case 52: goto L52;
+  case 61: goto L61;
+  case 86: goto L86;
+  case 95: goto L95;
+  case 120: goto L120;
+  case 129: goto L129;
+  case 138: goto L138;
+  case 139: goto L139;
+  case 148: goto L148;
+  case 157: goto L157;
+  case 166: goto L166;
+  case 167: goto L167;
+  case 176: goto L176;
+  case 185: goto L185;
+  case 194: goto L194;
+  case 195: goto L195;
+  case 220: goto L220;
+  case 229: goto L229;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_GLOBAL_KNOWN_REF(9);
+ L18:
+  _AOT_GLOBAL_KNOWN_CALL(18, 2);
+ L43:
+  _AOT_LOCAL_REF(43, 0);
+ L52:
+  _AOT_GLOBAL_KNOWN_REF(52);
+ L61:
+  _AOT_GLOBAL_KNOWN_CALL(61, 2);
+ L86:
+  _AOT_CLOSURE_REF(86, 2);
+ L95:
+  _AOT_GLOBAL_KNOWN_CALL(95, 2);
+ L120:
+  _AOT_PUSH(120);
+ L129:
+  _AOT_PUSH(129);
+ L138:
+  _AOT_EXIT(138);
+  /* MAKE-VECTOR */
+ L139:
+  _AOT_CLOSURE_REF(139, 1);
+ L148:
+  _AOT_PUSH(148);
+ L157:
+  _AOT_STACK_REF(157, 3);
+ L166:
+  _AOT_EXIT(166);
+  /* VECTOR-SET */
+ L167:
+  _AOT_CLOSURE_REF(167, 0);
+ L176:
+  _AOT_PUSH(176);
+ L185:
+  _AOT_STACK_REF(185, 3);
+ L194:
+  _AOT_EXIT(194);
+  /* VECTOR-SET */
+ L195:
+  _AOT_EXIT(195);
+  /* MAKE-PROCEDURE */
+ L220:
+  _AOT_TAIL_CALL(220, 2);
+ L229:
+  _AOT_RET(229);
+  _AOT_EXIT(230);
+}
+
+static const unsigned char sexp_aot_srfi_1_81_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0,
+  0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0,
+  0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0,
+  0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 24, 2, 0, 0, 0, 0, 0, 0, 0, 85,
+  0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 15, 14, 1, 0, 0, 0, 0, 0,
+  0, 15, 9, 0, 0, 0, 0, 0, 0, 0, 39, 24, 1, 0, 0, 0,
+  0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0,
+  0, 0, 0, 0, 0, 0, 27, 24, 0, 0, 0, 0, 0, 0, 0, 0,
+  15, 5, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0,
+  0, 0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 9, 0, 0,
+  0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_82 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 81: goto L81;
+  case 90: goto L90;
+  case 99: goto L99;
+  case 108: goto L108;
+  case 117: goto L117;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_NULLP_JUMP_UNLESS(9, L36);
+ L18:
+  _AOT_LOCAL_REF(18, 1);
+ L27:
+  _AOT_JUMP(27, L117);
+ L36:
+  _AOT_LOCAL_REF(36, 1);
+ L45:
+  _AOT_LOCAL_REF_CAR(45, 0);
+ L54:
+  _AOT_CLOSURE_REF(54, 2);
+ L63:
+  _AOT_CALL(63, 1);
+ L72:
+  _AOT_CLOSURE_REF(72, 1);
+ L81:
+  _AOT_CALL(81, 2);
+ L90:
+  _AOT_LOCAL_REF_CDR(90, 0);
+ L99:
+  _AOT_CLOSURE_REF_CDR(99, 0);
+ L108:
+  _AOT_TAIL_CALL(108, 2);
+ L117:
+  _AOT_RET(117);
+  _AOT_EXIT(118);
+}
+
+static const unsigned char sexp_aot_srfi_1_82_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 90, 26, 0, 0, 0, 0, 0,
+  0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 14, 89, 0, 0, 0,
+  0, 0, 0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 81, 0, 0,
+  0, 0, 0, 0, 0, 0, 24, 2, 0, 0, 0, 0, 0, 0, 0, 6,
+  5, 0, 0, 0, 0, 0, 0, 0, 24, 1, 0, 0, 0, 0, 0, 0,
+  0, 6, 9, 0, 0, 0, 0, 0, 0, 0, 82, 0, 0, 0, 0, 0,
+  0, 0, 0, 83, 0, 0, 0, 0, 0, 0, 0, 0, 5, 9, 0, 0,
+  0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_83 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 81: goto L81;
+  case 90: goto L90;
+  case 91: goto L91;
+  case 100: goto L100;
+  case 109: goto L109;
+  case 118: goto L118;
+  case 119: goto L119;
+  case 128: goto L128;
+  case 137: goto L137;
+  case 146: goto L146;
+  case 147: goto L147;
+  case 172: goto L172;
+  case 181: goto L181;
+  case 190: goto L190;
+  case 199: goto L199;
+  case 208: goto L208;
+  case 217: goto L217;
+  case 226: goto L226;
+  case 251: goto L251;
+  case 260: goto L260;
+  case 269: goto L269;
+  case 278: goto L278;
+  case 287: goto L287;
+  case 296: goto L296;
+  case 297: goto L297;
+  case 306: goto L306;
+  case 315: goto L315;
+  case 316: goto L316;
+  case 325: goto L325;
+  case 334: goto L334;
+  case 343: goto L343;
+  case 344: goto L344;
+  case 353: goto L353;
+  case 362: goto L362;
+  case 371: goto L371;
+  case 372: goto L372;
+  case 397: goto L397;
+  case 406: goto L406;
+  case 415: goto L415;
+  case 424: goto L424;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 3);
+ L9:
+  _AOT_NULLP_JUMP_UNLESS(9, L190);
+ L18:
+  _AOT_LOCAL_REF(18, 2);
+ L27:
+  _AOT_NULLP_JUMP_UNLESS(27, L54);
+ L36:
+  _AOT_PUSH(36);
+ L45:
+  _AOT_JUMP(45, L181);
+ L54:
+  _AOT_LOCAL_REF(54, 2);
+ L63:
+  _AOT_EXIT(63);
+  /* FCALL1 */
+ L72:
+  _AOT_PUSH(72);
+ L81:
+  _AOT_PUSH(81);
+ L90:
+  _AOT_EXIT(90);
+  /* MAKE-VECTOR */
+ L91:
+  _AOT_LOCAL_REF(91, 0);
+ L100:
+  _AOT_PUSH(100);
+ L109:
+  _AOT_STACK_REF(109, 3);
+ L118:
+  _AOT_EXIT(118);
+  /* VECTOR-SET */
+ L119:
+  _AOT_LOCAL_REF(119, 1);
+ L128:
+  _AOT_PUSH(128);
+ L137:
+  _AOT_STACK_REF(137, 3);
+ L146:
+  _AOT_EXIT(146);
+  /* VECTOR-SET */
+ L147:
+  _AOT_EXIT(147);
+  /* MAKE-PROCEDURE */
+ L172:
+  _AOT_TAIL_CALL(172, 1);
+ L181:
+  _AOT_JUMP(181, L424);
+ L190:
+  _AOT_LOCAL_REF(190, 2);
+ L199:
+  _AOT_PAIRP_JUMP_UNLESS(199, L260);
+ L208:
+  _AOT_LOCAL_REF(208, 3);
+ L217:
+  _AOT_GLOBAL_KNOWN_REF(217);
+ L226:
+  _AOT_GLOBAL_KNOWN_CALL(226, 2);
+ L251:
+  _AOT_JUMP(251, L269);
+ L260:
+  _AOT_PUSH(260);
+ L269:
+  _AOT_JUMP_UNLESS(269, L415);
+ L278:
+  _AOT_LOCAL_REF(278, 3);
+ L287:
+  _AOT_LOCAL_REF(287, 2);
+ L296:
+  _AOT_CONS(296);
+ L297:
+  _AOT_PUSH(297);
+ L306:
+  _AOT_PUSH(306);
+ L315:
+  _AOT_EXIT(315);
+  /* MAKE-VECTOR */
+ L316:
+  _AOT_LOCAL_REF(316, 0);
+ L325:
+  _AOT_PUSH(325);
+ L334:
+  _AOT_STACK_REF(334, 3);
+ L343:
+  _AOT_EXIT(343);
+  /* VECTOR-SET */
+ L344:
+  _AOT_LOCAL_REF(344, 1);
+ L353:
+  _AOT_PUSH(353);
+ L362:
+  _AOT_STACK_REF(362, 3);
+ L371:
+  _AOT_EXIT(371);
+  /* VECTOR-SET */
+ L372:
+  _AOT_EXIT(372);
+  /* MAKE-PROCEDURE */
+ L397:
+  _AOT_TAIL_CALL(397, 1);
+ L406:
+  _AOT_JUMP(406, L424);
+ L415:
+  _AOT_PUSH(415);
+ L424:
+  _AOT_RET(424);
+  _AOT_EXIT(425);
+}
+
+static const unsigned char sexp_aot_srfi_1_83_shape[] = {
+  22, 3, 0, 0, 0, 0, 0, 0, 0, 90, 180, 0, 0, 0, 0, 0,
+  0, 0, 22, 2, 0, 0, 0, 0, 0, 0, 0, 90, 26, 0, 0, 0,
+  0, 0, 0, 0, 15, 142, 0, 0, 0, 0, 0, 0, 0, 14, 135, 0,
+  0, 0, 0, 0, 0, 0, 22, 2, 0, 0, 0, 0, 0, 0, 0, 8,
+  0, 0, 0, 0, 0, 0, 0, 0, 15, 14, 1, 0, 0, 0, 0, 0,
+  0, 15, 9, 0, 0, 0, 0, 0, 0, 0, 39, 22, 0, 0, 0, 0,
+  0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0,
+  0, 0, 0, 0, 0, 0, 27, 22, 1, 0, 0, 0, 0, 0, 0, 0,
+  15, 5, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0,
+  0, 0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 0, 0,
+  0, 0, 0, 0, 0, 14, 242, 0, 0, 0, 0, 0, 0, 0, 22, 2,
+  0, 0, 0, 0, 0, 0, 0, 91, 60, 0, 0, 0, 0, 0, 0, 0,
+  22, 3, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0,
+  0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 17, 0, 0, 0,
+  0, 0, 0, 0, 15, 14, 0, 0, 0, 0, 0, 0, 0, 13, 145, 0,
+  0, 0, 0, 0, 0, 0, 22, 3, 0, 0, 0, 0, 0, 0, 0, 22,
+  2, 0, 0, 0, 0, 0, 0, 0, 58, 15, 14, 1, 0, 0, 0, 0,
+  0, 0, 15, 9, 0, 0, 0, 0, 0, 0, 0, 39, 22, 0, 0, 0,
+  0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0, 21, 3,
+  0, 0, 0, 0, 0, 0, 0, 27, 22, 1, 0, 0, 0, 0, 0, 0,
+  0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0,
+  0, 0, 0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 0,
+  0, 0, 0, 0, 0, 0, 14, 17, 0, 0, 0, 0, 0, 0, 0, 15,
+  142, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_84 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 2);
+ L9:
+  _AOT_LOCAL_REF(9, 1);
+ L18:
+  _AOT_LOCAL_REF(18, 0);
+ L27:
+  _AOT_GLOBAL_KNOWN_REF(27);
+ L36:
+  _AOT_GLOBAL_KNOWN_REF(36);
+ L45:
+  _AOT_TAIL_CALL(45, 4);
+ L54:
+  _AOT_RET(54);
+  _AOT_EXIT(55);
+}
+
+static const unsigned char sexp_aot_srfi_1_84_shape[] = {
+  22, 2, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0, 0, 0,
+  0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0,
+  0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 5, 17, 0,
+  0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_85 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_CLOSURE_REF(9, 0);
+ L18:
+  _AOT_TAIL_CALL(18, 1);
+ L27:
+  _AOT_RET(27);
+  _AOT_EXIT(28);
+}
+
+static const unsigned char sexp_aot_srfi_1_85_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0,
+  0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_86 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 46: goto L46;
+  case 55: goto L55;
+  case 64: goto L64;
+  case 73: goto L73;
+  case 74: goto L74;
+  case 99: goto L99;
+  case 108: goto L108;
+  case 117: goto L117;
+  case 126: goto L126;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 2);
+ L9:
+  _AOT_LOCAL_REF(9, 1);
+ L18:
+  _AOT_PUSH(18);
+ L27:
+  _AOT_PUSH(27);
+ L36:
+  _AOT_PUSH(36);
+ L45:
+  _AOT_EXIT(45);
+  /* MAKE-VECTOR */
+ L46:
+  _AOT_LOCAL_REF(46, 0);
+ L55:
+  _AOT_PUSH(55);
+ L64:
+  _AOT_STACK_REF(64, 3);
+ L73:
+  _AOT_EXIT(73);
+  /* VECTOR-SET */
+ L74:
+  _AOT_EXIT(74);
+  /* MAKE-PROCEDURE */
+ L99:
+  _AOT_GLOBAL_KNOWN_REF(99);
+ L108:
+  _AOT_GLOBAL_KNOWN_REF(108);
+ L117:
+  _AOT_TAIL_CALL(117, 5);
+ L126:
+  _AOT_RET(126);
+  _AOT_EXIT(127);
+}
+
+static const unsigned char sexp_aot_srfi_1_86_shape[] = {
+  22, 2, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0, 0, 0,
+  0, 0, 15, 14, 0, 0, 0, 0, 0, 0, 0, 15, 14, 1, 0, 0,
+  0, 0, 0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 39, 22, 0,
+  0, 0, 0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0,
+  21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 38, 1, 0, 0, 0, 0,
+  0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0,
+  0, 0, 0, 0, 0, 5, 21, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_87 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 17: goto L17;
+  case 26: goto L26;
+  case 35: goto L35;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 64: goto L64;
+  case 73: goto L73;
+  case 82: goto L82;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF_JUMP_UNLESS(0, 0, L45);
+ L17:
+  _AOT_CLOSURE_REF(17, 2);
+ L26:
+  _AOT_LOCAL_REF(26, 0);
+ L35:
+  _AOT_CONS(35);
+ L36:
+  _AOT_JUMP(36, L54);
+ L45:
+  _AOT_CLOSURE_REF(45, 2);
+ L54:
+  _AOT_CLOSURE_REF(54, 1);
+ L63:
+  _AOT_CDR(63);
+ L64:
+  _AOT_CLOSURE_REF_CDR(64, 0);
+ L73:
+  _AOT_TAIL_CALL(73, 2);
+ L82:
+  _AOT_RET(82);
+  _AOT_EXIT(83);
+}
+
+static const unsigned char sexp_aot_srfi_1_87_shape[] = {
+  84, 0, 0, 0, 0, 0, 0, 0, 0, 36, 0, 0, 0, 0, 0, 0,
+  0, 24, 2, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0,
+  0, 0, 0, 58, 14, 17, 0, 0, 0, 0, 0, 0, 0, 24, 2, 0,
+  0, 0, 0, 0, 0, 0, 24, 1, 0, 0, 0, 0, 0, 0, 0, 55,
+  83, 0, 0, 0, 0, 0, 0, 0, 0, 5, 9, 0, 0, 0, 0, 0,
+  0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_88 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 64: goto L64;
+  case 73: goto L73;
+  case 82: goto L82;
+  case 91: goto L91;
+  case 92: goto L92;
+  case 101: goto L101;
+  case 110: goto L110;
+  case 119: goto L119;
+  case 120: goto L120;
+  case 129: goto L129;
+  case 138: goto L138;
+  case 147: goto L147;
+  case 148: goto L148;
+  case 173: goto L173;
+  case 182: goto L182;
+  case 191: goto L191;
+  case 200: goto L200;
+  case 209: goto L209;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_PAIRP_JUMP_UNLESS(9, L191);
+ L18:
+  _AOT_LOCAL_REF_CAR(18, 0);
+ L27:
+  _AOT_CLOSURE_REF(27, 1);
+ L36:
+  _AOT_CALL(36, 1);
+ L45:
+  _AOT_PUSH(45);
+ L54:
+  _AOT_PUSH(54);
+ L63:
+  _AOT_EXIT(63);
+  /* MAKE-VECTOR */
+ L64:
+  _AOT_CLOSURE_REF(64, 0);
+ L73:
+  _AOT_PUSH(73);
+ L82:
+  _AOT_STACK_REF(82, 3);
+ L91:
+  _AOT_EXIT(91);
+  /* VECTOR-SET */
+ L92:
+  _AOT_LOCAL_REF(92, 0);
+ L101:
+  _AOT_PUSH(101);
+ L110:
+  _AOT_STACK_REF(110, 3);
+ L119:
+  _AOT_EXIT(119);
+  /* VECTOR-SET */
+ L120:
+  _AOT_LOCAL_REF(120, 1);
+ L129:
+  _AOT_PUSH(129);
+ L138:
+  _AOT_STACK_REF(138, 3);
+ L147:
+  _AOT_EXIT(147);
+  /* VECTOR-SET */
+ L148:
+  _AOT_EXIT(148);
+  /* MAKE-PROCEDURE */
+ L173:
+  _AOT_TAIL_CALL(173, 1);
+ L182:
+  _AOT_JUMP(182, L209);
+ L191:
+  _AOT_LOCAL_REF(191, 1);
+ L200:
+  _AOT_EXIT(200);
+  /* FCALL1 */
+ L209:
+  _AOT_RET(209);
+  _AOT_EXIT(210);
+}
+
+static const unsigned char sexp_aot_srfi_1_88_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 91, 181, 0, 0, 0, 0, 0,
+  0, 0, 81, 0, 0, 0, 0, 0, 0, 0, 0, 24, 1, 0, 0, 0,
+  0, 0, 0, 0, 6, 5, 0, 0, 0, 0, 0, 0, 0, 15, 14, 1,
+  0, 0, 0, 0, 0, 0, 15, 13, 0, 0, 0, 0, 0, 0, 0, 39,
+  24, 0, 0, 0, 0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0,
+  0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 22, 0, 0, 0,
+  0, 0, 0, 0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 21, 3,
+  0, 0, 0, 0, 0, 0, 0, 27, 22, 1, 0, 0, 0, 0, 0, 0,
+  0, 15, 9, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0,
+  0, 0, 0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 0,
+  0, 0, 0, 0, 0, 0, 14, 26, 0, 0, 0, 0, 0, 0, 0, 22,
+  1, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0,
+  0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_89 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 46: goto L46;
+  case 55: goto L55;
+  case 64: goto L64;
+  case 73: goto L73;
+  case 74: goto L74;
+  case 99: goto L99;
+  case 108: goto L108;
+  case 117: goto L117;
+  case 126: goto L126;
+  case 135: goto L135;
+  case 144: goto L144;
+  case 153: goto L153;
+  case 178: goto L178;
+  case 187: goto L187;
+  case 196: goto L196;
+  case 205: goto L205;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 2);
+ L9:
+  _AOT_NULLP_JUMP_UNLESS(9, L117);
+ L18:
+  _AOT_LOCAL_REF(18, 1);
+ L27:
+  _AOT_PUSH(27);
+ L36:
+  _AOT_PUSH(36);
+ L45:
+  _AOT_EXIT(45);
+  /* MAKE-VECTOR */
+ L46:
+  _AOT_LOCAL_REF(46, 0);
+ L55:
+  _AOT_PUSH(55);
+ L64:
+  _AOT_STACK_REF(64, 3);
+ L73:
+  _AOT_EXIT(73);
+  /* VECTOR-SET */
+ L74:
+  _AOT_EXIT(74);
+  /* MAKE-PROCEDURE */
+ L99:
+  _AOT_TAIL_CALL(99, 1);
+ L108:
+  _AOT_JUMP(108, L205);
+ L117:
+  _AOT_LOCAL_REF(117, 2);
+ L126:
+  _AOT_LOCAL_REF(126, 1);
+ L135:
+  _AOT_LOCAL_REF(135, 0);
+ L144:
+  _AOT_GLOBAL_KNOWN_REF(144);
+ L153:
+  _AOT_GLOBAL_KNOWN_CALL(153, 4);
+ L178:
+  _AOT_PUSH(178);
+ L187:
+  _AOT_GLOBAL_REF(187);
+ L196:
+  _AOT_TAIL_CALL(196, 2);
+ L205:
+  _AOT_RET(205);
+  _AOT_EXIT(206);
+}
+
+static const unsigned char sexp_aot_srfi_1_89_shape[] = {
+  22, 2, 0, 0, 0, 0, 0, 0, 0, 90, 107, 0, 0, 0, 0, 0,
+  0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 15, 14, 1, 0, 0,
+  0, 0, 0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 39, 22, 0,
+  0, 0, 0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0,
+  21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 38, 1, 0, 0, 0, 0,
+  0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 14, 96, 0, 0,
+  0, 0, 0, 0, 0, 22, 2, 0, 0, 0, 0, 0, 0, 0, 22, 1,
+  0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0,
+  19, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0,
+  0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 9, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_90 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 64: goto L64;
+  case 73: goto L73;
+  case 82: goto L82;
+  case 91: goto L91;
+  case 100: goto L100;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 1);
+ L9:
+  _AOT_LOCAL_REF(9, 0);
+ L18:
+  _AOT_EQ_JUMP_UNLESS(18, L45);
+ L27:
+  _AOT_LOCAL_REF(27, 2);
+ L36:
+  _AOT_JUMP(36, L100);
+ L45:
+  _AOT_LOCAL_REF(45, 2);
+ L54:
+  _AOT_LOCAL_REF_CAR(54, 0);
+ L63:
+  _AOT_CONS(63);
+ L64:
+  _AOT_LOCAL_REF(64, 1);
+ L73:
+  _AOT_LOCAL_REF_CDR(73, 0);
+ L82:
+  _AOT_GLOBAL_KNOWN_REF(82);
+ L91:
+  _AOT_TAIL_CALL(91, 3);
+ L100:
+  _AOT_RET(100);
+  _AOT_EXIT(101);
+}
+
+static const unsigned char sexp_aot_srfi_1_90_shape[] = {
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 89, 26, 0, 0, 0, 0, 0, 0, 0, 22, 2, 0, 0, 0,
+  0, 0, 0, 0, 14, 63, 0, 0, 0, 0, 0, 0, 0, 22, 2, 0,
+  0, 0, 0, 0, 0, 0, 81, 0, 0, 0, 0, 0, 0, 0, 0, 58,
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 82, 0, 0, 0, 0, 0, 0,
+  0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 5, 13, 0, 0, 0,
+  0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_91 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 17: goto L17;
+  case 26: goto L26;
+  case 35: goto L35;
+  case 44: goto L44;
+  case 69: goto L69;
+  case 78: goto L78;
+  case 87: goto L87;
+  case 96: goto L96;
+  case 105: goto L105;
+  case 114: goto L114;
+  case 123: goto L123;
+  case 132: goto L132;
+  case 141: goto L141;
+  case 150: goto L150;
+  case 159: goto L159;
+  case 168: goto L168;
+  case 177: goto L177;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF_JUMP_UNLESS(0, 0, L105);
+ L17:
+  _AOT_CLOSURE_REF(17, 2);
+ L26:
+  _AOT_LOCAL_REF(26, 0);
+ L35:
+  _AOT_CLOSURE_REF(35, 1);
+ L44:
+  _AOT_GLOBAL_KNOWN_CALL(44, 3);
+ L69:
+  _AOT_LOCAL_REF_CDR(69, 0);
+ L78:
+  _AOT_CLOSURE_REF_CDR(78, 0);
+ L87:
+  _AOT_TAIL_CALL(87, 2);
+ L96:
+  _AOT_JUMP(96, L177);
+ L105:
+  _AOT_CLOSURE_REF(105, 2);
+ L114:
+  _AOT_PAIRP_JUMP_UNLESS(114, L168);
+ L123:
+  _AOT_CLOSURE_REF(123, 1);
+ L132:
+  _AOT_CLOSURE_REF(132, 2);
+ L141:
+  _AOT_GLOBAL_KNOWN_REF(141);
+ L150:
+  _AOT_TAIL_CALL(150, 2);
+ L159:
+  _AOT_JUMP(159, L177);
+ L168:
+  _AOT_CLOSURE_REF(168, 1);
+ L177:
+  _AOT_RET(177);
+  _AOT_EXIT(178);
+}
+
+static const unsigned char sexp_aot_srfi_1_91_shape[] = {
+  84, 0, 0, 0, 0, 0, 0, 0, 0, 96, 0, 0, 0, 0, 0, 0,
+  0, 24, 2, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0,
+  0, 0, 0, 24, 1, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0,
+  0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 82, 0, 0, 0, 0, 0, 0, 0, 0, 83, 0,
+  0, 0, 0, 0, 0, 0, 0, 5, 9, 0, 0, 0, 0, 0, 0, 0,
+  14, 80, 0, 0, 0, 0, 0, 0, 0, 24, 2, 0, 0, 0, 0, 0,
+  0, 0, 91, 53, 0, 0, 0, 0, 0, 0, 0, 24, 1, 0, 0, 0,
+  0, 0, 0, 0, 24, 2, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0,
+  0, 0, 0, 0, 0, 0, 5, 9, 0, 0, 0, 0, 0, 0, 0, 14,
+  17, 0, 0, 0, 0, 0, 0, 0, 24, 1, 0, 0, 0, 0, 0, 0,
+  0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_92 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 43: goto L43;
+  case 52: goto L52;
+  case 61: goto L61;
+  case 62: goto L62;
+  case 71: goto L71;
+  case 80: goto L80;
+  case 89: goto L89;
+  case 90: goto L90;
+  case 99: goto L99;
+  case 108: goto L108;
+  case 117: goto L117;
+  case 118: goto L118;
+  case 127: goto L127;
+  case 136: goto L136;
+  case 145: goto L145;
+  case 146: goto L146;
+  case 171: goto L171;
+  case 180: goto L180;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_CLOSURE_REF(9, 1);
+ L18:
+  _AOT_GLOBAL_KNOWN_CALL(18, 2);
+ L43:
+  _AOT_PUSH(43);
+ L52:
+  _AOT_PUSH(52);
+ L61:
+  _AOT_EXIT(61);
+  /* MAKE-VECTOR */
+ L62:
+  _AOT_CLOSURE_REF(62, 0);
+ L71:
+  _AOT_PUSH(71);
+ L80:
+  _AOT_STACK_REF(80, 3);
+ L89:
+  _AOT_EXIT(89);
+  /* VECTOR-SET */
+ L90:
+  _AOT_LOCAL_REF(90, 0);
+ L99:
+  _AOT_PUSH(99);
+ L108:
+  _AOT_STACK_REF(108, 3);
+ L117:
+  _AOT_EXIT(117);
+  /* VECTOR-SET */
+ L118:
+  _AOT_LOCAL_REF(118, 1);
+ L127:
+  _AOT_PUSH(127);
+ L136:
+  _AOT_STACK_REF(136, 3);
+ L145:
+  _AOT_EXIT(145);
+  /* VECTOR-SET */
+ L146:
+  _AOT_EXIT(146);
+  /* MAKE-PROCEDURE */
+ L171:
+  _AOT_TAIL_CALL(171, 1);
+ L180:
+  _AOT_RET(180);
+  _AOT_EXIT(181);
+}
+
+static const unsigned char sexp_aot_srfi_1_92_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 24, 1, 0, 0, 0, 0, 0,
+  0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 14, 1, 0, 0,
+  0, 0, 0, 0, 15, 13, 0, 0, 0, 0, 0, 0, 0, 39, 24, 0,
+  0, 0, 0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0,
+  21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 22, 0, 0, 0, 0, 0,
+  0, 0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0,
+  0, 0, 0, 0, 0, 27, 22, 1, 0, 0, 0, 0, 0, 0, 0, 15,
+  9, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0,
+  0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0,
+  0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_93 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 81: goto L81;
+  case 90: goto L90;
+  case 99: goto L99;
+  case 108: goto L108;
+  case 117: goto L117;
+  case 126: goto L126;
+  case 135: goto L135;
+  case 144: goto L144;
+  case 145: goto L145;
+  case 154: goto L154;
+  case 163: goto L163;
+  case 172: goto L172;
+  case 181: goto L181;
+  case 190: goto L190;
+  case 199: goto L199;
+  case 200: goto L200;
+  case 209: goto L209;
+  case 218: goto L218;
+  case 227: goto L227;
+  case 236: goto L236;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_NULLP_JUMP_UNLESS(9, L81);
+ L18:
+  _AOT_LOCAL_REF(18, 2);
+ L27:
+  _AOT_EXIT(27);
+  /* FCALL1 */
+ L36:
+  _AOT_LOCAL_REF(36, 1);
+ L45:
+  _AOT_EXIT(45);
+  /* FCALL1 */
+ L54:
+  _AOT_GLOBAL_KNOWN_REF(54);
+ L63:
+  _AOT_TAIL_CALL(63, 2);
+ L72:
+  _AOT_JUMP(72, L236);
+ L81:
+  _AOT_LOCAL_REF_CAR(81, 0);
+ L90:
+  _AOT_CLOSURE_REF(90, 0);
+ L99:
+  _AOT_CALL(99, 1);
+ L108:
+  _AOT_JUMP_UNLESS(108, L181);
+ L117:
+  _AOT_LOCAL_REF(117, 2);
+ L126:
+  _AOT_LOCAL_REF(126, 1);
+ L135:
+  _AOT_LOCAL_REF_CAR(135, 0);
+ L144:
+  _AOT_CONS(144);
+ L145:
+  _AOT_LOCAL_REF_CDR(145, 0);
+ L154:
+  _AOT_CLOSURE_REF_CDR(154, 1);
+ L163:
+  _AOT_TAIL_CALL(163, 3);
+ L172:
+  _AOT_JUMP(172, L236);
+ L181:
+  _AOT_LOCAL_REF(181, 2);
+ L190:
+  _AOT_LOCAL_REF_CAR(190, 0);
+ L199:
+  _AOT_CONS(199);
+ L200:
+  _AOT_LOCAL_REF(200, 1);
+ L209:
+  _AOT_LOCAL_REF_CDR(209, 0);
+ L218:
+  _AOT_CLOSURE_REF_CDR(218, 1);
+ L227:
+  _AOT_TAIL_CALL(227, 3);
+ L236:
+  _AOT_RET(236);
+  _AOT_EXIT(237);
+}
+
+static const unsigned char sexp_aot_srfi_1_93_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 90, 71, 0, 0, 0, 0, 0,
+  0, 0, 22, 2, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0,
+  0, 0, 0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0,
+  0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+  9, 0, 0, 0, 0, 0, 0, 0, 14, 163, 0, 0, 0, 0, 0, 0,
+  0, 81, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0,
+  0, 0, 0, 6, 5, 0, 0, 0, 0, 0, 0, 0, 13, 72, 0, 0,
+  0, 0, 0, 0, 0, 22, 2, 0, 0, 0, 0, 0, 0, 0, 22, 1,
+  0, 0, 0, 0, 0, 0, 0, 81, 0, 0, 0, 0, 0, 0, 0, 0,
+  58, 82, 0, 0, 0, 0, 0, 0, 0, 0, 83, 1, 0, 0, 0, 0,
+  0, 0, 0, 5, 13, 0, 0, 0, 0, 0, 0, 0, 14, 63, 0, 0,
+  0, 0, 0, 0, 0, 22, 2, 0, 0, 0, 0, 0, 0, 0, 81, 0,
+  0, 0, 0, 0, 0, 0, 0, 58, 22, 1, 0, 0, 0, 0, 0, 0,
+  0, 82, 0, 0, 0, 0, 0, 0, 0, 0, 83, 1, 0, 0, 0, 0,
+  0, 0, 0, 5, 13, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_94 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_CLOSURE_REF(9, 1);
+ L18:
+  _AOT_CLOSURE_REF(18, 0);
+ L27:
+  _AOT_TAIL_CALL(27, 2);
+ L36:
+  _AOT_RET(36);
+  _AOT_EXIT(37);
+}
+
+static const unsigned char sexp_aot_srfi_1_94_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 24, 1, 0, 0, 0, 0, 0,
+  0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 5, 9, 0, 0, 0,
+  0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_95 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 46: goto L46;
+  case 55: goto L55;
+  case 64: goto L64;
+  case 73: goto L73;
+  case 74: goto L74;
+  case 83: goto L83;
+  case 92: goto L92;
+  case 101: goto L101;
+  case 102: goto L102;
+  case 111: goto L111;
+  case 120: goto L120;
+  case 129: goto L129;
+  case 130: goto L130;
+  case 155: goto L155;
+  case 164: goto L164;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_CLOSURE_REF(9, 1);
+ L18:
+  _AOT_EXIT(18);
+  /* FCALL2 */
+ L27:
+  _AOT_PUSH(27);
+ L36:
+  _AOT_PUSH(36);
+ L45:
+  _AOT_EXIT(45);
+  /* MAKE-VECTOR */
+ L46:
+  _AOT_CLOSURE_REF(46, 0);
+ L55:
+  _AOT_PUSH(55);
+ L64:
+  _AOT_STACK_REF(64, 3);
+ L73:
+  _AOT_EXIT(73);
+  /* VECTOR-SET */
+ L74:
+  _AOT_LOCAL_REF(74, 0);
+ L83:
+  _AOT_PUSH(83);
+ L92:
+  _AOT_STACK_REF(92, 3);
+ L101:
+  _AOT_EXIT(101);
+  /* VECTOR-SET */
+ L102:
+  _AOT_LOCAL_REF(102, 1);
+ L111:
+  _AOT_PUSH(111);
+ L120:
+  _AOT_STACK_REF(120, 3);
+ L129:
+  _AOT_EXIT(129);
+  /* VECTOR-SET */
+ L130:
+  _AOT_EXIT(130);
+  /* MAKE-PROCEDURE */
+ L155:
+  _AOT_TAIL_CALL(155, 1);
+ L164:
+  _AOT_RET(164);
+  _AOT_EXIT(165);
+}
+
+static const unsigned char sexp_aot_srfi_1_95_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 24, 1, 0, 0, 0, 0, 0,
+  0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 15, 14, 1, 0, 0,
+  0, 0, 0, 0, 15, 13, 0, 0, 0, 0, 0, 0, 0, 39, 24, 0,
+  0, 0, 0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0,
+  21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 22, 0, 0, 0, 0, 0,
+  0, 0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0,
+  0, 0, 0, 0, 0, 27, 22, 1, 0, 0, 0, 0, 0, 0, 0, 15,
+  9, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0,
+  0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0,
+  0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_96 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 55: goto L55;
+  case 64: goto L64;
+  case 73: goto L73;
+  case 82: goto L82;
+  case 83: goto L83;
+  case 108: goto L108;
+  case 117: goto L117;
+  case 126: goto L126;
+  case 135: goto L135;
+  case 144: goto L144;
+  case 153: goto L153;
+  case 154: goto L154;
+  case 163: goto L163;
+  case 172: goto L172;
+  case 181: goto L181;
+  case 182: goto L182;
+  case 191: goto L191;
+  case 200: goto L200;
+  case 209: goto L209;
+  case 210: goto L210;
+  case 235: goto L235;
+  case 244: goto L244;
+  case 253: goto L253;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_GLOBAL_KNOWN_REF(0);
+ L9:
+  _AOT_LOCAL_REF(9, 0);
+ L18:
+  _AOT_EQ_JUMP_UNLESS(18, L126);
+ L27:
+  _AOT_CLOSURE_REF(27, 1);
+ L36:
+  _AOT_PUSH(36);
+ L45:
+  _AOT_PUSH(45);
+ L54:
+  _AOT_EXIT(54);
+  /* MAKE-VECTOR */
+ L55:
+  _AOT_CLOSURE_REF(55, 0);
+ L64:
+  _AOT_PUSH(64);
+ L73:
+  _AOT_STACK_REF(73, 3);
+ L82:
+  _AOT_EXIT(82);
+  /* VECTOR-SET */
+ L83:
+  _AOT_EXIT(83);
+  /* MAKE-PROCEDURE */
+ L108:
+  _AOT_TAIL_CALL(108, 1);
+ L117:
+  _AOT_JUMP(117, L253);
+ L126:
+  _AOT_CLOSURE_REF(126, 1);
+ L135:
+  _AOT_PUSH(135);
+ L144:
+  _AOT_PUSH(144);
+ L153:
+  _AOT_EXIT(153);
+  /* MAKE-VECTOR */
+ L154:
+  _AOT_LOCAL_REF(154, 0);
+ L163:
+  _AOT_PUSH(163);
+ L172:
+  _AOT_STACK_REF(172, 3);
+ L181:
+  _AOT_EXIT(181);
+  /* VECTOR-SET */
+ L182:
+  _AOT_CLOSURE_REF(182, 0);
+ L191:
+  _AOT_PUSH(191);
+ L200:
+  _AOT_STACK_REF(200, 3);
+ L209:
+  _AOT_EXIT(209);
+  /* VECTOR-SET */
+ L210:
+  _AOT_EXIT(210);
+  /* MAKE-PROCEDURE */
+ L235:
+  _AOT_GLOBAL_KNOWN_REF(235);
+ L244:
+  _AOT_TAIL_CALL(244, 2);
+ L253:
+  _AOT_RET(253);
+  _AOT_EXIT(254);
+}
+
+static const unsigned char sexp_aot_srfi_1_96_shape[] = {
+  19, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 89, 107, 0, 0, 0, 0, 0, 0, 0, 24, 1, 0, 0, 0,
+  0, 0, 0, 0, 15, 14, 1, 0, 0, 0, 0, 0, 0, 15, 5, 0,
+  0, 0, 0, 0, 0, 0, 39, 24, 0, 0, 0, 0, 0, 0, 0, 0,
+  15, 1, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0,
+  0, 0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 0, 0,
+  0, 0, 0, 0, 0, 14, 135, 0, 0, 0, 0, 0, 0, 0, 24, 1,
+  0, 0, 0, 0, 0, 0, 0, 15, 14, 1, 0, 0, 0, 0, 0, 0,
+  15, 9, 0, 0, 0, 0, 0, 0, 0, 39, 22, 0, 0, 0, 0, 0,
+  0, 0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0,
+  0, 0, 0, 0, 0, 27, 24, 0, 0, 0, 0, 0, 0, 0, 0, 15,
+  5, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0,
+  0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 9, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_97 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 64: goto L64;
+  case 73: goto L73;
+  case 82: goto L82;
+  case 91: goto L91;
+  case 92: goto L92;
+  case 101: goto L101;
+  case 110: goto L110;
+  case 119: goto L119;
+  case 120: goto L120;
+  case 145: goto L145;
+  case 154: goto L154;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 2);
+ L9:
+  _AOT_PAIRP_JUMP_UNLESS(9, L36);
+ L18:
+  _AOT_LOCAL_REF_CAR(18, 2);
+ L27:
+  _AOT_JUMP(27, L45);
+ L36:
+  _AOT_GLOBAL_KNOWN_REF(36);
+ L45:
+  _AOT_PUSH(45);
+ L54:
+  _AOT_PUSH(54);
+ L63:
+  _AOT_EXIT(63);
+  /* MAKE-VECTOR */
+ L64:
+  _AOT_LOCAL_REF(64, 0);
+ L73:
+  _AOT_PUSH(73);
+ L82:
+  _AOT_STACK_REF(82, 3);
+ L91:
+  _AOT_EXIT(91);
+  /* VECTOR-SET */
+ L92:
+  _AOT_LOCAL_REF(92, 1);
+ L101:
+  _AOT_PUSH(101);
+ L110:
+  _AOT_STACK_REF(110, 3);
+ L119:
+  _AOT_EXIT(119);
+  /* VECTOR-SET */
+ L120:
+  _AOT_EXIT(120);
+  /* MAKE-PROCEDURE */
+ L145:
+  _AOT_TAIL_CALL(145, 1);
+ L154:
+  _AOT_RET(154);
+  _AOT_EXIT(155);
+}
+
+static const unsigned char sexp_aot_srfi_1_97_shape[] = {
+  22, 2, 0, 0, 0, 0, 0, 0, 0, 91, 26, 0, 0, 0, 0, 0,
+  0, 0, 81, 2, 0, 0, 0, 0, 0, 0, 0, 14, 17, 0, 0, 0,
+  0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 15, 14, 1,
+  0, 0, 0, 0, 0, 0, 15, 9, 0, 0, 0, 0, 0, 0, 0, 39,
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0,
+  0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 22, 1, 0, 0,
+  0, 0, 0, 0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 21, 3,
+  0, 0, 0, 0, 0, 0, 0, 27, 38, 1, 0, 0, 0, 0, 0, 0,
+  0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_98 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 70: goto L70;
+  case 79: goto L79;
+  case 88: goto L88;
+  case 97: goto L97;
+  case 106: goto L106;
+  case 115: goto L115;
+  case 116: goto L116;
+  case 125: goto L125;
+  case 134: goto L134;
+  case 143: goto L143;
+  case 152: goto L152;
+  case 161: goto L161;
+  case 170: goto L170;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_PAIRP_JUMP_UNLESS(9, L152);
+ L18:
+  _AOT_CLOSURE_REF(18, 1);
+ L27:
+  _AOT_LOCAL_REF(27, 1);
+ L36:
+  _AOT_LOCAL_REF_CAR(36, 0);
+ L45:
+  _AOT_GLOBAL_KNOWN_CALL(45, 3);
+ L70:
+  _AOT_JUMP_UNLESS(70, L97);
+ L79:
+  _AOT_LOCAL_REF(79, 1);
+ L88:
+  _AOT_JUMP(88, L116);
+ L97:
+  _AOT_LOCAL_REF(97, 1);
+ L106:
+  _AOT_LOCAL_REF_CAR(106, 0);
+ L115:
+  _AOT_CONS(115);
+ L116:
+  _AOT_LOCAL_REF_CDR(116, 0);
+ L125:
+  _AOT_CLOSURE_REF_CDR(125, 0);
+ L134:
+  _AOT_TAIL_CALL(134, 2);
+ L143:
+  _AOT_JUMP(143, L170);
+ L152:
+  _AOT_LOCAL_REF(152, 1);
+ L161:
+  _AOT_EXIT(161);
+  /* FCALL1 */
+ L170:
+  _AOT_RET(170);
+  _AOT_EXIT(171);
+}
+
+static const unsigned char sexp_aot_srfi_1_98_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 91, 142, 0, 0, 0, 0, 0,
+  0, 0, 24, 1, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0,
+  0, 0, 0, 0, 81, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0,
+  0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 13, 26, 0, 0, 0, 0, 0, 0, 0, 22,
+  1, 0, 0, 0, 0, 0, 0, 0, 14, 27, 0, 0, 0, 0, 0, 0,
+  0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 81, 0, 0, 0, 0, 0,
+  0, 0, 0, 58, 82, 0, 0, 0, 0, 0, 0, 0, 0, 83, 0, 0,
+  0, 0, 0, 0, 0, 0, 5, 9, 0, 0, 0, 0, 0, 0, 0, 14,
+  26, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0, 0, 0, 0,
+  0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_99 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 64: goto L64;
+  case 73: goto L73;
+  case 82: goto L82;
+  case 91: goto L91;
+  case 92: goto L92;
+  case 117: goto L117;
+  case 126: goto L126;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 1);
+ L9:
+  _AOT_PAIRP_JUMP_UNLESS(9, L36);
+ L18:
+  _AOT_LOCAL_REF_CAR(18, 1);
+ L27:
+  _AOT_JUMP(27, L45);
+ L36:
+  _AOT_GLOBAL_KNOWN_REF(36);
+ L45:
+  _AOT_PUSH(45);
+ L54:
+  _AOT_PUSH(54);
+ L63:
+  _AOT_EXIT(63);
+  /* MAKE-VECTOR */
+ L64:
+  _AOT_LOCAL_REF(64, 0);
+ L73:
+  _AOT_PUSH(73);
+ L82:
+  _AOT_STACK_REF(82, 3);
+ L91:
+  _AOT_EXIT(91);
+  /* VECTOR-SET */
+ L92:
+  _AOT_EXIT(92);
+  /* MAKE-PROCEDURE */
+ L117:
+  _AOT_TAIL_CALL(117, 1);
+ L126:
+  _AOT_RET(126);
+  _AOT_EXIT(127);
+}
+
+static const unsigned char sexp_aot_srfi_1_99_shape[] = {
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 91, 26, 0, 0, 0, 0, 0,
+  0, 0, 81, 1, 0, 0, 0, 0, 0, 0, 0, 14, 17, 0, 0, 0,
+  0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 15, 14, 1,
+  0, 0, 0, 0, 0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 39,
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0,
+  0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 38, 1, 0, 0,
+  0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_100 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 28: goto L28;
+  case 29: goto L29;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 2);
+ L9:
+  _AOT_LOCAL_REF(9, 1);
+ L18:
+  _AOT_LOCAL_REF(18, 0);
+ L27:
+  _AOT_CONS(27);
+ L28:
+  _AOT_CONS(28);
+ L29:
+  _AOT_RET(29);
+  _AOT_EXIT(30);
+}
+
+static const unsigned char sexp_aot_srfi_1_100_shape[] = {
+  22, 2, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0, 0, 0,
+  0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 58, 58, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_101 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 19: goto L19;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF_CDR(0, 0);
+ L9:
+  _AOT_LOCAL_REF_CAR(9, 0);
+ L18:
+  _AOT_CONS(18);
+ L19:
+  _AOT_RET(19);
+  _AOT_EXIT(20);
+}
+
+static const unsigned char sexp_aot_srfi_1_101_shape[] = {
+  82, 0, 0, 0, 0, 0, 0, 0, 0, 81, 0, 0, 0, 0, 0, 0,
+  0, 0, 58, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_102 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_PUSH(9);
+ L18:
+  _AOT_GLOBAL_KNOWN_REF(18);
+ L27:
+  _AOT_TAIL_CALL(27, 2);
+ L36:
+  _AOT_RET(36);
+  _AOT_EXIT(37);
+}
+
+static const unsigned char sexp_aot_srfi_1_102_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0,
+  0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 5, 9, 0, 0, 0,
+  0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_103 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_CLOSURE_REF(0, 1);
+ L9:
+  _AOT_LOCAL_REF_CAR(9, 0);
+ L18:
+  _AOT_CLOSURE_REF(18, 0);
+ L27:
+  _AOT_TAIL_CALL(27, 2);
+ L36:
+  _AOT_RET(36);
+  _AOT_EXIT(37);
+}
+
+static const unsigned char sexp_aot_srfi_1_103_shape[] = {
+  24, 1, 0, 0, 0, 0, 0, 0, 0, 81, 0, 0, 0, 0, 0, 0,
+  0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 5, 9, 0, 0, 0,
+  0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_104 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 28: goto L28;
+  case 37: goto L37;
+  case 46: goto L46;
+  case 55: goto L55;
+  case 56: goto L56;
+  case 65: goto L65;
+  case 74: goto L74;
+  case 83: goto L83;
+  case 84: goto L84;
+  case 109: goto L109;
+  case 118: goto L118;
+  case 127: goto L127;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_CLOSURE_REF(0, 1);
+ L9:
+  _AOT_PUSH(9);
+ L18:
+  _AOT_PUSH(18);
+ L27:
+  _AOT_EXIT(27);
+  /* MAKE-VECTOR */
+ L28:
+  _AOT_LOCAL_REF(28, 0);
+ L37:
+  _AOT_PUSH(37);
+ L46:
+  _AOT_STACK_REF(46, 3);
+ L55:
+  _AOT_EXIT(55);
+  /* VECTOR-SET */
+ L56:
+  _AOT_CLOSURE_REF(56, 0);
+ L65:
+  _AOT_PUSH(65);
+ L74:
+  _AOT_STACK_REF(74, 3);
+ L83:
+  _AOT_EXIT(83);
+  /* VECTOR-SET */
+ L84:
+  _AOT_EXIT(84);
+  /* MAKE-PROCEDURE */
+ L109:
+  _AOT_GLOBAL_KNOWN_REF(109);
+ L118:
+  _AOT_TAIL_CALL(118, 2);
+ L127:
+  _AOT_RET(127);
+  _AOT_EXIT(128);
+}
+
+static const unsigned char sexp_aot_srfi_1_104_shape[] = {
+  24, 1, 0, 0, 0, 0, 0, 0, 0, 15, 14, 1, 0, 0, 0, 0,
+  0, 0, 15, 9, 0, 0, 0, 0, 0, 0, 0, 39, 22, 0, 0, 0,
+  0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0, 21, 3,
+  0, 0, 0, 0, 0, 0, 0, 27, 24, 0, 0, 0, 0, 0, 0, 0,
+  0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0,
+  0, 0, 0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0,
+  0, 0, 0, 0, 0, 0, 5, 9, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_105 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 46: goto L46;
+  case 71: goto L71;
+  case 80: goto L80;
+  case 89: goto L89;
+  case 98: goto L98;
+  case 107: goto L107;
+  case 116: goto L116;
+  case 125: goto L125;
+  case 134: goto L134;
+  case 143: goto L143;
+  case 144: goto L144;
+  case 153: goto L153;
+  case 162: goto L162;
+  case 171: goto L171;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_PAIRP_JUMP_UNLESS(9, L134);
+ L18:
+  _AOT_CLOSURE_REF(18, 2);
+ L27:
+  _AOT_CLOSURE_REF(27, 1);
+ L36:
+  _AOT_CLOSURE_REF(36, 0);
+ L45:
+  _AOT_CAR(45);
+ L46:
+  _AOT_GLOBAL_KNOWN_CALL(46, 3);
+ L71:
+  _AOT_JUMP_UNLESS(71, L116);
+ L80:
+  _AOT_LOCAL_REF_CDR(80, 0);
+ L89:
+  _AOT_CLOSURE_REF_CDR(89, 3);
+ L98:
+  _AOT_TAIL_CALL(98, 1);
+ L107:
+  _AOT_JUMP(107, L125);
+ L116:
+  _AOT_PUSH(116);
+ L125:
+  _AOT_JUMP(125, L171);
+ L134:
+  _AOT_CLOSURE_REF(134, 5);
+ L143:
+  _AOT_CDR(143);
+ L144:
+  _AOT_CLOSURE_REF(144, 1);
+ L153:
+  _AOT_CLOSURE_REF_CDR(153, 4);
+ L162:
+  _AOT_TAIL_CALL(162, 2);
+ L171:
+  _AOT_RET(171);
+  _AOT_EXIT(172);
+}
+
+static const unsigned char sexp_aot_srfi_1_105_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 91, 124, 0, 0, 0, 0, 0,
+  0, 0, 24, 2, 0, 0, 0, 0, 0, 0, 0, 24, 1, 0, 0, 0,
+  0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 54, 85, 0,
+  0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 13, 44, 0, 0, 0, 0, 0, 0, 0,
+  82, 0, 0, 0, 0, 0, 0, 0, 0, 83, 3, 0, 0, 0, 0, 0,
+  0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 14, 17, 0, 0, 0,
+  0, 0, 0, 0, 15, 14, 0, 0, 0, 0, 0, 0, 0, 14, 45, 0,
+  0, 0, 0, 0, 0, 0, 24, 5, 0, 0, 0, 0, 0, 0, 0, 55,
+  24, 1, 0, 0, 0, 0, 0, 0, 0, 83, 4, 0, 0, 0, 0, 0,
+  0, 0, 5, 9, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_106 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 64: goto L64;
+  case 73: goto L73;
+  case 82: goto L82;
+  case 91: goto L91;
+  case 92: goto L92;
+  case 101: goto L101;
+  case 110: goto L110;
+  case 119: goto L119;
+  case 120: goto L120;
+  case 129: goto L129;
+  case 138: goto L138;
+  case 147: goto L147;
+  case 148: goto L148;
+  case 157: goto L157;
+  case 166: goto L166;
+  case 175: goto L175;
+  case 176: goto L176;
+  case 201: goto L201;
+  case 210: goto L210;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 1);
+ L9:
+  _AOT_NULLP_JUMP_UNLESS(9, L36);
+ L18:
+  _AOT_PUSH(18);
+ L27:
+  _AOT_JUMP(27, L210);
+ L36:
+  _AOT_LOCAL_REF_CAR(36, 1);
+ L45:
+  _AOT_PUSH(45);
+ L54:
+  _AOT_PUSH(54);
+ L63:
+  _AOT_EXIT(63);
+  /* MAKE-VECTOR */
+ L64:
+  _AOT_LOCAL_REF(64, 1);
+ L73:
+  _AOT_PUSH(73);
+ L82:
+  _AOT_STACK_REF(82, 3);
+ L91:
+  _AOT_EXIT(91);
+  /* VECTOR-SET */
+ L92:
+  _AOT_CLOSURE_REF(92, 0);
+ L101:
+  _AOT_PUSH(101);
+ L110:
+  _AOT_STACK_REF(110, 3);
+ L119:
+  _AOT_EXIT(119);
+  /* VECTOR-SET */
+ L120:
+  _AOT_CLOSURE_REF(120, 1);
+ L129:
+  _AOT_PUSH(129);
+ L138:
+  _AOT_STACK_REF(138, 3);
+ L147:
+  _AOT_EXIT(147);
+  /* VECTOR-SET */
+ L148:
+  _AOT_LOCAL_REF(148, 0);
+ L157:
+  _AOT_PUSH(157);
+ L166:
+  _AOT_STACK_REF(166, 3);
+ L175:
+  _AOT_EXIT(175);
+  /* VECTOR-SET */
+ L176:
+  _AOT_EXIT(176);
+  /* MAKE-PROCEDURE */
+ L201:
+  _AOT_TAIL_CALL(201, 1);
+ L210:
+  _AOT_RET(210);
+  _AOT_EXIT(211);
+}
+
+static const unsigned char sexp_aot_srfi_1_106_shape[] = {
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 90, 26, 0, 0, 0, 0, 0,
+  0, 0, 15, 78, 0, 0, 0, 0, 0, 0, 0, 14, 182, 0, 0, 0,
+  0, 0, 0, 0, 81, 1, 0, 0, 0, 0, 0, 0, 0, 15, 14, 1,
+  0, 0, 0, 0, 0, 0, 15, 17, 0, 0, 0, 0, 0, 0, 0, 39,
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0,
+  0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 24, 0, 0, 0,
+  0, 0, 0, 0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 21, 3,
+  0, 0, 0, 0, 0, 0, 0, 27, 24, 1, 0, 0, 0, 0, 0, 0,
+  0, 15, 9, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0,
+  0, 0, 0, 27, 22, 0, 0, 0, 0, 0, 0, 0, 0, 15, 13, 0,
+  0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27,
+  38, 1, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 0,
+  0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_107 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 73: goto L73;
+  case 82: goto L82;
+  case 91: goto L91;
+  case 100: goto L100;
+  case 101: goto L101;
+  case 126: goto L126;
+  case 135: goto L135;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 1);
+ L9:
+  _AOT_NULLP_JUMP_UNLESS(9, L36);
+ L18:
+  _AOT_PUSH(18);
+ L27:
+  _AOT_JUMP(27, L135);
+ L36:
+  _AOT_LOCAL_REF_CDR(36, 1);
+ L45:
+  _AOT_LOCAL_REF_CAR(45, 1);
+ L54:
+  _AOT_PUSH(54);
+ L63:
+  _AOT_PUSH(63);
+ L72:
+  _AOT_EXIT(72);
+  /* MAKE-VECTOR */
+ L73:
+  _AOT_LOCAL_REF(73, 0);
+ L82:
+  _AOT_PUSH(82);
+ L91:
+  _AOT_STACK_REF(91, 3);
+ L100:
+  _AOT_EXIT(100);
+  /* VECTOR-SET */
+ L101:
+  _AOT_EXIT(101);
+  /* MAKE-PROCEDURE */
+ L126:
+  _AOT_TAIL_CALL(126, 2);
+ L135:
+  _AOT_RET(135);
+  _AOT_EXIT(136);
+}
+
+static const unsigned char sexp_aot_srfi_1_107_shape[] = {
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 90, 26, 0, 0, 0, 0, 0,
+  0, 0, 15, 78, 0, 0, 0, 0, 0, 0, 0, 14, 107, 0, 0, 0,
+  0, 0, 0, 0, 82, 1, 0, 0, 0, 0, 0, 0, 0, 81, 1, 0,
+  0, 0, 0, 0, 0, 0, 15, 14, 1, 0, 0, 0, 0, 0, 0, 15,
+  5, 0, 0, 0, 0, 0, 0, 0, 39, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0,
+  0, 0, 0, 0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 9, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 9,
+  0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_108 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 52: goto L52;
+  case 61: goto L61;
+  case 70: goto L70;
+  case 79: goto L79;
+  case 88: goto L88;
+  case 97: goto L97;
+  case 106: goto L106;
+  case 115: goto L115;
+  case 124: goto L124;
+  case 133: goto L133;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 1);
+ L9:
+  _AOT_LOCAL_REF(9, 0);
+ L18:
+  _AOT_GLOBAL_KNOWN_REF(18);
+ L27:
+  _AOT_GLOBAL_KNOWN_CALL(27, 3);
+ L52:
+  _AOT_JUMP_UNLESS(52, L124);
+ L61:
+  _AOT_LOCAL_REF(61, 1);
+ L70:
+  _AOT_EXIT(70);
+  /* FCALL1 */
+ L79:
+  _AOT_LOCAL_REF(79, 0);
+ L88:
+  _AOT_GLOBAL_KNOWN_REF(88);
+ L97:
+  _AOT_GLOBAL_KNOWN_REF(97);
+ L106:
+  _AOT_TAIL_CALL(106, 3);
+ L115:
+  _AOT_JUMP(115, L133);
+ L124:
+  _AOT_PUSH(124);
+ L133:
+  _AOT_RET(133);
+  _AOT_EXIT(134);
+}
+
+static const unsigned char sexp_aot_srfi_1_108_shape[] = {
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0,
+  0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 13, 71, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0,
+  0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 22,
+  0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0,
+  0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 5, 13, 0, 0, 0, 0,
+  0, 0, 0, 14, 17, 0, 0, 0, 0, 0, 0, 0, 15, 14, 0, 0,
+  0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_109 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 2);
+ L9:
+  _AOT_LOCAL_REF(9, 1);
+ L18:
+  _AOT_LOCAL_REF(18, 0);
+ L27:
+  _AOT_GLOBAL_REF(27);
+ L36:
+  _AOT_TAIL_CALL(36, 3);
+ L45:
+  _AOT_RET(45);
+  _AOT_EXIT(46);
+}
+
+static const unsigned char sexp_aot_srfi_1_109_shape[] = {
+  22, 2, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0, 0, 0,
+  0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 13, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_110 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 97: goto L97;
+  case 106: goto L106;
+  case 115: goto L115;
+  case 124: goto L124;
+  case 133: goto L133;
+  case 142: goto L142;
+  case 143: goto L143;
+  case 152: goto L152;
+  case 161: goto L161;
+  case 170: goto L170;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 2);
+ L9:
+  _AOT_NULLP_JUMP_UNLESS(9, L36);
+ L18:
+  _AOT_LOCAL_REF(18, 1);
+ L27:
+  _AOT_JUMP(27, L170);
+ L36:
+  _AOT_LOCAL_REF_CDR(36, 2);
+ L45:
+  _AOT_LOCAL_REF(45, 0);
+ L54:
+  _AOT_LOCAL_REF(54, 1);
+ L63:
+  _AOT_LOCAL_REF_CAR(63, 2);
+ L72:
+  _AOT_GLOBAL_KNOWN_CALL(72, 3);
+ L97:
+  _AOT_JUMP_UNLESS(97, L124);
+ L106:
+  _AOT_LOCAL_REF(106, 1);
+ L115:
+  _AOT_JUMP(115, L143);
+ L124:
+  _AOT_LOCAL_REF(124, 1);
+ L133:
+  _AOT_LOCAL_REF_CAR(133, 2);
+ L142:
+  _AOT_CONS(142);
+ L143:
+  _AOT_LOCAL_REF(143, 0);
+ L152:
+  _AOT_GLOBAL_KNOWN_REF(152);
+ L161:
+  _AOT_TAIL_CALL(161, 3);
+ L170:
+  _AOT_RET(170);
+  _AOT_EXIT(171);
+}
+
+static const unsigned char sexp_aot_srfi_1_110_shape[] = {
+  22, 2, 0, 0, 0, 0, 0, 0, 0, 90, 26, 0, 0, 0, 0, 0,
+  0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 14, 142, 0, 0, 0,
+  0, 0, 0, 0, 82, 2, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0,
+  0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 81,
+  2, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0,
+  0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 13, 26, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0, 0,
+  0, 0, 0, 14, 27, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0, 0,
+  0, 0, 0, 0, 0, 81, 2, 0, 0, 0, 0, 0, 0, 0, 58, 22,
+  0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0,
+  0, 5, 13, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_111 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_CLOSURE_REF(0, 1);
+ L9:
+  _AOT_CLOSURE_REF(9, 0);
+ L18:
+  _AOT_LOCAL_REF(18, 0);
+ L27:
+  _AOT_GLOBAL_KNOWN_REF(27);
+ L36:
+  _AOT_TAIL_CALL(36, 3);
+ L45:
+  _AOT_RET(45);
+  _AOT_EXIT(46);
+}
+
+static const unsigned char sexp_aot_srfi_1_111_shape[] = {
+  24, 1, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0,
+  0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 13, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_112 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 28: goto L28;
+  case 37: goto L37;
+  case 46: goto L46;
+  case 55: goto L55;
+  case 56: goto L56;
+  case 65: goto L65;
+  case 74: goto L74;
+  case 83: goto L83;
+  case 84: goto L84;
+  case 109: goto L109;
+  case 118: goto L118;
+  case 127: goto L127;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 2);
+ L9:
+  _AOT_PUSH(9);
+ L18:
+  _AOT_PUSH(18);
+ L27:
+  _AOT_EXIT(27);
+  /* MAKE-VECTOR */
+ L28:
+  _AOT_LOCAL_REF(28, 1);
+ L37:
+  _AOT_PUSH(37);
+ L46:
+  _AOT_STACK_REF(46, 3);
+ L55:
+  _AOT_EXIT(55);
+  /* VECTOR-SET */
+ L56:
+  _AOT_LOCAL_REF(56, 0);
+ L65:
+  _AOT_PUSH(65);
+ L74:
+  _AOT_STACK_REF(74, 3);
+ L83:
+  _AOT_EXIT(83);
+  /* VECTOR-SET */
+ L84:
+  _AOT_EXIT(84);
+  /* MAKE-PROCEDURE */
+ L109:
+  _AOT_GLOBAL_KNOWN_REF(109);
+ L118:
+  _AOT_TAIL_CALL(118, 2);
+ L127:
+  _AOT_RET(127);
+  _AOT_EXIT(128);
+}
+
+static const unsigned char sexp_aot_srfi_1_112_shape[] = {
+  22, 2, 0, 0, 0, 0, 0, 0, 0, 15, 14, 1, 0, 0, 0, 0,
+  0, 0, 15, 9, 0, 0, 0, 0, 0, 0, 0, 39, 22, 1, 0, 0,
+  0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0, 21, 3,
+  0, 0, 0, 0, 0, 0, 0, 27, 22, 0, 0, 0, 0, 0, 0, 0,
+  0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0,
+  0, 0, 0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0,
+  0, 0, 0, 0, 0, 0, 5, 9, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_113 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 52: goto L52;
+  case 61: goto L61;
+  case 70: goto L70;
+  case 79: goto L79;
+  case 104: goto L104;
+  case 113: goto L113;
+  case 122: goto L122;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 1);
+ L9:
+  _AOT_LOCAL_REF(9, 0);
+ L18:
+  _AOT_GLOBAL_KNOWN_REF(18);
+ L27:
+  _AOT_GLOBAL_KNOWN_CALL(27, 3);
+ L52:
+  _AOT_LOCAL_REF(52, 1);
+ L61:
+  _AOT_LOCAL_REF(61, 0);
+ L70:
+  _AOT_GLOBAL_KNOWN_REF(70);
+ L79:
+  _AOT_GLOBAL_KNOWN_CALL(79, 3);
+ L104:
+  _AOT_GLOBAL_KNOWN_REF(104);
+ L113:
+  _AOT_TAIL_CALL(113, 2);
+ L122:
+  _AOT_RET(122);
+  _AOT_EXIT(123);
+}
+
+static const unsigned char sexp_aot_srfi_1_113_shape[] = {
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0,
+  0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0,
+  0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 85,
+  0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0,
+  0, 5, 9, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_114 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 52: goto L52;
+  case 61: goto L61;
+  case 70: goto L70;
+  case 79: goto L79;
+  case 104: goto L104;
+  case 113: goto L113;
+  case 122: goto L122;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_LOCAL_REF(9, 1);
+ L18:
+  _AOT_CLOSURE_REF(18, 0);
+ L27:
+  _AOT_GLOBAL_KNOWN_CALL(27, 3);
+ L52:
+  _AOT_LOCAL_REF(52, 1);
+ L61:
+  _AOT_LOCAL_REF(61, 0);
+ L70:
+  _AOT_CLOSURE_REF(70, 0);
+ L79:
+  _AOT_GLOBAL_KNOWN_CALL(79, 3);
+ L104:
+  _AOT_GLOBAL_KNOWN_REF(104);
+ L113:
+  _AOT_TAIL_CALL(113, 2);
+ L122:
+  _AOT_RET(122);
+  _AOT_EXIT(123);
+}
+
+static const unsigned char sexp_aot_srfi_1_114_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0, 0, 0,
+  0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0,
+  0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0,
+  0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 85,
+  0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0,
+  0, 5, 9, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_115 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 37: goto L37;
+  case 46: goto L46;
+  case 55: goto L55;
+  case 64: goto L64;
+  case 65: goto L65;
+  case 90: goto L90;
+  case 99: goto L99;
+  case 108: goto L108;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 1);
+ L9:
+  _AOT_PUSH(9);
+ L18:
+  _AOT_PUSH(18);
+ L27:
+  _AOT_PUSH(27);
+ L36:
+  _AOT_EXIT(36);
+  /* MAKE-VECTOR */
+ L37:
+  _AOT_LOCAL_REF(37, 0);
+ L46:
+  _AOT_PUSH(46);
+ L55:
+  _AOT_STACK_REF(55, 3);
+ L64:
+  _AOT_EXIT(64);
+  /* VECTOR-SET */
+ L65:
+  _AOT_EXIT(65);
+  /* MAKE-PROCEDURE */
+ L90:
+  _AOT_GLOBAL_KNOWN_REF(90);
+ L99:
+  _AOT_TAIL_CALL(99, 3);
+ L108:
+  _AOT_RET(108);
+  _AOT_EXIT(109);
+}
+
+static const unsigned char sexp_aot_srfi_1_115_shape[] = {
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 15, 142, 0, 0, 0, 0, 0,
+  0, 0, 15, 14, 1, 0, 0, 0, 0, 0, 0, 15, 5, 0, 0, 0,
+  0, 0, 0, 0, 39, 22, 0, 0, 0, 0, 0, 0, 0, 0, 15, 1,
+  0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0,
+  27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0,
+  0, 0, 0, 5, 13, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_116 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 1);
+ L9:
+  _AOT_LOCAL_REF(9, 0);
+ L18:
+  _AOT_CLOSURE_REF(18, 0);
+ L27:
+  _AOT_GLOBAL_KNOWN_REF(27);
+ L36:
+  _AOT_TAIL_CALL(36, 3);
+ L45:
+  _AOT_RET(45);
+  _AOT_EXIT(46);
+}
+
+static const unsigned char sexp_aot_srfi_1_116_shape[] = {
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 13, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_117 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 28: goto L28;
+  case 37: goto L37;
+  case 46: goto L46;
+  case 55: goto L55;
+  case 56: goto L56;
+  case 65: goto L65;
+  case 74: goto L74;
+  case 83: goto L83;
+  case 84: goto L84;
+  case 109: goto L109;
+  case 118: goto L118;
+  case 127: goto L127;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 1);
+ L9:
+  _AOT_PUSH(9);
+ L18:
+  _AOT_PUSH(18);
+ L27:
+  _AOT_EXIT(27);
+  /* MAKE-VECTOR */
+ L28:
+  _AOT_LOCAL_REF(28, 0);
+ L37:
+  _AOT_PUSH(37);
+ L46:
+  _AOT_STACK_REF(46, 3);
+ L55:
+  _AOT_EXIT(55);
+  /* VECTOR-SET */
+ L56:
+  _AOT_CLOSURE_REF(56, 0);
+ L65:
+  _AOT_PUSH(65);
+ L74:
+  _AOT_STACK_REF(74, 3);
+ L83:
+  _AOT_EXIT(83);
+  /* VECTOR-SET */
+ L84:
+  _AOT_EXIT(84);
+  /* MAKE-PROCEDURE */
+ L109:
+  _AOT_GLOBAL_KNOWN_REF(109);
+ L118:
+  _AOT_TAIL_CALL(118, 2);
+ L127:
+  _AOT_RET(127);
+  _AOT_EXIT(128);
+}
+
+static const unsigned char sexp_aot_srfi_1_117_shape[] = {
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 15, 14, 1, 0, 0, 0, 0,
+  0, 0, 15, 9, 0, 0, 0, 0, 0, 0, 0, 39, 22, 0, 0, 0,
+  0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0, 21, 3,
+  0, 0, 0, 0, 0, 0, 0, 27, 24, 0, 0, 0, 0, 0, 0, 0,
+  0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0,
+  0, 0, 0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0,
+  0, 0, 0, 0, 0, 0, 5, 9, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_1_118 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_LOCAL_REF(9, 1);
+ L18:
+  _AOT_CLOSURE_REF(18, 0);
+ L27:
+  _AOT_GLOBAL_KNOWN_REF(27);
+ L36:
+  _AOT_TAIL_CALL(36, 3);
+ L45:
+  _AOT_RET(45);
+  _AOT_EXIT(46);
+}
+
+static const unsigned char sexp_aot_srfi_1_118_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0, 0, 0,
+  0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 13, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static struct sexp_aot_proc_t sexp_aot_srfi_1_procs[] = {
+  {sexp_aot_srfi_1_0_shape, 100, sexp_aot_srfi_1_0, 0},
+  {sexp_aot_srfi_1_1_shape, 171, sexp_aot_srfi_1_1, 0},
+  {sexp_aot_srfi_1_2_shape, 157, sexp_aot_srfi_1_2, 0},
+  {sexp_aot_srfi_1_3_shape, 109, sexp_aot_srfi_1_3, 0},
+  {sexp_aot_srfi_1_4_shape, 53, sexp_aot_srfi_1_4, 0},
+  {sexp_aot_srfi_1_5_shape, 37, sexp_aot_srfi_1_5, 0},
+  {sexp_aot_srfi_1_6_shape, 11, sexp_aot_srfi_1_6, 0},
+  {sexp_aot_srfi_1_7_shape, 191, sexp_aot_srfi_1_7, 0},
+  {sexp_aot_srfi_1_8_shape, 217, sexp_aot_srfi_1_8, 0},
+  {sexp_aot_srfi_1_9_shape, 184, sexp_aot_srfi_1_9, 0},
+  {sexp_aot_srfi_1_10_shape, 148, sexp_aot_srfi_1_10, 0},
+  {sexp_aot_srfi_1_11_shape, 268, sexp_aot_srfi_1_11, 0},
+  {sexp_aot_srfi_1_12_shape, 107, sexp_aot_srfi_1_12, 0},
+  {sexp_aot_srfi_1_13_shape, 12, sexp_aot_srfi_1_13, 0},
+  {sexp_aot_srfi_1_14_shape, 13, sexp_aot_srfi_1_14, 0},
+  {sexp_aot_srfi_1_15_shape, 14, sexp_aot_srfi_1_15, 0},
+  {sexp_aot_srfi_1_16_shape, 15, sexp_aot_srfi_1_16, 0},
+  {sexp_aot_srfi_1_17_shape, 16, sexp_aot_srfi_1_17, 0},
+  {sexp_aot_srfi_1_18_shape, 17, sexp_aot_srfi_1_18, 0},
+  {sexp_aot_srfi_1_19_shape, 18, sexp_aot_srfi_1_19, 0},
+  {sexp_aot_srfi_1_20_shape, 37, sexp_aot_srfi_1_20, 0},
+  {sexp_aot_srfi_1_21_shape, 120, sexp_aot_srfi_1_21, 0},
+  {sexp_aot_srfi_1_22_shape, 29, sexp_aot_srfi_1_22, 0},
+  {sexp_aot_srfi_1_23_shape, 180, sexp_aot_srfi_1_23, 0},
+  {sexp_aot_srfi_1_24_shape, 92, sexp_aot_srfi_1_24, 0},
+  {sexp_aot_srfi_1_25_shape, 72, sexp_aot_srfi_1_25, 0},
+  {sexp_aot_srfi_1_26_shape, 147, sexp_aot_srfi_1_26, 0},
+  {sexp_aot_srfi_1_27_shape, 56, sexp_aot_srfi_1_27, 0},
+  {sexp_aot_srfi_1_28_shape, 119, sexp_aot_srfi_1_28, 0},
+  {sexp_aot_srfi_1_29_shape, 207, sexp_aot_srfi_1_29, 0},
+  {sexp_aot_srfi_1_30_shape, 64, sexp_aot_srfi_1_30, 0},
+  {sexp_aot_srfi_1_31_shape, 64, sexp_aot_srfi_1_31, 0},
+  {sexp_aot_srfi_1_32_shape, 146, sexp_aot_srfi_1_32, 0},
+  {sexp_aot_srfi_1_33_shape, 46, sexp_aot_srfi_1_33, 0},
+  {sexp_aot_srfi_1_34_shape, 125, sexp_aot_srfi_1_34, 0},
+  {sexp_aot_srfi_1_35_shape, 173, sexp_aot_srfi_1_35, 0},
+  {sexp_aot_srfi_1_36_shape, 100, sexp_aot_srfi_1_36, 0},
+  {sexp_aot_srfi_1_37_shape, 255, sexp_aot_srfi_1_37, 0},
+  {sexp_aot_srfi_1_38_shape, 137, sexp_aot_srfi_1_38, 0},
+  {sexp_aot_srfi_1_39_shape, 218, sexp_aot_srfi_1_39, 0},
+  {sexp_aot_srfi_1_40_shape, 101, sexp_aot_srfi_1_40, 0},
+  {sexp_aot_srfi_1_41_shape, 109, sexp_aot_srfi_1_41, 0},
+  {sexp_aot_srfi_1_42_shape, 28, sexp_aot_srfi_1_42, 0},
+  {sexp_aot_srfi_1_43_shape, 168, sexp_aot_srfi_1_43, 0},
+  {sexp_aot_srfi_1_44_shape, 127, sexp_aot_srfi_1_44, 0},
+  {sexp_aot_srfi_1_45_shape, 107, sexp_aot_srfi_1_45, 0},
+  {sexp_aot_srfi_1_46_shape, 37, sexp_aot_srfi_1_46, 0},
+  {sexp_aot_srfi_1_47_shape, 83, sexp_aot_srfi_1_47, 0},
+  {sexp_aot_srfi_1_48_shape, 29, sexp_aot_srfi_1_48, 0},
+  {sexp_aot_srfi_1_49_shape, 164, sexp_aot_srfi_1_49, 0},
+  {sexp_aot_srfi_1_50_shape, 46, sexp_aot_srfi_1_50, 0},
+  {sexp_aot_srfi_1_51_shape, 37, sexp_aot_srfi_1_51, 0},
+  {sexp_aot_srfi_1_52_shape, 105, sexp_aot_srfi_1_52, 0},
+  {sexp_aot_srfi_1_53_shape, 148, sexp_aot_srfi_1_53, 0},
+  {sexp_aot_srfi_1_54_shape, 191, sexp_aot_srfi_1_54, 0},
+  {sexp_aot_srfi_1_55_shape, 234, sexp_aot_srfi_1_55, 0},
+  {sexp_aot_srfi_1_56_shape, 255, sexp_aot_srfi_1_56, 0},
+  {sexp_aot_srfi_1_57_shape, 137, sexp_aot_srfi_1_57, 0},
+  {sexp_aot_srfi_1_58_shape, 20, sexp_aot_srfi_1_58, 0},
+  {sexp_aot_srfi_1_59_shape, 119, sexp_aot_srfi_1_59, 0},
+  {sexp_aot_srfi_1_60_shape, 120, sexp_aot_srfi_1_60, 0},
+  {sexp_aot_srfi_1_61_shape, 101, sexp_aot_srfi_1_61, 0},
+  {sexp_aot_srfi_1_62_shape, 54, sexp_aot_srfi_1_62, 0},
+  {sexp_aot_srfi_1_63_shape, 38, sexp_aot_srfi_1_63, 0},
+  {sexp_aot_srfi_1_64_shape, 146, sexp_aot_srfi_1_64, 0},
+  {sexp_aot_srfi_1_65_shape, 242, sexp_aot_srfi_1_65, 0},
+  {sexp_aot_srfi_1_66_shape, 243, sexp_aot_srfi_1_66, 0},
+  {sexp_aot_srfi_1_67_shape, 100, sexp_aot_srfi_1_67, 0},
+  {sexp_aot_srfi_1_68_shape, 236, sexp_aot_srfi_1_68, 0},
+  {sexp_aot_srfi_1_69_shape, 227, sexp_aot_srfi_1_69, 0},
+  {sexp_aot_srfi_1_70_shape, 91, sexp_aot_srfi_1_70, 0},
+  {sexp_aot_srfi_1_71_shape, 274, sexp_aot_srfi_1_71, 0},
+  {sexp_aot_srfi_1_72_shape, 234, sexp_aot_srfi_1_72, 0},
+  {sexp_aot_srfi_1_73_shape, 100, sexp_aot_srfi_1_73, 0},
+  {sexp_aot_srfi_1_74_shape, 218, sexp_aot_srfi_1_74, 0},
+  {sexp_aot_srfi_1_75_shape, 91, sexp_aot_srfi_1_75, 0},
+  {sexp_aot_srfi_1_76_shape, 82, sexp_aot_srfi_1_76, 0},
+  {sexp_aot_srfi_1_77_shape, 183, sexp_aot_srfi_1_77, 0},
+  {sexp_aot_srfi_1_78_shape, 137, sexp_aot_srfi_1_78, 0},
+  {sexp_aot_srfi_1_79_shape, 192, sexp_aot_srfi_1_79, 0},
+  {sexp_aot_srfi_1_80_shape, 125, sexp_aot_srfi_1_80, 0},
+  {sexp_aot_srfi_1_81_shape, 230, sexp_aot_srfi_1_81, 0},
+  {sexp_aot_srfi_1_82_shape, 118, sexp_aot_srfi_1_82, 0},
+  {sexp_aot_srfi_1_83_shape, 425, sexp_aot_srfi_1_83, 0},
+  {sexp_aot_srfi_1_84_shape, 55, sexp_aot_srfi_1_84, 0},
+  {sexp_aot_srfi_1_85_shape, 28, sexp_aot_srfi_1_85, 0},
+  {sexp_aot_srfi_1_86_shape, 127, sexp_aot_srfi_1_86, 0},
+  {sexp_aot_srfi_1_87_shape, 83, sexp_aot_srfi_1_87, 0},
+  {sexp_aot_srfi_1_88_shape, 210, sexp_aot_srfi_1_88, 0},
+  {sexp_aot_srfi_1_89_shape, 206, sexp_aot_srfi_1_89, 0},
+  {sexp_aot_srfi_1_90_shape, 101, sexp_aot_srfi_1_90, 0},
+  {sexp_aot_srfi_1_91_shape, 178, sexp_aot_srfi_1_91, 0},
+  {sexp_aot_srfi_1_92_shape, 181, sexp_aot_srfi_1_92, 0},
+  {sexp_aot_srfi_1_93_shape, 237, sexp_aot_srfi_1_93, 0},
+  {sexp_aot_srfi_1_94_shape, 37, sexp_aot_srfi_1_94, 0},
+  {sexp_aot_srfi_1_95_shape, 165, sexp_aot_srfi_1_95, 0},
+  {sexp_aot_srfi_1_96_shape, 254, sexp_aot_srfi_1_96, 0},
+  {sexp_aot_srfi_1_97_shape, 155, sexp_aot_srfi_1_97, 0},
+  {sexp_aot_srfi_1_98_shape, 171, sexp_aot_srfi_1_98, 0},
+  {sexp_aot_srfi_1_99_shape, 127, sexp_aot_srfi_1_99, 0},
+  {sexp_aot_srfi_1_100_shape, 30, sexp_aot_srfi_1_100, 0},
+  {sexp_aot_srfi_1_101_shape, 20, sexp_aot_srfi_1_101, 0},
+  {sexp_aot_srfi_1_102_shape, 37, sexp_aot_srfi_1_102, 0},
+  {sexp_aot_srfi_1_103_shape, 37, sexp_aot_srfi_1_103, 0},
+  {sexp_aot_srfi_1_104_shape, 128, sexp_aot_srfi_1_104, 0},
+  {sexp_aot_srfi_1_105_shape, 172, sexp_aot_srfi_1_105, 0},
+  {sexp_aot_srfi_1_106_shape, 211, sexp_aot_srfi_1_106, 0},
+  {sexp_aot_srfi_1_107_shape, 136, sexp_aot_srfi_1_107, 0},
+  {sexp_aot_srfi_1_108_shape, 134, sexp_aot_srfi_1_108, 0},
+  {sexp_aot_srfi_1_109_shape, 46, sexp_aot_srfi_1_109, 0},
+  {sexp_aot_srfi_1_110_shape, 171, sexp_aot_srfi_1_110, 0},
+  {sexp_aot_srfi_1_111_shape, 46, sexp_aot_srfi_1_111, 0},
+  {sexp_aot_srfi_1_112_shape, 128, sexp_aot_srfi_1_112, 0},
+  {sexp_aot_srfi_1_113_shape, 123, sexp_aot_srfi_1_113, 0},
+  {sexp_aot_srfi_1_114_shape, 123, sexp_aot_srfi_1_114, 0},
+  {sexp_aot_srfi_1_115_shape, 109, sexp_aot_srfi_1_115, 0},
+  {sexp_aot_srfi_1_116_shape, 46, sexp_aot_srfi_1_116, 0},
+  {sexp_aot_srfi_1_117_shape, 128, sexp_aot_srfi_1_117, 0},
+  {sexp_aot_srfi_1_118_shape, 46, sexp_aot_srfi_1_118, 0},
+  {NULL, 0, NULL, 0}
+};
+
+static struct sexp_aot_library_t sexp_aot_srfi_1_library = {sexp_aot_srfi_1_procs, NULL, 0};
+
+static sexp sexp_aot_srfi_1_init (sexp ctx, sexp self, sexp_sint_t n, sexp env, const char* version, const sexp_abi_identifier_t abi) {
+  sexp_aot_register(&sexp_aot_srfi_1_library);
+  return SEXP_VOID;
+}
+
+static sexp_sint_t sexp_aot_srfi_95_0 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 64: goto L64;
+  case 73: goto L73;
+  case 82: goto L82;
+  case 83: goto L83;
+  case 92: goto L92;
+  case 101: goto L101;
+  case 102: goto L102;
+  case 111: goto L111;
+  case 120: goto L120;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_PUSH(0);
+ L9:
+  _AOT_LOCAL_REF(9, 0);
+ L18:
+  _AOT_LT_JUMP_UNLESS(18, L45);
+ L27:
+  _AOT_CLOSURE_REF(27, 0);
+ L36:
+  _AOT_JUMP(36, L120);
+ L45:
+  _AOT_LOCAL_REF(45, 0);
+ L54:
+  _AOT_CLOSURE_REF(54, 1);
+ L63:
+  _AOT_VECTOR_REF(63);
+ L64:
+  _AOT_LOCAL_REF(64, 0);
+ L73:
+  _AOT_CLOSURE_REF(73, 0);
+ L82:
+  _AOT_EXIT(82);
+  /* VECTOR-SET */
+ L83:
+  _AOT_PUSH(83);
+ L92:
+  _AOT_LOCAL_REF(92, 0);
+ L101:
+  _AOT_SUB(101);
+ L102:
+  _AOT_CLOSURE_REF_CDR(102, 2);
+ L111:
+  _AOT_TAIL_CALL(111, 1);
+ L120:
+  _AOT_RET(120);
+  _AOT_EXIT(121);
+}
+
+static const unsigned char sexp_aot_srfi_95_0_shape[] = {
+  15, 1, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 86, 26, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0,
+  0, 0, 0, 0, 14, 83, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0,
+  0, 0, 0, 0, 0, 0, 24, 1, 0, 0, 0, 0, 0, 0, 0, 26,
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0,
+  0, 0, 27, 15, 5, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0,
+  0, 0, 0, 0, 0, 60, 83, 2, 0, 0, 0, 0, 0, 0, 0, 5,
+  5, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_95_1 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 19: goto L19;
+  case 28: goto L28;
+  case 37: goto L37;
+  case 38: goto L38;
+  case 47: goto L47;
+  case 56: goto L56;
+  case 65: goto L65;
+  case 66: goto L66;
+  case 75: goto L75;
+  case 84: goto L84;
+  case 93: goto L93;
+  case 94: goto L94;
+  case 119: goto L119;
+  case 128: goto L128;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_PUSH(0);
+ L9:
+  _AOT_CLOSURE_REF(9, 2);
+ L18:
+  _AOT_SUB(18);
+ L19:
+  _AOT_PUSH(19);
+ L28:
+  _AOT_PUSH(28);
+ L37:
+  _AOT_EXIT(37);
+  /* MAKE-VECTOR */
+ L38:
+  _AOT_CLOSURE_REF(38, 1);
+ L47:
+  _AOT_PUSH(47);
+ L56:
+  _AOT_STACK_REF(56, 3);
+ L65:
+  _AOT_EXIT(65);
+  /* VECTOR-SET */
+ L66:
+  _AOT_CLOSURE_REF(66, 0);
+ L75:
+  _AOT_PUSH(75);
+ L84:
+  _AOT_STACK_REF(84, 3);
+ L93:
+  _AOT_EXIT(93);
+  /* VECTOR-SET */
+ L94:
+  _AOT_EXIT(94);
+  /* MAKE-PROCEDURE */
+ L119:
+  _AOT_TAIL_CALL(119, 1);
+ L128:
+  _AOT_RET(128);
+  _AOT_EXIT(129);
+}
+
+static const unsigned char sexp_aot_srfi_95_1_shape[] = {
+  15, 5, 0, 0, 0, 0, 0, 0, 0, 24, 2, 0, 0, 0, 0, 0,
+  0, 0, 60, 15, 14, 1, 0, 0, 0, 0, 0, 0, 15, 9, 0, 0,
+  0, 0, 0, 0, 0, 39, 24, 1, 0, 0, 0, 0, 0, 0, 0, 15,
+  1, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0,
+  0, 27, 24, 0, 0, 0, 0, 0, 0, 0, 0, 15, 5, 0, 0, 0,
+  0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 38, 1,
+  0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0,
+  79
+};
+
+static sexp_sint_t sexp_aot_srfi_95_2 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 19: goto L19;
+  case 28: goto L28;
+  case 37: goto L37;
+  case 38: goto L38;
+  case 47: goto L47;
+  case 56: goto L56;
+  case 65: goto L65;
+  case 66: goto L66;
+  case 75: goto L75;
+  case 84: goto L84;
+  case 93: goto L93;
+  case 94: goto L94;
+  case 119: goto L119;
+  case 128: goto L128;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_PUSH(0);
+ L9:
+  _AOT_LOCAL_REF(9, 0);
+ L18:
+  _AOT_EXIT(18);
+  /* MAKE-VECTOR */
+ L19:
+  _AOT_PUSH(19);
+ L28:
+  _AOT_PUSH(28);
+ L37:
+  _AOT_EXIT(37);
+  /* MAKE-VECTOR */
+ L38:
+  _AOT_LOCAL_REF(38, 0);
+ L47:
+  _AOT_PUSH(47);
+ L56:
+  _AOT_STACK_REF(56, 3);
+ L65:
+  _AOT_EXIT(65);
+  /* VECTOR-SET */
+ L66:
+  _AOT_CLOSURE_REF(66, 0);
+ L75:
+  _AOT_PUSH(75);
+ L84:
+  _AOT_STACK_REF(84, 3);
+ L93:
+  _AOT_EXIT(93);
+  /* VECTOR-SET */
+ L94:
+  _AOT_EXIT(94);
+  /* MAKE-PROCEDURE */
+ L119:
+  _AOT_TAIL_CALL(119, 1);
+ L128:
+  _AOT_RET(128);
+  _AOT_EXIT(129);
+}
+
+static const unsigned char sexp_aot_srfi_95_2_shape[] = {
+  15, 14, 1, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 39, 15, 14, 1, 0, 0, 0, 0, 0, 0, 15, 9, 0, 0,
+  0, 0, 0, 0, 0, 39, 22, 0, 0, 0, 0, 0, 0, 0, 0, 15,
+  1, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0,
+  0, 27, 24, 0, 0, 0, 0, 0, 0, 0, 0, 15, 5, 0, 0, 0,
+  0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 38, 1,
+  0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0,
+  79
+};
+
+static sexp_sint_t sexp_aot_srfi_95_3 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 37: goto L37;
+  case 46: goto L46;
+  case 55: goto L55;
+  case 56: goto L56;
+  case 65: goto L65;
+  case 74: goto L74;
+  case 83: goto L83;
+  case 84: goto L84;
+  case 109: goto L109;
+  case 118: goto L118;
+  case 127: goto L127;
+  case 136: goto L136;
+  case 145: goto L145;
+  case 154: goto L154;
+  case 163: goto L163;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_TYPEP(9, 10);
+ L18:
+  _AOT_JUMP_UNLESS(18, L127);
+ L27:
+  _AOT_LOCAL_REF(27, 0);
+ L36:
+  _AOT_VECTOR_LENGTH(36);
+ L37:
+  _AOT_PUSH(37);
+ L46:
+  _AOT_PUSH(46);
+ L55:
+  _AOT_EXIT(55);
+  /* MAKE-VECTOR */
+ L56:
+  _AOT_LOCAL_REF(56, 0);
+ L65:
+  _AOT_PUSH(65);
+ L74:
+  _AOT_STACK_REF(74, 3);
+ L83:
+  _AOT_EXIT(83);
+  /* VECTOR-SET */
+ L84:
+  _AOT_EXIT(84);
+  /* MAKE-PROCEDURE */
+ L109:
+  _AOT_TAIL_CALL(109, 1);
+ L118:
+  _AOT_JUMP(118, L163);
+ L127:
+  _AOT_LOCAL_REF(127, 0);
+ L136:
+  _AOT_PUSH(136);
+ L145:
+  _AOT_GLOBAL_KNOWN_REF(145);
+ L154:
+  _AOT_TAIL_CALL(154, 2);
+ L163:
+  _AOT_RET(163);
+  _AOT_EXIT(164);
+}
+
+static const unsigned char sexp_aot_srfi_95_3_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 47, 10, 0, 0, 0, 0, 0,
+  0, 0, 13, 108, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0,
+  0, 0, 0, 0, 28, 15, 14, 1, 0, 0, 0, 0, 0, 0, 15, 5,
+  0, 0, 0, 0, 0, 0, 0, 39, 22, 0, 0, 0, 0, 0, 0, 0,
+  0, 15, 1, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0,
+  0, 0, 0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 0,
+  0, 0, 0, 0, 0, 0, 14, 44, 0, 0, 0, 0, 0, 0, 0, 22,
+  0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0,
+  0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 5, 9, 0, 0, 0, 0,
+  0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_95_4 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 52: goto L52;
+  case 61: goto L61;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 1);
+ L9:
+  _AOT_LOCAL_REF(9, 0);
+ L18:
+  _AOT_CLOSURE_REF(18, 0);
+ L27:
+  _AOT_GLOBAL_KNOWN_CALL(27, 1);
+ L52:
+  _AOT_EXIT(52);
+  /* FCALL3 */
+ L61:
+  _AOT_RET(61);
+  _AOT_EXIT(62);
+}
+
+static const unsigned char sexp_aot_srfi_95_4_shape[] = {
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_95_5 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 46: goto L46;
+  case 55: goto L55;
+  case 64: goto L64;
+  case 73: goto L73;
+  case 82: goto L82;
+  case 91: goto L91;
+  case 100: goto L100;
+  case 109: goto L109;
+  case 118: goto L118;
+  case 127: goto L127;
+  case 136: goto L136;
+  case 145: goto L145;
+  case 146: goto L146;
+  case 155: goto L155;
+  case 164: goto L164;
+  case 173: goto L173;
+  case 174: goto L174;
+  case 199: goto L199;
+  case 208: goto L208;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 1);
+ L9:
+  _AOT_PAIRP_JUMP_UNLESS(9, L73);
+ L18:
+  _AOT_LOCAL_REF_CDR(18, 1);
+ L27:
+  _AOT_PAIRP_JUMP_UNLESS(27, L55);
+ L36:
+  _AOT_LOCAL_REF_CDR(36, 1);
+ L45:
+  _AOT_CAR(45);
+ L46:
+  _AOT_JUMP(46, L64);
+ L55:
+  _AOT_PUSH(55);
+ L64:
+  _AOT_JUMP(64, L82);
+ L73:
+  _AOT_PUSH(73);
+ L82:
+  _AOT_LOCAL_REF(82, 1);
+ L91:
+  _AOT_PAIRP_JUMP_UNLESS(91, L118);
+ L100:
+  _AOT_LOCAL_REF_CAR(100, 1);
+ L109:
+  _AOT_JUMP(109, L127);
+ L118:
+  _AOT_PUSH(118);
+ L127:
+  _AOT_PUSH(127);
+ L136:
+  _AOT_PUSH(136);
+ L145:
+  _AOT_EXIT(145);
+  /* MAKE-VECTOR */
+ L146:
+  _AOT_LOCAL_REF(146, 0);
+ L155:
+  _AOT_PUSH(155);
+ L164:
+  _AOT_STACK_REF(164, 3);
+ L173:
+  _AOT_EXIT(173);
+  /* VECTOR-SET */
+ L174:
+  _AOT_EXIT(174);
+  /* MAKE-PROCEDURE */
+ L199:
+  _AOT_TAIL_CALL(199, 2);
+ L208:
+  _AOT_RET(208);
+  _AOT_EXIT(209);
+}
+
+static const unsigned char sexp_aot_srfi_95_5_shape[] = {
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 91, 63, 0, 0, 0, 0, 0,
+  0, 0, 82, 1, 0, 0, 0, 0, 0, 0, 0, 91, 27, 0, 0, 0,
+  0, 0, 0, 0, 82, 1, 0, 0, 0, 0, 0, 0, 0, 54, 14, 17,
+  0, 0, 0, 0, 0, 0, 0, 15, 14, 0, 0, 0, 0, 0, 0, 0,
+  14, 17, 0, 0, 0, 0, 0, 0, 0, 15, 14, 0, 0, 0, 0, 0,
+  0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 91, 26, 0, 0, 0,
+  0, 0, 0, 0, 81, 1, 0, 0, 0, 0, 0, 0, 0, 14, 17, 0,
+  0, 0, 0, 0, 0, 0, 15, 14, 0, 0, 0, 0, 0, 0, 0, 15,
+  14, 1, 0, 0, 0, 0, 0, 0, 15, 5, 0, 0, 0, 0, 0, 0,
+  0, 39, 22, 0, 0, 0, 0, 0, 0, 0, 0, 15, 1, 0, 0, 0,
+  0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 38, 1,
+  0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 5, 9, 0, 0, 0, 0, 0, 0, 0,
+  79
+};
+
+static sexp_sint_t sexp_aot_srfi_95_6 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 81: goto L81;
+  case 90: goto L90;
+  case 99: goto L99;
+  case 108: goto L108;
+  case 117: goto L117;
+  case 126: goto L126;
+  case 135: goto L135;
+  case 144: goto L144;
+  case 153: goto L153;
+  case 162: goto L162;
+  case 171: goto L171;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 1);
+ L9:
+  _AOT_NULLP_JUMP_UNLESS(9, L36);
+ L18:
+  _AOT_PUSH(18);
+ L27:
+  _AOT_JUMP(27, L171);
+ L36:
+  _AOT_LOCAL_REF_CAR(36, 0);
+ L45:
+  _AOT_CLOSURE_REF(45, 1);
+ L54:
+  _AOT_CALL(54, 1);
+ L63:
+  _AOT_LOCAL_REF_CAR(63, 1);
+ L72:
+  _AOT_CLOSURE_REF(72, 1);
+ L81:
+  _AOT_CALL(81, 1);
+ L90:
+  _AOT_CLOSURE_REF(90, 0);
+ L99:
+  _AOT_CALL(99, 2);
+ L108:
+  _AOT_JUMP_UNLESS(108, L135);
+ L117:
+  _AOT_PUSH(117);
+ L126:
+  _AOT_JUMP(126, L171);
+ L135:
+  _AOT_LOCAL_REF_CDR(135, 1);
+ L144:
+  _AOT_LOCAL_REF(144, 1);
+ L153:
+  _AOT_CLOSURE_REF_CDR(153, 2);
+ L162:
+  _AOT_TAIL_CALL(162, 2);
+ L171:
+  _AOT_RET(171);
+  _AOT_EXIT(172);
+}
+
+static const unsigned char sexp_aot_srfi_95_6_shape[] = {
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 90, 26, 0, 0, 0, 0, 0,
+  0, 0, 15, 78, 0, 0, 0, 0, 0, 0, 0, 14, 143, 0, 0, 0,
+  0, 0, 0, 0, 81, 0, 0, 0, 0, 0, 0, 0, 0, 24, 1, 0,
+  0, 0, 0, 0, 0, 0, 6, 5, 0, 0, 0, 0, 0, 0, 0, 81,
+  1, 0, 0, 0, 0, 0, 0, 0, 24, 1, 0, 0, 0, 0, 0, 0,
+  0, 6, 5, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0,
+  0, 0, 0, 6, 9, 0, 0, 0, 0, 0, 0, 0, 13, 26, 0, 0,
+  0, 0, 0, 0, 0, 15, 14, 0, 0, 0, 0, 0, 0, 0, 14, 44,
+  0, 0, 0, 0, 0, 0, 0, 82, 1, 0, 0, 0, 0, 0, 0, 0,
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 83, 2, 0, 0, 0, 0, 0,
+  0, 0, 5, 9, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_95_7 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 64: goto L64;
+  case 73: goto L73;
+  case 82: goto L82;
+  case 91: goto L91;
+  case 100: goto L100;
+  case 101: goto L101;
+  case 110: goto L110;
+  case 111: goto L111;
+  case 120: goto L120;
+  case 129: goto L129;
+  case 138: goto L138;
+  case 147: goto L147;
+  case 156: goto L156;
+  case 165: goto L165;
+  case 174: goto L174;
+  case 183: goto L183;
+  case 192: goto L192;
+  case 193: goto L193;
+  case 202: goto L202;
+  case 211: goto L211;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_CLOSURE_REF(9, 0);
+ L18:
+  _AOT_LE_JUMP_UNLESS(18, L45);
+ L27:
+  _AOT_PUSH(27);
+ L36:
+  _AOT_JUMP(36, L211);
+ L45:
+  _AOT_LOCAL_REF(45, 0);
+ L54:
+  _AOT_CLOSURE_REF(54, 3);
+ L63:
+  _AOT_VECTOR_REF(63);
+ L64:
+  _AOT_CLOSURE_REF(64, 2);
+ L73:
+  _AOT_CALL(73, 1);
+ L82:
+  _AOT_PUSH(82);
+ L91:
+  _AOT_LOCAL_REF(91, 0);
+ L100:
+  _AOT_ADD(100);
+ L101:
+  _AOT_CLOSURE_REF(101, 3);
+ L110:
+  _AOT_VECTOR_REF(110);
+ L111:
+  _AOT_CLOSURE_REF(111, 2);
+ L120:
+  _AOT_CALL(120, 1);
+ L129:
+  _AOT_CLOSURE_REF(129, 1);
+ L138:
+  _AOT_CALL(138, 2);
+ L147:
+  _AOT_JUMP_UNLESS(147, L174);
+ L156:
+  _AOT_PUSH(156);
+ L165:
+  _AOT_JUMP(165, L211);
+ L174:
+  _AOT_PUSH(174);
+ L183:
+  _AOT_LOCAL_REF(183, 0);
+ L192:
+  _AOT_ADD(192);
+ L193:
+  _AOT_CLOSURE_REF_CDR(193, 4);
+ L202:
+  _AOT_TAIL_CALL(202, 1);
+ L211:
+  _AOT_RET(211);
+  _AOT_EXIT(212);
+}
+
+static const unsigned char sexp_aot_srfi_95_7_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0,
+  0, 0, 87, 26, 0, 0, 0, 0, 0, 0, 0, 15, 78, 0, 0, 0,
+  0, 0, 0, 0, 14, 174, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0,
+  0, 0, 0, 0, 0, 0, 24, 3, 0, 0, 0, 0, 0, 0, 0, 26,
+  24, 2, 0, 0, 0, 0, 0, 0, 0, 6, 5, 0, 0, 0, 0, 0,
+  0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0,
+  0, 0, 0, 0, 59, 24, 3, 0, 0, 0, 0, 0, 0, 0, 26, 24,
+  2, 0, 0, 0, 0, 0, 0, 0, 6, 5, 0, 0, 0, 0, 0, 0,
+  0, 24, 1, 0, 0, 0, 0, 0, 0, 0, 6, 9, 0, 0, 0, 0,
+  0, 0, 0, 13, 26, 0, 0, 0, 0, 0, 0, 0, 15, 14, 0, 0,
+  0, 0, 0, 0, 0, 14, 45, 0, 0, 0, 0, 0, 0, 0, 15, 5,
+  0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0,
+  59, 83, 4, 0, 0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0,
+  0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_95_8 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 46: goto L46;
+  case 47: goto L47;
+  case 56: goto L56;
+  case 65: goto L65;
+  case 66: goto L66;
+  case 75: goto L75;
+  case 84: goto L84;
+  case 93: goto L93;
+  case 94: goto L94;
+  case 103: goto L103;
+  case 112: goto L112;
+  case 121: goto L121;
+  case 122: goto L122;
+  case 131: goto L131;
+  case 140: goto L140;
+  case 149: goto L149;
+  case 150: goto L150;
+  case 175: goto L175;
+  case 184: goto L184;
+  case 193: goto L193;
+  case 202: goto L202;
+  case 211: goto L211;
+  case 220: goto L220;
+  case 229: goto L229;
+  case 238: goto L238;
+  case 247: goto L247;
+  case 256: goto L256;
+  case 257: goto L257;
+  case 266: goto L266;
+  case 275: goto L275;
+  case 284: goto L284;
+  case 285: goto L285;
+  case 294: goto L294;
+  case 303: goto L303;
+  case 312: goto L312;
+  case 313: goto L313;
+  case 322: goto L322;
+  case 331: goto L331;
+  case 340: goto L340;
+  case 341: goto L341;
+  case 366: goto L366;
+  case 375: goto L375;
+  case 384: goto L384;
+  case 393: goto L393;
+  case 402: goto L402;
+  case 411: goto L411;
+  case 420: goto L420;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_CLOSURE_REF(0, 0);
+ L9:
+  _AOT_TYPEP(9, 10);
+ L18:
+  _AOT_JUMP_UNLESS(18, L193);
+ L27:
+  _AOT_PUSH(27);
+ L36:
+  _AOT_CLOSURE_REF(36, 0);
+ L45:
+  _AOT_VECTOR_LENGTH(45);
+ L46:
+  _AOT_SUB(46);
+ L47:
+  _AOT_PUSH(47);
+ L56:
+  _AOT_PUSH(56);
+ L65:
+  _AOT_EXIT(65);
+  /* MAKE-VECTOR */
+ L66:
+  _AOT_CLOSURE_REF(66, 0);
+ L75:
+  _AOT_PUSH(75);
+ L84:
+  _AOT_STACK_REF(84, 3);
+ L93:
+  _AOT_EXIT(93);
+  /* VECTOR-SET */
+ L94:
+  _AOT_LOCAL_REF(94, 0);
+ L103:
+  _AOT_PUSH(103);
+ L112:
+  _AOT_STACK_REF(112, 3);
+ L121:
+  _AOT_EXIT(121);
+  /* VECTOR-SET */
+ L122:
+  _AOT_CLOSURE_REF(122, 1);
+ L131:
+  _AOT_PUSH(131);
+ L140:
+  _AOT_STACK_REF(140, 3);
+ L149:
+  _AOT_EXIT(149);
+  /* VECTOR-SET */
+ L150:
+  _AOT_EXIT(150);
+  /* MAKE-PROCEDURE */
+ L175:
+  _AOT_TAIL_CALL(175, 1);
+ L184:
+  _AOT_JUMP(184, L420);
+ L193:
+  _AOT_CLOSURE_REF(193, 0);
+ L202:
+  _AOT_NULLP_JUMP_UNLESS(202, L229);
+ L211:
+  _AOT_PUSH(211);
+ L220:
+  _AOT_JUMP(220, L420);
+ L229:
+  _AOT_CLOSURE_REF(229, 0);
+ L238:
+  _AOT_PAIRP_JUMP_UNLESS(238, L384);
+ L247:
+  _AOT_CLOSURE_REF(247, 0);
+ L256:
+  _AOT_CDR(256);
+ L257:
+  _AOT_CLOSURE_REF(257, 0);
+ L266:
+  _AOT_PUSH(266);
+ L275:
+  _AOT_PUSH(275);
+ L284:
+  _AOT_EXIT(284);
+  /* MAKE-VECTOR */
+ L285:
+  _AOT_CLOSURE_REF(285, 1);
+ L294:
+  _AOT_PUSH(294);
+ L303:
+  _AOT_STACK_REF(303, 3);
+ L312:
+  _AOT_EXIT(312);
+  /* VECTOR-SET */
+ L313:
+  _AOT_LOCAL_REF(313, 0);
+ L322:
+  _AOT_PUSH(322);
+ L331:
+  _AOT_STACK_REF(331, 3);
+ L340:
+  _AOT_EXIT(340);
+  /* VECTOR-SET */
+ L341:
+  _AOT_EXIT(341);
+  /* MAKE-PROCEDURE */
+ L366:
+  _AOT_TAIL_CALL(366, 2);
+ L375:
+  _AOT_JUMP(375, L420);
+ L384:
+  _AOT_CLOSURE_REF(384, 0);
+ L393:
+  _AOT_PUSH(393);
+ L402:
+  _AOT_GLOBAL_KNOWN_REF(402);
+ L411:
+  _AOT_TAIL_CALL(411, 2);
+ L420:
+  _AOT_RET(420);
+  _AOT_EXIT(421);
+}
+
+static const unsigned char sexp_aot_srfi_95_8_shape[] = {
+  24, 0, 0, 0, 0, 0, 0, 0, 0, 47, 10, 0, 0, 0, 0, 0,
+  0, 0, 13, 174, 0, 0, 0, 0, 0, 0, 0, 15, 5, 0, 0, 0,
+  0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 28, 60, 15,
+  14, 1, 0, 0, 0, 0, 0, 0, 15, 13, 0, 0, 0, 0, 0, 0,
+  0, 39, 24, 0, 0, 0, 0, 0, 0, 0, 0, 15, 1, 0, 0, 0,
+  0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 22, 0,
+  0, 0, 0, 0, 0, 0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0,
+  21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 24, 1, 0, 0, 0, 0,
+  0, 0, 0, 15, 9, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0,
+  0, 0, 0, 0, 0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 5,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+  5, 0, 0, 0, 0, 0, 0, 0, 14, 235, 0, 0, 0, 0, 0, 0,
+  0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 90, 26, 0, 0, 0, 0,
+  0, 0, 0, 15, 78, 0, 0, 0, 0, 0, 0, 0, 14, 199, 0, 0,
+  0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 91, 145,
+  0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0,
+  55, 24, 0, 0, 0, 0, 0, 0, 0, 0, 15, 14, 1, 0, 0, 0,
+  0, 0, 0, 15, 9, 0, 0, 0, 0, 0, 0, 0, 39, 24, 1, 0,
+  0, 0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0, 21,
+  3, 0, 0, 0, 0, 0, 0, 0, 27, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0,
+  0, 0, 0, 0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 9, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 9,
+  0, 0, 0, 0, 0, 0, 0, 14, 44, 0, 0, 0, 0, 0, 0, 0,
+  24, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0,
+  0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 5, 9, 0, 0, 0,
+  0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_95_9 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 64: goto L64;
+  case 73: goto L73;
+  case 82: goto L82;
+  case 91: goto L91;
+  case 92: goto L92;
+  case 101: goto L101;
+  case 110: goto L110;
+  case 119: goto L119;
+  case 120: goto L120;
+  case 145: goto L145;
+  case 154: goto L154;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 2);
+ L9:
+  _AOT_PAIRP_JUMP_UNLESS(9, L36);
+ L18:
+  _AOT_LOCAL_REF_CAR(18, 2);
+ L27:
+  _AOT_JUMP(27, L45);
+ L36:
+  _AOT_PUSH(36);
+ L45:
+  _AOT_PUSH(45);
+ L54:
+  _AOT_PUSH(54);
+ L63:
+  _AOT_EXIT(63);
+  /* MAKE-VECTOR */
+ L64:
+  _AOT_LOCAL_REF(64, 0);
+ L73:
+  _AOT_PUSH(73);
+ L82:
+  _AOT_STACK_REF(82, 3);
+ L91:
+  _AOT_EXIT(91);
+  /* VECTOR-SET */
+ L92:
+  _AOT_LOCAL_REF(92, 1);
+ L101:
+  _AOT_PUSH(101);
+ L110:
+  _AOT_STACK_REF(110, 3);
+ L119:
+  _AOT_EXIT(119);
+  /* VECTOR-SET */
+ L120:
+  _AOT_EXIT(120);
+  /* MAKE-PROCEDURE */
+ L145:
+  _AOT_TAIL_CALL(145, 1);
+ L154:
+  _AOT_RET(154);
+  _AOT_EXIT(155);
+}
+
+static const unsigned char sexp_aot_srfi_95_9_shape[] = {
+  22, 2, 0, 0, 0, 0, 0, 0, 0, 91, 26, 0, 0, 0, 0, 0,
+  0, 0, 81, 2, 0, 0, 0, 0, 0, 0, 0, 14, 17, 0, 0, 0,
+  0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 0, 15, 14, 1,
+  0, 0, 0, 0, 0, 0, 15, 9, 0, 0, 0, 0, 0, 0, 0, 39,
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0,
+  0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 22, 1, 0, 0,
+  0, 0, 0, 0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 21, 3,
+  0, 0, 0, 0, 0, 0, 0, 27, 38, 1, 0, 0, 0, 0, 0, 0,
+  0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_95_10 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 55: goto L55;
+  case 64: goto L64;
+  case 73: goto L73;
+  case 82: goto L82;
+  case 83: goto L83;
+  case 92: goto L92;
+  case 101: goto L101;
+  case 110: goto L110;
+  case 119: goto L119;
+  case 128: goto L128;
+  case 137: goto L137;
+  case 138: goto L138;
+  case 139: goto L139;
+  case 148: goto L148;
+  case 157: goto L157;
+  case 166: goto L166;
+  case 175: goto L175;
+  case 176: goto L176;
+  case 185: goto L185;
+  case 194: goto L194;
+  case 203: goto L203;
+  case 204: goto L204;
+  case 213: goto L213;
+  case 222: goto L222;
+  case 231: goto L231;
+  case 232: goto L232;
+  case 241: goto L241;
+  case 250: goto L250;
+  case 259: goto L259;
+  case 260: goto L260;
+  case 269: goto L269;
+  case 278: goto L278;
+  case 287: goto L287;
+  case 296: goto L296;
+  case 305: goto L305;
+  case 314: goto L314;
+  case 315: goto L315;
+  case 316: goto L316;
+  case 325: goto L325;
+  case 334: goto L334;
+  case 343: goto L343;
+  case 352: goto L352;
+  case 353: goto L353;
+  case 362: goto L362;
+  case 371: goto L371;
+  case 380: goto L380;
+  case 381: goto L381;
+  case 390: goto L390;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 1);
+ L9:
+  _AOT_LOCAL_REF(9, 0);
+ L18:
+  _AOT_CLOSURE_REF(18, 0);
+ L27:
+  _AOT_CALL(27, 2);
+ L36:
+  _AOT_JUMP_UNLESS(36, L222);
+ L45:
+  _AOT_CLOSURE_REF(45, 1);
+ L54:
+  _AOT_CDR(54);
+ L55:
+  _AOT_NULLP_JUMP_UNLESS(55, L101);
+ L64:
+  _AOT_CLOSURE_REF(64, 2);
+ L73:
+  _AOT_CLOSURE_REF(73, 1);
+ L82:
+  _AOT_EXIT(82);
+  /* SET-CDR */
+ L83:
+  _AOT_PUSH(83);
+ L92:
+  _AOT_JUMP(92, L203);
+ L101:
+  _AOT_CLOSURE_REF(101, 4);
+ L110:
+  _AOT_CLOSURE_REF(110, 0);
+ L119:
+  _AOT_LOCAL_REF(119, 1);
+ L128:
+  _AOT_CLOSURE_REF(128, 1);
+ L137:
+  _AOT_CDR(137);
+ L138:
+  _AOT_CAR(138);
+ L139:
+  _AOT_CLOSURE_REF(139, 4);
+ L148:
+  _AOT_CALL(148, 1);
+ L157:
+  _AOT_CLOSURE_REF(157, 2);
+ L166:
+  _AOT_CLOSURE_REF(166, 1);
+ L175:
+  _AOT_CDR(175);
+ L176:
+  _AOT_CLOSURE_REF(176, 1);
+ L185:
+  _AOT_CLOSURE_REF_CDR(185, 3);
+ L194:
+  _AOT_CALL(194, 7);
+ L203:
+  _AOT_DROP(203);
+ L204:
+  _AOT_CLOSURE_REF(204, 1);
+ L213:
+  _AOT_JUMP(213, L390);
+ L222:
+  _AOT_CLOSURE_REF(222, 2);
+ L231:
+  _AOT_CDR(231);
+ L232:
+  _AOT_NULLP_JUMP_UNLESS(232, L278);
+ L241:
+  _AOT_CLOSURE_REF(241, 1);
+ L250:
+  _AOT_CLOSURE_REF(250, 2);
+ L259:
+  _AOT_EXIT(259);
+  /* SET-CDR */
+ L260:
+  _AOT_PUSH(260);
+ L269:
+  _AOT_JUMP(269, L380);
+ L278:
+  _AOT_CLOSURE_REF(278, 4);
+ L287:
+  _AOT_CLOSURE_REF(287, 0);
+ L296:
+  _AOT_LOCAL_REF(296, 0);
+ L305:
+  _AOT_CLOSURE_REF(305, 2);
+ L314:
+  _AOT_CDR(314);
+ L315:
+  _AOT_CAR(315);
+ L316:
+  _AOT_CLOSURE_REF(316, 4);
+ L325:
+  _AOT_CALL(325, 1);
+ L334:
+  _AOT_CLOSURE_REF(334, 1);
+ L343:
+  _AOT_CLOSURE_REF(343, 2);
+ L352:
+  _AOT_CDR(352);
+ L353:
+  _AOT_CLOSURE_REF(353, 2);
+ L362:
+  _AOT_CLOSURE_REF_CDR(362, 3);
+ L371:
+  _AOT_CALL(371, 7);
+ L380:
+  _AOT_DROP(380);
+ L381:
+  _AOT_CLOSURE_REF(381, 2);
+ L390:
+  _AOT_RET(390);
+  _AOT_EXIT(391);
+}
+
+static const unsigned char sexp_aot_srfi_95_10_shape[] = {
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 6, 9, 0, 0, 0,
+  0, 0, 0, 0, 13, 185, 0, 0, 0, 0, 0, 0, 0, 24, 1, 0,
+  0, 0, 0, 0, 0, 0, 55, 90, 45, 0, 0, 0, 0, 0, 0, 0,
+  24, 2, 0, 0, 0, 0, 0, 0, 0, 24, 1, 0, 0, 0, 0, 0,
+  0, 0, 57, 15, 14, 1, 0, 0, 0, 0, 0, 0, 14, 110, 0, 0,
+  0, 0, 0, 0, 0, 24, 4, 0, 0, 0, 0, 0, 0, 0, 24, 0,
+  0, 0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0,
+  24, 1, 0, 0, 0, 0, 0, 0, 0, 55, 54, 24, 4, 0, 0, 0,
+  0, 0, 0, 0, 6, 5, 0, 0, 0, 0, 0, 0, 0, 24, 2, 0,
+  0, 0, 0, 0, 0, 0, 24, 1, 0, 0, 0, 0, 0, 0, 0, 55,
+  24, 1, 0, 0, 0, 0, 0, 0, 0, 83, 3, 0, 0, 0, 0, 0,
+  0, 0, 6, 29, 0, 0, 0, 0, 0, 0, 0, 17, 24, 1, 0, 0,
+  0, 0, 0, 0, 0, 14, 176, 0, 0, 0, 0, 0, 0, 0, 24, 2,
+  0, 0, 0, 0, 0, 0, 0, 55, 90, 45, 0, 0, 0, 0, 0, 0,
+  0, 24, 1, 0, 0, 0, 0, 0, 0, 0, 24, 2, 0, 0, 0, 0,
+  0, 0, 0, 57, 15, 14, 1, 0, 0, 0, 0, 0, 0, 14, 110, 0,
+  0, 0, 0, 0, 0, 0, 24, 4, 0, 0, 0, 0, 0, 0, 0, 24,
+  0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0,
+  0, 24, 2, 0, 0, 0, 0, 0, 0, 0, 55, 54, 24, 4, 0, 0,
+  0, 0, 0, 0, 0, 6, 5, 0, 0, 0, 0, 0, 0, 0, 24, 1,
+  0, 0, 0, 0, 0, 0, 0, 24, 2, 0, 0, 0, 0, 0, 0, 0,
+  55, 24, 2, 0, 0, 0, 0, 0, 0, 0, 83, 3, 0, 0, 0, 0,
+  0, 0, 0, 6, 29, 0, 0, 0, 0, 0, 0, 0, 17, 24, 2, 0,
+  0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_95_11 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 81: goto L81;
+  case 82: goto L82;
+  case 91: goto L91;
+  case 100: goto L100;
+  case 109: goto L109;
+  case 118: goto L118;
+  case 127: goto L127;
+  case 136: goto L136;
+  case 137: goto L137;
+  case 146: goto L146;
+  case 155: goto L155;
+  case 164: goto L164;
+  case 173: goto L173;
+  case 182: goto L182;
+  case 191: goto L191;
+  case 200: goto L200;
+  case 209: goto L209;
+  case 218: goto L218;
+  case 227: goto L227;
+  case 228: goto L228;
+  case 237: goto L237;
+  case 246: goto L246;
+  case 255: goto L255;
+  case 264: goto L264;
+  case 265: goto L265;
+  case 274: goto L274;
+  case 283: goto L283;
+  case 292: goto L292;
+  case 301: goto L301;
+  case 310: goto L310;
+  case 319: goto L319;
+  case 320: goto L320;
+  case 329: goto L329;
+  case 338: goto L338;
+  case 347: goto L347;
+  case 356: goto L356;
+  case 365: goto L365;
+  case 374: goto L374;
+  case 383: goto L383;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 4);
+ L9:
+  _AOT_LOCAL_REF(9, 3);
+ L18:
+  _AOT_LOCAL_REF(18, 5);
+ L27:
+  _AOT_CALL(27, 2);
+ L36:
+  _AOT_JUMP_UNLESS(36, L209);
+ L45:
+  _AOT_LOCAL_REF_CDR(45, 1);
+ L54:
+  _AOT_NULLP_JUMP_UNLESS(54, L100);
+ L63:
+  _AOT_LOCAL_REF(63, 2);
+ L72:
+  _AOT_LOCAL_REF(72, 1);
+ L81:
+  _AOT_EXIT(81);
+  /* SET-CDR */
+ L82:
+  _AOT_PUSH(82);
+ L91:
+  _AOT_JUMP(91, L200);
+ L100:
+  _AOT_LOCAL_REF(100, 6);
+ L109:
+  _AOT_LOCAL_REF(109, 5);
+ L118:
+  _AOT_LOCAL_REF(118, 4);
+ L127:
+  _AOT_LOCAL_REF_CDR(127, 1);
+ L136:
+  _AOT_CAR(136);
+ L137:
+  _AOT_LOCAL_REF(137, 6);
+ L146:
+  _AOT_CALL(146, 1);
+ L155:
+  _AOT_LOCAL_REF(155, 2);
+ L164:
+  _AOT_LOCAL_REF_CDR(164, 1);
+ L173:
+  _AOT_LOCAL_REF(173, 1);
+ L182:
+  _AOT_CLOSURE_REF_CDR(182, 0);
+ L191:
+  _AOT_TAIL_CALL(191, 7);
+ L200:
+  _AOT_JUMP(200, L383);
+ L209:
+  _AOT_LOCAL_REF(209, 2);
+ L218:
+  _AOT_LOCAL_REF(218, 0);
+ L227:
+  _AOT_EXIT(227);
+  /* SET-CDR */
+ L228:
+  _AOT_LOCAL_REF_CDR(228, 2);
+ L237:
+  _AOT_NULLP_JUMP_UNLESS(237, L283);
+ L246:
+  _AOT_LOCAL_REF(246, 1);
+ L255:
+  _AOT_LOCAL_REF(255, 2);
+ L264:
+  _AOT_EXIT(264);
+  /* SET-CDR */
+ L265:
+  _AOT_PUSH(265);
+ L274:
+  _AOT_JUMP(274, L383);
+ L283:
+  _AOT_LOCAL_REF(283, 6);
+ L292:
+  _AOT_LOCAL_REF(292, 5);
+ L301:
+  _AOT_LOCAL_REF(301, 3);
+ L310:
+  _AOT_LOCAL_REF_CDR(310, 2);
+ L319:
+  _AOT_CAR(319);
+ L320:
+  _AOT_LOCAL_REF(320, 6);
+ L329:
+  _AOT_CALL(329, 1);
+ L338:
+  _AOT_LOCAL_REF(338, 1);
+ L347:
+  _AOT_LOCAL_REF_CDR(347, 2);
+ L356:
+  _AOT_LOCAL_REF(356, 2);
+ L365:
+  _AOT_CLOSURE_REF_CDR(365, 0);
+ L374:
+  _AOT_TAIL_CALL(374, 7);
+ L383:
+  _AOT_RET(383);
+  _AOT_EXIT(384);
+}
+
+static const unsigned char sexp_aot_srfi_95_11_shape[] = {
+  22, 4, 0, 0, 0, 0, 0, 0, 0, 22, 3, 0, 0, 0, 0, 0,
+  0, 0, 22, 5, 0, 0, 0, 0, 0, 0, 0, 6, 9, 0, 0, 0,
+  0, 0, 0, 0, 13, 172, 0, 0, 0, 0, 0, 0, 0, 82, 1, 0,
+  0, 0, 0, 0, 0, 0, 90, 45, 0, 0, 0, 0, 0, 0, 0, 22,
+  2, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0, 0, 0, 0,
+  0, 57, 15, 14, 1, 0, 0, 0, 0, 0, 0, 14, 108, 0, 0, 0,
+  0, 0, 0, 0, 22, 6, 0, 0, 0, 0, 0, 0, 0, 22, 5, 0,
+  0, 0, 0, 0, 0, 0, 22, 4, 0, 0, 0, 0, 0, 0, 0, 82,
+  1, 0, 0, 0, 0, 0, 0, 0, 54, 22, 6, 0, 0, 0, 0, 0,
+  0, 0, 6, 5, 0, 0, 0, 0, 0, 0, 0, 22, 2, 0, 0, 0,
+  0, 0, 0, 0, 82, 1, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0,
+  0, 0, 0, 0, 0, 0, 83, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+  29, 0, 0, 0, 0, 0, 0, 0, 14, 182, 0, 0, 0, 0, 0, 0,
+  0, 22, 2, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0,
+  0, 0, 0, 57, 82, 2, 0, 0, 0, 0, 0, 0, 0, 90, 45, 0,
+  0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 22,
+  2, 0, 0, 0, 0, 0, 0, 0, 57, 15, 14, 1, 0, 0, 0, 0,
+  0, 0, 14, 108, 0, 0, 0, 0, 0, 0, 0, 22, 6, 0, 0, 0,
+  0, 0, 0, 0, 22, 5, 0, 0, 0, 0, 0, 0, 0, 22, 3, 0,
+  0, 0, 0, 0, 0, 0, 82, 2, 0, 0, 0, 0, 0, 0, 0, 54,
+  22, 6, 0, 0, 0, 0, 0, 0, 0, 6, 5, 0, 0, 0, 0, 0,
+  0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 82, 2, 0, 0, 0,
+  0, 0, 0, 0, 22, 2, 0, 0, 0, 0, 0, 0, 0, 83, 0, 0,
+  0, 0, 0, 0, 0, 0, 5, 29, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_95_12 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 28: goto L28;
+  case 37: goto L37;
+  case 46: goto L46;
+  case 55: goto L55;
+  case 56: goto L56;
+  case 65: goto L65;
+  case 74: goto L74;
+  case 83: goto L83;
+  case 84: goto L84;
+  case 109: goto L109;
+  case 118: goto L118;
+  case 119: goto L119;
+  case 128: goto L128;
+  case 137: goto L137;
+  case 146: goto L146;
+  case 155: goto L155;
+  case 164: goto L164;
+  case 173: goto L173;
+  case 182: goto L182;
+  case 191: goto L191;
+  case 200: goto L200;
+  case 201: goto L201;
+  case 210: goto L210;
+  case 219: goto L219;
+  case 228: goto L228;
+  case 229: goto L229;
+  case 238: goto L238;
+  case 247: goto L247;
+  case 256: goto L256;
+  case 265: goto L265;
+  case 266: goto L266;
+  case 275: goto L275;
+  case 284: goto L284;
+  case 293: goto L293;
+  case 294: goto L294;
+  case 303: goto L303;
+  case 312: goto L312;
+  case 321: goto L321;
+  case 322: goto L322;
+  case 331: goto L331;
+  case 340: goto L340;
+  case 349: goto L349;
+  case 350: goto L350;
+  case 359: goto L359;
+  case 368: goto L368;
+  case 377: goto L377;
+  case 378: goto L378;
+  case 387: goto L387;
+  case 396: goto L396;
+  case 405: goto L405;
+  case 406: goto L406;
+  case 431: goto L431;
+  case 440: goto L440;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_PUSH(0);
+ L9:
+  _AOT_LOCAL_REF(9, -5);
+ L18:
+  _AOT_PUSH(18);
+ L27:
+  _AOT_CONS(27);
+ L28:
+  _AOT_LOCAL_SET(28, -5);
+ L37:
+  _AOT_PUSH(37);
+ L46:
+  _AOT_PUSH(46);
+ L55:
+  _AOT_EXIT(55);
+  /* MAKE-VECTOR */
+ L56:
+  _AOT_LOCAL_REF(56, -5);
+ L65:
+  _AOT_PUSH(65);
+ L74:
+  _AOT_STACK_REF(74, 3);
+ L83:
+  _AOT_EXIT(83);
+  /* VECTOR-SET */
+ L84:
+  _AOT_EXIT(84);
+  /* MAKE-PROCEDURE */
+ L109:
+  _AOT_LOCAL_REF(109, -5);
+ L118:
+  _AOT_EXIT(118);
+  /* SET-CDR */
+ L119:
+  _AOT_CLOSURE_REF(119, 0);
+ L128:
+  _AOT_NULLP_JUMP_UNLESS(128, L155);
+ L137:
+  _AOT_CLOSURE_REF(137, 1);
+ L146:
+  _AOT_JUMP(146, L440);
+ L155:
+  _AOT_CLOSURE_REF(155, 1);
+ L164:
+  _AOT_NULLP_JUMP_UNLESS(164, L191);
+ L173:
+  _AOT_CLOSURE_REF(173, 0);
+ L182:
+  _AOT_JUMP(182, L440);
+ L191:
+  _AOT_CLOSURE_REF(191, 1);
+ L200:
+  _AOT_CAR(200);
+ L201:
+  _AOT_LOCAL_REF(201, 0);
+ L210:
+  _AOT_CALL(210, 1);
+ L219:
+  _AOT_CLOSURE_REF(219, 0);
+ L228:
+  _AOT_CAR(228);
+ L229:
+  _AOT_LOCAL_REF(229, 0);
+ L238:
+  _AOT_CALL(238, 1);
+ L247:
+  _AOT_PUSH(247);
+ L256:
+  _AOT_PUSH(256);
+ L265:
+  _AOT_EXIT(265);
+  /* MAKE-VECTOR */
+ L266:
+  _AOT_CLOSURE_REF(266, 2);
+ L275:
+  _AOT_PUSH(275);
+ L284:
+  _AOT_STACK_REF(284, 3);
+ L293:
+  _AOT_EXIT(293);
+  /* VECTOR-SET */
+ L294:
+  _AOT_CLOSURE_REF(294, 0);
+ L303:
+  _AOT_PUSH(303);
+ L312:
+  _AOT_STACK_REF(312, 3);
+ L321:
+  _AOT_EXIT(321);
+  /* VECTOR-SET */
+ L322:
+  _AOT_CLOSURE_REF(322, 1);
+ L331:
+  _AOT_PUSH(331);
+ L340:
+  _AOT_STACK_REF(340, 3);
+ L349:
+  _AOT_EXIT(349);
+  /* VECTOR-SET */
+ L350:
+  _AOT_LOCAL_REF(350, -5);
+ L359:
+  _AOT_PUSH(359);
+ L368:
+  _AOT_STACK_REF(368, 3);
+ L377:
+  _AOT_EXIT(377);
+  /* VECTOR-SET */
+ L378:
+  _AOT_LOCAL_REF(378, 0);
+ L387:
+  _AOT_PUSH(387);
+ L396:
+  _AOT_STACK_REF(396, 3);
+ L405:
+  _AOT_EXIT(405);
+  /* VECTOR-SET */
+ L406:
+  _AOT_EXIT(406);
+  /* MAKE-PROCEDURE */
+ L431:
+  _AOT_TAIL_CALL(431, 2);
+ L440:
+  _AOT_RET(440);
+  _AOT_EXIT(441);
+}
+
+static const unsigned char sexp_aot_srfi_95_12_shape[] = {
+  15, 78, 1, 0, 0, 0, 0, 0, 0, 22, 251, 255, 255, 255, 255, 255,
+  255, 255, 15, 199, 1, 0, 0, 0, 0, 0, 0, 58, 23, 251, 255, 255,
+  255, 255, 255, 255, 255, 15, 14, 1, 0, 0, 0, 0, 0, 0, 15, 5,
+  0, 0, 0, 0, 0, 0, 0, 39, 22, 251, 255, 255, 255, 255, 255, 255,
+  255, 15, 1, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0,
+  0, 0, 0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 29, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 251, 255,
+  255, 255, 255, 255, 255, 255, 57, 24, 0, 0, 0, 0, 0, 0, 0, 0,
+  90, 26, 0, 0, 0, 0, 0, 0, 0, 24, 1, 0, 0, 0, 0, 0,
+  0, 0, 14, 37, 1, 0, 0, 0, 0, 0, 0, 24, 1, 0, 0, 0,
+  0, 0, 0, 0, 90, 26, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0,
+  0, 0, 0, 0, 0, 0, 14, 1, 1, 0, 0, 0, 0, 0, 0, 24,
+  1, 0, 0, 0, 0, 0, 0, 0, 54, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 6, 5, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0,
+  0, 0, 0, 0, 54, 22, 0, 0, 0, 0, 0, 0, 0, 0, 6, 5,
+  0, 0, 0, 0, 0, 0, 0, 15, 14, 1, 0, 0, 0, 0, 0, 0,
+  15, 21, 0, 0, 0, 0, 0, 0, 0, 39, 24, 2, 0, 0, 0, 0,
+  0, 0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0,
+  0, 0, 0, 0, 0, 27, 24, 0, 0, 0, 0, 0, 0, 0, 0, 15,
+  5, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0,
+  0, 27, 24, 1, 0, 0, 0, 0, 0, 0, 0, 15, 9, 0, 0, 0,
+  0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 22, 251,
+  255, 255, 255, 255, 255, 255, 255, 15, 13, 0, 0, 0, 0, 0, 0, 0,
+  21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 22, 0, 0, 0, 0, 0,
+  0, 0, 0, 15, 17, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0,
+  0, 0, 0, 0, 0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 9,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+  9, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_95_13 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 64: goto L64;
+  case 73: goto L73;
+  case 82: goto L82;
+  case 91: goto L91;
+  case 92: goto L92;
+  case 101: goto L101;
+  case 110: goto L110;
+  case 119: goto L119;
+  case 120: goto L120;
+  case 129: goto L129;
+  case 138: goto L138;
+  case 147: goto L147;
+  case 148: goto L148;
+  case 173: goto L173;
+  case 182: goto L182;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 3);
+ L9:
+  _AOT_PAIRP_JUMP_UNLESS(9, L36);
+ L18:
+  _AOT_LOCAL_REF_CAR(18, 3);
+ L27:
+  _AOT_JUMP(27, L45);
+ L36:
+  _AOT_PUSH(36);
+ L45:
+  _AOT_PUSH(45);
+ L54:
+  _AOT_PUSH(54);
+ L63:
+  _AOT_EXIT(63);
+  /* MAKE-VECTOR */
+ L64:
+  _AOT_LOCAL_REF(64, 0);
+ L73:
+  _AOT_PUSH(73);
+ L82:
+  _AOT_STACK_REF(82, 3);
+ L91:
+  _AOT_EXIT(91);
+  /* VECTOR-SET */
+ L92:
+  _AOT_LOCAL_REF(92, 1);
+ L101:
+  _AOT_PUSH(101);
+ L110:
+  _AOT_STACK_REF(110, 3);
+ L119:
+  _AOT_EXIT(119);
+  /* VECTOR-SET */
+ L120:
+  _AOT_LOCAL_REF(120, 2);
+ L129:
+  _AOT_PUSH(129);
+ L138:
+  _AOT_STACK_REF(138, 3);
+ L147:
+  _AOT_EXIT(147);
+  /* VECTOR-SET */
+ L148:
+  _AOT_EXIT(148);
+  /* MAKE-PROCEDURE */
+ L173:
+  _AOT_TAIL_CALL(173, 1);
+ L182:
+  _AOT_RET(182);
+  _AOT_EXIT(183);
+}
+
+static const unsigned char sexp_aot_srfi_95_13_shape[] = {
+  22, 3, 0, 0, 0, 0, 0, 0, 0, 91, 26, 0, 0, 0, 0, 0,
+  0, 0, 81, 3, 0, 0, 0, 0, 0, 0, 0, 14, 17, 0, 0, 0,
+  0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 0, 15, 14, 1,
+  0, 0, 0, 0, 0, 0, 15, 13, 0, 0, 0, 0, 0, 0, 0, 39,
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0,
+  0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 22, 1, 0, 0,
+  0, 0, 0, 0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 21, 3,
+  0, 0, 0, 0, 0, 0, 0, 27, 22, 2, 0, 0, 0, 0, 0, 0,
+  0, 15, 9, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0,
+  0, 0, 0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 0,
+  0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_srfi_95_14 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 52: goto L52;
+  case 61: goto L61;
+  case 86: goto L86;
+  case 95: goto L95;
+  case 104: goto L104;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_CLOSURE_REF(9, 2);
+ L18:
+  _AOT_CLOSURE_REF(18, 1);
+ L27:
+  _AOT_GLOBAL_KNOWN_CALL(27, 1);
+ L52:
+  _AOT_CLOSURE_REF(52, 0);
+ L61:
+  _AOT_GLOBAL_KNOWN_CALL(61, 1);
+ L86:
+  _AOT_GLOBAL_KNOWN_REF(86);
+ L95:
+  _AOT_TAIL_CALL(95, 4);
+ L104:
+  _AOT_RET(104);
+  _AOT_EXIT(105);
+}
+
+static const unsigned char sexp_aot_srfi_95_14_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 24, 2, 0, 0, 0, 0, 0,
+  0, 0, 24, 1, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0,
+  0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+  17, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static struct sexp_aot_proc_t sexp_aot_srfi_95_procs[] = {
+  {sexp_aot_srfi_95_0_shape, 121, sexp_aot_srfi_95_0, 0},
+  {sexp_aot_srfi_95_1_shape, 129, sexp_aot_srfi_95_1, 0},
+  {sexp_aot_srfi_95_2_shape, 129, sexp_aot_srfi_95_2, 0},
+  {sexp_aot_srfi_95_3_shape, 164, sexp_aot_srfi_95_3, 0},
+  {sexp_aot_srfi_95_4_shape, 62, sexp_aot_srfi_95_4, 0},
+  {sexp_aot_srfi_95_5_shape, 209, sexp_aot_srfi_95_5, 0},
+  {sexp_aot_srfi_95_6_shape, 172, sexp_aot_srfi_95_6, 0},
+  {sexp_aot_srfi_95_7_shape, 212, sexp_aot_srfi_95_7, 0},
+  {sexp_aot_srfi_95_8_shape, 421, sexp_aot_srfi_95_8, 0},
+  {sexp_aot_srfi_95_9_shape, 155, sexp_aot_srfi_95_9, 0},
+  {sexp_aot_srfi_95_10_shape, 391, sexp_aot_srfi_95_10, 0},
+  {sexp_aot_srfi_95_11_shape, 384, sexp_aot_srfi_95_11, 0},
+  {sexp_aot_srfi_95_12_shape, 441, sexp_aot_srfi_95_12, 0},
+  {sexp_aot_srfi_95_13_shape, 183, sexp_aot_srfi_95_13, 0},
+  {sexp_aot_srfi_95_14_shape, 105, sexp_aot_srfi_95_14, 0},
+  {NULL, 0, NULL, 0}
+};
+
+static struct sexp_aot_library_t sexp_aot_srfi_95_library = {sexp_aot_srfi_95_procs, NULL, 0};
+
+static sexp sexp_aot_srfi_95_init (sexp ctx, sexp self, sexp_sint_t n, sexp env, const char* version, const sexp_abi_identifier_t abi) {
+  sexp_aot_register(&sexp_aot_srfi_95_library);
+  return SEXP_VOID;
+}
+
+static sexp_sint_t sexp_aot_chibi_char_set_base_0 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 10: goto L10;
+  case 19: goto L19;
+  case 28: goto L28;
+  case 37: goto L37;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 1);
+ L9:
+  _AOT_EXIT(9);
+  /* CHAR->INTEGER */
+ L10:
+  _AOT_LOCAL_REF(10, 0);
+ L19:
+  _AOT_GLOBAL_KNOWN_REF(19);
+ L28:
+  _AOT_TAIL_CALL(28, 2);
+ L37:
+  _AOT_RET(37);
+  _AOT_EXIT(38);
+}
+
+static const unsigned char sexp_aot_chibi_char_set_base_0_shape[] = {
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 69, 22, 0, 0, 0, 0, 0,
+  0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 5, 9, 0, 0,
+  0, 0, 0, 0, 0, 79
+};
+
+static struct sexp_aot_proc_t sexp_aot_chibi_char_set_base_procs[] = {
+  {sexp_aot_chibi_char_set_base_0_shape, 38, sexp_aot_chibi_char_set_base_0, 0},
+  {NULL, 0, NULL, 0}
+};
+
+static struct sexp_aot_library_t sexp_aot_chibi_char_set_base_library = {sexp_aot_chibi_char_set_base_procs, NULL, 0};
+
+static sexp sexp_aot_chibi_char_set_base_init (sexp ctx, sexp self, sexp_sint_t n, sexp env, const char* version, const sexp_abi_identifier_t abi) {
+  sexp_aot_register(&sexp_aot_chibi_char_set_base_library);
+  return SEXP_VOID;
+}
+
+static sexp_sint_t sexp_aot_chibi_string_0 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_PUSH(0);
+ L9:
+  _AOT_LOCAL_REF(9, 0);
+ L18:
+  _AOT_EXIT(18);
+  /* FCALL2 */
+ L27:
+  _AOT_RET(27);
+  _AOT_EXIT(28);
+}
+
+static const unsigned char sexp_aot_chibi_string_0_shape[] = {
+  15, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_1 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_CLOSURE_REF(9, 0);
+ L18:
+  _AOT_GLOBAL_KNOWN_REF(18);
+ L27:
+  _AOT_TAIL_CALL(27, 2);
+ L36:
+  _AOT_RET(36);
+  _AOT_EXIT(37);
+}
+
+static const unsigned char sexp_aot_chibi_string_1_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0,
+  0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 5, 9, 0, 0, 0,
+  0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_2 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 19: goto L19;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_CLOSURE_REF(0, 0);
+ L9:
+  _AOT_LOCAL_REF(9, 0);
+ L18:
+  _AOT_EQ(18);
+ L19:
+  _AOT_RET(19);
+  _AOT_EXIT(20);
+}
+
+static const unsigned char sexp_aot_chibi_string_2_shape[] = {
+  24, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 68, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_3 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 34: goto L34;
+  case 43: goto L43;
+  case 52: goto L52;
+  case 61: goto L61;
+  case 70: goto L70;
+  case 71: goto L71;
+  case 80: goto L80;
+  case 89: goto L89;
+  case 98: goto L98;
+  case 99: goto L99;
+  case 108: goto L108;
+  case 117: goto L117;
+  case 126: goto L126;
+  case 127: goto L127;
+  case 152: goto L152;
+  case 161: goto L161;
+  case 170: goto L170;
+  case 179: goto L179;
+  case 188: goto L188;
+  case 197: goto L197;
+  case 206: goto L206;
+  case 207: goto L207;
+  case 216: goto L216;
+  case 225: goto L225;
+  case 234: goto L234;
+  case 235: goto L235;
+  case 260: goto L260;
+  case 269: goto L269;
+  case 278: goto L278;
+  case 287: goto L287;
+  case 296: goto L296;
+  case 305: goto L305;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_GLOBAL_KNOWN_CALL(9, 1);
+ L34:
+  _AOT_JUMP_UNLESS(34, L61);
+ L43:
+  _AOT_LOCAL_REF(43, 0);
+ L52:
+  _AOT_JUMP(52, L305);
+ L61:
+  _AOT_LOCAL_REF(61, 0);
+ L70:
+  _AOT_EXIT(70);
+  /* CHAR? */
+ L71:
+  _AOT_JUMP_UNLESS(71, L161);
+ L80:
+  _AOT_PUSH(80);
+ L89:
+  _AOT_PUSH(89);
+ L98:
+  _AOT_EXIT(98);
+  /* MAKE-VECTOR */
+ L99:
+  _AOT_LOCAL_REF(99, 0);
+ L108:
+  _AOT_PUSH(108);
+ L117:
+  _AOT_STACK_REF(117, 3);
+ L126:
+  _AOT_EXIT(126);
+  /* VECTOR-SET */
+ L127:
+  _AOT_EXIT(127);
+  /* MAKE-PROCEDURE */
+ L152:
+  _AOT_JUMP(152, L305);
+ L161:
+  _AOT_LOCAL_REF(161, 0);
+ L170:
+  _AOT_TYPEP(170, 37);
+ L179:
+  _AOT_JUMP_UNLESS(179, L269);
+ L188:
+  _AOT_PUSH(188);
+ L197:
+  _AOT_PUSH(197);
+ L206:
+  _AOT_EXIT(206);
+  /* MAKE-VECTOR */
+ L207:
+  _AOT_LOCAL_REF(207, 0);
+ L216:
+  _AOT_PUSH(216);
+ L225:
+  _AOT_STACK_REF(225, 3);
+ L234:
+  _AOT_EXIT(234);
+  /* VECTOR-SET */
+ L235:
+  _AOT_EXIT(235);
+  /* MAKE-PROCEDURE */
+ L260:
+  _AOT_JUMP(260, L305);
+ L269:
+  _AOT_LOCAL_REF(269, 0);
+ L278:
+  _AOT_PUSH(278);
+ L287:
+  _AOT_GLOBAL_KNOWN_REF(287);
+ L296:
+  _AOT_TAIL_CALL(296, 2);
+ L305:
+  _AOT_RET(305);
+  _AOT_EXIT(306);
+}
+
+static const unsigned char sexp_aot_chibi_string_3_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0,
+  0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 13, 26, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0,
+  0, 0, 0, 0, 14, 252, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0,
+  0, 0, 0, 0, 0, 0, 45, 13, 89, 0, 0, 0, 0, 0, 0, 0,
+  15, 14, 1, 0, 0, 0, 0, 0, 0, 15, 5, 0, 0, 0, 0, 0,
+  0, 0, 39, 22, 0, 0, 0, 0, 0, 0, 0, 0, 15, 1, 0, 0,
+  0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 38,
+  1, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 14, 152, 0, 0, 0, 0, 0, 0,
+  0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 47, 37, 0, 0, 0, 0,
+  0, 0, 0, 13, 89, 0, 0, 0, 0, 0, 0, 0, 15, 14, 1, 0,
+  0, 0, 0, 0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 39, 22,
+  0, 0, 0, 0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0, 0,
+  0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 38, 1, 0, 0, 0,
+  0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 14, 44, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0,
+  0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 0, 19,
+  0, 0, 0, 0, 0, 0, 0, 0, 5, 9, 0, 0, 0, 0, 0, 0,
+  0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_4 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 17: goto L17;
+  case 26: goto L26;
+  case 35: goto L35;
+  case 44: goto L44;
+  case 53: goto L53;
+  case 62: goto L62;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF_JUMP_UNLESS(0, 0, L35);
+ L17:
+  _AOT_LOCAL_REF(17, 0);
+ L26:
+  _AOT_JUMP(26, L62);
+ L35:
+  _AOT_CLOSURE_REF(35, 1);
+ L44:
+  _AOT_CLOSURE_REF_CDR(44, 0);
+ L53:
+  _AOT_TAIL_CALL(53, 1);
+ L62:
+  _AOT_RET(62);
+  _AOT_EXIT(63);
+}
+
+static const unsigned char sexp_aot_chibi_string_4_shape[] = {
+  84, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0, 0, 0,
+  0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 14, 35, 0, 0, 0, 0,
+  0, 0, 0, 24, 1, 0, 0, 0, 0, 0, 0, 0, 83, 0, 0, 0,
+  0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_5 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 81: goto L81;
+  case 90: goto L90;
+  case 99: goto L99;
+  case 108: goto L108;
+  case 109: goto L109;
+  case 118: goto L118;
+  case 127: goto L127;
+  case 136: goto L136;
+  case 137: goto L137;
+  case 146: goto L146;
+  case 155: goto L155;
+  case 164: goto L164;
+  case 165: goto L165;
+  case 190: goto L190;
+  case 199: goto L199;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_CLOSURE_REF(9, 0);
+ L18:
+  _AOT_LE_JUMP_UNLESS(18, L63);
+ L27:
+  _AOT_LOCAL_REF(27, 1);
+ L36:
+  _AOT_CLOSURE_REF(36, 1);
+ L45:
+  _AOT_TAIL_CALL(45, 1);
+ L54:
+  _AOT_JUMP(54, L199);
+ L63:
+  _AOT_LOCAL_REF(63, 1);
+ L72:
+  _AOT_CLOSURE_REF(72, 1);
+ L81:
+  _AOT_CALL(81, 1);
+ L90:
+  _AOT_PUSH(90);
+ L99:
+  _AOT_PUSH(99);
+ L108:
+  _AOT_EXIT(108);
+  /* MAKE-VECTOR */
+ L109:
+  _AOT_CLOSURE_REF(109, 2);
+ L118:
+  _AOT_PUSH(118);
+ L127:
+  _AOT_STACK_REF(127, 3);
+ L136:
+  _AOT_EXIT(136);
+  /* VECTOR-SET */
+ L137:
+  _AOT_LOCAL_REF(137, 0);
+ L146:
+  _AOT_PUSH(146);
+ L155:
+  _AOT_STACK_REF(155, 3);
+ L164:
+  _AOT_EXIT(164);
+  /* VECTOR-SET */
+ L165:
+  _AOT_EXIT(165);
+  /* MAKE-PROCEDURE */
+ L190:
+  _AOT_TAIL_CALL(190, 1);
+ L199:
+  _AOT_RET(199);
+  _AOT_EXIT(200);
+}
+
+static const unsigned char sexp_aot_chibi_string_5_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0,
+  0, 0, 87, 44, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0,
+  0, 0, 0, 0, 24, 1, 0, 0, 0, 0, 0, 0, 0, 5, 5, 0,
+  0, 0, 0, 0, 0, 0, 14, 144, 0, 0, 0, 0, 0, 0, 0, 22,
+  1, 0, 0, 0, 0, 0, 0, 0, 24, 1, 0, 0, 0, 0, 0, 0,
+  0, 6, 5, 0, 0, 0, 0, 0, 0, 0, 15, 14, 1, 0, 0, 0,
+  0, 0, 0, 15, 9, 0, 0, 0, 0, 0, 0, 0, 39, 24, 2, 0,
+  0, 0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0, 21,
+  3, 0, 0, 0, 0, 0, 0, 0, 27, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0,
+  0, 0, 0, 0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 5, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5,
+  0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_6 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 19: goto L19;
+  case 28: goto L28;
+  case 37: goto L37;
+  case 38: goto L38;
+  case 47: goto L47;
+  case 56: goto L56;
+  case 57: goto L57;
+  case 66: goto L66;
+  case 75: goto L75;
+  case 84: goto L84;
+  case 85: goto L85;
+  case 94: goto L94;
+  case 103: goto L103;
+  case 112: goto L112;
+  case 113: goto L113;
+  case 122: goto L122;
+  case 131: goto L131;
+  case 140: goto L140;
+  case 141: goto L141;
+  case 166: goto L166;
+  case 175: goto L175;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_CLOSURE_REF(9, 3);
+ L18:
+  _AOT_EXIT(18);
+  /* STRING-REF */
+ L19:
+  _AOT_LOCAL_REF(19, 0);
+ L28:
+  _AOT_CLOSURE_REF(28, 3);
+ L37:
+  _AOT_EXIT(37);
+  /* STRING-CURSOR-NEXT */
+ L38:
+  _AOT_PUSH(38);
+ L47:
+  _AOT_PUSH(47);
+ L56:
+  _AOT_EXIT(56);
+  /* MAKE-VECTOR */
+ L57:
+  _AOT_CLOSURE_REF(57, 2);
+ L66:
+  _AOT_PUSH(66);
+ L75:
+  _AOT_STACK_REF(75, 3);
+ L84:
+  _AOT_EXIT(84);
+  /* VECTOR-SET */
+ L85:
+  _AOT_CLOSURE_REF(85, 1);
+ L94:
+  _AOT_PUSH(94);
+ L103:
+  _AOT_STACK_REF(103, 3);
+ L112:
+  _AOT_EXIT(112);
+  /* VECTOR-SET */
+ L113:
+  _AOT_CLOSURE_REF(113, 0);
+ L122:
+  _AOT_PUSH(122);
+ L131:
+  _AOT_STACK_REF(131, 3);
+ L140:
+  _AOT_EXIT(140);
+  /* VECTOR-SET */
+ L141:
+  _AOT_EXIT(141);
+  /* MAKE-PROCEDURE */
+ L166:
+  _AOT_TAIL_CALL(166, 2);
+ L175:
+  _AOT_RET(175);
+  _AOT_EXIT(176);
+}
+
+static const unsigned char sexp_aot_chibi_string_6_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 24, 3, 0, 0, 0, 0, 0,
+  0, 0, 32, 22, 0, 0, 0, 0, 0, 0, 0, 0, 24, 3, 0, 0,
+  0, 0, 0, 0, 0, 35, 15, 14, 1, 0, 0, 0, 0, 0, 0, 15,
+  13, 0, 0, 0, 0, 0, 0, 0, 39, 24, 2, 0, 0, 0, 0, 0,
+  0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0,
+  0, 0, 0, 0, 27, 24, 1, 0, 0, 0, 0, 0, 0, 0, 15, 5,
+  0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0,
+  27, 24, 0, 0, 0, 0, 0, 0, 0, 0, 15, 9, 0, 0, 0, 0,
+  0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 38, 1, 0,
+  0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 5, 9, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_7 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 43: goto L43;
+  case 52: goto L52;
+  case 61: goto L61;
+  case 86: goto L86;
+  case 95: goto L95;
+  case 104: goto L104;
+  case 105: goto L105;
+  case 114: goto L114;
+  case 123: goto L123;
+  case 132: goto L132;
+  case 133: goto L133;
+  case 142: goto L142;
+  case 151: goto L151;
+  case 160: goto L160;
+  case 161: goto L161;
+  case 170: goto L170;
+  case 179: goto L179;
+  case 188: goto L188;
+  case 189: goto L189;
+  case 214: goto L214;
+  case 223: goto L223;
+  case 232: goto L232;
+  case 241: goto L241;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 1);
+ L9:
+  _AOT_CLOSURE_REF(9, 0);
+ L18:
+  _AOT_GLOBAL_KNOWN_CALL(18, 1);
+ L43:
+  _AOT_LT_JUMP_UNLESS(43, L232);
+ L52:
+  _AOT_CLOSURE_REF(52, 0);
+ L61:
+  _AOT_GLOBAL_KNOWN_CALL(61, 1);
+ L86:
+  _AOT_PUSH(86);
+ L95:
+  _AOT_PUSH(95);
+ L104:
+  _AOT_EXIT(104);
+  /* MAKE-VECTOR */
+ L105:
+  _AOT_LOCAL_REF(105, 0);
+ L114:
+  _AOT_PUSH(114);
+ L123:
+  _AOT_STACK_REF(123, 3);
+ L132:
+  _AOT_EXIT(132);
+  /* VECTOR-SET */
+ L133:
+  _AOT_LOCAL_REF(133, 1);
+ L142:
+  _AOT_PUSH(142);
+ L151:
+  _AOT_STACK_REF(151, 3);
+ L160:
+  _AOT_EXIT(160);
+  /* VECTOR-SET */
+ L161:
+  _AOT_CLOSURE_REF(161, 0);
+ L170:
+  _AOT_PUSH(170);
+ L179:
+  _AOT_STACK_REF(179, 3);
+ L188:
+  _AOT_EXIT(188);
+  /* VECTOR-SET */
+ L189:
+  _AOT_EXIT(189);
+  /* MAKE-PROCEDURE */
+ L214:
+  _AOT_TAIL_CALL(214, 1);
+ L223:
+  _AOT_JUMP(223, L241);
+ L232:
+  _AOT_PUSH(232);
+ L241:
+  _AOT_RET(241);
+  _AOT_EXIT(242);
+}
+
+static const unsigned char sexp_aot_chibi_string_7_shape[] = {
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0,
+  0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 86, 188, 0, 0, 0,
+  0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0,
+  0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 15, 14, 1, 0, 0, 0, 0, 0, 0, 15,
+  13, 0, 0, 0, 0, 0, 0, 0, 39, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0,
+  0, 0, 0, 0, 27, 22, 1, 0, 0, 0, 0, 0, 0, 0, 15, 5,
+  0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0,
+  27, 24, 0, 0, 0, 0, 0, 0, 0, 0, 15, 9, 0, 0, 0, 0,
+  0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 38, 1, 0,
+  0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 14,
+  17, 0, 0, 0, 0, 0, 0, 0, 15, 14, 0, 0, 0, 0, 0, 0,
+  0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_8 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 10: goto L10;
+  case 19: goto L19;
+  case 44: goto L44;
+  case 53: goto L53;
+  case 62: goto L62;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 81: goto L81;
+  case 90: goto L90;
+  case 91: goto L91;
+  case 116: goto L116;
+  case 125: goto L125;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 1);
+ L9:
+  _AOT_EXIT(9);
+  /* STRING-SIZE */
+ L10:
+  _AOT_LOCAL_REF(10, 0);
+ L19:
+  _AOT_GLOBAL_KNOWN_CALL(19, 1);
+ L44:
+  _AOT_PUSH(44);
+ L53:
+  _AOT_PUSH(53);
+ L62:
+  _AOT_EXIT(62);
+  /* MAKE-VECTOR */
+ L63:
+  _AOT_LOCAL_REF(63, 1);
+ L72:
+  _AOT_PUSH(72);
+ L81:
+  _AOT_STACK_REF(81, 3);
+ L90:
+  _AOT_EXIT(90);
+  /* VECTOR-SET */
+ L91:
+  _AOT_EXIT(91);
+  /* MAKE-PROCEDURE */
+ L116:
+  _AOT_TAIL_CALL(116, 2);
+ L125:
+  _AOT_RET(125);
+  _AOT_EXIT(126);
+}
+
+static const unsigned char sexp_aot_chibi_string_8_shape[] = {
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 37, 22, 0, 0, 0, 0, 0,
+  0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 14, 1, 0,
+  0, 0, 0, 0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 39, 22,
+  1, 0, 0, 0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0, 0,
+  0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 38, 1, 0, 0, 0,
+  0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 9, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_9 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 43: goto L43;
+  case 68: goto L68;
+  case 93: goto L93;
+  case 102: goto L102;
+  case 111: goto L111;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 1);
+ L9:
+  _AOT_LOCAL_REF(9, 0);
+ L18:
+  _AOT_GLOBAL_KNOWN_CALL(18, 1);
+ L43:
+  _AOT_GLOBAL_KNOWN_CALL(43, 1);
+ L68:
+  _AOT_GLOBAL_KNOWN_CALL(68, 2);
+ L93:
+  _AOT_GLOBAL_KNOWN_REF(93);
+ L102:
+  _AOT_TAIL_CALL(102, 1);
+ L111:
+  _AOT_RET(111);
+  _AOT_EXIT(112);
+}
+
+static const unsigned char sexp_aot_chibi_string_9_shape[] = {
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0,
+  0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_10 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 64: goto L64;
+  case 73: goto L73;
+  case 82: goto L82;
+  case 91: goto L91;
+  case 100: goto L100;
+  case 109: goto L109;
+  case 118: goto L118;
+  case 127: goto L127;
+  case 128: goto L128;
+  case 137: goto L137;
+  case 146: goto L146;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_CLOSURE_REF(9, 0);
+ L18:
+  _AOT_LE_JUMP_UNLESS(18, L45);
+ L27:
+  _AOT_CLOSURE_REF(27, 0);
+ L36:
+  _AOT_JUMP(36, L146);
+ L45:
+  _AOT_LOCAL_REF(45, 0);
+ L54:
+  _AOT_CLOSURE_REF(54, 2);
+ L63:
+  _AOT_EXIT(63);
+  /* STRING-REF */
+ L64:
+  _AOT_CLOSURE_REF(64, 1);
+ L73:
+  _AOT_CALL(73, 1);
+ L82:
+  _AOT_JUMP_UNLESS(82, L109);
+ L91:
+  _AOT_LOCAL_REF(91, 0);
+ L100:
+  _AOT_JUMP(100, L146);
+ L109:
+  _AOT_LOCAL_REF(109, 0);
+ L118:
+  _AOT_CLOSURE_REF(118, 2);
+ L127:
+  _AOT_EXIT(127);
+  /* STRING-CURSOR-NEXT */
+ L128:
+  _AOT_CLOSURE_REF_CDR(128, 3);
+ L137:
+  _AOT_TAIL_CALL(137, 1);
+ L146:
+  _AOT_RET(146);
+  _AOT_EXIT(147);
+}
+
+static const unsigned char sexp_aot_chibi_string_10_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0,
+  0, 0, 87, 26, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0,
+  0, 0, 0, 0, 14, 109, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0,
+  0, 0, 0, 0, 0, 0, 24, 2, 0, 0, 0, 0, 0, 0, 0, 32,
+  24, 1, 0, 0, 0, 0, 0, 0, 0, 6, 5, 0, 0, 0, 0, 0,
+  0, 0, 13, 26, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0,
+  0, 0, 0, 0, 14, 45, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0,
+  0, 0, 0, 0, 0, 0, 24, 2, 0, 0, 0, 0, 0, 0, 0, 35,
+  83, 3, 0, 0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 0,
+  0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_11 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 28: goto L28;
+  case 37: goto L37;
+  case 46: goto L46;
+  case 71: goto L71;
+  case 80: goto L80;
+  case 89: goto L89;
+  case 90: goto L90;
+  case 99: goto L99;
+  case 108: goto L108;
+  case 117: goto L117;
+  case 118: goto L118;
+  case 127: goto L127;
+  case 136: goto L136;
+  case 145: goto L145;
+  case 146: goto L146;
+  case 155: goto L155;
+  case 164: goto L164;
+  case 173: goto L173;
+  case 174: goto L174;
+  case 199: goto L199;
+  case 208: goto L208;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_CLOSURE_REF(0, 1);
+ L9:
+  _AOT_PAIRP_JUMP_UNLESS(9, L37);
+ L18:
+  _AOT_CLOSURE_REF(18, 1);
+ L27:
+  _AOT_CAR(27);
+ L28:
+  _AOT_JUMP(28, L71);
+ L37:
+  _AOT_CLOSURE_REF(37, 0);
+ L46:
+  _AOT_GLOBAL_KNOWN_CALL(46, 1);
+ L71:
+  _AOT_PUSH(71);
+ L80:
+  _AOT_PUSH(80);
+ L89:
+  _AOT_EXIT(89);
+  /* MAKE-VECTOR */
+ L90:
+  _AOT_LOCAL_REF(90, 1);
+ L99:
+  _AOT_PUSH(99);
+ L108:
+  _AOT_STACK_REF(108, 3);
+ L117:
+  _AOT_EXIT(117);
+  /* VECTOR-SET */
+ L118:
+  _AOT_LOCAL_REF(118, 0);
+ L127:
+  _AOT_PUSH(127);
+ L136:
+  _AOT_STACK_REF(136, 3);
+ L145:
+  _AOT_EXIT(145);
+  /* VECTOR-SET */
+ L146:
+  _AOT_CLOSURE_REF(146, 0);
+ L155:
+  _AOT_PUSH(155);
+ L164:
+  _AOT_STACK_REF(164, 3);
+ L173:
+  _AOT_EXIT(173);
+  /* VECTOR-SET */
+ L174:
+  _AOT_EXIT(174);
+  /* MAKE-PROCEDURE */
+ L199:
+  _AOT_TAIL_CALL(199, 1);
+ L208:
+  _AOT_RET(208);
+  _AOT_EXIT(209);
+}
+
+static const unsigned char sexp_aot_chibi_string_11_shape[] = {
+  24, 1, 0, 0, 0, 0, 0, 0, 0, 91, 27, 0, 0, 0, 0, 0,
+  0, 0, 24, 1, 0, 0, 0, 0, 0, 0, 0, 54, 14, 42, 0, 0,
+  0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0,
+  0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 15, 14, 1, 0, 0, 0, 0, 0, 0,
+  15, 13, 0, 0, 0, 0, 0, 0, 0, 39, 22, 1, 0, 0, 0, 0,
+  0, 0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0,
+  0, 0, 0, 0, 0, 27, 22, 0, 0, 0, 0, 0, 0, 0, 0, 15,
+  5, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0,
+  0, 27, 24, 0, 0, 0, 0, 0, 0, 0, 0, 15, 9, 0, 0, 0,
+  0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 38, 1,
+  0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0,
+  79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_12 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 97: goto L97;
+  case 106: goto L106;
+  case 115: goto L115;
+  case 116: goto L116;
+  case 125: goto L125;
+  case 150: goto L150;
+  case 159: goto L159;
+  case 168: goto L168;
+  case 169: goto L169;
+  case 178: goto L178;
+  case 187: goto L187;
+  case 196: goto L196;
+  case 197: goto L197;
+  case 206: goto L206;
+  case 215: goto L215;
+  case 224: goto L224;
+  case 225: goto L225;
+  case 250: goto L250;
+  case 259: goto L259;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 2);
+ L9:
+  _AOT_PAIRP_JUMP_UNLESS(9, L45);
+ L18:
+  _AOT_LOCAL_REF_CDR(18, 2);
+ L27:
+  _AOT_TYPEP(27, 6);
+ L36:
+  _AOT_JUMP(36, L54);
+ L45:
+  _AOT_PUSH(45);
+ L54:
+  _AOT_JUMP_UNLESS(54, L106);
+ L63:
+  _AOT_LOCAL_REF(63, 2);
+ L72:
+  _AOT_GLOBAL_KNOWN_CALL(72, 1);
+ L97:
+  _AOT_JUMP(97, L116);
+ L106:
+  _AOT_LOCAL_REF(106, 0);
+ L115:
+  _AOT_EXIT(115);
+  /* STRING-SIZE */
+ L116:
+  _AOT_LOCAL_REF(116, 1);
+ L125:
+  _AOT_GLOBAL_KNOWN_CALL(125, 1);
+ L150:
+  _AOT_PUSH(150);
+ L159:
+  _AOT_PUSH(159);
+ L168:
+  _AOT_EXIT(168);
+  /* MAKE-VECTOR */
+ L169:
+  _AOT_LOCAL_REF(169, 0);
+ L178:
+  _AOT_PUSH(178);
+ L187:
+  _AOT_STACK_REF(187, 3);
+ L196:
+  _AOT_EXIT(196);
+  /* VECTOR-SET */
+ L197:
+  _AOT_LOCAL_REF(197, 2);
+ L206:
+  _AOT_PUSH(206);
+ L215:
+  _AOT_STACK_REF(215, 3);
+ L224:
+  _AOT_EXIT(224);
+  /* VECTOR-SET */
+ L225:
+  _AOT_EXIT(225);
+  /* MAKE-PROCEDURE */
+ L250:
+  _AOT_TAIL_CALL(250, 2);
+ L259:
+  _AOT_RET(259);
+  _AOT_EXIT(260);
+}
+
+static const unsigned char sexp_aot_chibi_string_12_shape[] = {
+  22, 2, 0, 0, 0, 0, 0, 0, 0, 91, 35, 0, 0, 0, 0, 0,
+  0, 0, 82, 2, 0, 0, 0, 0, 0, 0, 0, 47, 6, 0, 0, 0,
+  0, 0, 0, 0, 14, 17, 0, 0, 0, 0, 0, 0, 0, 15, 14, 0,
+  0, 0, 0, 0, 0, 0, 13, 51, 0, 0, 0, 0, 0, 0, 0, 22,
+  2, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0,
+  0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 14, 18, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0,
+  0, 0, 0, 37, 22, 1, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0,
+  0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 15, 14, 1, 0, 0, 0, 0, 0, 0, 15,
+  9, 0, 0, 0, 0, 0, 0, 0, 39, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0,
+  0, 0, 0, 0, 27, 22, 2, 0, 0, 0, 0, 0, 0, 0, 15, 5,
+  0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0,
+  27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 9, 0, 0, 0, 0,
+  0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_13 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 70: goto L70;
+  case 71: goto L71;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 1);
+ L9:
+  _AOT_LOCAL_REF(9, 1);
+ L18:
+  _AOT_LOCAL_REF(18, 0);
+ L27:
+  _AOT_CLOSURE_REF(27, 1);
+ L36:
+  _AOT_CLOSURE_REF(36, 0);
+ L45:
+  _AOT_GLOBAL_KNOWN_CALL(45, 4);
+ L70:
+  _AOT_LT(70);
+ L71:
+  _AOT_RET(71);
+  _AOT_EXIT(72);
+}
+
+static const unsigned char sexp_aot_chibi_string_13_shape[] = {
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0, 0, 0,
+  0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 24, 1, 0, 0, 0,
+  0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0,
+  0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 65, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_14 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 97: goto L97;
+  case 106: goto L106;
+  case 115: goto L115;
+  case 116: goto L116;
+  case 125: goto L125;
+  case 134: goto L134;
+  case 143: goto L143;
+  case 152: goto L152;
+  case 161: goto L161;
+  case 186: goto L186;
+  case 195: goto L195;
+  case 204: goto L204;
+  case 205: goto L205;
+  case 214: goto L214;
+  case 223: goto L223;
+  case 232: goto L232;
+  case 233: goto L233;
+  case 242: goto L242;
+  case 251: goto L251;
+  case 260: goto L260;
+  case 261: goto L261;
+  case 286: goto L286;
+  case 295: goto L295;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 2);
+ L9:
+  _AOT_PAIRP_JUMP_UNLESS(9, L45);
+ L18:
+  _AOT_LOCAL_REF_CDR(18, 2);
+ L27:
+  _AOT_TYPEP(27, 6);
+ L36:
+  _AOT_JUMP(36, L54);
+ L45:
+  _AOT_PUSH(45);
+ L54:
+  _AOT_JUMP_UNLESS(54, L106);
+ L63:
+  _AOT_LOCAL_REF(63, 2);
+ L72:
+  _AOT_GLOBAL_KNOWN_CALL(72, 1);
+ L97:
+  _AOT_JUMP(97, L116);
+ L106:
+  _AOT_LOCAL_REF(106, 0);
+ L115:
+  _AOT_EXIT(115);
+  /* STRING-SIZE */
+ L116:
+  _AOT_LOCAL_REF(116, 2);
+ L125:
+  _AOT_PAIRP_JUMP_UNLESS(125, L152);
+ L134:
+  _AOT_LOCAL_REF_CAR(134, 2);
+ L143:
+  _AOT_JUMP(143, L186);
+ L152:
+  _AOT_LOCAL_REF(152, 0);
+ L161:
+  _AOT_GLOBAL_KNOWN_CALL(161, 1);
+ L186:
+  _AOT_PUSH(186);
+ L195:
+  _AOT_PUSH(195);
+ L204:
+  _AOT_EXIT(204);
+  /* MAKE-VECTOR */
+ L205:
+  _AOT_LOCAL_REF(205, 0);
+ L214:
+  _AOT_PUSH(214);
+ L223:
+  _AOT_STACK_REF(223, 3);
+ L232:
+  _AOT_EXIT(232);
+  /* VECTOR-SET */
+ L233:
+  _AOT_LOCAL_REF(233, 1);
+ L242:
+  _AOT_PUSH(242);
+ L251:
+  _AOT_STACK_REF(251, 3);
+ L260:
+  _AOT_EXIT(260);
+  /* VECTOR-SET */
+ L261:
+  _AOT_EXIT(261);
+  /* MAKE-PROCEDURE */
+ L286:
+  _AOT_TAIL_CALL(286, 2);
+ L295:
+  _AOT_RET(295);
+  _AOT_EXIT(296);
+}
+
+static const unsigned char sexp_aot_chibi_string_14_shape[] = {
+  22, 2, 0, 0, 0, 0, 0, 0, 0, 91, 35, 0, 0, 0, 0, 0,
+  0, 0, 82, 2, 0, 0, 0, 0, 0, 0, 0, 47, 6, 0, 0, 0,
+  0, 0, 0, 0, 14, 17, 0, 0, 0, 0, 0, 0, 0, 15, 14, 0,
+  0, 0, 0, 0, 0, 0, 13, 51, 0, 0, 0, 0, 0, 0, 0, 22,
+  2, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0,
+  0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 14, 18, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0,
+  0, 0, 0, 37, 22, 2, 0, 0, 0, 0, 0, 0, 0, 91, 26, 0,
+  0, 0, 0, 0, 0, 0, 81, 2, 0, 0, 0, 0, 0, 0, 0, 14,
+  42, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0,
+  0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 14, 1, 0, 0, 0,
+  0, 0, 0, 15, 9, 0, 0, 0, 0, 0, 0, 0, 39, 22, 0, 0,
+  0, 0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0, 21,
+  3, 0, 0, 0, 0, 0, 0, 0, 27, 22, 1, 0, 0, 0, 0, 0,
+  0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0,
+  0, 0, 0, 0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 9, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 9,
+  0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_15 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 64: goto L64;
+  case 73: goto L73;
+  case 82: goto L82;
+  case 91: goto L91;
+  case 100: goto L100;
+  case 109: goto L109;
+  case 118: goto L118;
+  case 127: goto L127;
+  case 136: goto L136;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_CLOSURE_REF(0, 0);
+ L9:
+  _AOT_LOCAL_REF(9, 0);
+ L18:
+  _AOT_LT_JUMP_UNLESS(18, L45);
+ L27:
+  _AOT_CLOSURE_REF(27, 0);
+ L36:
+  _AOT_JUMP(36, L136);
+ L45:
+  _AOT_LOCAL_REF(45, 0);
+ L54:
+  _AOT_CLOSURE_REF(54, 2);
+ L63:
+  _AOT_EXIT(63);
+  /* STRING-REF */
+ L64:
+  _AOT_CLOSURE_REF(64, 1);
+ L73:
+  _AOT_CALL(73, 1);
+ L82:
+  _AOT_JUMP_UNLESS(82, L109);
+ L91:
+  _AOT_CLOSURE_REF(91, 3);
+ L100:
+  _AOT_JUMP(100, L136);
+ L109:
+  _AOT_LOCAL_REF(109, 0);
+ L118:
+  _AOT_CLOSURE_REF_CDR(118, 4);
+ L127:
+  _AOT_TAIL_CALL(127, 1);
+ L136:
+  _AOT_RET(136);
+  _AOT_EXIT(137);
+}
+
+static const unsigned char sexp_aot_chibi_string_15_shape[] = {
+  24, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 86, 26, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0,
+  0, 0, 0, 0, 14, 99, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0,
+  0, 0, 0, 0, 0, 0, 24, 2, 0, 0, 0, 0, 0, 0, 0, 32,
+  24, 1, 0, 0, 0, 0, 0, 0, 0, 6, 5, 0, 0, 0, 0, 0,
+  0, 0, 13, 26, 0, 0, 0, 0, 0, 0, 0, 24, 3, 0, 0, 0,
+  0, 0, 0, 0, 14, 35, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0,
+  0, 0, 0, 0, 0, 0, 83, 4, 0, 0, 0, 0, 0, 0, 0, 5,
+  5, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_16 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 19: goto L19;
+  case 28: goto L28;
+  case 37: goto L37;
+  case 38: goto L38;
+  case 47: goto L47;
+  case 56: goto L56;
+  case 65: goto L65;
+  case 66: goto L66;
+  case 75: goto L75;
+  case 84: goto L84;
+  case 93: goto L93;
+  case 94: goto L94;
+  case 103: goto L103;
+  case 112: goto L112;
+  case 121: goto L121;
+  case 122: goto L122;
+  case 131: goto L131;
+  case 140: goto L140;
+  case 149: goto L149;
+  case 150: goto L150;
+  case 159: goto L159;
+  case 168: goto L168;
+  case 177: goto L177;
+  case 178: goto L178;
+  case 203: goto L203;
+  case 212: goto L212;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_CLOSURE_REF(9, 1);
+ L18:
+  _AOT_EXIT(18);
+  /* STRING-CURSOR-PREV */
+ L19:
+  _AOT_PUSH(19);
+ L28:
+  _AOT_PUSH(28);
+ L37:
+  _AOT_EXIT(37);
+  /* MAKE-VECTOR */
+ L38:
+  _AOT_CLOSURE_REF(38, 3);
+ L47:
+  _AOT_PUSH(47);
+ L56:
+  _AOT_STACK_REF(56, 3);
+ L65:
+  _AOT_EXIT(65);
+  /* VECTOR-SET */
+ L66:
+  _AOT_CLOSURE_REF(66, 2);
+ L75:
+  _AOT_PUSH(75);
+ L84:
+  _AOT_STACK_REF(84, 3);
+ L93:
+  _AOT_EXIT(93);
+  /* VECTOR-SET */
+ L94:
+  _AOT_CLOSURE_REF(94, 1);
+ L103:
+  _AOT_PUSH(103);
+ L112:
+  _AOT_STACK_REF(112, 3);
+ L121:
+  _AOT_EXIT(121);
+  /* VECTOR-SET */
+ L122:
+  _AOT_LOCAL_REF(122, 0);
+ L131:
+  _AOT_PUSH(131);
+ L140:
+  _AOT_STACK_REF(140, 3);
+ L149:
+  _AOT_EXIT(149);
+  /* VECTOR-SET */
+ L150:
+  _AOT_CLOSURE_REF(150, 0);
+ L159:
+  _AOT_PUSH(159);
+ L168:
+  _AOT_STACK_REF(168, 3);
+ L177:
+  _AOT_EXIT(177);
+  /* VECTOR-SET */
+ L178:
+  _AOT_EXIT(178);
+  /* MAKE-PROCEDURE */
+ L203:
+  _AOT_TAIL_CALL(203, 1);
+ L212:
+  _AOT_RET(212);
+  _AOT_EXIT(213);
+}
+
+static const unsigned char sexp_aot_chibi_string_16_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 24, 1, 0, 0, 0, 0, 0,
+  0, 0, 36, 15, 14, 1, 0, 0, 0, 0, 0, 0, 15, 21, 0, 0,
+  0, 0, 0, 0, 0, 39, 24, 3, 0, 0, 0, 0, 0, 0, 0, 15,
+  1, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0,
+  0, 27, 24, 2, 0, 0, 0, 0, 0, 0, 0, 15, 5, 0, 0, 0,
+  0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 24, 1,
+  0, 0, 0, 0, 0, 0, 0, 15, 9, 0, 0, 0, 0, 0, 0, 0,
+  21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 22, 0, 0, 0, 0, 0,
+  0, 0, 0, 15, 13, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0,
+  0, 0, 0, 0, 0, 27, 24, 0, 0, 0, 0, 0, 0, 0, 0, 15,
+  17, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0,
+  0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0,
+  0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_17 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 28: goto L28;
+  case 37: goto L37;
+  case 46: goto L46;
+  case 55: goto L55;
+  case 64: goto L64;
+  case 73: goto L73;
+  case 98: goto L98;
+  case 107: goto L107;
+  case 116: goto L116;
+  case 117: goto L117;
+  case 126: goto L126;
+  case 135: goto L135;
+  case 136: goto L136;
+  case 145: goto L145;
+  case 154: goto L154;
+  case 163: goto L163;
+  case 164: goto L164;
+  case 173: goto L173;
+  case 182: goto L182;
+  case 191: goto L191;
+  case 192: goto L192;
+  case 201: goto L201;
+  case 210: goto L210;
+  case 219: goto L219;
+  case 220: goto L220;
+  case 245: goto L245;
+  case 254: goto L254;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_CLOSURE_REF(0, 1);
+ L9:
+  _AOT_PAIRP_JUMP_UNLESS(9, L46);
+ L18:
+  _AOT_CLOSURE_REF(18, 1);
+ L27:
+  _AOT_CDR(27);
+ L28:
+  _AOT_TYPEP(28, 6);
+ L37:
+  _AOT_JUMP(37, L55);
+ L46:
+  _AOT_PUSH(46);
+ L55:
+  _AOT_JUMP_UNLESS(55, L107);
+ L64:
+  _AOT_CLOSURE_REF(64, 1);
+ L73:
+  _AOT_GLOBAL_KNOWN_CALL(73, 1);
+ L98:
+  _AOT_JUMP(98, L117);
+ L107:
+  _AOT_CLOSURE_REF(107, 0);
+ L116:
+  _AOT_EXIT(116);
+  /* STRING-SIZE */
+ L117:
+  _AOT_PUSH(117);
+ L126:
+  _AOT_PUSH(126);
+ L135:
+  _AOT_EXIT(135);
+  /* MAKE-VECTOR */
+ L136:
+  _AOT_CLOSURE_REF(136, 0);
+ L145:
+  _AOT_PUSH(145);
+ L154:
+  _AOT_STACK_REF(154, 3);
+ L163:
+  _AOT_EXIT(163);
+  /* VECTOR-SET */
+ L164:
+  _AOT_LOCAL_REF(164, 0);
+ L173:
+  _AOT_PUSH(173);
+ L182:
+  _AOT_STACK_REF(182, 3);
+ L191:
+  _AOT_EXIT(191);
+  /* VECTOR-SET */
+ L192:
+  _AOT_LOCAL_REF(192, 1);
+ L201:
+  _AOT_PUSH(201);
+ L210:
+  _AOT_STACK_REF(210, 3);
+ L219:
+  _AOT_EXIT(219);
+  /* VECTOR-SET */
+ L220:
+  _AOT_EXIT(220);
+  /* MAKE-PROCEDURE */
+ L245:
+  _AOT_TAIL_CALL(245, 1);
+ L254:
+  _AOT_RET(254);
+  _AOT_EXIT(255);
+}
+
+static const unsigned char sexp_aot_chibi_string_17_shape[] = {
+  24, 1, 0, 0, 0, 0, 0, 0, 0, 91, 36, 0, 0, 0, 0, 0,
+  0, 0, 24, 1, 0, 0, 0, 0, 0, 0, 0, 55, 47, 6, 0, 0,
+  0, 0, 0, 0, 0, 14, 17, 0, 0, 0, 0, 0, 0, 0, 15, 14,
+  0, 0, 0, 0, 0, 0, 0, 13, 51, 0, 0, 0, 0, 0, 0, 0,
+  24, 1, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0,
+  0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 14, 18, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0,
+  0, 0, 0, 0, 37, 15, 14, 1, 0, 0, 0, 0, 0, 0, 15, 13,
+  0, 0, 0, 0, 0, 0, 0, 39, 24, 0, 0, 0, 0, 0, 0, 0,
+  0, 15, 1, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0,
+  0, 0, 0, 27, 22, 0, 0, 0, 0, 0, 0, 0, 0, 15, 5, 0,
+  0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27,
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 15, 9, 0, 0, 0, 0, 0,
+  0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 38, 1, 0, 0,
+  0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_18 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 70: goto L70;
+  case 79: goto L79;
+  case 104: goto L104;
+  case 113: goto L113;
+  case 122: goto L122;
+  case 123: goto L123;
+  case 132: goto L132;
+  case 141: goto L141;
+  case 150: goto L150;
+  case 151: goto L151;
+  case 160: goto L160;
+  case 169: goto L169;
+  case 178: goto L178;
+  case 179: goto L179;
+  case 204: goto L204;
+  case 213: goto L213;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 2);
+ L9:
+  _AOT_PAIRP_JUMP_UNLESS(9, L36);
+ L18:
+  _AOT_LOCAL_REF_CAR(18, 2);
+ L27:
+  _AOT_JUMP(27, L70);
+ L36:
+  _AOT_LOCAL_REF(36, 0);
+ L45:
+  _AOT_GLOBAL_KNOWN_CALL(45, 1);
+ L70:
+  _AOT_LOCAL_REF(70, 1);
+ L79:
+  _AOT_GLOBAL_KNOWN_CALL(79, 1);
+ L104:
+  _AOT_PUSH(104);
+ L113:
+  _AOT_PUSH(113);
+ L122:
+  _AOT_EXIT(122);
+  /* MAKE-VECTOR */
+ L123:
+  _AOT_LOCAL_REF(123, 0);
+ L132:
+  _AOT_PUSH(132);
+ L141:
+  _AOT_STACK_REF(141, 3);
+ L150:
+  _AOT_EXIT(150);
+  /* VECTOR-SET */
+ L151:
+  _AOT_LOCAL_REF(151, 2);
+ L160:
+  _AOT_PUSH(160);
+ L169:
+  _AOT_STACK_REF(169, 3);
+ L178:
+  _AOT_EXIT(178);
+  /* VECTOR-SET */
+ L179:
+  _AOT_EXIT(179);
+  /* MAKE-PROCEDURE */
+ L204:
+  _AOT_TAIL_CALL(204, 2);
+ L213:
+  _AOT_RET(213);
+  _AOT_EXIT(214);
+}
+
+static const unsigned char sexp_aot_chibi_string_18_shape[] = {
+  22, 2, 0, 0, 0, 0, 0, 0, 0, 91, 26, 0, 0, 0, 0, 0,
+  0, 0, 81, 2, 0, 0, 0, 0, 0, 0, 0, 14, 42, 0, 0, 0,
+  0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0,
+  0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 85,
+  0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 15, 14, 1, 0, 0, 0, 0, 0,
+  0, 15, 9, 0, 0, 0, 0, 0, 0, 0, 39, 22, 0, 0, 0, 0,
+  0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0,
+  0, 0, 0, 0, 0, 0, 27, 22, 2, 0, 0, 0, 0, 0, 0, 0,
+  15, 5, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0,
+  0, 0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 9, 0, 0,
+  0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_19 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 43: goto L43;
+  case 68: goto L68;
+  case 77: goto L77;
+  case 86: goto L86;
+  case 95: goto L95;
+  case 104: goto L104;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 2);
+ L9:
+  _AOT_LOCAL_REF(9, 1);
+ L18:
+  _AOT_GLOBAL_KNOWN_CALL(18, 1);
+ L43:
+  _AOT_GLOBAL_KNOWN_CALL(43, 1);
+ L68:
+  _AOT_LOCAL_REF(68, 0);
+ L77:
+  _AOT_GLOBAL_KNOWN_REF(77);
+ L86:
+  _AOT_GLOBAL_KNOWN_REF(86);
+ L95:
+  _AOT_TAIL_CALL(95, 4);
+ L104:
+  _AOT_RET(104);
+  _AOT_EXIT(105);
+}
+
+static const unsigned char sexp_aot_chibi_string_19_shape[] = {
+  22, 2, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0, 0, 0,
+  0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0,
+  0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+  17, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_20 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 81: goto L81;
+  case 82: goto L82;
+  case 91: goto L91;
+  case 100: goto L100;
+  case 101: goto L101;
+  case 110: goto L110;
+  case 119: goto L119;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_CLOSURE_REF(0, 0);
+ L9:
+  _AOT_CLOSURE_REF(9, 1);
+ L18:
+  _AOT_LE_JUMP_UNLESS(18, L54);
+ L27:
+  _AOT_CLOSURE_REF(27, 2);
+ L36:
+  _AOT_EXIT(36);
+  /* FCALL1 */
+ L45:
+  _AOT_JUMP(45, L119);
+ L54:
+  _AOT_CLOSURE_REF(54, 2);
+ L63:
+  _AOT_PUSH(63);
+ L72:
+  _AOT_CLOSURE_REF(72, 5);
+ L81:
+  _AOT_ADD(81);
+ L82:
+  _AOT_CLOSURE_REF(82, 0);
+ L91:
+  _AOT_CLOSURE_REF(91, 4);
+ L100:
+  _AOT_EXIT(100);
+  /* STRING-CURSOR-NEXT */
+ L101:
+  _AOT_CLOSURE_REF_CDR(101, 3);
+ L110:
+  _AOT_TAIL_CALL(110, 3);
+ L119:
+  _AOT_RET(119);
+  _AOT_EXIT(120);
+}
+
+static const unsigned char sexp_aot_chibi_string_20_shape[] = {
+  24, 0, 0, 0, 0, 0, 0, 0, 0, 24, 1, 0, 0, 0, 0, 0,
+  0, 0, 87, 35, 0, 0, 0, 0, 0, 0, 0, 24, 2, 0, 0, 0,
+  0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 14, 73, 0,
+  0, 0, 0, 0, 0, 0, 24, 2, 0, 0, 0, 0, 0, 0, 0, 15,
+  5, 0, 0, 0, 0, 0, 0, 0, 24, 5, 0, 0, 0, 0, 0, 0,
+  0, 59, 24, 0, 0, 0, 0, 0, 0, 0, 0, 24, 4, 0, 0, 0,
+  0, 0, 0, 0, 35, 83, 3, 0, 0, 0, 0, 0, 0, 0, 5, 13,
+  0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_21 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 46: goto L46;
+  case 55: goto L55;
+  case 64: goto L64;
+  case 65: goto L65;
+  case 74: goto L74;
+  case 83: goto L83;
+  case 92: goto L92;
+  case 93: goto L93;
+  case 102: goto L102;
+  case 111: goto L111;
+  case 120: goto L120;
+  case 121: goto L121;
+  case 130: goto L130;
+  case 139: goto L139;
+  case 148: goto L148;
+  case 149: goto L149;
+  case 158: goto L158;
+  case 167: goto L167;
+  case 176: goto L176;
+  case 177: goto L177;
+  case 186: goto L186;
+  case 195: goto L195;
+  case 204: goto L204;
+  case 205: goto L205;
+  case 230: goto L230;
+  case 239: goto L239;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_CLOSURE_REF(0, 5);
+ L9:
+  _AOT_LOCAL_REF(9, 0);
+ L18:
+  _AOT_CLOSURE_REF(18, 4);
+ L27:
+  _AOT_CLOSURE_REF(27, 2);
+ L36:
+  _AOT_EXIT(36);
+  /* FCALL3 */
+ L45:
+  _AOT_CONS(45);
+ L46:
+  _AOT_PUSH(46);
+ L55:
+  _AOT_PUSH(55);
+ L64:
+  _AOT_EXIT(64);
+  /* MAKE-VECTOR */
+ L65:
+  _AOT_CLOSURE_REF(65, 3);
+ L74:
+  _AOT_PUSH(74);
+ L83:
+  _AOT_STACK_REF(83, 3);
+ L92:
+  _AOT_EXIT(92);
+  /* VECTOR-SET */
+ L93:
+  _AOT_CLOSURE_REF(93, 2);
+ L102:
+  _AOT_PUSH(102);
+ L111:
+  _AOT_STACK_REF(111, 3);
+ L120:
+  _AOT_EXIT(120);
+  /* VECTOR-SET */
+ L121:
+  _AOT_CLOSURE_REF(121, 1);
+ L130:
+  _AOT_PUSH(130);
+ L139:
+  _AOT_STACK_REF(139, 3);
+ L148:
+  _AOT_EXIT(148);
+  /* VECTOR-SET */
+ L149:
+  _AOT_CLOSURE_REF(149, 0);
+ L158:
+  _AOT_PUSH(158);
+ L167:
+  _AOT_STACK_REF(167, 3);
+ L176:
+  _AOT_EXIT(176);
+  /* VECTOR-SET */
+ L177:
+  _AOT_LOCAL_REF(177, 0);
+ L186:
+  _AOT_PUSH(186);
+ L195:
+  _AOT_STACK_REF(195, 3);
+ L204:
+  _AOT_EXIT(204);
+  /* VECTOR-SET */
+ L205:
+  _AOT_EXIT(205);
+  /* MAKE-PROCEDURE */
+ L230:
+  _AOT_TAIL_CALL(230, 1);
+ L239:
+  _AOT_RET(239);
+  _AOT_EXIT(240);
+}
+
+static const unsigned char sexp_aot_chibi_string_21_shape[] = {
+  24, 5, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 24, 4, 0, 0, 0, 0, 0, 0, 0, 24, 2, 0, 0, 0,
+  0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 58, 15, 14,
+  1, 0, 0, 0, 0, 0, 0, 15, 21, 0, 0, 0, 0, 0, 0, 0,
+  39, 24, 3, 0, 0, 0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0,
+  0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 24, 2, 0,
+  0, 0, 0, 0, 0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 21,
+  3, 0, 0, 0, 0, 0, 0, 0, 27, 24, 1, 0, 0, 0, 0, 0,
+  0, 0, 15, 9, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0,
+  0, 0, 0, 0, 27, 24, 0, 0, 0, 0, 0, 0, 0, 0, 15, 13,
+  0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0,
+  27, 22, 0, 0, 0, 0, 0, 0, 0, 0, 15, 17, 0, 0, 0, 0,
+  0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 38, 1, 0,
+  0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_22 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 73: goto L73;
+  case 82: goto L82;
+  case 91: goto L91;
+  case 100: goto L100;
+  case 109: goto L109;
+  case 118: goto L118;
+  case 143: goto L143;
+  case 152: goto L152;
+  case 161: goto L161;
+  case 162: goto L162;
+  case 171: goto L171;
+  case 180: goto L180;
+  case 189: goto L189;
+  case 190: goto L190;
+  case 199: goto L199;
+  case 208: goto L208;
+  case 217: goto L217;
+  case 218: goto L218;
+  case 227: goto L227;
+  case 236: goto L236;
+  case 245: goto L245;
+  case 246: goto L246;
+  case 255: goto L255;
+  case 264: goto L264;
+  case 273: goto L273;
+  case 274: goto L274;
+  case 283: goto L283;
+  case 292: goto L292;
+  case 301: goto L301;
+  case 302: goto L302;
+  case 311: goto L311;
+  case 320: goto L320;
+  case 329: goto L329;
+  case 330: goto L330;
+  case 355: goto L355;
+  case 364: goto L364;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 1);
+ L9:
+  _AOT_CLOSURE_REF(9, 0);
+ L18:
+  _AOT_LE_JUMP_UNLESS(18, L91);
+ L27:
+  _AOT_LOCAL_REF(27, 2);
+ L36:
+  _AOT_PUSH(36);
+ L45:
+  _AOT_LOCAL_REF(45, 0);
+ L54:
+  _AOT_CLOSURE_REF(54, 1);
+ L63:
+  _AOT_EXIT(63);
+  /* FCALL3 */
+ L72:
+  _AOT_CONS(72);
+ L73:
+  _AOT_EXIT(73);
+  /* FCALL1 */
+ L82:
+  _AOT_JUMP(82, L364);
+ L91:
+  _AOT_LOCAL_REF(91, 0);
+ L100:
+  _AOT_CLOSURE_REF(100, 4);
+ L109:
+  _AOT_CLOSURE_REF(109, 1);
+ L118:
+  _AOT_GLOBAL_KNOWN_CALL(118, 3);
+ L143:
+  _AOT_PUSH(143);
+ L152:
+  _AOT_PUSH(152);
+ L161:
+  _AOT_EXIT(161);
+  /* MAKE-VECTOR */
+ L162:
+  _AOT_CLOSURE_REF(162, 2);
+ L171:
+  _AOT_PUSH(171);
+ L180:
+  _AOT_STACK_REF(180, 3);
+ L189:
+  _AOT_EXIT(189);
+  /* VECTOR-SET */
+ L190:
+  _AOT_CLOSURE_REF(190, 3);
+ L199:
+  _AOT_PUSH(199);
+ L208:
+  _AOT_STACK_REF(208, 3);
+ L217:
+  _AOT_EXIT(217);
+  /* VECTOR-SET */
+ L218:
+  _AOT_CLOSURE_REF(218, 1);
+ L227:
+  _AOT_PUSH(227);
+ L236:
+  _AOT_STACK_REF(236, 3);
+ L245:
+  _AOT_EXIT(245);
+  /* VECTOR-SET */
+ L246:
+  _AOT_LOCAL_REF(246, 1);
+ L255:
+  _AOT_PUSH(255);
+ L264:
+  _AOT_STACK_REF(264, 3);
+ L273:
+  _AOT_EXIT(273);
+  /* VECTOR-SET */
+ L274:
+  _AOT_LOCAL_REF(274, 0);
+ L283:
+  _AOT_PUSH(283);
+ L292:
+  _AOT_STACK_REF(292, 3);
+ L301:
+  _AOT_EXIT(301);
+  /* VECTOR-SET */
+ L302:
+  _AOT_LOCAL_REF(302, 2);
+ L311:
+  _AOT_PUSH(311);
+ L320:
+  _AOT_STACK_REF(320, 3);
+ L329:
+  _AOT_EXIT(329);
+  /* VECTOR-SET */
+ L330:
+  _AOT_EXIT(330);
+  /* MAKE-PROCEDURE */
+ L355:
+  _AOT_TAIL_CALL(355, 1);
+ L364:
+  _AOT_RET(364);
+  _AOT_EXIT(365);
+}
+
+static const unsigned char sexp_aot_chibi_string_22_shape[] = {
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0,
+  0, 0, 87, 72, 0, 0, 0, 0, 0, 0, 0, 22, 2, 0, 0, 0,
+  0, 0, 0, 0, 15, 14, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0,
+  0, 0, 0, 0, 0, 0, 24, 1, 0, 0, 0, 0, 0, 0, 0, 10,
+  0, 0, 0, 0, 0, 0, 0, 0, 58, 8, 0, 0, 0, 0, 0, 0,
+  0, 0, 14, 25, 1, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0,
+  0, 0, 0, 0, 24, 4, 0, 0, 0, 0, 0, 0, 0, 24, 1, 0,
+  0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 13,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15,
+  14, 1, 0, 0, 0, 0, 0, 0, 15, 25, 0, 0, 0, 0, 0, 0,
+  0, 39, 24, 2, 0, 0, 0, 0, 0, 0, 0, 15, 1, 0, 0, 0,
+  0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 24, 3,
+  0, 0, 0, 0, 0, 0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0,
+  21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 24, 1, 0, 0, 0, 0,
+  0, 0, 0, 15, 9, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0,
+  0, 0, 0, 0, 0, 27, 22, 1, 0, 0, 0, 0, 0, 0, 0, 15,
+  13, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0,
+  0, 27, 22, 0, 0, 0, 0, 0, 0, 0, 0, 15, 17, 0, 0, 0,
+  0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 22, 2,
+  0, 0, 0, 0, 0, 0, 0, 15, 21, 0, 0, 0, 0, 0, 0, 0,
+  21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 38, 1, 0, 0, 0, 0,
+  0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_23 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 73: goto L73;
+  case 82: goto L82;
+  case 91: goto L91;
+  case 100: goto L100;
+  case 101: goto L101;
+  case 110: goto L110;
+  case 119: goto L119;
+  case 128: goto L128;
+  case 129: goto L129;
+  case 138: goto L138;
+  case 147: goto L147;
+  case 156: goto L156;
+  case 157: goto L157;
+  case 166: goto L166;
+  case 175: goto L175;
+  case 184: goto L184;
+  case 185: goto L185;
+  case 210: goto L210;
+  case 219: goto L219;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 2);
+ L9:
+  _AOT_LOCAL_REF(9, 3);
+ L18:
+  _AOT_LE_JUMP_UNLESS(18, L45);
+ L27:
+  _AOT_PUSH(27);
+ L36:
+  _AOT_JUMP(36, L219);
+ L45:
+  _AOT_LOCAL_REF(45, 2);
+ L54:
+  _AOT_PUSH(54);
+ L63:
+  _AOT_PUSH(63);
+ L72:
+  _AOT_EXIT(72);
+  /* MAKE-VECTOR */
+ L73:
+  _AOT_LOCAL_REF(73, 1);
+ L82:
+  _AOT_PUSH(82);
+ L91:
+  _AOT_STACK_REF(91, 3);
+ L100:
+  _AOT_EXIT(100);
+  /* VECTOR-SET */
+ L101:
+  _AOT_CLOSURE_REF(101, 0);
+ L110:
+  _AOT_PUSH(110);
+ L119:
+  _AOT_STACK_REF(119, 3);
+ L128:
+  _AOT_EXIT(128);
+  /* VECTOR-SET */
+ L129:
+  _AOT_LOCAL_REF(129, 3);
+ L138:
+  _AOT_PUSH(138);
+ L147:
+  _AOT_STACK_REF(147, 3);
+ L156:
+  _AOT_EXIT(156);
+  /* VECTOR-SET */
+ L157:
+  _AOT_LOCAL_REF(157, 0);
+ L166:
+  _AOT_PUSH(166);
+ L175:
+  _AOT_STACK_REF(175, 3);
+ L184:
+  _AOT_EXIT(184);
+  /* VECTOR-SET */
+ L185:
+  _AOT_EXIT(185);
+  /* MAKE-PROCEDURE */
+ L210:
+  _AOT_TAIL_CALL(210, 1);
+ L219:
+  _AOT_RET(219);
+  _AOT_EXIT(220);
+}
+
+static const unsigned char sexp_aot_chibi_string_23_shape[] = {
+  22, 2, 0, 0, 0, 0, 0, 0, 0, 22, 3, 0, 0, 0, 0, 0,
+  0, 0, 87, 26, 0, 0, 0, 0, 0, 0, 0, 15, 142, 0, 0, 0,
+  0, 0, 0, 0, 14, 182, 0, 0, 0, 0, 0, 0, 0, 22, 2, 0,
+  0, 0, 0, 0, 0, 0, 15, 14, 1, 0, 0, 0, 0, 0, 0, 15,
+  17, 0, 0, 0, 0, 0, 0, 0, 39, 22, 1, 0, 0, 0, 0, 0,
+  0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0,
+  0, 0, 0, 0, 27, 24, 0, 0, 0, 0, 0, 0, 0, 0, 15, 5,
+  0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0,
+  27, 22, 3, 0, 0, 0, 0, 0, 0, 0, 15, 9, 0, 0, 0, 0,
+  0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 22, 0, 0,
+  0, 0, 0, 0, 0, 0, 15, 13, 0, 0, 0, 0, 0, 0, 0, 21,
+  3, 0, 0, 0, 0, 0, 0, 0, 27, 38, 1, 0, 0, 0, 0, 0,
+  0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_24 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 10: goto L10;
+  case 19: goto L19;
+  case 44: goto L44;
+  case 53: goto L53;
+  case 62: goto L62;
+  case 71: goto L71;
+  case 80: goto L80;
+  case 89: goto L89;
+  case 98: goto L98;
+  case 107: goto L107;
+  case 116: goto L116;
+  case 141: goto L141;
+  case 150: goto L150;
+  case 159: goto L159;
+  case 160: goto L160;
+  case 169: goto L169;
+  case 170: goto L170;
+  case 179: goto L179;
+  case 188: goto L188;
+  case 197: goto L197;
+  case 206: goto L206;
+  case 215: goto L215;
+  case 240: goto L240;
+  case 249: goto L249;
+  case 258: goto L258;
+  case 259: goto L259;
+  case 268: goto L268;
+  case 277: goto L277;
+  case 286: goto L286;
+  case 287: goto L287;
+  case 312: goto L312;
+  case 321: goto L321;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_EXIT(9);
+  /* STRING-SIZE */
+ L10:
+  _AOT_LOCAL_REF(10, 0);
+ L19:
+  _AOT_GLOBAL_KNOWN_CALL(19, 1);
+ L44:
+  _AOT_LOCAL_REF(44, 1);
+ L53:
+  _AOT_PAIRP_JUMP_UNLESS(53, L89);
+ L62:
+  _AOT_LOCAL_REF_CDR(62, 1);
+ L71:
+  _AOT_TYPEP(71, 6);
+ L80:
+  _AOT_JUMP(80, L98);
+ L89:
+  _AOT_PUSH(89);
+ L98:
+  _AOT_JUMP_UNLESS(98, L150);
+ L107:
+  _AOT_LOCAL_REF(107, 1);
+ L116:
+  _AOT_GLOBAL_KNOWN_CALL(116, 1);
+ L141:
+  _AOT_JUMP(141, L170);
+ L150:
+  _AOT_LOCAL_REF(150, 0);
+ L159:
+  _AOT_EXIT(159);
+  /* STRING-SIZE */
+ L160:
+  _AOT_PUSH(160);
+ L169:
+  _AOT_ADD(169);
+ L170:
+  _AOT_LOCAL_REF(170, 1);
+ L179:
+  _AOT_PAIRP_JUMP_UNLESS(179, L206);
+ L188:
+  _AOT_LOCAL_REF_CAR(188, 1);
+ L197:
+  _AOT_JUMP(197, L215);
+ L206:
+  _AOT_PUSH(206);
+ L215:
+  _AOT_GLOBAL_KNOWN_CALL(215, 1);
+ L240:
+  _AOT_PUSH(240);
+ L249:
+  _AOT_PUSH(249);
+ L258:
+  _AOT_EXIT(258);
+  /* MAKE-VECTOR */
+ L259:
+  _AOT_LOCAL_REF(259, 0);
+ L268:
+  _AOT_PUSH(268);
+ L277:
+  _AOT_STACK_REF(277, 3);
+ L286:
+  _AOT_EXIT(286);
+  /* VECTOR-SET */
+ L287:
+  _AOT_EXIT(287);
+  /* MAKE-PROCEDURE */
+ L312:
+  _AOT_TAIL_CALL(312, 4);
+ L321:
+  _AOT_RET(321);
+  _AOT_EXIT(322);
+}
+
+static const unsigned char sexp_aot_chibi_string_24_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 37, 22, 0, 0, 0, 0, 0,
+  0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0, 0,
+  0, 0, 0, 0, 0, 91, 35, 0, 0, 0, 0, 0, 0, 0, 82, 1,
+  0, 0, 0, 0, 0, 0, 0, 47, 6, 0, 0, 0, 0, 0, 0, 0,
+  14, 17, 0, 0, 0, 0, 0, 0, 0, 15, 14, 0, 0, 0, 0, 0,
+  0, 0, 13, 51, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0,
+  0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 28, 0,
+  0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 37,
+  15, 5, 0, 0, 0, 0, 0, 0, 0, 59, 22, 1, 0, 0, 0, 0,
+  0, 0, 0, 91, 26, 0, 0, 0, 0, 0, 0, 0, 81, 1, 0, 0,
+  0, 0, 0, 0, 0, 14, 17, 0, 0, 0, 0, 0, 0, 0, 15, 6,
+  8, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0,
+  5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  15, 14, 1, 0, 0, 0, 0, 0, 0, 15, 5, 0, 0, 0, 0, 0,
+  0, 0, 39, 22, 0, 0, 0, 0, 0, 0, 0, 0, 15, 1, 0, 0,
+  0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 38,
+  1, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 5, 17, 0, 0, 0, 0, 0, 0,
+  0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_25 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 52: goto L52;
+  case 61: goto L61;
+  case 70: goto L70;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_PUSH(0);
+ L9:
+  _AOT_LOCAL_REF(9, 0);
+ L18:
+  _AOT_CLOSURE_REF(18, 0);
+ L27:
+  _AOT_GLOBAL_KNOWN_CALL(27, 2);
+ L52:
+  _AOT_CLOSURE_REF(52, 0);
+ L61:
+  _AOT_EXIT(61);
+  /* FCALL3 */
+ L70:
+  _AOT_RET(70);
+  _AOT_EXIT(71);
+}
+
+static const unsigned char sexp_aot_chibi_string_25_shape[] = {
+  15, 14, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0,
+  0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 10, 0, 0,
+  0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_26 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 70: goto L70;
+  case 79: goto L79;
+  case 88: goto L88;
+  case 89: goto L89;
+  case 98: goto L98;
+  case 107: goto L107;
+  case 116: goto L116;
+  case 117: goto L117;
+  case 142: goto L142;
+  case 151: goto L151;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 1);
+ L9:
+  _AOT_PAIRP_JUMP_UNLESS(9, L36);
+ L18:
+  _AOT_LOCAL_REF_CAR(18, 1);
+ L27:
+  _AOT_JUMP(27, L45);
+ L36:
+  _AOT_PUSH(36);
+ L45:
+  _AOT_GLOBAL_KNOWN_CALL(45, 1);
+ L70:
+  _AOT_PUSH(70);
+ L79:
+  _AOT_PUSH(79);
+ L88:
+  _AOT_EXIT(88);
+  /* MAKE-VECTOR */
+ L89:
+  _AOT_LOCAL_REF(89, 0);
+ L98:
+  _AOT_PUSH(98);
+ L107:
+  _AOT_STACK_REF(107, 3);
+ L116:
+  _AOT_EXIT(116);
+  /* VECTOR-SET */
+ L117:
+  _AOT_EXIT(117);
+  /* MAKE-PROCEDURE */
+ L142:
+  _AOT_TAIL_CALL(142, 1);
+ L151:
+  _AOT_RET(151);
+  _AOT_EXIT(152);
+}
+
+static const unsigned char sexp_aot_chibi_string_26_shape[] = {
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 91, 26, 0, 0, 0, 0, 0,
+  0, 0, 81, 1, 0, 0, 0, 0, 0, 0, 0, 14, 17, 0, 0, 0,
+  0, 0, 0, 0, 15, 6, 8, 0, 0, 0, 0, 0, 0, 85, 0, 0,
+  0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 15, 14, 1, 0, 0, 0, 0, 0, 0, 15,
+  5, 0, 0, 0, 0, 0, 0, 0, 39, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0,
+  0, 0, 0, 0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 5, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5,
+  0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_27 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 43: goto L43;
+  case 52: goto L52;
+  case 77: goto L77;
+  case 86: goto L86;
+  case 95: goto L95;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_CLOSURE_REF(9, 0);
+ L18:
+  _AOT_GLOBAL_KNOWN_CALL(18, 2);
+ L43:
+  _AOT_CLOSURE_REF(43, 0);
+ L52:
+  _AOT_GLOBAL_KNOWN_CALL(52, 1);
+ L77:
+  _AOT_CLOSURE_REF(77, 0);
+ L86:
+  _AOT_EXIT(86);
+  /* FCALL3 */
+ L95:
+  _AOT_RET(95);
+  _AOT_EXIT(96);
+}
+
+static const unsigned char sexp_aot_chibi_string_27_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0,
+  0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0,
+  0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0,
+  0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_28 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 81: goto L81;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_CLOSURE_REF(0, 0);
+ L9:
+  _AOT_CLOSURE_REF(9, 1);
+ L18:
+  _AOT_LE_JUMP_UNLESS(18, L45);
+ L27:
+  _AOT_PUSH(27);
+ L36:
+  _AOT_JUMP(36, L81);
+ L45:
+  _AOT_CLOSURE_REF(45, 1);
+ L54:
+  _AOT_CLOSURE_REF(54, 0);
+ L63:
+  _AOT_CLOSURE_REF(63, 2);
+ L72:
+  _AOT_EXIT(72);
+  /* FCALL3 */
+ L81:
+  _AOT_RET(81);
+  _AOT_EXIT(82);
+}
+
+static const unsigned char sexp_aot_chibi_string_28_shape[] = {
+  24, 0, 0, 0, 0, 0, 0, 0, 0, 24, 1, 0, 0, 0, 0, 0,
+  0, 0, 87, 26, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0,
+  0, 0, 0, 0, 14, 44, 0, 0, 0, 0, 0, 0, 0, 24, 1, 0,
+  0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 24,
+  2, 0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0,
+  0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_29 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 43: goto L43;
+  case 52: goto L52;
+  case 61: goto L61;
+  case 62: goto L62;
+  case 71: goto L71;
+  case 80: goto L80;
+  case 89: goto L89;
+  case 90: goto L90;
+  case 99: goto L99;
+  case 108: goto L108;
+  case 117: goto L117;
+  case 118: goto L118;
+  case 143: goto L143;
+  case 152: goto L152;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_CLOSURE_REF(0, 1);
+ L9:
+  _AOT_CLOSURE_REF(9, 0);
+ L18:
+  _AOT_GLOBAL_KNOWN_CALL(18, 2);
+ L43:
+  _AOT_PUSH(43);
+ L52:
+  _AOT_PUSH(52);
+ L61:
+  _AOT_EXIT(61);
+  /* MAKE-VECTOR */
+ L62:
+  _AOT_CLOSURE_REF(62, 0);
+ L71:
+  _AOT_PUSH(71);
+ L80:
+  _AOT_STACK_REF(80, 3);
+ L89:
+  _AOT_EXIT(89);
+  /* VECTOR-SET */
+ L90:
+  _AOT_LOCAL_REF(90, 0);
+ L99:
+  _AOT_PUSH(99);
+ L108:
+  _AOT_STACK_REF(108, 3);
+ L117:
+  _AOT_EXIT(117);
+  /* VECTOR-SET */
+ L118:
+  _AOT_EXIT(118);
+  /* MAKE-PROCEDURE */
+ L143:
+  _AOT_TAIL_CALL(143, 1);
+ L152:
+  _AOT_RET(152);
+  _AOT_EXIT(153);
+}
+
+static const unsigned char sexp_aot_chibi_string_29_shape[] = {
+  24, 1, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0,
+  0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 14, 1, 0, 0,
+  0, 0, 0, 0, 15, 9, 0, 0, 0, 0, 0, 0, 0, 39, 24, 0,
+  0, 0, 0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0,
+  21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 22, 0, 0, 0, 0, 0,
+  0, 0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0,
+  0, 0, 0, 0, 0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 5,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+  5, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_30 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 43: goto L43;
+  case 52: goto L52;
+  case 61: goto L61;
+  case 62: goto L62;
+  case 71: goto L71;
+  case 80: goto L80;
+  case 89: goto L89;
+  case 90: goto L90;
+  case 99: goto L99;
+  case 108: goto L108;
+  case 117: goto L117;
+  case 118: goto L118;
+  case 143: goto L143;
+  case 152: goto L152;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_CLOSURE_REF(9, 0);
+ L18:
+  _AOT_GLOBAL_KNOWN_CALL(18, 2);
+ L43:
+  _AOT_PUSH(43);
+ L52:
+  _AOT_PUSH(52);
+ L61:
+  _AOT_EXIT(61);
+  /* MAKE-VECTOR */
+ L62:
+  _AOT_CLOSURE_REF(62, 0);
+ L71:
+  _AOT_PUSH(71);
+ L80:
+  _AOT_STACK_REF(80, 3);
+ L89:
+  _AOT_EXIT(89);
+  /* VECTOR-SET */
+ L90:
+  _AOT_LOCAL_REF(90, 0);
+ L99:
+  _AOT_PUSH(99);
+ L108:
+  _AOT_STACK_REF(108, 3);
+ L117:
+  _AOT_EXIT(117);
+  /* VECTOR-SET */
+ L118:
+  _AOT_EXIT(118);
+  /* MAKE-PROCEDURE */
+ L143:
+  _AOT_TAIL_CALL(143, 1);
+ L152:
+  _AOT_RET(152);
+  _AOT_EXIT(153);
+}
+
+static const unsigned char sexp_aot_chibi_string_30_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0,
+  0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 14, 1, 0, 0,
+  0, 0, 0, 0, 15, 9, 0, 0, 0, 0, 0, 0, 0, 39, 24, 0,
+  0, 0, 0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0,
+  21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 22, 0, 0, 0, 0, 0,
+  0, 0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0,
+  0, 0, 0, 0, 0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 5,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+  5, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_31 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 64: goto L64;
+  case 73: goto L73;
+  case 82: goto L82;
+  case 91: goto L91;
+  case 92: goto L92;
+  case 117: goto L117;
+  case 126: goto L126;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 1);
+ L9:
+  _AOT_PAIRP_JUMP_UNLESS(9, L36);
+ L18:
+  _AOT_LOCAL_REF_CAR(18, 1);
+ L27:
+  _AOT_JUMP(27, L45);
+ L36:
+  _AOT_PUSH(36);
+ L45:
+  _AOT_PUSH(45);
+ L54:
+  _AOT_PUSH(54);
+ L63:
+  _AOT_EXIT(63);
+  /* MAKE-VECTOR */
+ L64:
+  _AOT_LOCAL_REF(64, 0);
+ L73:
+  _AOT_PUSH(73);
+ L82:
+  _AOT_STACK_REF(82, 3);
+ L91:
+  _AOT_EXIT(91);
+  /* VECTOR-SET */
+ L92:
+  _AOT_EXIT(92);
+  /* MAKE-PROCEDURE */
+ L117:
+  _AOT_TAIL_CALL(117, 1);
+ L126:
+  _AOT_RET(126);
+  _AOT_EXIT(127);
+}
+
+static const unsigned char sexp_aot_chibi_string_31_shape[] = {
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 91, 26, 0, 0, 0, 0, 0,
+  0, 0, 81, 1, 0, 0, 0, 0, 0, 0, 0, 14, 17, 0, 0, 0,
+  0, 0, 0, 0, 15, 6, 8, 0, 0, 0, 0, 0, 0, 15, 14, 1,
+  0, 0, 0, 0, 0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 39,
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0,
+  0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 38, 1, 0, 0,
+  0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_32 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 17: goto L17;
+  case 26: goto L26;
+  case 35: goto L35;
+  case 44: goto L44;
+  case 53: goto L53;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 73: goto L73;
+  case 74: goto L74;
+  case 83: goto L83;
+  case 92: goto L92;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF_JUMP_UNLESS(0, 0, L35);
+ L17:
+  _AOT_LOCAL_REF(17, 0);
+ L26:
+  _AOT_JUMP(26, L92);
+ L35:
+  _AOT_CLOSURE_REF(35, 3);
+ L44:
+  _AOT_CLOSURE_REF(44, 2);
+ L53:
+  _AOT_EXIT(53);
+  /* STRING-REF */
+ L54:
+  _AOT_CLOSURE_REF(54, 1);
+ L63:
+  _AOT_CLOSURE_REF(63, 0);
+ L72:
+  _AOT_EXIT(72);
+  /* STRING-REF */
+ L73:
+  _AOT_EQ(73);
+ L74:
+  _AOT_GLOBAL_KNOWN_REF(74);
+ L83:
+  _AOT_TAIL_CALL(83, 1);
+ L92:
+  _AOT_RET(92);
+  _AOT_EXIT(93);
+}
+
+static const unsigned char sexp_aot_chibi_string_32_shape[] = {
+  84, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0, 0, 0,
+  0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 14, 65, 0, 0, 0, 0,
+  0, 0, 0, 24, 3, 0, 0, 0, 0, 0, 0, 0, 24, 2, 0, 0,
+  0, 0, 0, 0, 0, 32, 24, 1, 0, 0, 0, 0, 0, 0, 0, 24,
+  0, 0, 0, 0, 0, 0, 0, 0, 32, 68, 19, 0, 0, 0, 0, 0,
+  0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_33 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 17: goto L17;
+  case 26: goto L26;
+  case 35: goto L35;
+  case 44: goto L44;
+  case 53: goto L53;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 73: goto L73;
+  case 82: goto L82;
+  case 91: goto L91;
+  case 100: goto L100;
+  case 101: goto L101;
+  case 110: goto L110;
+  case 119: goto L119;
+  case 128: goto L128;
+  case 129: goto L129;
+  case 138: goto L138;
+  case 147: goto L147;
+  case 156: goto L156;
+  case 157: goto L157;
+  case 166: goto L166;
+  case 175: goto L175;
+  case 184: goto L184;
+  case 185: goto L185;
+  case 210: goto L210;
+  case 219: goto L219;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF_JUMP_UNLESS(0, 0, L35);
+ L17:
+  _AOT_LOCAL_REF(17, 0);
+ L26:
+  _AOT_JUMP(26, L219);
+ L35:
+  _AOT_CLOSURE_REF(35, 3);
+ L44:
+  _AOT_CLOSURE_REF(44, 4);
+ L53:
+  _AOT_LE(53);
+ L54:
+  _AOT_PUSH(54);
+ L63:
+  _AOT_PUSH(63);
+ L72:
+  _AOT_EXIT(72);
+  /* MAKE-VECTOR */
+ L73:
+  _AOT_CLOSURE_REF(73, 0);
+ L82:
+  _AOT_PUSH(82);
+ L91:
+  _AOT_STACK_REF(91, 3);
+ L100:
+  _AOT_EXIT(100);
+  /* VECTOR-SET */
+ L101:
+  _AOT_CLOSURE_REF(101, 1);
+ L110:
+  _AOT_PUSH(110);
+ L119:
+  _AOT_STACK_REF(119, 3);
+ L128:
+  _AOT_EXIT(128);
+  /* VECTOR-SET */
+ L129:
+  _AOT_CLOSURE_REF(129, 2);
+ L138:
+  _AOT_PUSH(138);
+ L147:
+  _AOT_STACK_REF(147, 3);
+ L156:
+  _AOT_EXIT(156);
+  /* VECTOR-SET */
+ L157:
+  _AOT_CLOSURE_REF(157, 3);
+ L166:
+  _AOT_PUSH(166);
+ L175:
+  _AOT_STACK_REF(175, 3);
+ L184:
+  _AOT_EXIT(184);
+  /* VECTOR-SET */
+ L185:
+  _AOT_EXIT(185);
+  /* MAKE-PROCEDURE */
+ L210:
+  _AOT_TAIL_CALL(210, 1);
+ L219:
+  _AOT_RET(219);
+  _AOT_EXIT(220);
+}
+
+static const unsigned char sexp_aot_chibi_string_33_shape[] = {
+  84, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0, 0, 0,
+  0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 14, 192, 0, 0, 0, 0,
+  0, 0, 0, 24, 3, 0, 0, 0, 0, 0, 0, 0, 24, 4, 0, 0,
+  0, 0, 0, 0, 0, 66, 15, 14, 1, 0, 0, 0, 0, 0, 0, 15,
+  17, 0, 0, 0, 0, 0, 0, 0, 39, 24, 0, 0, 0, 0, 0, 0,
+  0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0,
+  0, 0, 0, 0, 27, 24, 1, 0, 0, 0, 0, 0, 0, 0, 15, 5,
+  0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0,
+  27, 24, 2, 0, 0, 0, 0, 0, 0, 0, 15, 9, 0, 0, 0, 0,
+  0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 24, 3, 0,
+  0, 0, 0, 0, 0, 0, 15, 13, 0, 0, 0, 0, 0, 0, 0, 21,
+  3, 0, 0, 0, 0, 0, 0, 0, 27, 38, 1, 0, 0, 0, 0, 0,
+  0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_34 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 19: goto L19;
+  case 28: goto L28;
+  case 37: goto L37;
+  case 38: goto L38;
+  case 47: goto L47;
+  case 56: goto L56;
+  case 65: goto L65;
+  case 66: goto L66;
+  case 75: goto L75;
+  case 84: goto L84;
+  case 93: goto L93;
+  case 94: goto L94;
+  case 103: goto L103;
+  case 112: goto L112;
+  case 121: goto L121;
+  case 122: goto L122;
+  case 131: goto L131;
+  case 140: goto L140;
+  case 149: goto L149;
+  case 150: goto L150;
+  case 159: goto L159;
+  case 168: goto L168;
+  case 177: goto L177;
+  case 178: goto L178;
+  case 203: goto L203;
+  case 212: goto L212;
+  case 221: goto L221;
+  case 230: goto L230;
+  case 239: goto L239;
+  case 248: goto L248;
+  case 257: goto L257;
+  case 258: goto L258;
+  case 267: goto L267;
+  case 276: goto L276;
+  case 277: goto L277;
+  case 286: goto L286;
+  case 295: goto L295;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_CLOSURE_REF(9, 3);
+ L18:
+  _AOT_LE(18);
+ L19:
+  _AOT_PUSH(19);
+ L28:
+  _AOT_PUSH(28);
+ L37:
+  _AOT_EXIT(37);
+  /* MAKE-VECTOR */
+ L38:
+  _AOT_CLOSURE_REF(38, 2);
+ L47:
+  _AOT_PUSH(47);
+ L56:
+  _AOT_STACK_REF(56, 3);
+ L65:
+  _AOT_EXIT(65);
+  /* VECTOR-SET */
+ L66:
+  _AOT_LOCAL_REF(66, 0);
+ L75:
+  _AOT_PUSH(75);
+ L84:
+  _AOT_STACK_REF(84, 3);
+ L93:
+  _AOT_EXIT(93);
+  /* VECTOR-SET */
+ L94:
+  _AOT_CLOSURE_REF(94, 1);
+ L103:
+  _AOT_PUSH(103);
+ L112:
+  _AOT_STACK_REF(112, 3);
+ L121:
+  _AOT_EXIT(121);
+  /* VECTOR-SET */
+ L122:
+  _AOT_LOCAL_REF(122, 1);
+ L131:
+  _AOT_PUSH(131);
+ L140:
+  _AOT_STACK_REF(140, 3);
+ L149:
+  _AOT_EXIT(149);
+  /* VECTOR-SET */
+ L150:
+  _AOT_CLOSURE_REF(150, 0);
+ L159:
+  _AOT_PUSH(159);
+ L168:
+  _AOT_STACK_REF(168, 3);
+ L177:
+  _AOT_EXIT(177);
+  /* VECTOR-SET */
+ L178:
+  _AOT_EXIT(178);
+  /* MAKE-PROCEDURE */
+ L203:
+  _AOT_CALL(203, 1);
+ L212:
+  _AOT_JUMP_UNLESS(212, L239);
+ L221:
+  _AOT_LOCAL_REF(221, 1);
+ L230:
+  _AOT_JUMP(230, L295);
+ L239:
+  _AOT_LOCAL_REF(239, 1);
+ L248:
+  _AOT_CLOSURE_REF(248, 1);
+ L257:
+  _AOT_EXIT(257);
+  /* STRING-CURSOR-NEXT */
+ L258:
+  _AOT_LOCAL_REF(258, 0);
+ L267:
+  _AOT_CLOSURE_REF(267, 2);
+ L276:
+  _AOT_EXIT(276);
+  /* STRING-CURSOR-NEXT */
+ L277:
+  _AOT_CLOSURE_REF_CDR(277, 4);
+ L286:
+  _AOT_TAIL_CALL(286, 2);
+ L295:
+  _AOT_RET(295);
+  _AOT_EXIT(296);
+}
+
+static const unsigned char sexp_aot_chibi_string_34_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 24, 3, 0, 0, 0, 0, 0,
+  0, 0, 66, 15, 14, 1, 0, 0, 0, 0, 0, 0, 15, 21, 0, 0,
+  0, 0, 0, 0, 0, 39, 24, 2, 0, 0, 0, 0, 0, 0, 0, 15,
+  1, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0,
+  0, 27, 22, 0, 0, 0, 0, 0, 0, 0, 0, 15, 5, 0, 0, 0,
+  0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 24, 1,
+  0, 0, 0, 0, 0, 0, 0, 15, 9, 0, 0, 0, 0, 0, 0, 0,
+  21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 22, 1, 0, 0, 0, 0,
+  0, 0, 0, 15, 13, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0,
+  0, 0, 0, 0, 0, 27, 24, 0, 0, 0, 0, 0, 0, 0, 0, 15,
+  17, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0,
+  0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 5, 0, 0, 0,
+  0, 0, 0, 0, 13, 26, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0,
+  0, 0, 0, 0, 0, 0, 14, 64, 0, 0, 0, 0, 0, 0, 0, 22,
+  1, 0, 0, 0, 0, 0, 0, 0, 24, 1, 0, 0, 0, 0, 0, 0,
+  0, 35, 22, 0, 0, 0, 0, 0, 0, 0, 0, 24, 2, 0, 0, 0,
+  0, 0, 0, 0, 35, 83, 4, 0, 0, 0, 0, 0, 0, 0, 5, 9,
+  0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_35 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 34: goto L34;
+  case 43: goto L43;
+  case 68: goto L68;
+  case 77: goto L77;
+  case 86: goto L86;
+  case 87: goto L87;
+  case 96: goto L96;
+  case 105: goto L105;
+  case 114: goto L114;
+  case 115: goto L115;
+  case 124: goto L124;
+  case 133: goto L133;
+  case 142: goto L142;
+  case 143: goto L143;
+  case 152: goto L152;
+  case 161: goto L161;
+  case 170: goto L170;
+  case 171: goto L171;
+  case 180: goto L180;
+  case 189: goto L189;
+  case 198: goto L198;
+  case 199: goto L199;
+  case 224: goto L224;
+  case 233: goto L233;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_CLOSURE_REF(0, 1);
+ L9:
+  _AOT_GLOBAL_KNOWN_CALL(9, 1);
+ L34:
+  _AOT_CLOSURE_REF(34, 0);
+ L43:
+  _AOT_GLOBAL_KNOWN_CALL(43, 1);
+ L68:
+  _AOT_PUSH(68);
+ L77:
+  _AOT_PUSH(77);
+ L86:
+  _AOT_EXIT(86);
+  /* MAKE-VECTOR */
+ L87:
+  _AOT_LOCAL_REF(87, 1);
+ L96:
+  _AOT_PUSH(96);
+ L105:
+  _AOT_STACK_REF(105, 3);
+ L114:
+  _AOT_EXIT(114);
+  /* VECTOR-SET */
+ L115:
+  _AOT_CLOSURE_REF(115, 1);
+ L124:
+  _AOT_PUSH(124);
+ L133:
+  _AOT_STACK_REF(133, 3);
+ L142:
+  _AOT_EXIT(142);
+  /* VECTOR-SET */
+ L143:
+  _AOT_CLOSURE_REF(143, 0);
+ L152:
+  _AOT_PUSH(152);
+ L161:
+  _AOT_STACK_REF(161, 3);
+ L170:
+  _AOT_EXIT(170);
+  /* VECTOR-SET */
+ L171:
+  _AOT_LOCAL_REF(171, 0);
+ L180:
+  _AOT_PUSH(180);
+ L189:
+  _AOT_STACK_REF(189, 3);
+ L198:
+  _AOT_EXIT(198);
+  /* VECTOR-SET */
+ L199:
+  _AOT_EXIT(199);
+  /* MAKE-PROCEDURE */
+ L224:
+  _AOT_TAIL_CALL(224, 2);
+ L233:
+  _AOT_RET(233);
+  _AOT_EXIT(234);
+}
+
+static const unsigned char sexp_aot_chibi_string_35_shape[] = {
+  24, 1, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0,
+  0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 15, 14, 1, 0, 0, 0, 0, 0, 0, 15, 17, 0,
+  0, 0, 0, 0, 0, 0, 39, 22, 1, 0, 0, 0, 0, 0, 0, 0,
+  15, 1, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0,
+  0, 0, 27, 24, 1, 0, 0, 0, 0, 0, 0, 0, 15, 5, 0, 0,
+  0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 24,
+  0, 0, 0, 0, 0, 0, 0, 0, 15, 9, 0, 0, 0, 0, 0, 0,
+  0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 22, 0, 0, 0, 0,
+  0, 0, 0, 0, 15, 13, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0,
+  0, 0, 0, 0, 0, 0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0,
+  9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  5, 9, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_36 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 10: goto L10;
+  case 19: goto L19;
+  case 20: goto L20;
+  case 29: goto L29;
+  case 38: goto L38;
+  case 39: goto L39;
+  case 48: goto L48;
+  case 57: goto L57;
+  case 66: goto L66;
+  case 67: goto L67;
+  case 76: goto L76;
+  case 85: goto L85;
+  case 94: goto L94;
+  case 95: goto L95;
+  case 120: goto L120;
+  case 129: goto L129;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 1);
+ L9:
+  _AOT_EXIT(9);
+  /* STRING-SIZE */
+ L10:
+  _AOT_LOCAL_REF(10, 0);
+ L19:
+  _AOT_EXIT(19);
+  /* STRING-SIZE */
+ L20:
+  _AOT_PUSH(20);
+ L29:
+  _AOT_PUSH(29);
+ L38:
+  _AOT_EXIT(38);
+  /* MAKE-VECTOR */
+ L39:
+  _AOT_LOCAL_REF(39, 0);
+ L48:
+  _AOT_PUSH(48);
+ L57:
+  _AOT_STACK_REF(57, 3);
+ L66:
+  _AOT_EXIT(66);
+  /* VECTOR-SET */
+ L67:
+  _AOT_LOCAL_REF(67, 1);
+ L76:
+  _AOT_PUSH(76);
+ L85:
+  _AOT_STACK_REF(85, 3);
+ L94:
+  _AOT_EXIT(94);
+  /* VECTOR-SET */
+ L95:
+  _AOT_EXIT(95);
+  /* MAKE-PROCEDURE */
+ L120:
+  _AOT_TAIL_CALL(120, 2);
+ L129:
+  _AOT_RET(129);
+  _AOT_EXIT(130);
+}
+
+static const unsigned char sexp_aot_chibi_string_36_shape[] = {
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 37, 22, 0, 0, 0, 0, 0,
+  0, 0, 0, 37, 15, 14, 1, 0, 0, 0, 0, 0, 0, 15, 9, 0,
+  0, 0, 0, 0, 0, 0, 39, 22, 0, 0, 0, 0, 0, 0, 0, 0,
+  15, 1, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0,
+  0, 0, 27, 22, 1, 0, 0, 0, 0, 0, 0, 0, 15, 5, 0, 0,
+  0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 38,
+  1, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 5, 9, 0, 0, 0, 0, 0, 0,
+  0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_37 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 17: goto L17;
+  case 26: goto L26;
+  case 35: goto L35;
+  case 44: goto L44;
+  case 53: goto L53;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 73: goto L73;
+  case 82: goto L82;
+  case 91: goto L91;
+  case 100: goto L100;
+  case 101: goto L101;
+  case 110: goto L110;
+  case 119: goto L119;
+  case 128: goto L128;
+  case 129: goto L129;
+  case 138: goto L138;
+  case 147: goto L147;
+  case 156: goto L156;
+  case 157: goto L157;
+  case 166: goto L166;
+  case 175: goto L175;
+  case 184: goto L184;
+  case 185: goto L185;
+  case 210: goto L210;
+  case 219: goto L219;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF_JUMP_UNLESS(0, 0, L35);
+ L17:
+  _AOT_LOCAL_REF(17, 0);
+ L26:
+  _AOT_JUMP(26, L219);
+ L35:
+  _AOT_CLOSURE_REF(35, 4);
+ L44:
+  _AOT_CLOSURE_REF(44, 3);
+ L53:
+  _AOT_LT(53);
+ L54:
+  _AOT_PUSH(54);
+ L63:
+  _AOT_PUSH(63);
+ L72:
+  _AOT_EXIT(72);
+  /* MAKE-VECTOR */
+ L73:
+  _AOT_CLOSURE_REF(73, 0);
+ L82:
+  _AOT_PUSH(82);
+ L91:
+  _AOT_STACK_REF(91, 3);
+ L100:
+  _AOT_EXIT(100);
+  /* VECTOR-SET */
+ L101:
+  _AOT_CLOSURE_REF(101, 1);
+ L110:
+  _AOT_PUSH(110);
+ L119:
+  _AOT_STACK_REF(119, 3);
+ L128:
+  _AOT_EXIT(128);
+  /* VECTOR-SET */
+ L129:
+  _AOT_CLOSURE_REF(129, 2);
+ L138:
+  _AOT_PUSH(138);
+ L147:
+  _AOT_STACK_REF(147, 3);
+ L156:
+  _AOT_EXIT(156);
+  /* VECTOR-SET */
+ L157:
+  _AOT_CLOSURE_REF(157, 3);
+ L166:
+  _AOT_PUSH(166);
+ L175:
+  _AOT_STACK_REF(175, 3);
+ L184:
+  _AOT_EXIT(184);
+  /* VECTOR-SET */
+ L185:
+  _AOT_EXIT(185);
+  /* MAKE-PROCEDURE */
+ L210:
+  _AOT_TAIL_CALL(210, 1);
+ L219:
+  _AOT_RET(219);
+  _AOT_EXIT(220);
+}
+
+static const unsigned char sexp_aot_chibi_string_37_shape[] = {
+  84, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0, 0, 0,
+  0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 14, 192, 0, 0, 0, 0,
+  0, 0, 0, 24, 4, 0, 0, 0, 0, 0, 0, 0, 24, 3, 0, 0,
+  0, 0, 0, 0, 0, 65, 15, 14, 1, 0, 0, 0, 0, 0, 0, 15,
+  17, 0, 0, 0, 0, 0, 0, 0, 39, 24, 0, 0, 0, 0, 0, 0,
+  0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0,
+  0, 0, 0, 0, 27, 24, 1, 0, 0, 0, 0, 0, 0, 0, 15, 5,
+  0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0,
+  27, 24, 2, 0, 0, 0, 0, 0, 0, 0, 15, 9, 0, 0, 0, 0,
+  0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 24, 3, 0,
+  0, 0, 0, 0, 0, 0, 15, 13, 0, 0, 0, 0, 0, 0, 0, 21,
+  3, 0, 0, 0, 0, 0, 0, 0, 27, 38, 1, 0, 0, 0, 0, 0,
+  0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_38 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 19: goto L19;
+  case 28: goto L28;
+  case 37: goto L37;
+  case 38: goto L38;
+  case 47: goto L47;
+  case 56: goto L56;
+  case 65: goto L65;
+  case 66: goto L66;
+  case 75: goto L75;
+  case 84: goto L84;
+  case 93: goto L93;
+  case 94: goto L94;
+  case 103: goto L103;
+  case 112: goto L112;
+  case 121: goto L121;
+  case 122: goto L122;
+  case 131: goto L131;
+  case 140: goto L140;
+  case 149: goto L149;
+  case 150: goto L150;
+  case 159: goto L159;
+  case 168: goto L168;
+  case 177: goto L177;
+  case 178: goto L178;
+  case 203: goto L203;
+  case 212: goto L212;
+  case 221: goto L221;
+  case 230: goto L230;
+  case 239: goto L239;
+  case 248: goto L248;
+  case 257: goto L257;
+  case 258: goto L258;
+  case 267: goto L267;
+  case 276: goto L276;
+  case 277: goto L277;
+  case 286: goto L286;
+  case 295: goto L295;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_CLOSURE_REF(0, 3);
+ L9:
+  _AOT_LOCAL_REF(9, 0);
+ L18:
+  _AOT_LT(18);
+ L19:
+  _AOT_PUSH(19);
+ L28:
+  _AOT_PUSH(28);
+ L37:
+  _AOT_EXIT(37);
+  /* MAKE-VECTOR */
+ L38:
+  _AOT_CLOSURE_REF(38, 2);
+ L47:
+  _AOT_PUSH(47);
+ L56:
+  _AOT_STACK_REF(56, 3);
+ L65:
+  _AOT_EXIT(65);
+  /* VECTOR-SET */
+ L66:
+  _AOT_LOCAL_REF(66, 0);
+ L75:
+  _AOT_PUSH(75);
+ L84:
+  _AOT_STACK_REF(84, 3);
+ L93:
+  _AOT_EXIT(93);
+  /* VECTOR-SET */
+ L94:
+  _AOT_CLOSURE_REF(94, 1);
+ L103:
+  _AOT_PUSH(103);
+ L112:
+  _AOT_STACK_REF(112, 3);
+ L121:
+  _AOT_EXIT(121);
+  /* VECTOR-SET */
+ L122:
+  _AOT_LOCAL_REF(122, 1);
+ L131:
+  _AOT_PUSH(131);
+ L140:
+  _AOT_STACK_REF(140, 3);
+ L149:
+  _AOT_EXIT(149);
+  /* VECTOR-SET */
+ L150:
+  _AOT_CLOSURE_REF(150, 0);
+ L159:
+  _AOT_PUSH(159);
+ L168:
+  _AOT_STACK_REF(168, 3);
+ L177:
+  _AOT_EXIT(177);
+  /* VECTOR-SET */
+ L178:
+  _AOT_EXIT(178);
+  /* MAKE-PROCEDURE */
+ L203:
+  _AOT_CALL(203, 1);
+ L212:
+  _AOT_JUMP_UNLESS(212, L239);
+ L221:
+  _AOT_LOCAL_REF(221, 1);
+ L230:
+  _AOT_JUMP(230, L295);
+ L239:
+  _AOT_LOCAL_REF(239, 1);
+ L248:
+  _AOT_CLOSURE_REF(248, 1);
+ L257:
+  _AOT_EXIT(257);
+  /* STRING-CURSOR-PREV */
+ L258:
+  _AOT_LOCAL_REF(258, 0);
+ L267:
+  _AOT_CLOSURE_REF(267, 2);
+ L276:
+  _AOT_EXIT(276);
+  /* STRING-CURSOR-PREV */
+ L277:
+  _AOT_CLOSURE_REF_CDR(277, 4);
+ L286:
+  _AOT_TAIL_CALL(286, 2);
+ L295:
+  _AOT_RET(295);
+  _AOT_EXIT(296);
+}
+
+static const unsigned char sexp_aot_chibi_string_38_shape[] = {
+  24, 3, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 65, 15, 14, 1, 0, 0, 0, 0, 0, 0, 15, 21, 0, 0,
+  0, 0, 0, 0, 0, 39, 24, 2, 0, 0, 0, 0, 0, 0, 0, 15,
+  1, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0,
+  0, 27, 22, 0, 0, 0, 0, 0, 0, 0, 0, 15, 5, 0, 0, 0,
+  0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 24, 1,
+  0, 0, 0, 0, 0, 0, 0, 15, 9, 0, 0, 0, 0, 0, 0, 0,
+  21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 22, 1, 0, 0, 0, 0,
+  0, 0, 0, 15, 13, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0,
+  0, 0, 0, 0, 0, 27, 24, 0, 0, 0, 0, 0, 0, 0, 0, 15,
+  17, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0,
+  0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 5, 0, 0, 0,
+  0, 0, 0, 0, 13, 26, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0,
+  0, 0, 0, 0, 0, 0, 14, 64, 0, 0, 0, 0, 0, 0, 0, 22,
+  1, 0, 0, 0, 0, 0, 0, 0, 24, 1, 0, 0, 0, 0, 0, 0,
+  0, 36, 22, 0, 0, 0, 0, 0, 0, 0, 0, 24, 2, 0, 0, 0,
+  0, 0, 0, 0, 36, 83, 4, 0, 0, 0, 0, 0, 0, 0, 5, 9,
+  0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_39 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 10: goto L10;
+  case 19: goto L19;
+  case 20: goto L20;
+  case 29: goto L29;
+  case 30: goto L30;
+  case 39: goto L39;
+  case 40: goto L40;
+  case 49: goto L49;
+  case 58: goto L58;
+  case 59: goto L59;
+  case 68: goto L68;
+  case 77: goto L77;
+  case 86: goto L86;
+  case 87: goto L87;
+  case 96: goto L96;
+  case 105: goto L105;
+  case 114: goto L114;
+  case 115: goto L115;
+  case 124: goto L124;
+  case 133: goto L133;
+  case 142: goto L142;
+  case 143: goto L143;
+  case 152: goto L152;
+  case 161: goto L161;
+  case 170: goto L170;
+  case 171: goto L171;
+  case 196: goto L196;
+  case 205: goto L205;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_CLOSURE_REF(0, 1);
+ L9:
+  _AOT_EXIT(9);
+  /* STRING-SIZE */
+ L10:
+  _AOT_CLOSURE_REF(10, 1);
+ L19:
+  _AOT_EXIT(19);
+  /* STRING-CURSOR-PREV */
+ L20:
+  _AOT_CLOSURE_REF(20, 0);
+ L29:
+  _AOT_EXIT(29);
+  /* STRING-SIZE */
+ L30:
+  _AOT_CLOSURE_REF(30, 0);
+ L39:
+  _AOT_EXIT(39);
+  /* STRING-CURSOR-PREV */
+ L40:
+  _AOT_PUSH(40);
+ L49:
+  _AOT_PUSH(49);
+ L58:
+  _AOT_EXIT(58);
+  /* MAKE-VECTOR */
+ L59:
+  _AOT_LOCAL_REF(59, 1);
+ L68:
+  _AOT_PUSH(68);
+ L77:
+  _AOT_STACK_REF(77, 3);
+ L86:
+  _AOT_EXIT(86);
+  /* VECTOR-SET */
+ L87:
+  _AOT_CLOSURE_REF(87, 1);
+ L96:
+  _AOT_PUSH(96);
+ L105:
+  _AOT_STACK_REF(105, 3);
+ L114:
+  _AOT_EXIT(114);
+  /* VECTOR-SET */
+ L115:
+  _AOT_CLOSURE_REF(115, 0);
+ L124:
+  _AOT_PUSH(124);
+ L133:
+  _AOT_STACK_REF(133, 3);
+ L142:
+  _AOT_EXIT(142);
+  /* VECTOR-SET */
+ L143:
+  _AOT_LOCAL_REF(143, 0);
+ L152:
+  _AOT_PUSH(152);
+ L161:
+  _AOT_STACK_REF(161, 3);
+ L170:
+  _AOT_EXIT(170);
+  /* VECTOR-SET */
+ L171:
+  _AOT_EXIT(171);
+  /* MAKE-PROCEDURE */
+ L196:
+  _AOT_TAIL_CALL(196, 2);
+ L205:
+  _AOT_RET(205);
+  _AOT_EXIT(206);
+}
+
+static const unsigned char sexp_aot_chibi_string_39_shape[] = {
+  24, 1, 0, 0, 0, 0, 0, 0, 0, 37, 24, 1, 0, 0, 0, 0,
+  0, 0, 0, 36, 24, 0, 0, 0, 0, 0, 0, 0, 0, 37, 24, 0,
+  0, 0, 0, 0, 0, 0, 0, 36, 15, 14, 1, 0, 0, 0, 0, 0,
+  0, 15, 17, 0, 0, 0, 0, 0, 0, 0, 39, 22, 1, 0, 0, 0,
+  0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0,
+  0, 0, 0, 0, 0, 0, 27, 24, 1, 0, 0, 0, 0, 0, 0, 0,
+  15, 5, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0,
+  0, 0, 27, 24, 0, 0, 0, 0, 0, 0, 0, 0, 15, 9, 0, 0,
+  0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 22,
+  0, 0, 0, 0, 0, 0, 0, 0, 15, 13, 0, 0, 0, 0, 0, 0,
+  0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 38, 1, 0, 0, 0,
+  0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 9, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_40 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 34: goto L34;
+  case 43: goto L43;
+  case 68: goto L68;
+  case 77: goto L77;
+  case 86: goto L86;
+  case 87: goto L87;
+  case 96: goto L96;
+  case 105: goto L105;
+  case 114: goto L114;
+  case 115: goto L115;
+  case 124: goto L124;
+  case 133: goto L133;
+  case 142: goto L142;
+  case 143: goto L143;
+  case 168: goto L168;
+  case 177: goto L177;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 1);
+ L9:
+  _AOT_GLOBAL_KNOWN_CALL(9, 1);
+ L34:
+  _AOT_LOCAL_REF(34, 0);
+ L43:
+  _AOT_GLOBAL_KNOWN_CALL(43, 1);
+ L68:
+  _AOT_PUSH(68);
+ L77:
+  _AOT_PUSH(77);
+ L86:
+  _AOT_EXIT(86);
+  /* MAKE-VECTOR */
+ L87:
+  _AOT_LOCAL_REF(87, 0);
+ L96:
+  _AOT_PUSH(96);
+ L105:
+  _AOT_STACK_REF(105, 3);
+ L114:
+  _AOT_EXIT(114);
+  /* VECTOR-SET */
+ L115:
+  _AOT_LOCAL_REF(115, 1);
+ L124:
+  _AOT_PUSH(124);
+ L133:
+  _AOT_STACK_REF(133, 3);
+ L142:
+  _AOT_EXIT(142);
+  /* VECTOR-SET */
+ L143:
+  _AOT_EXIT(143);
+  /* MAKE-PROCEDURE */
+ L168:
+  _AOT_TAIL_CALL(168, 2);
+ L177:
+  _AOT_RET(177);
+  _AOT_EXIT(178);
+}
+
+static const unsigned char sexp_aot_chibi_string_40_shape[] = {
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0,
+  0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 15, 14, 1, 0, 0, 0, 0, 0, 0, 15, 9, 0,
+  0, 0, 0, 0, 0, 0, 39, 22, 0, 0, 0, 0, 0, 0, 0, 0,
+  15, 1, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0,
+  0, 0, 27, 22, 1, 0, 0, 0, 0, 0, 0, 0, 15, 5, 0, 0,
+  0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 38,
+  1, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 5, 9, 0, 0, 0, 0, 0, 0,
+  0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_41 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 43: goto L43;
+  case 52: goto L52;
+  case 53: goto L53;
+  case 54: goto L54;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 1);
+ L9:
+  _AOT_LOCAL_REF(9, 0);
+ L18:
+  _AOT_GLOBAL_KNOWN_CALL(18, 2);
+ L43:
+  _AOT_LOCAL_REF(43, 0);
+ L52:
+  _AOT_EXIT(52);
+  /* STRING-SIZE */
+ L53:
+  _AOT_EQN(53);
+ L54:
+  _AOT_RET(54);
+  _AOT_EXIT(55);
+}
+
+static const unsigned char sexp_aot_chibi_string_41_shape[] = {
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0,
+  0, 0, 0, 0, 37, 67, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_42 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 10: goto L10;
+  case 19: goto L19;
+  case 20: goto L20;
+  case 21: goto L21;
+  case 30: goto L30;
+  case 39: goto L39;
+  case 64: goto L64;
+  case 65: goto L65;
+  case 74: goto L74;
+  case 99: goto L99;
+  case 108: goto L108;
+  case 109: goto L109;
+  case 110: goto L110;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_EXIT(9);
+  /* STRING-SIZE */
+ L10:
+  _AOT_LOCAL_REF(10, 1);
+ L19:
+  _AOT_EXIT(19);
+  /* STRING-SIZE */
+ L20:
+  _AOT_SUB(20);
+ L21:
+  _AOT_LOCAL_REF(21, 1);
+ L30:
+  _AOT_LOCAL_REF(30, 0);
+ L39:
+  _AOT_GLOBAL_KNOWN_CALL(39, 2);
+ L64:
+  _AOT_SUB(64);
+ L65:
+  _AOT_LOCAL_REF(65, 0);
+ L74:
+  _AOT_GLOBAL_KNOWN_CALL(74, 1);
+ L99:
+  _AOT_LOCAL_REF(99, 0);
+ L108:
+  _AOT_EXIT(108);
+  /* STRING-CURSOR-PREV */
+ L109:
+  _AOT_EQN(109);
+ L110:
+  _AOT_RET(110);
+  _AOT_EXIT(111);
+}
+
+static const unsigned char sexp_aot_chibi_string_42_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 37, 22, 1, 0, 0, 0, 0,
+  0, 0, 0, 37, 60, 22, 1, 0, 0, 0, 0, 0, 0, 0, 22, 0,
+  0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0,
+  9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  60, 22, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0,
+  0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 36, 67, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_43 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 19: goto L19;
+  case 20: goto L20;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 1);
+ L9:
+  _AOT_LOCAL_REF(9, 0);
+ L18:
+  _AOT_EXIT(18);
+  /* STRING-SIZE */
+ L19:
+  _AOT_LE(19);
+ L20:
+  _AOT_RET(20);
+  _AOT_EXIT(21);
+}
+
+static const unsigned char sexp_aot_chibi_string_43_shape[] = {
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 37, 66, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_44 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 52: goto L52;
+  case 61: goto L61;
+  case 70: goto L70;
+  case 79: goto L79;
+  case 88: goto L88;
+  case 113: goto L113;
+  case 122: goto L122;
+  case 131: goto L131;
+  case 140: goto L140;
+  case 165: goto L165;
+  case 190: goto L190;
+  case 199: goto L199;
+  case 224: goto L224;
+  case 233: goto L233;
+  case 242: goto L242;
+  case 251: goto L251;
+  case 276: goto L276;
+  case 285: goto L285;
+  case 294: goto L294;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_CLOSURE_REF(9, 0);
+ L18:
+  _AOT_PUSH(18);
+ L27:
+  _AOT_GLOBAL_KNOWN_CALL(27, 3);
+ L52:
+  _AOT_JUMP_UNLESS(52, L79);
+ L61:
+  _AOT_LOCAL_REF(61, 1);
+ L70:
+  _AOT_JUMP(70, L294);
+ L79:
+  _AOT_LOCAL_REF(79, 1);
+ L88:
+  _AOT_GLOBAL_KNOWN_CALL(88, 1);
+ L113:
+  _AOT_LOCAL_REF(113, 0);
+ L122:
+  _AOT_CLOSURE_REF(122, 0);
+ L131:
+  _AOT_GLOBAL_KNOWN_REF(131);
+ L140:
+  _AOT_GLOBAL_KNOWN_CALL(140, 3);
+ L165:
+  _AOT_GLOBAL_KNOWN_CALL(165, 2);
+ L190:
+  _AOT_CLOSURE_REF(190, 2);
+ L199:
+  _AOT_GLOBAL_KNOWN_CALL(199, 2);
+ L224:
+  _AOT_LOCAL_REF(224, 0);
+ L233:
+  _AOT_CLOSURE_REF(233, 0);
+ L242:
+  _AOT_GLOBAL_KNOWN_REF(242);
+ L251:
+  _AOT_GLOBAL_KNOWN_CALL(251, 3);
+ L276:
+  _AOT_CLOSURE_REF_CDR(276, 1);
+ L285:
+  _AOT_TAIL_CALL(285, 2);
+ L294:
+  _AOT_RET(294);
+  _AOT_EXIT(295);
+}
+
+static const unsigned char sexp_aot_chibi_string_44_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0,
+  0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0,
+  0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 13, 26, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0,
+  0, 0, 0, 0, 0, 0, 14, 223, 0, 0, 0, 0, 0, 0, 0, 22,
+  1, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0,
+  0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0,
+  0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0,
+  0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 2,
+  0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0,
+  9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0,
+  0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0,
+  0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 83, 1, 0, 0, 0, 0, 0, 0, 0, 5, 9, 0,
+  0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_45 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 52: goto L52;
+  case 61: goto L61;
+  case 70: goto L70;
+  case 71: goto L71;
+  case 80: goto L80;
+  case 89: goto L89;
+  case 98: goto L98;
+  case 99: goto L99;
+  case 108: goto L108;
+  case 117: goto L117;
+  case 126: goto L126;
+  case 127: goto L127;
+  case 152: goto L152;
+  case 161: goto L161;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_CLOSURE_REF(0, 1);
+ L9:
+  _AOT_LOCAL_REF(9, 0);
+ L18:
+  _AOT_GLOBAL_KNOWN_REF(18);
+ L27:
+  _AOT_GLOBAL_KNOWN_CALL(27, 2);
+ L52:
+  _AOT_PUSH(52);
+ L61:
+  _AOT_PUSH(61);
+ L70:
+  _AOT_EXIT(70);
+  /* MAKE-VECTOR */
+ L71:
+  _AOT_LOCAL_REF(71, 0);
+ L80:
+  _AOT_PUSH(80);
+ L89:
+  _AOT_STACK_REF(89, 3);
+ L98:
+  _AOT_EXIT(98);
+  /* VECTOR-SET */
+ L99:
+  _AOT_CLOSURE_REF(99, 0);
+ L108:
+  _AOT_PUSH(108);
+ L117:
+  _AOT_STACK_REF(117, 3);
+ L126:
+  _AOT_EXIT(126);
+  /* VECTOR-SET */
+ L127:
+  _AOT_EXIT(127);
+  /* MAKE-PROCEDURE */
+ L152:
+  _AOT_TAIL_CALL(152, 2);
+ L161:
+  _AOT_RET(161);
+  _AOT_EXIT(162);
+}
+
+static const unsigned char sexp_aot_chibi_string_45_shape[] = {
+  24, 1, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0,
+  0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 15, 14, 1, 0, 0, 0, 0, 0, 0, 15, 9, 0,
+  0, 0, 0, 0, 0, 0, 39, 22, 0, 0, 0, 0, 0, 0, 0, 0,
+  15, 1, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0,
+  0, 0, 27, 24, 0, 0, 0, 0, 0, 0, 0, 0, 15, 5, 0, 0,
+  0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 38,
+  1, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 5, 9, 0, 0, 0, 0, 0, 0,
+  0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_46 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 72: goto L72;
+  case 73: goto L73;
+  case 82: goto L82;
+  case 91: goto L91;
+  case 100: goto L100;
+  case 109: goto L109;
+  case 110: goto L110;
+  case 119: goto L119;
+  case 128: goto L128;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_CLOSURE_REF(9, 0);
+ L18:
+  _AOT_LE_JUMP_UNLESS(18, L45);
+ L27:
+  _AOT_LOCAL_REF(27, 1);
+ L36:
+  _AOT_JUMP(36, L128);
+ L45:
+  _AOT_LOCAL_REF(45, 1);
+ L54:
+  _AOT_LOCAL_REF(54, 0);
+ L63:
+  _AOT_CLOSURE_REF(63, 2);
+ L72:
+  _AOT_EXIT(72);
+  /* STRING-REF */
+ L73:
+  _AOT_CLOSURE_REF(73, 3);
+ L82:
+  _AOT_CALL(82, 2);
+ L91:
+  _AOT_LOCAL_REF(91, 0);
+ L100:
+  _AOT_CLOSURE_REF(100, 2);
+ L109:
+  _AOT_EXIT(109);
+  /* STRING-CURSOR-NEXT */
+ L110:
+  _AOT_CLOSURE_REF_CDR(110, 1);
+ L119:
+  _AOT_TAIL_CALL(119, 2);
+ L128:
+  _AOT_RET(128);
+  _AOT_EXIT(129);
+}
+
+static const unsigned char sexp_aot_chibi_string_46_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0,
+  0, 0, 87, 26, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0, 0, 0,
+  0, 0, 0, 0, 14, 91, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0,
+  0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 24,
+  2, 0, 0, 0, 0, 0, 0, 0, 32, 24, 3, 0, 0, 0, 0, 0,
+  0, 0, 6, 9, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0,
+  0, 0, 0, 0, 24, 2, 0, 0, 0, 0, 0, 0, 0, 35, 83, 1,
+  0, 0, 0, 0, 0, 0, 0, 5, 9, 0, 0, 0, 0, 0, 0, 0,
+  79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_47 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 43: goto L43;
+  case 52: goto L52;
+  case 61: goto L61;
+  case 62: goto L62;
+  case 71: goto L71;
+  case 80: goto L80;
+  case 89: goto L89;
+  case 90: goto L90;
+  case 99: goto L99;
+  case 108: goto L108;
+  case 117: goto L117;
+  case 118: goto L118;
+  case 127: goto L127;
+  case 136: goto L136;
+  case 145: goto L145;
+  case 146: goto L146;
+  case 171: goto L171;
+  case 180: goto L180;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_CLOSURE_REF(0, 2);
+ L9:
+  _AOT_CLOSURE_REF(9, 1);
+ L18:
+  _AOT_GLOBAL_KNOWN_CALL(18, 1);
+ L43:
+  _AOT_PUSH(43);
+ L52:
+  _AOT_PUSH(52);
+ L61:
+  _AOT_EXIT(61);
+  /* MAKE-VECTOR */
+ L62:
+  _AOT_LOCAL_REF(62, 0);
+ L71:
+  _AOT_PUSH(71);
+ L80:
+  _AOT_STACK_REF(80, 3);
+ L89:
+  _AOT_EXIT(89);
+  /* VECTOR-SET */
+ L90:
+  _AOT_CLOSURE_REF(90, 1);
+ L99:
+  _AOT_PUSH(99);
+ L108:
+  _AOT_STACK_REF(108, 3);
+ L117:
+  _AOT_EXIT(117);
+  /* VECTOR-SET */
+ L118:
+  _AOT_CLOSURE_REF(118, 0);
+ L127:
+  _AOT_PUSH(127);
+ L136:
+  _AOT_STACK_REF(136, 3);
+ L145:
+  _AOT_EXIT(145);
+  /* VECTOR-SET */
+ L146:
+  _AOT_EXIT(146);
+  /* MAKE-PROCEDURE */
+ L171:
+  _AOT_TAIL_CALL(171, 2);
+ L180:
+  _AOT_RET(180);
+  _AOT_EXIT(181);
+}
+
+static const unsigned char sexp_aot_chibi_string_47_shape[] = {
+  24, 2, 0, 0, 0, 0, 0, 0, 0, 24, 1, 0, 0, 0, 0, 0,
+  0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 14, 1, 0, 0,
+  0, 0, 0, 0, 15, 13, 0, 0, 0, 0, 0, 0, 0, 39, 22, 0,
+  0, 0, 0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0,
+  21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 24, 1, 0, 0, 0, 0,
+  0, 0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0,
+  0, 0, 0, 0, 0, 27, 24, 0, 0, 0, 0, 0, 0, 0, 0, 15,
+  9, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0,
+  0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 9, 0, 0, 0,
+  0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_48 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 28: goto L28;
+  case 37: goto L37;
+  case 46: goto L46;
+  case 47: goto L47;
+  case 56: goto L56;
+  case 65: goto L65;
+  case 74: goto L74;
+  case 75: goto L75;
+  case 84: goto L84;
+  case 93: goto L93;
+  case 102: goto L102;
+  case 103: goto L103;
+  case 112: goto L112;
+  case 121: goto L121;
+  case 130: goto L130;
+  case 131: goto L131;
+  case 156: goto L156;
+  case 165: goto L165;
+  case 174: goto L174;
+  case 183: goto L183;
+  case 192: goto L192;
+  case 193: goto L193;
+  case 202: goto L202;
+  case 211: goto L211;
+  case 212: goto L212;
+  case 221: goto L221;
+  case 230: goto L230;
+  case 239: goto L239;
+  case 240: goto L240;
+  case 249: goto L249;
+  case 258: goto L258;
+  case 267: goto L267;
+  case 268: goto L268;
+  case 293: goto L293;
+  case 302: goto L302;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 3);
+ L9:
+  _AOT_NULLP_JUMP_UNLESS(9, L174);
+ L18:
+  _AOT_LOCAL_REF(18, 2);
+ L27:
+  _AOT_EXIT(27);
+  /* STRING-SIZE */
+ L28:
+  _AOT_PUSH(28);
+ L37:
+  _AOT_PUSH(37);
+ L46:
+  _AOT_EXIT(46);
+  /* MAKE-VECTOR */
+ L47:
+  _AOT_LOCAL_REF(47, 0);
+ L56:
+  _AOT_PUSH(56);
+ L65:
+  _AOT_STACK_REF(65, 3);
+ L74:
+  _AOT_EXIT(74);
+  /* VECTOR-SET */
+ L75:
+  _AOT_LOCAL_REF(75, 2);
+ L84:
+  _AOT_PUSH(84);
+ L93:
+  _AOT_STACK_REF(93, 3);
+ L102:
+  _AOT_EXIT(102);
+  /* VECTOR-SET */
+ L103:
+  _AOT_LOCAL_REF(103, 1);
+ L112:
+  _AOT_PUSH(112);
+ L121:
+  _AOT_STACK_REF(121, 3);
+ L130:
+  _AOT_EXIT(130);
+  /* VECTOR-SET */
+ L131:
+  _AOT_EXIT(131);
+  /* MAKE-PROCEDURE */
+ L156:
+  _AOT_TAIL_CALL(156, 1);
+ L165:
+  _AOT_JUMP(165, L302);
+ L174:
+  _AOT_LOCAL_REF(174, 3);
+ L183:
+  _AOT_LOCAL_REF(183, 2);
+ L192:
+  _AOT_CONS(192);
+ L193:
+  _AOT_PUSH(193);
+ L202:
+  _AOT_PUSH(202);
+ L211:
+  _AOT_EXIT(211);
+  /* MAKE-VECTOR */
+ L212:
+  _AOT_LOCAL_REF(212, 0);
+ L221:
+  _AOT_PUSH(221);
+ L230:
+  _AOT_STACK_REF(230, 3);
+ L239:
+  _AOT_EXIT(239);
+  /* VECTOR-SET */
+ L240:
+  _AOT_LOCAL_REF(240, 1);
+ L249:
+  _AOT_PUSH(249);
+ L258:
+  _AOT_STACK_REF(258, 3);
+ L267:
+  _AOT_EXIT(267);
+  /* VECTOR-SET */
+ L268:
+  _AOT_EXIT(268);
+  /* MAKE-PROCEDURE */
+ L293:
+  _AOT_TAIL_CALL(293, 1);
+ L302:
+  _AOT_RET(302);
+  _AOT_EXIT(303);
+}
+
+static const unsigned char sexp_aot_chibi_string_48_shape[] = {
+  22, 3, 0, 0, 0, 0, 0, 0, 0, 90, 164, 0, 0, 0, 0, 0,
+  0, 0, 22, 2, 0, 0, 0, 0, 0, 0, 0, 37, 15, 14, 1, 0,
+  0, 0, 0, 0, 0, 15, 13, 0, 0, 0, 0, 0, 0, 0, 39, 22,
+  0, 0, 0, 0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0, 0,
+  0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 22, 2, 0, 0, 0,
+  0, 0, 0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0,
+  0, 0, 0, 0, 0, 0, 27, 22, 1, 0, 0, 0, 0, 0, 0, 0,
+  15, 9, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0,
+  0, 0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 0, 0,
+  0, 0, 0, 0, 0, 14, 136, 0, 0, 0, 0, 0, 0, 0, 22, 3,
+  0, 0, 0, 0, 0, 0, 0, 22, 2, 0, 0, 0, 0, 0, 0, 0,
+  58, 15, 14, 1, 0, 0, 0, 0, 0, 0, 15, 9, 0, 0, 0, 0,
+  0, 0, 0, 39, 22, 0, 0, 0, 0, 0, 0, 0, 0, 15, 1, 0,
+  0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27,
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 15, 5, 0, 0, 0, 0, 0,
+  0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 38, 1, 0, 0,
+  0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_49 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 63: goto L63;
+  case 64: goto L64;
+  case 73: goto L73;
+  case 82: goto L82;
+  case 91: goto L91;
+  case 100: goto L100;
+  case 101: goto L101;
+  case 110: goto L110;
+  case 119: goto L119;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_CLOSURE_REF(9, 0);
+ L18:
+  _AOT_LE_JUMP_UNLESS(18, L45);
+ L27:
+  _AOT_CLOSURE_REF(27, 1);
+ L36:
+  _AOT_JUMP(36, L119);
+ L45:
+  _AOT_LOCAL_REF(45, 0);
+ L54:
+  _AOT_CLOSURE_REF(54, 3);
+ L63:
+  _AOT_EXIT(63);
+  /* STRING-CURSOR-NEXT */
+ L64:
+  _AOT_CLOSURE_REF_CDR(64, 4);
+ L73:
+  _AOT_CALL(73, 1);
+ L82:
+  _AOT_LOCAL_REF(82, 0);
+ L91:
+  _AOT_CLOSURE_REF(91, 3);
+ L100:
+  _AOT_EXIT(100);
+  /* STRING-REF */
+ L101:
+  _AOT_CLOSURE_REF(101, 2);
+ L110:
+  _AOT_TAIL_CALL(110, 2);
+ L119:
+  _AOT_RET(119);
+  _AOT_EXIT(120);
+}
+
+static const unsigned char sexp_aot_chibi_string_49_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0,
+  0, 0, 87, 26, 0, 0, 0, 0, 0, 0, 0, 24, 1, 0, 0, 0,
+  0, 0, 0, 0, 14, 82, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0,
+  0, 0, 0, 0, 0, 0, 24, 3, 0, 0, 0, 0, 0, 0, 0, 35,
+  83, 4, 0, 0, 0, 0, 0, 0, 0, 6, 5, 0, 0, 0, 0, 0,
+  0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 24, 3, 0, 0, 0,
+  0, 0, 0, 0, 32, 24, 2, 0, 0, 0, 0, 0, 0, 0, 5, 9,
+  0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_50 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 34: goto L34;
+  case 43: goto L43;
+  case 52: goto L52;
+  case 53: goto L53;
+  case 62: goto L62;
+  case 71: goto L71;
+  case 80: goto L80;
+  case 81: goto L81;
+  case 90: goto L90;
+  case 99: goto L99;
+  case 108: goto L108;
+  case 109: goto L109;
+  case 118: goto L118;
+  case 127: goto L127;
+  case 136: goto L136;
+  case 137: goto L137;
+  case 146: goto L146;
+  case 155: goto L155;
+  case 164: goto L164;
+  case 165: goto L165;
+  case 190: goto L190;
+  case 199: goto L199;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_CLOSURE_REF(0, 0);
+ L9:
+  _AOT_GLOBAL_KNOWN_CALL(9, 1);
+ L34:
+  _AOT_PUSH(34);
+ L43:
+  _AOT_PUSH(43);
+ L52:
+  _AOT_EXIT(52);
+  /* MAKE-VECTOR */
+ L53:
+  _AOT_LOCAL_REF(53, 0);
+ L62:
+  _AOT_PUSH(62);
+ L71:
+  _AOT_STACK_REF(71, 3);
+ L80:
+  _AOT_EXIT(80);
+  /* VECTOR-SET */
+ L81:
+  _AOT_CLOSURE_REF(81, 2);
+ L90:
+  _AOT_PUSH(90);
+ L99:
+  _AOT_STACK_REF(99, 3);
+ L108:
+  _AOT_EXIT(108);
+  /* VECTOR-SET */
+ L109:
+  _AOT_CLOSURE_REF(109, 1);
+ L118:
+  _AOT_PUSH(118);
+ L127:
+  _AOT_STACK_REF(127, 3);
+ L136:
+  _AOT_EXIT(136);
+  /* VECTOR-SET */
+ L137:
+  _AOT_CLOSURE_REF(137, 0);
+ L146:
+  _AOT_PUSH(146);
+ L155:
+  _AOT_STACK_REF(155, 3);
+ L164:
+  _AOT_EXIT(164);
+  /* VECTOR-SET */
+ L165:
+  _AOT_EXIT(165);
+  /* MAKE-PROCEDURE */
+ L190:
+  _AOT_TAIL_CALL(190, 1);
+ L199:
+  _AOT_RET(199);
+  _AOT_EXIT(200);
+}
+
+static const unsigned char sexp_aot_chibi_string_50_shape[] = {
+  24, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0,
+  0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 15, 14, 1, 0, 0, 0, 0, 0, 0, 15, 17, 0, 0, 0,
+  0, 0, 0, 0, 39, 22, 0, 0, 0, 0, 0, 0, 0, 0, 15, 1,
+  0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0,
+  27, 24, 2, 0, 0, 0, 0, 0, 0, 0, 15, 5, 0, 0, 0, 0,
+  0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 24, 1, 0,
+  0, 0, 0, 0, 0, 0, 15, 9, 0, 0, 0, 0, 0, 0, 0, 21,
+  3, 0, 0, 0, 0, 0, 0, 0, 27, 24, 0, 0, 0, 0, 0, 0,
+  0, 0, 15, 13, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0,
+  0, 0, 0, 0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 5, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5,
+  0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_51 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 10: goto L10;
+  case 19: goto L19;
+  case 28: goto L28;
+  case 29: goto L29;
+  case 38: goto L38;
+  case 47: goto L47;
+  case 56: goto L56;
+  case 57: goto L57;
+  case 66: goto L66;
+  case 75: goto L75;
+  case 84: goto L84;
+  case 85: goto L85;
+  case 94: goto L94;
+  case 103: goto L103;
+  case 112: goto L112;
+  case 113: goto L113;
+  case 138: goto L138;
+  case 147: goto L147;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 2);
+ L9:
+  _AOT_EXIT(9);
+  /* STRING-SIZE */
+ L10:
+  _AOT_PUSH(10);
+ L19:
+  _AOT_PUSH(19);
+ L28:
+  _AOT_EXIT(28);
+  /* MAKE-VECTOR */
+ L29:
+  _AOT_LOCAL_REF(29, 2);
+ L38:
+  _AOT_PUSH(38);
+ L47:
+  _AOT_STACK_REF(47, 3);
+ L56:
+  _AOT_EXIT(56);
+  /* VECTOR-SET */
+ L57:
+  _AOT_LOCAL_REF(57, 0);
+ L66:
+  _AOT_PUSH(66);
+ L75:
+  _AOT_STACK_REF(75, 3);
+ L84:
+  _AOT_EXIT(84);
+  /* VECTOR-SET */
+ L85:
+  _AOT_LOCAL_REF(85, 1);
+ L94:
+  _AOT_PUSH(94);
+ L103:
+  _AOT_STACK_REF(103, 3);
+ L112:
+  _AOT_EXIT(112);
+  /* VECTOR-SET */
+ L113:
+  _AOT_EXIT(113);
+  /* MAKE-PROCEDURE */
+ L138:
+  _AOT_TAIL_CALL(138, 1);
+ L147:
+  _AOT_RET(147);
+  _AOT_EXIT(148);
+}
+
+static const unsigned char sexp_aot_chibi_string_51_shape[] = {
+  22, 2, 0, 0, 0, 0, 0, 0, 0, 37, 15, 14, 1, 0, 0, 0,
+  0, 0, 0, 15, 13, 0, 0, 0, 0, 0, 0, 0, 39, 22, 2, 0,
+  0, 0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0, 21,
+  3, 0, 0, 0, 0, 0, 0, 0, 27, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0,
+  0, 0, 0, 0, 27, 22, 1, 0, 0, 0, 0, 0, 0, 0, 15, 9,
+  0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0,
+  27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0,
+  0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_52 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 55: goto L55;
+  case 64: goto L64;
+  case 73: goto L73;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_CLOSURE_REF(9, 0);
+ L18:
+  _AOT_CALL(18, 1);
+ L27:
+  _AOT_JUMP_UNLESS(27, L64);
+ L36:
+  _AOT_PUSH(36);
+ L45:
+  _AOT_LOCAL_REF(45, 1);
+ L54:
+  _AOT_ADD(54);
+ L55:
+  _AOT_JUMP(55, L73);
+ L64:
+  _AOT_LOCAL_REF(64, 1);
+ L73:
+  _AOT_RET(73);
+  _AOT_EXIT(74);
+}
+
+static const unsigned char sexp_aot_chibi_string_52_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0,
+  0, 0, 6, 5, 0, 0, 0, 0, 0, 0, 0, 13, 36, 0, 0, 0,
+  0, 0, 0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 22, 1, 0,
+  0, 0, 0, 0, 0, 0, 59, 14, 17, 0, 0, 0, 0, 0, 0, 0,
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_53 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 37: goto L37;
+  case 46: goto L46;
+  case 55: goto L55;
+  case 64: goto L64;
+  case 65: goto L65;
+  case 90: goto L90;
+  case 99: goto L99;
+  case 108: goto L108;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_CLOSURE_REF(0, 0);
+ L9:
+  _AOT_PUSH(9);
+ L18:
+  _AOT_PUSH(18);
+ L27:
+  _AOT_PUSH(27);
+ L36:
+  _AOT_EXIT(36);
+  /* MAKE-VECTOR */
+ L37:
+  _AOT_LOCAL_REF(37, 0);
+ L46:
+  _AOT_PUSH(46);
+ L55:
+  _AOT_STACK_REF(55, 3);
+ L64:
+  _AOT_EXIT(64);
+  /* VECTOR-SET */
+ L65:
+  _AOT_EXIT(65);
+  /* MAKE-PROCEDURE */
+ L90:
+  _AOT_GLOBAL_KNOWN_REF(90);
+ L99:
+  _AOT_TAIL_CALL(99, 3);
+ L108:
+  _AOT_RET(108);
+  _AOT_EXIT(109);
+}
+
+static const unsigned char sexp_aot_chibi_string_53_shape[] = {
+  24, 0, 0, 0, 0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0,
+  0, 0, 15, 14, 1, 0, 0, 0, 0, 0, 0, 15, 5, 0, 0, 0,
+  0, 0, 0, 0, 39, 22, 0, 0, 0, 0, 0, 0, 0, 0, 15, 1,
+  0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0,
+  27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0,
+  0, 0, 0, 5, 13, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_54 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 34: goto L34;
+  case 43: goto L43;
+  case 52: goto L52;
+  case 53: goto L53;
+  case 62: goto L62;
+  case 71: goto L71;
+  case 80: goto L80;
+  case 81: goto L81;
+  case 106: goto L106;
+  case 115: goto L115;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 1);
+ L9:
+  _AOT_GLOBAL_KNOWN_CALL(9, 1);
+ L34:
+  _AOT_PUSH(34);
+ L43:
+  _AOT_PUSH(43);
+ L52:
+  _AOT_EXIT(52);
+  /* MAKE-VECTOR */
+ L53:
+  _AOT_LOCAL_REF(53, 0);
+ L62:
+  _AOT_PUSH(62);
+ L71:
+  _AOT_STACK_REF(71, 3);
+ L80:
+  _AOT_EXIT(80);
+  /* VECTOR-SET */
+ L81:
+  _AOT_EXIT(81);
+  /* MAKE-PROCEDURE */
+ L106:
+  _AOT_TAIL_CALL(106, 1);
+ L115:
+  _AOT_RET(115);
+  _AOT_EXIT(116);
+}
+
+static const unsigned char sexp_aot_chibi_string_54_shape[] = {
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0,
+  0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 15, 14, 1, 0, 0, 0, 0, 0, 0, 15, 5, 0, 0, 0,
+  0, 0, 0, 0, 39, 22, 0, 0, 0, 0, 0, 0, 0, 0, 15, 1,
+  0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0,
+  27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0,
+  0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_55 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 17: goto L17;
+  case 26: goto L26;
+  case 35: goto L35;
+  case 44: goto L44;
+  case 53: goto L53;
+  case 62: goto L62;
+  case 87: goto L87;
+  case 96: goto L96;
+  case 121: goto L121;
+  case 122: goto L122;
+  case 131: goto L131;
+  case 140: goto L140;
+  case 149: goto L149;
+  case 174: goto L174;
+  case 183: goto L183;
+  case 192: goto L192;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF_JUMP_UNLESS(0, 0, L35);
+ L17:
+  _AOT_LOCAL_REF(17, 0);
+ L26:
+  _AOT_JUMP(26, L192);
+ L35:
+  _AOT_CLOSURE_REF(35, 2);
+ L44:
+  _AOT_CLOSURE_REF(44, 1);
+ L53:
+  _AOT_GLOBAL_KNOWN_REF(53);
+ L62:
+  _AOT_GLOBAL_KNOWN_CALL(62, 3);
+ L87:
+  _AOT_CLOSURE_REF(87, 0);
+ L96:
+  _AOT_GLOBAL_KNOWN_CALL(96, 2);
+ L121:
+  _AOT_DROP(121);
+ L122:
+  _AOT_CLOSURE_REF(122, 2);
+ L131:
+  _AOT_CLOSURE_REF(131, 1);
+ L140:
+  _AOT_GLOBAL_KNOWN_REF(140);
+ L149:
+  _AOT_GLOBAL_KNOWN_CALL(149, 3);
+ L174:
+  _AOT_CLOSURE_REF_CDR(174, 3);
+ L183:
+  _AOT_TAIL_CALL(183, 1);
+ L192:
+  _AOT_RET(192);
+  _AOT_EXIT(193);
+}
+
+static const unsigned char sexp_aot_chibi_string_55_shape[] = {
+  84, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0, 0, 0,
+  0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 14, 165, 0, 0, 0, 0,
+  0, 0, 0, 24, 2, 0, 0, 0, 0, 0, 0, 0, 24, 1, 0, 0,
+  0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0,
+  0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0,
+  85, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 24, 2, 0, 0, 0, 0,
+  0, 0, 0, 24, 1, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0,
+  0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 83, 3,
+  0, 0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0,
+  79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_56 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 52: goto L52;
+  case 61: goto L61;
+  case 70: goto L70;
+  case 71: goto L71;
+  case 80: goto L80;
+  case 89: goto L89;
+  case 98: goto L98;
+  case 99: goto L99;
+  case 108: goto L108;
+  case 117: goto L117;
+  case 126: goto L126;
+  case 127: goto L127;
+  case 136: goto L136;
+  case 145: goto L145;
+  case 154: goto L154;
+  case 155: goto L155;
+  case 164: goto L164;
+  case 173: goto L173;
+  case 182: goto L182;
+  case 183: goto L183;
+  case 208: goto L208;
+  case 217: goto L217;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_CLOSURE_REF(9, 1);
+ L18:
+  _AOT_PUSH(18);
+ L27:
+  _AOT_GLOBAL_KNOWN_CALL(27, 3);
+ L52:
+  _AOT_PUSH(52);
+ L61:
+  _AOT_PUSH(61);
+ L70:
+  _AOT_EXIT(70);
+  /* MAKE-VECTOR */
+ L71:
+  _AOT_CLOSURE_REF(71, 2);
+ L80:
+  _AOT_PUSH(80);
+ L89:
+  _AOT_STACK_REF(89, 3);
+ L98:
+  _AOT_EXIT(98);
+  /* VECTOR-SET */
+ L99:
+  _AOT_CLOSURE_REF(99, 1);
+ L108:
+  _AOT_PUSH(108);
+ L117:
+  _AOT_STACK_REF(117, 3);
+ L126:
+  _AOT_EXIT(126);
+  /* VECTOR-SET */
+ L127:
+  _AOT_LOCAL_REF(127, 0);
+ L136:
+  _AOT_PUSH(136);
+ L145:
+  _AOT_STACK_REF(145, 3);
+ L154:
+  _AOT_EXIT(154);
+  /* VECTOR-SET */
+ L155:
+  _AOT_CLOSURE_REF(155, 0);
+ L164:
+  _AOT_PUSH(164);
+ L173:
+  _AOT_STACK_REF(173, 3);
+ L182:
+  _AOT_EXIT(182);
+  /* VECTOR-SET */
+ L183:
+  _AOT_EXIT(183);
+  /* MAKE-PROCEDURE */
+ L208:
+  _AOT_TAIL_CALL(208, 1);
+ L217:
+  _AOT_RET(217);
+  _AOT_EXIT(218);
+}
+
+static const unsigned char sexp_aot_chibi_string_56_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 24, 1, 0, 0, 0, 0, 0,
+  0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0,
+  0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 15, 14, 1, 0, 0, 0, 0, 0, 0, 15, 17, 0,
+  0, 0, 0, 0, 0, 0, 39, 24, 2, 0, 0, 0, 0, 0, 0, 0,
+  15, 1, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0,
+  0, 0, 27, 24, 1, 0, 0, 0, 0, 0, 0, 0, 15, 5, 0, 0,
+  0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 22,
+  0, 0, 0, 0, 0, 0, 0, 0, 15, 9, 0, 0, 0, 0, 0, 0,
+  0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 24, 0, 0, 0, 0,
+  0, 0, 0, 0, 15, 13, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0,
+  0, 0, 0, 0, 0, 0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0,
+  5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  5, 5, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_57 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 43: goto L43;
+  case 52: goto L52;
+  case 61: goto L61;
+  case 62: goto L62;
+  case 71: goto L71;
+  case 80: goto L80;
+  case 89: goto L89;
+  case 90: goto L90;
+  case 99: goto L99;
+  case 108: goto L108;
+  case 117: goto L117;
+  case 118: goto L118;
+  case 143: goto L143;
+  case 152: goto L152;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 0);
+ L9:
+  _AOT_GLOBAL_KNOWN_REF(9);
+ L18:
+  _AOT_GLOBAL_KNOWN_CALL(18, 2);
+ L43:
+  _AOT_PUSH(43);
+ L52:
+  _AOT_PUSH(52);
+ L61:
+  _AOT_EXIT(61);
+  /* MAKE-VECTOR */
+ L62:
+  _AOT_LOCAL_REF(62, 0);
+ L71:
+  _AOT_PUSH(71);
+ L80:
+  _AOT_STACK_REF(80, 3);
+ L89:
+  _AOT_EXIT(89);
+  /* VECTOR-SET */
+ L90:
+  _AOT_CLOSURE_REF(90, 0);
+ L99:
+  _AOT_PUSH(99);
+ L108:
+  _AOT_STACK_REF(108, 3);
+ L117:
+  _AOT_EXIT(117);
+  /* VECTOR-SET */
+ L118:
+  _AOT_EXIT(118);
+  /* MAKE-PROCEDURE */
+ L143:
+  _AOT_TAIL_CALL(143, 1);
+ L152:
+  _AOT_RET(152);
+  _AOT_EXIT(153);
+}
+
+static const unsigned char sexp_aot_chibi_string_57_shape[] = {
+  22, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0,
+  0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 14, 1, 0, 0,
+  0, 0, 0, 0, 15, 9, 0, 0, 0, 0, 0, 0, 0, 39, 22, 0,
+  0, 0, 0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0,
+  21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 24, 0, 0, 0, 0, 0,
+  0, 0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0,
+  0, 0, 0, 0, 0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 5,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5,
+  5, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_58 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 45: goto L45;
+  case 54: goto L54;
+  case 55: goto L55;
+  case 64: goto L64;
+  case 73: goto L73;
+  case 82: goto L82;
+  case 83: goto L83;
+  case 108: goto L108;
+  case 117: goto L117;
+  case 126: goto L126;
+  case 135: goto L135;
+  case 144: goto L144;
+  case 153: goto L153;
+  case 154: goto L154;
+  case 163: goto L163;
+  case 172: goto L172;
+  case 173: goto L173;
+  case 182: goto L182;
+  case 191: goto L191;
+  case 200: goto L200;
+  case 201: goto L201;
+  case 226: goto L226;
+  case 235: goto L235;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_LOCAL_REF(0, 2);
+ L9:
+  _AOT_NULLP_JUMP_UNLESS(9, L135);
+ L18:
+  _AOT_LOCAL_REF(18, 1);
+ L27:
+  _AOT_PUSH(27);
+ L36:
+  _AOT_PUSH(36);
+ L45:
+  _AOT_PUSH(45);
+ L54:
+  _AOT_EXIT(54);
+  /* MAKE-VECTOR */
+ L55:
+  _AOT_LOCAL_REF(55, 0);
+ L64:
+  _AOT_PUSH(64);
+ L73:
+  _AOT_STACK_REF(73, 3);
+ L82:
+  _AOT_EXIT(82);
+  /* VECTOR-SET */
+ L83:
+  _AOT_EXIT(83);
+  /* MAKE-PROCEDURE */
+ L108:
+  _AOT_GLOBAL_KNOWN_REF(108);
+ L117:
+  _AOT_TAIL_CALL(117, 3);
+ L126:
+  _AOT_JUMP(126, L235);
+ L135:
+  _AOT_LOCAL_REF(135, 2);
+ L144:
+  _AOT_LOCAL_REF(144, 1);
+ L153:
+  _AOT_CONS(153);
+ L154:
+  _AOT_PUSH(154);
+ L163:
+  _AOT_PUSH(163);
+ L172:
+  _AOT_EXIT(172);
+  /* MAKE-VECTOR */
+ L173:
+  _AOT_LOCAL_REF(173, 0);
+ L182:
+  _AOT_PUSH(182);
+ L191:
+  _AOT_STACK_REF(191, 3);
+ L200:
+  _AOT_EXIT(200);
+  /* VECTOR-SET */
+ L201:
+  _AOT_EXIT(201);
+  /* MAKE-PROCEDURE */
+ L226:
+  _AOT_TAIL_CALL(226, 1);
+ L235:
+  _AOT_RET(235);
+  _AOT_EXIT(236);
+}
+
+static const unsigned char sexp_aot_chibi_string_58_shape[] = {
+  22, 2, 0, 0, 0, 0, 0, 0, 0, 90, 125, 0, 0, 0, 0, 0,
+  0, 0, 22, 1, 0, 0, 0, 0, 0, 0, 0, 15, 14, 0, 0, 0,
+  0, 0, 0, 0, 15, 14, 1, 0, 0, 0, 0, 0, 0, 15, 5, 0,
+  0, 0, 0, 0, 0, 0, 39, 22, 0, 0, 0, 0, 0, 0, 0, 0,
+  15, 1, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0,
+  0, 0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0,
+  0, 0, 0, 0, 0, 5, 13, 0, 0, 0, 0, 0, 0, 0, 14, 108,
+  0, 0, 0, 0, 0, 0, 0, 22, 2, 0, 0, 0, 0, 0, 0, 0,
+  22, 1, 0, 0, 0, 0, 0, 0, 0, 58, 15, 14, 1, 0, 0, 0,
+  0, 0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 39, 22, 0, 0,
+  0, 0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0, 21,
+  3, 0, 0, 0, 0, 0, 0, 0, 27, 38, 1, 0, 0, 0, 0, 0,
+  0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_59 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 52: goto L52;
+  case 53: goto L53;
+  case 62: goto L62;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_CLOSURE_REF(0, 1);
+ L9:
+  _AOT_LOCAL_REF(9, 0);
+ L18:
+  _AOT_CLOSURE_REF(18, 0);
+ L27:
+  _AOT_GLOBAL_KNOWN_CALL(27, 2);
+ L52:
+  _AOT_EXIT(52);
+  /* WRITE-CHAR */
+ L53:
+  _AOT_PUSH(53);
+ L62:
+  _AOT_RET(62);
+  _AOT_EXIT(63);
+}
+
+static const unsigned char sexp_aot_chibi_string_59_shape[] = {
+  24, 1, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0,
+  0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 73, 15, 14, 1, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_60 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 36: goto L36;
+  case 37: goto L37;
+  case 46: goto L46;
+  case 55: goto L55;
+  case 64: goto L64;
+  case 65: goto L65;
+  case 74: goto L74;
+  case 83: goto L83;
+  case 92: goto L92;
+  case 93: goto L93;
+  case 118: goto L118;
+  case 127: goto L127;
+  case 136: goto L136;
+  case 145: goto L145;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_CLOSURE_REF(0, 2);
+ L9:
+  _AOT_CLOSURE_REF(9, 1);
+ L18:
+  _AOT_PUSH(18);
+ L27:
+  _AOT_PUSH(27);
+ L36:
+  _AOT_EXIT(36);
+  /* MAKE-VECTOR */
+ L37:
+  _AOT_CLOSURE_REF(37, 0);
+ L46:
+  _AOT_PUSH(46);
+ L55:
+  _AOT_STACK_REF(55, 3);
+ L64:
+  _AOT_EXIT(64);
+  /* VECTOR-SET */
+ L65:
+  _AOT_LOCAL_REF(65, 0);
+ L74:
+  _AOT_PUSH(74);
+ L83:
+  _AOT_STACK_REF(83, 3);
+ L92:
+  _AOT_EXIT(92);
+  /* VECTOR-SET */
+ L93:
+  _AOT_EXIT(93);
+  /* MAKE-PROCEDURE */
+ L118:
+  _AOT_GLOBAL_KNOWN_REF(118);
+ L127:
+  _AOT_GLOBAL_KNOWN_REF(127);
+ L136:
+  _AOT_TAIL_CALL(136, 4);
+ L145:
+  _AOT_RET(145);
+  _AOT_EXIT(146);
+}
+
+static const unsigned char sexp_aot_chibi_string_60_shape[] = {
+  24, 2, 0, 0, 0, 0, 0, 0, 0, 24, 1, 0, 0, 0, 0, 0,
+  0, 0, 15, 14, 1, 0, 0, 0, 0, 0, 0, 15, 9, 0, 0, 0,
+  0, 0, 0, 0, 39, 24, 0, 0, 0, 0, 0, 0, 0, 0, 15, 1,
+  0, 0, 0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0,
+  27, 22, 0, 0, 0, 0, 0, 0, 0, 0, 15, 5, 0, 0, 0, 0,
+  0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 38, 5, 0,
+  0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 19,
+  0, 0, 0, 0, 0, 0, 0, 0, 5, 17, 0, 0, 0, 0, 0, 0,
+  0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_61 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 19: goto L19;
+  case 28: goto L28;
+  case 37: goto L37;
+  case 46: goto L46;
+  case 47: goto L47;
+  case 56: goto L56;
+  case 65: goto L65;
+  case 74: goto L74;
+  case 75: goto L75;
+  case 84: goto L84;
+  case 93: goto L93;
+  case 102: goto L102;
+  case 103: goto L103;
+  case 128: goto L128;
+  case 137: goto L137;
+  case 146: goto L146;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_PUSH(0);
+ L9:
+  _AOT_PUSH(9);
+ L18:
+  _AOT_EXIT(18);
+  /* MAKE-VECTOR */
+ L19:
+  _AOT_LOCAL_REF(19, 0);
+ L28:
+  _AOT_PUSH(28);
+ L37:
+  _AOT_STACK_REF(37, 3);
+ L46:
+  _AOT_EXIT(46);
+  /* VECTOR-SET */
+ L47:
+  _AOT_LOCAL_REF(47, 1);
+ L56:
+  _AOT_PUSH(56);
+ L65:
+  _AOT_STACK_REF(65, 3);
+ L74:
+  _AOT_EXIT(74);
+  /* VECTOR-SET */
+ L75:
+  _AOT_LOCAL_REF(75, 2);
+ L84:
+  _AOT_PUSH(84);
+ L93:
+  _AOT_STACK_REF(93, 3);
+ L102:
+  _AOT_EXIT(102);
+  /* VECTOR-SET */
+ L103:
+  _AOT_EXIT(103);
+  /* MAKE-PROCEDURE */
+ L128:
+  _AOT_GLOBAL_KNOWN_REF(128);
+ L137:
+  _AOT_TAIL_CALL(137, 1);
+ L146:
+  _AOT_RET(146);
+  _AOT_EXIT(147);
+}
+
+static const unsigned char sexp_aot_chibi_string_61_shape[] = {
+  15, 14, 1, 0, 0, 0, 0, 0, 0, 15, 13, 0, 0, 0, 0, 0,
+  0, 0, 39, 22, 0, 0, 0, 0, 0, 0, 0, 0, 15, 1, 0, 0,
+  0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 22,
+  1, 0, 0, 0, 0, 0, 0, 0, 15, 5, 0, 0, 0, 0, 0, 0,
+  0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 22, 2, 0, 0, 0,
+  0, 0, 0, 0, 15, 9, 0, 0, 0, 0, 0, 0, 0, 21, 3, 0,
+  0, 0, 0, 0, 0, 0, 27, 38, 1, 0, 0, 0, 0, 0, 0, 0,
+  5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  19, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 0,
+  0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_62 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_CLOSURE_REF(0, 0);
+ L9:
+  _AOT_LOCAL_REF(9, 0);
+ L18:
+  _AOT_EXIT(18);
+  /* FCALL2 */
+ L27:
+  _AOT_RET(27);
+  _AOT_EXIT(28);
+}
+
+static const unsigned char sexp_aot_chibi_string_62_shape[] = {
+  24, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_63 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 19: goto L19;
+  case 20: goto L20;
+  case 29: goto L29;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_CLOSURE_REF(0, 0);
+ L9:
+  _AOT_LOCAL_REF(9, 0);
+ L18:
+  _AOT_EXIT(18);
+  /* CHAR-DOWNCASE */
+ L19:
+  _AOT_EXIT(19);
+  /* WRITE-CHAR */
+ L20:
+  _AOT_PUSH(20);
+ L29:
+  _AOT_RET(29);
+  _AOT_EXIT(30);
+}
+
+static const unsigned char sexp_aot_chibi_string_63_shape[] = {
+  24, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 72, 73, 15, 14, 1, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_64 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 27: goto L27;
+  case 28: goto L28;
+  case 37: goto L37;
+  case 46: goto L46;
+  case 55: goto L55;
+  case 56: goto L56;
+  case 81: goto L81;
+  case 90: goto L90;
+  case 99: goto L99;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_CLOSURE_REF(0, 0);
+ L9:
+  _AOT_PUSH(9);
+ L18:
+  _AOT_PUSH(18);
+ L27:
+  _AOT_EXIT(27);
+  /* MAKE-VECTOR */
+ L28:
+  _AOT_LOCAL_REF(28, 0);
+ L37:
+  _AOT_PUSH(37);
+ L46:
+  _AOT_STACK_REF(46, 3);
+ L55:
+  _AOT_EXIT(55);
+  /* VECTOR-SET */
+ L56:
+  _AOT_EXIT(56);
+  /* MAKE-PROCEDURE */
+ L81:
+  _AOT_GLOBAL_KNOWN_REF(81);
+ L90:
+  _AOT_TAIL_CALL(90, 2);
+ L99:
+  _AOT_RET(99);
+  _AOT_EXIT(100);
+}
+
+static const unsigned char sexp_aot_chibi_string_64_shape[] = {
+  24, 0, 0, 0, 0, 0, 0, 0, 0, 15, 14, 1, 0, 0, 0, 0,
+  0, 0, 15, 5, 0, 0, 0, 0, 0, 0, 0, 39, 22, 0, 0, 0,
+  0, 0, 0, 0, 0, 15, 1, 0, 0, 0, 0, 0, 0, 0, 21, 3,
+  0, 0, 0, 0, 0, 0, 0, 27, 38, 1, 0, 0, 0, 0, 0, 0,
+  0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 5, 9, 0, 0, 0, 0,
+  0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_65 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 19: goto L19;
+  case 28: goto L28;
+  case 37: goto L37;
+  case 46: goto L46;
+  case 47: goto L47;
+  case 72: goto L72;
+  case 81: goto L81;
+  case 90: goto L90;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_PUSH(0);
+ L9:
+  _AOT_PUSH(9);
+ L18:
+  _AOT_EXIT(18);
+  /* MAKE-VECTOR */
+ L19:
+  _AOT_LOCAL_REF(19, 0);
+ L28:
+  _AOT_PUSH(28);
+ L37:
+  _AOT_STACK_REF(37, 3);
+ L46:
+  _AOT_EXIT(46);
+  /* VECTOR-SET */
+ L47:
+  _AOT_EXIT(47);
+  /* MAKE-PROCEDURE */
+ L72:
+  _AOT_GLOBAL_KNOWN_REF(72);
+ L81:
+  _AOT_TAIL_CALL(81, 1);
+ L90:
+  _AOT_RET(90);
+  _AOT_EXIT(91);
+}
+
+static const unsigned char sexp_aot_chibi_string_65_shape[] = {
+  15, 14, 1, 0, 0, 0, 0, 0, 0, 15, 5, 0, 0, 0, 0, 0,
+  0, 0, 39, 22, 0, 0, 0, 0, 0, 0, 0, 0, 15, 1, 0, 0,
+  0, 0, 0, 0, 0, 21, 3, 0, 0, 0, 0, 0, 0, 0, 27, 38,
+  1, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0,
+  0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 79
+};
+
+static sexp_sint_t sexp_aot_chibi_string_66 (sexp_native_regs_t *regs, sexp_sint_t off) {
+  _AOT_BEGIN;
+  switch (off) {
+  case 0: goto L0;
+  case 9: goto L9;
+  case 18: goto L18;
+  case 19: goto L19;
+  case 20: goto L20;
+  case 29: goto L29;
+  }
+  _AOT_EXIT(off);
+ L0:
+  _AOT_CLOSURE_REF(0, 0);
+ L9:
+  _AOT_LOCAL_REF(9, 0);
+ L18:
+  _AOT_EXIT(18);
+  /* CHAR-UPCASE */
+ L19:
+  _AOT_EXIT(19);
+  /* WRITE-CHAR */
+ L20:
+  _AOT_PUSH(20);
+ L29:
+  _AOT_RET(29);
+  _AOT_EXIT(30);
+}
+
+static const unsigned char sexp_aot_chibi_string_66_shape[] = {
+  24, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0,
+  0, 0, 71, 73, 15, 14, 1, 0, 0, 0, 0, 0, 0, 79
+};
+
+static struct sexp_aot_proc_t sexp_aot_chibi_string_procs[] = {
+  {sexp_aot_chibi_string_0_shape, 28, sexp_aot_chibi_string_0, 0},
+  {sexp_aot_chibi_string_1_shape, 37, sexp_aot_chibi_string_1, 0},
+  {sexp_aot_chibi_string_2_shape, 20, sexp_aot_chibi_string_2, 0},
+  {sexp_aot_chibi_string_3_shape, 306, sexp_aot_chibi_string_3, 0},
+  {sexp_aot_chibi_string_4_shape, 63, sexp_aot_chibi_string_4, 0},
+  {sexp_aot_chibi_string_5_shape, 200, sexp_aot_chibi_string_5, 0},
+  {sexp_aot_chibi_string_6_shape, 176, sexp_aot_chibi_string_6, 0},
+  {sexp_aot_chibi_string_7_shape, 242, sexp_aot_chibi_string_7, 0},
+  {sexp_aot_chibi_string_8_shape, 126, sexp_aot_chibi_string_8, 0},
+  {sexp_aot_chibi_string_9_shape, 112, sexp_aot_chibi_string_9, 0},
+  {sexp_aot_chibi_string_10_shape, 147, sexp_aot_chibi_string_10, 0},
+  {sexp_aot_chibi_string_11_shape, 209, sexp_aot_chibi_string_11, 0},
+  {sexp_aot_chibi_string_12_shape, 260, sexp_aot_chibi_string_12, 0},
+  {sexp_aot_chibi_string_13_shape, 72, sexp_aot_chibi_string_13, 0},
+  {sexp_aot_chibi_string_14_shape, 296, sexp_aot_chibi_string_14, 0},
+  {sexp_aot_chibi_string_15_shape, 137, sexp_aot_chibi_string_15, 0},
+  {sexp_aot_chibi_string_16_shape, 213, sexp_aot_chibi_string_16, 0},
+  {sexp_aot_chibi_string_17_shape, 255, sexp_aot_chibi_string_17, 0},
+  {sexp_aot_chibi_string_18_shape, 214, sexp_aot_chibi_string_18, 0},
+  {sexp_aot_chibi_string_19_shape, 105, sexp_aot_chibi_string_19, 0},
+  {sexp_aot_chibi_string_20_shape, 120, sexp_aot_chibi_string_20, 0},
+  {sexp_aot_chibi_string_21_shape, 240, sexp_aot_chibi_string_21, 0},
+  {sexp_aot_chibi_string_22_shape, 365, sexp_aot_chibi_string_22, 0},
+  {sexp_aot_chibi_string_23_shape, 220, sexp_aot_chibi_string_23, 0},
+  {sexp_aot_chibi_string_24_shape, 322, sexp_aot_chibi_string_24, 0},
+  {sexp_aot_chibi_string_25_shape, 71, sexp_aot_chibi_string_25, 0},
+  {sexp_aot_chibi_string_26_shape, 152, sexp_aot_chibi_string_26, 0},
+  {sexp_aot_chibi_string_27_shape, 96, sexp_aot_chibi_string_27, 0},
+  {sexp_aot_chibi_string_28_shape, 82, sexp_aot_chibi_string_28, 0},
+  {sexp_aot_chibi_string_29_shape, 153, sexp_aot_chibi_string_29, 0},
+  {sexp_aot_chibi_string_30_shape, 153, sexp_aot_chibi_string_30, 0},
+  {sexp_aot_chibi_string_31_shape, 127, sexp_aot_chibi_string_31, 0},
+  {sexp_aot_chibi_string_32_shape, 93, sexp_aot_chibi_string_32, 0},
+  {sexp_aot_chibi_string_33_shape, 220, sexp_aot_chibi_string_33, 0},
+  {sexp_aot_chibi_string_34_shape, 296, sexp_aot_chibi_string_34, 0},
+  {sexp_aot_chibi_string_35_shape, 234, sexp_aot_chibi_string_35, 0},
+  {sexp_aot_chibi_string_36_shape, 130, sexp_aot_chibi_string_36, 0},
+  {sexp_aot_chibi_string_37_shape, 220, sexp_aot_chibi_string_37, 0},
+  {sexp_aot_chibi_string_38_shape, 296, sexp_aot_chibi_string_38, 0},
+  {sexp_aot_chibi_string_39_shape, 206, sexp_aot_chibi_string_39, 0},
+  {sexp_aot_chibi_string_40_shape, 178, sexp_aot_chibi_string_40, 0},
+  {sexp_aot_chibi_string_41_shape, 55, sexp_aot_chibi_string_41, 0},
+  {sexp_aot_chibi_string_42_shape, 111, sexp_aot_chibi_string_42, 0},
+  {sexp_aot_chibi_string_43_shape, 21, sexp_aot_chibi_string_43, 0},
+  {sexp_aot_chibi_string_44_shape, 295, sexp_aot_chibi_string_44, 0},
+  {sexp_aot_chibi_string_45_shape, 162, sexp_aot_chibi_string_45, 0},
+  {sexp_aot_chibi_string_46_shape, 129, sexp_aot_chibi_string_46, 0},
+  {sexp_aot_chibi_string_47_shape, 181, sexp_aot_chibi_string_47, 0},
+  {sexp_aot_chibi_string_48_shape, 303, sexp_aot_chibi_string_48, 0},
+  {sexp_aot_chibi_string_49_shape, 120, sexp_aot_chibi_string_49, 0},
+  {sexp_aot_chibi_string_50_shape, 200, sexp_aot_chibi_string_50, 0},
+  {sexp_aot_chibi_string_51_shape, 148, sexp_aot_chibi_string_51, 0},
+  {sexp_aot_chibi_string_52_shape, 74, sexp_aot_chibi_string_52, 0},
+  {sexp_aot_chibi_string_53_shape, 109, sexp_aot_chibi_string_53, 0},
+  {sexp_aot_chibi_string_54_shape, 116, sexp_aot_chibi_string_54, 0},
+  {sexp_aot_chibi_string_55_shape, 193, sexp_aot_chibi_string_55, 0},
+  {sexp_aot_chibi_string_56_shape, 218, sexp_aot_chibi_string_56, 0},
+  {sexp_aot_chibi_string_57_shape, 153, sexp_aot_chibi_string_57, 0},
+  {sexp_aot_chibi_string_58_shape, 236, sexp_aot_chibi_string_58, 0},
+  {sexp_aot_chibi_string_59_shape, 63, sexp_aot_chibi_string_59, 0},
+  {sexp_aot_chibi_string_60_shape, 146, sexp_aot_chibi_string_60, 0},
+  {sexp_aot_chibi_string_61_shape, 147, sexp_aot_chibi_string_61, 0},
+  {sexp_aot_chibi_string_62_shape, 28, sexp_aot_chibi_string_62, 0},
+  {sexp_aot_chibi_string_63_shape, 30, sexp_aot_chibi_string_63, 0},
+  {sexp_aot_chibi_string_64_shape, 100, sexp_aot_chibi_string_64, 0},
+  {sexp_aot_chibi_string_65_shape, 91, sexp_aot_chibi_string_65, 0},
+  {sexp_aot_chibi_string_66_shape, 30, sexp_aot_chibi_string_66, 0},
+  {NULL, 0, NULL, 0}
+};
+
+static struct sexp_aot_library_t sexp_aot_chibi_string_library = {sexp_aot_chibi_string_procs, NULL, 0};
+
+static sexp sexp_aot_chibi_string_init (sexp ctx, sexp self, sexp_sint_t n, sexp env, const char* version, const sexp_abi_identifier_t abi) {
+  sexp_aot_register(&sexp_aot_chibi_string_library);
+  return SEXP_VOID;
+}
+
+struct sexp_library_entry_t sexp_aot_libraries[] = {
+  { "srfi/1.sld", sexp_aot_srfi_1_init },
+  { "srfi/95.sld", sexp_aot_srfi_95_init },
+  { "chibi/char-set/base.sld", sexp_aot_chibi_char_set_base_init },
+  { "chibi/string.sld", sexp_aot_chibi_string_init },
+  { NULL, NULL }
+};
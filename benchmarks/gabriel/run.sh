@@ -1,16 +1,19 @@
 #!/bin/sh
 
 BENCHDIR=$(dirname $0)
-if [ "${BENCHDIR%%/*}" == "." ]; then
+if [ "${BENCHDIR%%/*}" = "." ]; then
     BENCHDIR=$(pwd)${BENCHDIR#.}
 fi
 CHIBIHOME=${BENCHDIR%%/benchmarks/gabriel}
 CHIBI="${CHIBI:-${CHIBIHOME}/chibi-scheme} -I$CHIBIHOME"
 
 cd $BENCHDIR
+# the benchmarks read their input to defeat constant folding
+[ -f input.txt ] || { echo '#t' > input.txt; CREATED_INPUT=1; }
 for t in *.sch; do
     echo "${t%%.sch}"
     LD_LIBRARY_PATH="$CHIBIHOME" DYLD_LIBRARY_PATH="$CHIBIHOME" \
-        $CHIBI -I"$CHIBIHOME/lib" -lchibi-prelude.scm $t
+        $CHIBI -I"$CHIBIHOME/lib" -q -lchibi-prelude.scm $t
 done
+[ -z "$CREATED_INPUT" ] || rm -f input.txt
 cd -
@@ -0,0 +1,67 @@
+
+;;; Small object allocation on a fragmented heap.
+;;;
+;;; Fills the heap with interleaved long-lived and short-lived objects
+;;; of varying sizes, so that after a collection the free space is
+;;; scattered in many small holes, then times allocating pairs,
+;;; flonums and short vectors.  With segregated free lists the time
+;;; per allocation should be independent of the number of holes.
+;;;
+;;; Usage: chibi-scheme benchmarks/gc/alloc.scm [holes [allocs]]
+
+(import (scheme base) (scheme write) (scheme process-context)
+        (chibi time) (chibi ast))
+
+(define (timeval->milliseconds tv)
+  (+ (* 1000 (timeval-seconds tv))
+     (quotient (timeval-microseconds tv) 1000)))
+
+(define (now) (timeval->milliseconds (car (get-time-of-day))))
+
+(define (fragment! n)
+  ;; interleave long-lived vectors with pair-sized garbage, leaving
+  ;; holes too small for anything but another pair
+  (let ((junk (make-vector n #f)))
+    (let lp ((i 0) (keep '()))
+      (cond
+       ((< i n)
+        (let ((x (make-vector (+ 1 (modulo i 6)) i)))
+          (vector-set! junk i (cons i i))
+          (lp (+ i 1) (cons x keep))))
+       (else
+        (gc)
+        keep)))))
+
+(define (allocate! n make)
+  ;; only the last 1000 objects are live at any time
+  (let lp ((i 0) (j 0) (acc '()))
+    (cond
+     ((>= i n) (length acc))
+     ((= j 1000) (lp i 0 '()))
+     (else (lp (+ i 1) (+ j 1) (cons (make i) acc))))))
+
+(define (run holes allocs)
+  (for-each
+   (lambda (kind)
+     (gc)
+     (let ((keep (fragment! holes)))
+       (let* ((start (now))
+              (res (allocate! allocs (cdr kind)))
+              (msecs (- (now) start)))
+         (display "holes: ") (write holes)
+         (display " ") (display (car kind))
+         (display " allocs: ") (write allocs)
+         (display " msecs: ") (write msecs)
+         (newline)
+         (length keep))))
+   (list (cons "vector" (lambda (i) (make-vector 3 i)))
+         (cons "pair" (lambda (i) (cons i i)))
+         (cons "flonum" (lambda (i) (inexact i))))))
+
+(let* ((args (command-line))
+       (holes (if (pair? (cdr args)) (string->number (cadr args)) #f))
+       (allocs (if (and (pair? (cdr args)) (pair? (cddr args)))
+                   (string->number (car (cddr args)))
+                   1000000)))
+  (for-each (lambda (n) (run n allocs))
+            (if holes (list holes) '(0 10000 100000 400000))))
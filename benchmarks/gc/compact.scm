@@ -0,0 +1,65 @@
+;;; Compacting a fragmented heap.
+;;;
+;;; Interleaves n small survivors with garbage while the heap grows,
+;;; so the survivors end up scattered over every chunk, then times
+;;; walking them before and after an explicit compaction, which
+;;; slides them together in allocation order.  Requires a build with
+;;; SEXP_USE_COMPACT_GC.
+;;;
+;;; Usage: chibi-scheme benchmarks/gc/compact.scm [objects [walks]]
+
+(import (scheme base) (scheme write) (scheme process-context)
+        (chibi time) (chibi ast) (chibi heap-stats))
+
+(define (timeval->milliseconds tv)
+  (+ (* 1000 (timeval-seconds tv))
+     (quotient (timeval-microseconds tv) 1000)))
+
+(define (now) (timeval->milliseconds (car (get-time-of-day))))
+
+(define (stat name)
+  (cond ((assq name (gc-stats)) => cdr) (else 0)))
+
+(define (fill! n)
+  (let lp ((i 0) (keep '()))
+    (if (>= i n)
+        keep
+        (let ((x (vector i (cons i i))))
+          (make-vector 16 i)
+          (lp (+ i 1) (cons x keep))))))
+
+(define (walk ls walks)
+  (let ((start (now)))
+    (do ((i 0 (+ i 1))) ((= i walks))
+      (let lp ((ls ls) (sum 0))
+        (if (pair? ls)
+            (lp (cdr ls) (+ sum (car (vector-ref (car ls) 1))))
+            sum)))
+    (- (now) start)))
+
+(define (run objects walks)
+  (let ((keep (fill! objects)))
+    (gc)
+    (let* ((before (walk keep walks))
+           (moved (stat 'compact-bytes))
+           (start (now)))
+      (if (not (compact-heap!))
+          (error "this build can't compact the heap"))
+      (let* ((msecs (- (now) start))
+             (after (walk keep walks)))
+        (display "objects: ") (write objects)
+        (display " chunks: ") (write (stat 'chunks))
+        (display " compact msecs: ") (write msecs)
+        (display " moved: ") (write (- (stat 'compact-bytes) moved))
+        (newline)
+        (display "walk msecs before: ") (write before)
+        (display " after: ") (write after)
+        (newline)
+        (length keep)))))
+
+(let* ((args (command-line))
+       (objects (if (pair? (cdr args)) (string->number (cadr args)) 1000000))
+       (walks (if (and (pair? (cdr args)) (pair? (cddr args)))
+                  (string->number (car (cddr args)))
+                  20)))
+  (run objects walks))
@@ -0,0 +1,63 @@
+;;; Marking large wide and deep structures.
+;;;
+;;; Builds a single structure of n nodes and times full collections
+;;; while it's live.  The shapes are a wide vector of pairs, a chain
+;;; nested through the first slot of each node so the marker can't
+;;; just loop on the last slot, and a complete binary tree.  With an
+;;; explicit mark stack the deep chain needs no C stack and costs
+;;; about the same per node as the other shapes.
+;;;
+;;; Usage: chibi-scheme benchmarks/gc/mark.scm [nodes [collections]]
+
+(import (scheme base) (scheme write) (scheme process-context)
+        (chibi time) (chibi ast))
+
+(define (timeval->milliseconds tv)
+  (+ (* 1000 (timeval-seconds tv))
+     (quotient (timeval-microseconds tv) 1000)))
+
+(define (now) (timeval->milliseconds (car (get-time-of-day))))
+
+(define shared (string-copy "shared"))
+
+(define (make-wide n)
+  (let ((v (make-vector n #f)))
+    (do ((i 0 (+ i 1))) ((= i n) v)
+      (vector-set! v i (cons i shared)))))
+
+(define (make-deep n)
+  ;; the trailing non-immediate keeps the child out of the last slot
+  (do ((i 0 (+ i 1))
+       (x '() (vector x shared)))
+      ((= i n) x)))
+
+(define (make-tree n)
+  ;; a complete binary tree in heap order, node i has children
+  ;; 2i+1 and 2i+2
+  (let build ((i 0))
+    (if (>= i n)
+        '()
+        (vector (build (+ (* 2 i) 1)) (build (+ (* 2 i) 2)) shared))))
+
+(define (run name make nodes collections)
+  (gc)
+  (let ((x (make nodes)))
+    (gc)
+    (let* ((start (now))
+           (res (do ((i 0 (+ i 1))) ((= i collections)) (gc)))
+           (msecs (- (now) start)))
+      (display name)
+      (display " nodes: ") (write nodes)
+      (display " collections: ") (write collections)
+      (display " msecs: ") (write msecs)
+      (newline)
+      (vector? x))))
+
+(let* ((args (command-line))
+       (nodes (if (pair? (cdr args)) (string->number (cadr args)) 10000000))
+       (collections (if (and (pair? (cdr args)) (pair? (cddr args)))
+                        (string->number (car (cddr args)))
+                        5)))
+  (run "wide" make-wide nodes collections)
+  (run "deep" make-deep nodes collections)
+  (run "tree" make-tree nodes collections))
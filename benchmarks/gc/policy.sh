@@ -0,0 +1,49 @@
+#!/bin/sh
+
+# Runs the gabriel suite under each combination of heap growth
+# policy settings, printing the time taken by each benchmark and
+# the total per setting.  The settings swept can be overridden
+# from the environment, e.g.
+#
+#   SIZES="1M 16M" FACTORS="1.5 2" RATIOS="0.5 0.75" MAX_SIZE=1G \
+#   BENCHMARKS="nboyer earley" ./benchmarks/gc/policy.sh
+
+BENCHDIR=$(cd "$(dirname $0)" && pwd)
+CHIBIHOME=${BENCHDIR%%/benchmarks/gc}
+GABRIEL="$CHIBIHOME/benchmarks/gabriel"
+CHIBI="${CHIBI:-${CHIBIHOME}/chibi-scheme}"
+
+SIZES="${SIZES:-1M 8M 64M}"
+FACTORS="${FACTORS:-1.5 2 4}"
+RATIOS="${RATIOS:-0.5 0.75 0.9}"
+MAX_SIZE="${MAX_SIZE:-}"
+if [ -z "$BENCHMARKS" ]; then
+    BENCHMARKS=$(cd "$GABRIEL" && ls *.sch | sed 's/\.sch$//')
+fi
+
+# the benchmarks read their input from the current directory
+WORKDIR=$(mktemp -d)
+trap 'rm -rf "$WORKDIR"' 0
+echo '#t' > "$WORKDIR/input.txt"
+cd "$WORKDIR"
+
+printf '%-8s %-6s %-6s %-12s %s\n' size factor ratio benchmark msecs
+for size in $SIZES; do
+    for factor in $FACTORS; do
+        for ratio in $RATIOS; do
+            total=0
+            for t in $BENCHMARKS; do
+                msecs=$(LD_LIBRARY_PATH="$CHIBIHOME" \
+                        DYLD_LIBRARY_PATH="$CHIBIHOME" \
+                        $CHIBI -I"$CHIBIHOME/lib" -I"$GABRIEL" \
+                        -h "$size${MAX_SIZE:+/$MAX_SIZE}" -g "$factor/$ratio" \
+                        -q -lchibi-prelude.scm "$GABRIEL/$t.sch" 2>/dev/null \
+                    | sed -n 's/^user: .* real: \([0-9]*\).*/\1/p' | head -1)
+                printf '%-8s %-6s %-6s %-12s %s\n' \
+                    $size $factor $ratio $t "${msecs:-failed}"
+                total=$((total + ${msecs:-0}))
+            done
+            printf '%-8s %-6s %-6s %-12s %s\n' $size $factor $ratio total $total
+        done
+    done
+done
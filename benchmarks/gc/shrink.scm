@@ -0,0 +1,43 @@
+;;; Giving memory back after a burst of allocation.
+;;;
+;;; Keeps n small vectors live long enough to grow the heap by
+;;; several chunks, drops them, and runs a few full collections.
+;;; Chunks found empty for SEXP_SHRINK_HEAP_DELAY sweeps in a row
+;;; are released as long as what's left stays under
+;;; SEXP_SHRINK_HEAP_RATIO full.  Reports the chunks and bytes
+;;; released and the heap before and after.
+;;;
+;;; Usage: chibi-scheme benchmarks/gc/shrink.scm [objects [collections]]
+
+(import (scheme base) (scheme write) (scheme process-context)
+        (chibi ast) (chibi heap-stats))
+
+(define (stat name)
+  (cond ((assq name (gc-stats)) => cdr) (else 0)))
+
+(define (burst n)
+  (let lp ((i 0) (keep '()))
+    (if (>= i n)
+        (length keep)
+        (lp (+ i 1) (cons (make-vector 4 i) keep)))))
+
+(define (run objects collections)
+  (gc)
+  (let ((before (stat 'chunks)))
+    (burst objects)
+    (let ((peak (stat 'chunks)))
+      (do ((i 0 (+ i 1))) ((= i collections)) (gc))
+      (display "objects: ") (write objects)
+      (display " chunks: ") (write before)
+      (display " -> ") (write peak)
+      (display " -> ") (write (stat 'chunks))
+      (display " released: ") (write (stat 'released-chunks))
+      (display " (") (write (stat 'released-bytes)) (display " bytes)")
+      (newline))))
+
+(let* ((args (command-line))
+       (objects (if (pair? (cdr args)) (string->number (cadr args)) 1000000))
+       (collections (if (and (pair? (cdr args)) (pair? (cddr args)))
+                        (string->number (car (cddr args)))
+                        4)))
+  (run objects collections))
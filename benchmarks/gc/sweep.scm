@@ -0,0 +1,46 @@
+;;; Sweeping a heap of many chunks.
+;;;
+;;; Grows the heap by keeping every other one of n small vectors
+;;; live, then runs full collections and reports the sweep time
+;;; recorded by the collector.  Every chunk is then half garbage
+;;; scattered between survivors.  With SEXP_USE_PARALLEL_GC the
+;;; chunks are swept concurrently by the marking threads.  The sweep
+;;; time is only recorded in builds with SEXP_USE_TIME_GC.
+;;;
+;;; Usage: chibi-scheme benchmarks/gc/sweep.scm [objects [collections]]
+
+(import (scheme base) (scheme write) (scheme process-context)
+        (chibi ast) (chibi heap-stats))
+
+(define (stat name)
+  (cond ((assq name (gc-stats)) => cdr) (else 0)))
+
+(define (fill! n)
+  (let lp ((i 0) (keep '()))
+    (if (>= i n)
+        keep
+        (let ((x (make-vector 4 i)))
+          (make-vector 4 i)
+          (lp (+ i 1) (cons x keep))))))
+
+(define (run objects collections)
+  (let ((keep (fill! objects)))
+    (gc)
+    (let ((sweeps (stat 'sweeps))
+          (usecs (stat 'sweep-usecs)))
+      (do ((i 0 (+ i 1))) ((= i collections)) (gc))
+      (display "objects: ") (write objects)
+      (display " chunks: ") (write (stat 'chunks))
+      (display " threads: ") (write (max 1 (stat 'mark-threads)))
+      (display " sweeps: ") (write (- (stat 'sweeps) sweeps))
+      (display " sweep msecs: ")
+      (write (quotient (- (stat 'sweep-usecs) usecs) 1000))
+      (newline)
+      (length keep))))
+
+(let* ((args (command-line))
+       (objects (if (pair? (cdr args)) (string->number (cadr args)) 2000000))
+       (collections (if (and (pair? (cdr args)) (pair? (cddr args)))
+                        (string->number (car (cddr args)))
+                        10)))
+  (run objects collections))
@@ -0,0 +1,82 @@
+#!/bin/sh
+
+# Compares run times with and without the (chibi optimize <pass>)
+# libraries named in $PASSES (default inline).  The benchmarks define
+# their procedures at the top-level, so for the optimized runs the
+# interaction environment is sealed first, as with a (sealed) library
+# declaration.  The plain runs load the same libraries without the
+# passes so that both start with a similar heap.  Each benchmark is
+# run $RUNS times (default 3) per setting and the fastest time
+# printed, e.g.
+#
+#   RUNS=5 BENCHMARKS="takl deriv" ./benchmarks/optimize/compare.sh
+#   PASSES="lift" ./benchmarks/optimize/compare.sh
+#   PASSES="types" ./benchmarks/optimize/compare.sh   # checked vs unchecked
+#
+# Gabriel benchmarks are named as is, shootout benchmarks with a
+# shootout/ prefix and run with $SHOOTOUT_ARG (default 16).
+
+BENCHDIR=$(cd "$(dirname $0)" && pwd)
+CHIBIHOME=${BENCHDIR%%/benchmarks/optimize}
+GABRIEL="$CHIBIHOME/benchmarks/gabriel"
+SHOOTOUT="$CHIBIHOME/benchmarks/shootout"
+CHIBI="${CHIBI:-${CHIBIHOME}/chibi-scheme}"
+RUNS="${RUNS:-3}"
+SHOOTOUT_ARG="${SHOOTOUT_ARG:-16}"
+BENCHMARKS="${BENCHMARKS:-takl deriv shootout/binarytrees}"
+PASSES="${PASSES:-inline}"
+
+# the benchmarks read their input from the current directory
+WORKDIR=$(mktemp -d)
+trap 'rm -rf "$WORKDIR"' 0
+echo '#t' > "$WORKDIR/input.txt"
+printf '(import (chibi) (srfi 1) (srfi 9) (srfi 69) (chibi ast) (chibi match))\n' \
+    > "$WORKDIR/plain-prelude.scm"
+printf '(import (chibi) (only (meta) seal-environment!)%s)\n%s\n' \
+    "$(for p in $PASSES; do printf ' (chibi optimize %s)' $p; done)" \
+    '(seal-environment! (current-environment))' \
+    > "$WORKDIR/optimized-prelude.scm"
+cd "$WORKDIR"
+
+now() {
+    echo $(($(date +%s%N) / 1000000))
+}
+
+# msecs benchmark [prelude-option]: prints the run time of benchmark
+msecs() {
+    case "$1" in
+        shootout/*)
+            start=$(now)
+            LD_LIBRARY_PATH="$CHIBIHOME" DYLD_LIBRARY_PATH="$CHIBIHOME" \
+                $CHIBI -I"$CHIBIHOME/lib" -I"$WORKDIR" $2 \
+                "$SHOOTOUT/${1#shootout/}.chibi" $SHOOTOUT_ARG >/dev/null \
+                && echo $(($(now) - start))
+            ;;
+        *)
+            LD_LIBRARY_PATH="$CHIBIHOME" DYLD_LIBRARY_PATH="$CHIBIHOME" \
+                $CHIBI -I"$CHIBIHOME/lib" -I"$GABRIEL" -I"$WORKDIR" \
+                -q -lchibi-prelude.scm $2 "$GABRIEL/$1.sch" 2>/dev/null \
+                | sed -n 's/^user: .* real: \([0-9]*\).*/\1/p' | head -1
+            ;;
+    esac
+}
+
+# best benchmark [prelude-option]: the fastest of $RUNS runs
+best() {
+    b=
+    i=0
+    while [ $i -lt $RUNS ]; do
+        t=$(msecs "$1" $2)
+        if [ -n "$t" ] && { [ -z "$b" ] || [ "$t" -lt "$b" ]; }; then
+            b=$t
+        fi
+        i=$((i + 1))
+    done
+    echo "${b:-failed}"
+}
+
+printf '%-24s %10s %10s\n' benchmark plain optimized
+for t in $BENCHMARKS; do
+    printf '%-24s %10s %10s\n' $t \
+        $(best $t -lplain-prelude.scm) $(best $t -loptimized-prelude.scm)
+done
@@ -0,0 +1,51 @@
+#!/bin/sh
+
+# Counts the opcodes dispatched by each gabriel benchmark.  Needs
+# chibi built with SEXP_USE_PROFILE_VM, and to measure the effect of
+# superinstructions a second such build with them disabled:
+#
+#   make D="PROFILE_VM=1"
+#   cp -r . /tmp/base && (cd /tmp/base && make clean &&
+#     make D="PROFILE_VM=1 SUPERINSTRUCTIONS=0")
+#   BASE=/tmp/base BENCHMARKS="tak nboyer" ./benchmarks/vm/dispatch.sh
+#
+# With BASE set both builds are run and the reduction in dispatches
+# is printed per benchmark.  The raw profiles are kept in $PROFILES
+# if set, for tools/vm-superinstructions.scm.
+
+BENCHDIR=$(cd "$(dirname $0)" && pwd)
+CHIBIHOME=${BENCHDIR%%/benchmarks/vm}
+GABRIEL="$CHIBIHOME/benchmarks/gabriel"
+if [ -z "$BENCHMARKS" ]; then
+    BENCHMARKS=$(cd "$GABRIEL" && ls *.sch | sed 's/\.sch$//')
+fi
+
+# the benchmarks read their input from the current directory
+WORKDIR=$(mktemp -d)
+trap 'rm -rf "$WORKDIR"' 0
+echo '#t' > "$WORKDIR/input.txt"
+cd "$WORKDIR"
+
+# dispatches home benchmark [tag]: runs the benchmark under the build
+# in home and prints the total number of opcodes dispatched
+dispatches() {
+    out="${PROFILES:-$WORKDIR}/$2${3:+-$3}.txt"
+    LD_LIBRARY_PATH="$1" DYLD_LIBRARY_PATH="$1" \
+        "$1/chibi-scheme" -I"$1/lib" -I"$GABRIEL" -q -lchibi-prelude.scm \
+        -e '(reset-vm-profile)' -l "$2.sch" \
+        -e '(print-vm-profile)' >/dev/null 2>"$out"
+    awk 'NF == 2 {n += $2} END {printf "%d\n", n}' "$out"
+}
+
+[ -n "$PROFILES" ] && mkdir -p "$PROFILES"
+printf '%-12s %14s %14s %s\n' benchmark base dispatches saved
+for t in $BENCHMARKS; do
+    n=$(dispatches "$CHIBIHOME" $t)
+    if [ -n "$BASE" ]; then
+        b=$(dispatches "$BASE" $t base)
+        printf '%-12s %14s %14s %s%%\n' $t $b $n \
+            $(awk "BEGIN {printf \"%.1f\", $b ? 100 * ($b - $n) / $b : 0}")
+    else
+        printf '%-12s %14s %14s\n' $t - $n
+    fi
+done
@@ -0,0 +1,60 @@
+#!/bin/sh
+
+# Compares the run times of the gabriel benchmarks under the x86-64
+# JIT with a plain build in $BASE, printing the fastest of $RUNS runs
+# (default 3) for each:
+#
+#   make D="NATIVE_X86=1"
+#   cp -r . /tmp/base && (cd /tmp/base && make clean && make)
+#   BASE=/tmp/base BENCHMARKS="tak fib" ./benchmarks/vm/jit.sh
+
+BENCHDIR=$(cd "$(dirname $0)" && pwd)
+CHIBIHOME=${BENCHDIR%%/benchmarks/vm}
+GABRIEL="$CHIBIHOME/benchmarks/gabriel"
+RUNS="${RUNS:-3}"
+if [ -z "$BASE" ]; then
+    echo "usage: BASE=<plain chibi build> $0" >&2
+    exit 1
+fi
+if [ -z "$BENCHMARKS" ]; then
+    BENCHMARKS=$(cd "$GABRIEL" && ls *.sch | sed 's/\.sch$//')
+fi
+
+# the benchmarks read their input from the current directory
+WORKDIR=$(mktemp -d)
+trap 'rm -rf "$WORKDIR"' 0
+echo '#t' > "$WORKDIR/input.txt"
+cd "$WORKDIR"
+
+# msecs home benchmark: the run time of benchmark under the build in home
+msecs() {
+    LD_LIBRARY_PATH="$1" DYLD_LIBRARY_PATH="$1" \
+        "$1/chibi-scheme" -I"$1/lib" -I"$GABRIEL" -q -lchibi-prelude.scm \
+        "$GABRIEL/$2.sch" 2>/dev/null \
+        | sed -n 's/^user: .* real: \([0-9]*\).*/\1/p' | head -1
+}
+
+# best home benchmark: the fastest of $RUNS runs
+best() {
+    b=
+    i=0
+    while [ $i -lt $RUNS ]; do
+        t=$(msecs "$1" $2)
+        if [ -n "$t" ] && { [ -z "$b" ] || [ "$t" -lt "$b" ]; }; then
+            b=$t
+        fi
+        i=$((i + 1))
+    done
+    echo "${b:-failed}"
+}
+
+printf '%-12s %10s %10s %s\n' benchmark base jit speedup
+for t in $BENCHMARKS; do
+    b=$(best "$BASE" $t)
+    n=$(best "$CHIBIHOME" $t)
+    case "$b$n" in
+        *failed*) printf '%-12s %10s %10s\n' $t $b $n ;;
+        *) printf '%-12s %10s %10s %sx\n' $t $b $n \
+               $(awk "BEGIN {printf \"%.2f\", $n ? $b / $n : 0}") ;;
+    esac
+done
@@ -119,8 +119,12 @@ static sexp sexp_env_undefine (sexp ctx, sexp env, sexp key) {
   for (ls2=sexp_env_bindings(env); sexp_pairp(ls2);
        ls1=ls2, ls2=sexp_env_next_cell(ls2))
     if (sexp_car(ls2) == key) {
-      if (ls1) sexp_env_next_cell(ls1) = sexp_env_next_cell(ls2);
-      else sexp_env_bindings(env) = sexp_env_next_cell(ls2);
+      if (ls1) {
+        sexp_write_barrier(ctx, ls1, sexp_env_next_cell(ls2));
+        sexp_env_next_cell(ls1) = sexp_env_next_cell(ls2);
+      } else {
+        sexp_env_bindings(env) = sexp_env_next_cell(ls2);
+      }
       return SEXP_TRUE;
     }
   return SEXP_FALSE;
@@ -142,8 +146,10 @@ sexp sexp_env_cell_define (sexp ctx, sexp env, sexp key,
 #endif
   for (ls=sexp_env_bindings(env); sexp_pairp(ls); ls=sexp_env_next_cell(ls))
     if (sexp_car(ls) == key) {
-      if (sexp_cdr(ls) == SEXP_UNDEF)
+      if (sexp_cdr(ls) == SEXP_UNDEF) {
+        sexp_write_barrier(ctx, ls, value);
         sexp_cdr(ls) = value;
+      }
       return ls;
     }
   sexp_gc_preserve2(ctx, cell, ls);
@@ -177,6 +183,7 @@ sexp sexp_env_define (sexp ctx, sexp env, sexp key, sexp value) {
     sexp_env_undefine(ctx, env, key);
     sexp_env_push(ctx, env, tmp, key, value);
   } else {
+    sexp_write_barrier(ctx, cell, value);
     sexp_cdr(cell) = value;
   }
   return res;
@@ -457,7 +464,6 @@ static void sexp_add_path (sexp ctx, const char *str) {
   }
 }
 
-#if ! SEXP_USE_NATIVE_X86
 static void sexp_init_eval_context_bytecodes (sexp ctx) {
   sexp_gc_var3(tmp, vec, ctx2);
   sexp_gc_preserve3(ctx, tmp, vec, ctx2);
@@ -473,14 +479,11 @@ static void sexp_init_eval_context_bytecodes (sexp ctx) {
     = sexp_intern(ctx, "final-resumer", -1);
   sexp_gc_release3(ctx);
 }
-#endif
 
 void sexp_init_eval_context_globals (sexp ctx) {
   const char* user_path;
   ctx = sexp_make_child_context(ctx, NULL);
-#if ! SEXP_USE_NATIVE_X86
   sexp_init_eval_context_bytecodes(ctx);
-#endif
   sexp_global(ctx, SEXP_G_MODULE_PATH) = SEXP_NULL;
   sexp_add_path(ctx, sexp_default_module_path);
   user_path = getenv(SEXP_MODULE_PATH_VAR);
@@ -1066,7 +1069,19 @@ error:
   return res;
 }
 
-sexp sexp_analyze (sexp ctx, sexp x) {return analyze(ctx, x, 0, 1);}
+sexp sexp_analyze (sexp ctx, sexp x) {
+#if SEXP_USE_GC_SAFEPOINTS
+  /* the analyzer mutates partially built ast nodes without write */
+  /* barriers, so no deferred gc work may run in macro expanders */
+  sexp res;
+  sexp_context_heap(ctx)->vm_depth++;
+  res = analyze(ctx, x, 0, 1);
+  sexp_context_heap(ctx)->vm_depth--;
+  return res;
+#else
+  return analyze(ctx, x, 0, 1);
+#endif
+}
 
 /********************** free varable analysis *************************/
 
@@ -1297,9 +1312,16 @@ static sexp sexp_load_dl (sexp ctx, sexp file, sexp env) {
 #endif
 #endif
 
+#if SEXP_USE_FASL
+#include "opt/fasl.c"
+#endif
+
 sexp sexp_load_op (sexp ctx, sexp self, sexp_sint_t n, sexp source, sexp env) {
 #if SEXP_USE_DL || SEXP_USE_STATIC_LIBS
   const char *suffix;
+#endif
+#if SEXP_USE_FASL
+  sexp_fasl_writer fasl;
 #endif
   sexp_gc_var5(ctx2, x, in, res, out);
   if (!env) env = sexp_context_env(ctx);
@@ -1330,11 +1352,26 @@ sexp sexp_load_op (sexp ctx, sexp self, sexp_sint_t n, sexp source, sexp env) {
     ctx2 = sexp_make_eval_context(ctx, NULL, env, 0, 0);
     sexp_context_parent(ctx2) = ctx;
     sexp_context_tailp(ctx2) = 0;
+#if SEXP_USE_FASL
+    res = sexp_stringp(source) ? sexp_fasl_load(ctx2, source, env) : SEXP_FALSE;
+    if (res == SEXP_FALSE) {
+      res = SEXP_VOID;
+      fasl = sexp_stringp(source) ? sexp_fasl_open(ctx2, source, env) : NULL;
+#endif
     while ((x=sexp_read(ctx2, in)) != (sexp) SEXP_EOF) {
+#if SEXP_USE_FASL
+      if (fasl && !sexp_exceptionp(x))
+        res = sexp_fasl_eval(ctx2, fasl, x, env);
+      else
+#endif
       res = sexp_exceptionp(x) ? x : sexp_eval(ctx2, x, env);
       if (sexp_exceptionp(res))
         break;
     }
+#if SEXP_USE_FASL
+      if (fasl) sexp_fasl_close(ctx2, fasl, x == SEXP_EOF);
+    }
+#endif
     sexp_context_last_fp(ctx) = sexp_context_last_fp(ctx2);
     if (x == SEXP_EOF)
       res = SEXP_VOID;
@@ -2031,12 +2068,47 @@ sexp sexp_make_null_env_op (sexp ctx, sexp self, sexp_sint_t n, sexp version) {
   return e;
 }
 
+/* The opcodes which skip their type checks aren't bound, so that */
+/* only code proven to pass them the right types can use them. */
+/* (chibi optimize types) gets them from unchecked-opcode, which */
+/* it binds privately. */
+static int sexp_unchecked_opcodep (struct sexp_opcode_struct *op) {
+  switch (op->code) {
+  case SEXP_OP_UNCHECKED_CAR: case SEXP_OP_UNCHECKED_CDR:
+  case SEXP_OP_UNCHECKED_VECTOR_REF:
+  case SEXP_OP_UNCHECKED_ADD: case SEXP_OP_UNCHECKED_SUB:
+    return 1;
+  }
+  return 0;
+}
+
+sexp sexp_unchecked_opcode_op (sexp ctx, sexp self, sexp_sint_t n, sexp name) {
+  int i;
+  sexp res = SEXP_FALSE;
+  sexp_gc_var1(str);
+  sexp_assert_type(ctx, sexp_symbolp, SEXP_SYMBOL, name);
+  sexp_gc_preserve1(ctx, str);
+  str = sexp_symbol_to_string(ctx, name);
+  for (i=0; sexp_primitive_opcodes[i].op_class; i++) {
+    if (sexp_unchecked_opcodep(&sexp_primitive_opcodes[i])
+        && strcmp((char*)sexp_primitive_opcodes[i].name, sexp_string_data(str)) == 0) {
+      res = sexp_copy_opcode(ctx, &sexp_primitive_opcodes[i]);
+      sexp_opcode_name(res) = str;
+      break;
+    }
+  }
+  sexp_gc_release1(ctx);
+  return res;
+}
+
 sexp sexp_make_primitive_env_op (sexp ctx, sexp self, sexp_sint_t n, sexp version) {
   int i;
   sexp_gc_var4(e, op, sym, name);
   sexp_gc_preserve4(ctx, e, op, sym, name);
   e = sexp_make_null_env(ctx, version);
   for (i=0; sexp_primitive_opcodes[i].op_class; i++) {
+    if (sexp_unchecked_opcodep(&sexp_primitive_opcodes[i]))
+      continue;
     op = sexp_copy_opcode(ctx, &sexp_primitive_opcodes[i]);
     name = sexp_intern(ctx, (char*)sexp_opcode_name(op), -1);
     sexp_opcode_name(op) = sexp_c_string(ctx, (char*)sexp_opcode_name(op), -1);
@@ -2146,7 +2218,9 @@ sexp sexp_add_module_directory_op (sexp ctx, sexp self, sexp_sint_t n, sexp dir,
     if (sexp_pairp(ls=sexp_global(ctx, SEXP_G_MODULE_PATH))) {
       for ( ; sexp_pairp(sexp_cdr(ls)); ls=sexp_cdr(ls))
         ;
-      sexp_cdr(ls) = sexp_list1(ctx, dir);
+      dir = sexp_list1(ctx, dir);
+      sexp_write_barrier(ctx, ls, dir);
+      sexp_cdr(ls) = dir;
     } else {
       sexp_global(ctx, SEXP_G_MODULE_PATH) = sexp_list1(ctx, dir);
     }
@@ -2193,8 +2267,10 @@ void sexp_set_parameter (sexp ctx, sexp env, sexp name, sexp value) {
   if (sexp_opcodep(param)) {
     if (! sexp_pairp(sexp_opcode_data(param)))
       sexp_opcode_data(param) = sexp_cons(ctx, name, value);
-    else
+    else {
+      sexp_write_barrier(ctx, sexp_opcode_data(param), value);
       sexp_cdr(sexp_opcode_data(param)) = value;
+    }
   } else {
     sexp_warn(ctx, "can't set non-parameter: ", name);
   }
@@ -2323,6 +2399,7 @@ sexp sexp_load_standard_env (sexp ctx, sexp e, sexp version) {
       /* frozen version in the meta env) */
       tmp = sexp_cons(ctx, sym, tmp);
       sexp_env_next_cell(tmp) = sexp_env_next_cell(sexp_env_bindings(e));
+      sexp_write_barrier(ctx, sexp_env_bindings(e), tmp);
       sexp_env_next_cell(sexp_env_bindings(e)) = tmp;
     }
   }
@@ -2340,6 +2417,15 @@ sexp sexp_make_standard_env_op (sexp ctx, sexp self, sexp_sint_t n, sexp version
   return env;
 }
 
+#if SEXP_USE_STATIC_IMAGE
+#include "staticimage.c"
+
+sexp sexp_load_static_image (sexp_uint_t heap_size, sexp_uint_t heap_max_size) {
+  return sexp_load_image_data(sexp_static_image, sizeof(sexp_static_image)-1,
+                              heap_size, heap_max_size);
+}
+#endif
+
 sexp sexp_env_parent_op (sexp ctx, sexp self, sexp_sint_t n, sexp e) {
   sexp_assert_type(ctx, sexp_envp, SEXP_ENV, e);
   return sexp_env_parent(e) ? sexp_env_parent(e) : SEXP_FALSE;
@@ -2432,7 +2518,6 @@ sexp sexp_generate_op (sexp ctx, sexp self, sexp_sint_t n, sexp ast, sexp env) {
   }
   sexp_gc_preserve3(ctx, ctx2, vec, res);
   sexp_free_vars(ctx2, ast, SEXP_NULL);    /* should return SEXP_NULL */
-  sexp_emit_enter(ctx2);
   sexp_generate(ctx2, 0, 0, 0, ast);
   res = sexp_complete_bytecode(ctx2);
   if (!sexp_exceptionp(res)) {
@@ -2451,6 +2536,9 @@ sexp sexp_compile_op (sexp ctx, sexp self, sexp_sint_t n, sexp obj, sexp env) {
   if (! env) env = sexp_context_env(ctx);
   sexp_assert_type(ctx, sexp_envp, SEXP_ENV, env);
   sexp_gc_preserve3(ctx, ast, tmp, res);
+#if SEXP_USE_GC_SAFEPOINTS
+  sexp_context_heap(ctx)->vm_depth++;
+#endif
   ctx2 = sexp_make_eval_context(ctx, NULL, env, 0, 0);
   if (sexp_exceptionp(ctx2)) {
     res = ctx2;
@@ -2473,6 +2561,9 @@ sexp sexp_compile_op (sexp ctx, sexp self, sexp_sint_t n, sexp obj, sexp env) {
     sexp_context_child(ctx) = tmp;
     sexp_context_last_fp(ctx) = sexp_context_last_fp(ctx2);
   }
+#if SEXP_USE_GC_SAFEPOINTS
+  sexp_context_heap(ctx)->vm_depth--;
+#endif
   sexp_gc_release3(ctx);
   return res;
 }
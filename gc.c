@@ -6,8 +6,23 @@
 
 #include "chibi/sexp.h"
 
-#if SEXP_USE_MMAP_GC
+#if SEXP_USE_MMAP_GC || SEXP_USE_IMAGE_LOADING
 #include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#if SEXP_USE_IMAGE_LOADING
+#include <fcntl.h>
+#endif
+
+#if SEXP_USE_PARALLEL_GC
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#endif
+
+#if SEXP_USE_TIME_GC
+#include <sys/time.h>
 #endif
 
 #ifdef __APPLE__
@@ -34,6 +49,20 @@ static sexp* stack_base;
 #define sexp_debug_printf(fmt, ...)
 #endif
 
+#if SEXP_USE_TIME_GC
+static sexp_uint_t sexp_usecs (void) {
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+static void sexp_record_sweep (sexp ctx, sexp_uint_t start) {
+  sexp_heap h = sexp_context_heap(ctx);
+  h->sweep_usecs += sexp_usecs() - start;
+  h->sweep_count++;
+}
+#endif
+
 static sexp_heap sexp_heap_last (sexp_heap h) {
   while (h->next) h = h->next;
   return h;
@@ -46,8 +75,28 @@ static size_t sexp_heap_total_size (sexp_heap h) {
   return total_size;
 }
 
+#if SEXP_USE_PARALLEL_GC
+static void sexp_free_mark_pool (struct sexp_mark_pool_t *pool);
+#endif
+
 #if ! SEXP_USE_GLOBAL_HEAP
 void sexp_free_heap (sexp_heap heap) {
+#if SEXP_USE_GENERATIONAL_GC
+  if (heap->remembered) free(heap->remembered);
+#endif
+  if (heap->mark_stack) free(heap->mark_stack);
+#if SEXP_USE_PARALLEL_GC
+  if (heap->mark_pool) sexp_free_mark_pool(heap->mark_pool);
+#endif
+#if SEXP_USE_INCREMENTAL_GC
+  if (heap->rescan) free(heap->rescan);
+#endif
+#if SEXP_USE_IMAGE_LOADING && ! SEXP_USE_MMAP_GC
+  if (heap->mappedp) {
+    munmap(heap, sexp_heap_pad_size(heap->size));
+    return;
+  }
+#endif
 #if SEXP_USE_MMAP_GC
   munmap(heap, sexp_heap_pad_size(heap->size));
 #else
@@ -186,34 +235,452 @@ int sexp_valid_object_p (sexp ctx, sexp x) {
 }
 #endif
 
-void sexp_mark (sexp ctx, sexp x) {
-  sexp_sint_t len;
-  sexp t, *p, *q;
-  struct sexp_gc_var_t *saves;
- loop:
+#if SEXP_USE_GENERATIONAL_GC || SEXP_USE_INCREMENTAL_GC
+/* Objects which C code routinely mutates in place without a write */
+/* barrier.  These are kept in the remembered set for as long as */
+/* they live, or rescanned at the end of incremental marking. */
+static int sexp_unbarrieredp (sexp ctx, sexp x) {
+  switch (sexp_pointer_tag(x)) {
+  case SEXP_CONTEXT: case SEXP_STACK: case SEXP_ENV: case SEXP_TYPE:
+  case SEXP_OPCODE: case SEXP_IPORT: case SEXP_OPORT:
+    return 1;
+  }
+  return sexp_pointer_tag(x) < sexp_context_num_types(ctx)
+    && sexp_type_weak_base(sexp_object_type(ctx, x)) > 0;
+}
+#endif
+
+/* push x on one of the heap's object stacks, or return 0 if */
+/* there's no memory left to grow it */
+static int sexp_push_object (sexp **v, sexp_uint_t *len, sexp_uint_t *size,
+                             sexp x) {
+  sexp *tmp;
+  if (*len >= *size) {
+    tmp = realloc(*v, (*size*2+1024)*sizeof(sexp));
+    if (!tmp) return 0;
+    *v = tmp;
+    *size = *size*2+1024;
+  }
+  (*v)[(*len)++] = x;
+  return 1;
+}
+
+#if SEXP_USE_INCREMENTAL_GC
+static void sexp_push_rescan (sexp ctx, sexp x) {
+  sexp_heap h = sexp_context_heap(ctx);
+  if (! sexp_push_object(&h->rescan, &h->rescan_len, &h->rescan_size, x))
+    h->rescan_overflowp = 1;
+}
+#endif
+
+#if SEXP_USE_GENERATIONAL_GC
+
+void sexp_remember (sexp ctx, sexp x) {
+  sexp_heap h = sexp_context_heap(ctx);
+  sexp *tmp;
+  if (h->remembered_len >= h->remembered_size) {
+    tmp = realloc(h->remembered, (h->remembered_size*2+1024)*sizeof(sexp));
+    if (!tmp) {
+      /* can't track x, force the next collection to be a full one */
+      h->major_size = 0;
+      h->gc_requested = 1;
+      return;
+    }
+    h->remembered = tmp;
+    h->remembered_size = h->remembered_size*2+1024;
+  }
+  sexp_rememberedp(x) = 1;
+  h->remembered[h->remembered_len++] = x;
+}
+
+#endif
+
+/* Marking uses an explicit stack of grey objects, which are marked */
+/* but haven't had their slots scanned yet, so that deeply nested */
+/* data can't overflow the C stack.  If the stack can't be grown, */
+/* the object is left marked but unscanned, and once the stack is */
+/* empty the heap is rescanned for marked objects with unmarked */
+/* children. */
+static void sexp_mark_grey (sexp ctx, sexp x) {
+  sexp_heap h = sexp_context_heap(ctx);
   if (!x || !sexp_pointerp(x) || !sexp_valid_object_p(ctx, x) || sexp_markedp(x))
     return;
   sexp_markedp(x) = 1;
-  if (sexp_contextp(x)) {
+#if SEXP_USE_GENERATIONAL_GC
+  if (h->promotingp && !sexp_rememberedp(x) && sexp_unbarrieredp(ctx, x))
+    sexp_remember(ctx, x);
+#endif
+#if SEXP_USE_LAZY_SWEEP || SEXP_USE_INCREMENTAL_GC
+  h->live_size += sexp_heap_align(sexp_allocated_bytes(ctx, x));
+#endif
+#if SEXP_USE_INCREMENTAL_GC
+  /* record objects the final incremental pause must rescan */
+  if (h->markingp && sexp_unbarrieredp(ctx, x))
+    sexp_push_rescan(ctx, x);
+#endif
+  if (! sexp_push_object(&h->mark_stack, &h->mark_stack_len,
+                         &h->mark_stack_size, x))
+    h->mark_overflowp = 1;
+}
+
+/* grey the children of x, returning the number of words scanned */
+static sexp_uint_t sexp_scan_slots (sexp ctx, sexp x) {
+  sexp_sint_t i, len;
+  sexp t, *p;
+  struct sexp_gc_var_t *saves;
+  if (sexp_contextp(x))
     for (saves=sexp_context_saves(x); saves; saves=saves->next)
-      if (saves->var) sexp_mark(ctx, *(saves->var));
-  }
+      if (saves->var) sexp_mark_grey(ctx, *(saves->var));
   t = sexp_object_type(ctx, x);
-  len = sexp_type_num_slots_of_object(t, x) - 1;
-  if (len >= 0) {
-    p = (sexp*) (((char*)x) + sexp_type_field_base(t));
-    q = p + len;
-    while (p < q && ! (*q && sexp_pointerp(*q)))
-      q--;                      /* skip trailing immediates */
-    while (p < q && *q == q[-1])
-      q--;                      /* skip trailing duplicates */
-    while (p < q)
-      sexp_mark(ctx, *p++);
-    x = *p;
-    goto loop;
+  len = sexp_type_num_slots_of_object(t, x);
+  p = (sexp*) (((char*)x) + sexp_type_field_base(t));
+  for (i=0; i<len; i++)
+    sexp_mark_grey(ctx, p[i]);
+  return len + 1;
+}
+
+/* rescan every marked object in the heap, for when the mark stack */
+/* overflowed and some grey objects were never pushed */
+static sexp_uint_t sexp_rescan_marked (sexp ctx) {
+  sexp_heap h = sexp_context_heap(ctx), c;
+  sexp_uint_t words = 0;
+  sexp p, end;
+  sexp_free_list q, r;
+  sexp_debug_printf("%p rescanning heap after mark stack overflow", ctx);
+  for (c=h; c; c=c->next) {
+    p = sexp_heap_first_block(c);
+    q = c->free_list;
+    end = sexp_heap_end(c);
+    while (p < end) {
+      for (r=q->next; r && ((char*)r<(char*)p); q=r, r=r->next)
+        ;
+      if ((char*)r == (char*)p) {
+        p = (sexp) (((char*)p) + r->size);
+        continue;
+      }
+      if (sexp_markedp(p)) {
+        words += sexp_scan_slots(ctx, p);
+        while (h->mark_stack_len > 0)
+          words += sexp_scan_slots(ctx, h->mark_stack[--h->mark_stack_len]);
+      }
+      p = (sexp) (((char*)p)+sexp_heap_align(sexp_allocated_bytes(ctx, p)));
+    }
+  }
+  return words;
+}
+
+/* scan up to budget words from the mark stack, or all of it if */
+/* budget is 0, returning true if marking is complete */
+static int sexp_drain_mark_stack (sexp ctx, sexp_uint_t budget) {
+  sexp_heap h = sexp_context_heap(ctx);
+  sexp_uint_t words = 0;
+  for (;;) {
+    while (h->mark_stack_len > 0 && (!budget || words < budget))
+      words += sexp_scan_slots(ctx, h->mark_stack[--h->mark_stack_len]);
+    if (h->mark_stack_len > 0)
+      return 0;
+    if (! h->mark_overflowp)
+      return 1;
+    h->mark_overflowp = 0;
+    words += sexp_rescan_marked(ctx);
+  }
+}
+
+void sexp_mark (sexp ctx, sexp x) {
+  sexp_mark_grey(ctx, x);
+  sexp_drain_mark_stack(ctx, 0);
+}
+
+#if SEXP_USE_PARALLEL_GC
+
+/* Parallel marking.  The first heap chunk owns a pool of threads, */
+/* started on the first collection with enough to mark.  Each */
+/* worker marks from a private stack, and while others are idle */
+/* moves half of it to its own deque for them to steal from.  The */
+/* collecting thread takes part as worker 0. */
+
+typedef struct sexp_mark_pool_t *sexp_mark_pool;
+
+typedef struct sexp_mark_worker_t {
+  sexp_mark_pool pool;
+  pthread_t thread;
+  pthread_mutex_t lock;         /* guards the deque */
+  sexp *stack, *deque;
+  sexp_uint_t stack_len, stack_size, deque_len, deque_size;
+  sexp_uint_t live_size;
+  size_t sum_freed, max_freed;
+  int generation, overflowp;
+} *sexp_mark_worker;
+
+struct sexp_mark_pool_t {
+  sexp ctx;
+  void (*task)(sexp_mark_worker w);
+  pthread_mutex_t lock;
+  pthread_cond_t start, done;
+  int num_workers, generation, running, active, shutdownp, unswept_only;
+  sexp_heap next_chunk, stop_chunk;
+  sexp_mark_worker workers;
+};
+
+/* make room for n more objects on a stack */
+static int sexp_reserve_objects (sexp **v, sexp_uint_t len, sexp_uint_t *size,
+                                 sexp_uint_t n) {
+  sexp *tmp;
+  if (len + n > *size) {
+    tmp = realloc(*v, (len+n+*size+1024)*sizeof(sexp));
+    if (!tmp) return 0;
+    *v = tmp;
+    *size = len+n+*size+1024;
+  }
+  return 1;
+}
+
+static void sexp_worker_grey (sexp_mark_worker w, sexp x) {
+  sexp ctx = w->pool->ctx;
+  if (!x || !sexp_pointerp(x) || !sexp_valid_object_p(ctx, x) || sexp_markedp(x)
+      || __atomic_exchange_n(&sexp_markedp(x), 1, __ATOMIC_RELAXED))
+    return;
+#if SEXP_USE_LAZY_SWEEP
+  w->live_size += sexp_heap_align(sexp_allocated_bytes(ctx, x));
+#endif
+  if (! sexp_push_object(&w->stack, &w->stack_len, &w->stack_size, x))
+    w->overflowp = 1;
+}
+
+static void sexp_worker_scan (sexp_mark_worker w, sexp x) {
+  sexp_sint_t i, len;
+  sexp t, *p;
+  struct sexp_gc_var_t *saves;
+  if (sexp_contextp(x))
+    for (saves=sexp_context_saves(x); saves; saves=saves->next)
+      if (saves->var) sexp_worker_grey(w, *(saves->var));
+  t = sexp_object_type(w->pool->ctx, x);
+  len = sexp_type_num_slots_of_object(t, x);
+  p = (sexp*) (((char*)x) + sexp_type_field_base(t));
+  for (i=0; i<len; i++)
+    sexp_worker_grey(w, p[i]);
+}
+
+/* move the top half of the private stack to the empty deque */
+static void sexp_worker_share (sexp_mark_worker w) {
+  sexp_uint_t n = w->stack_len / 2;
+  pthread_mutex_lock(&w->lock);
+  if (w->deque_len == 0 && sexp_reserve_objects(&w->deque, 0, &w->deque_size, n)) {
+    w->stack_len -= n;
+    memcpy(w->deque, w->stack + w->stack_len, n*sizeof(sexp));
+    __atomic_store_n(&w->deque_len, n, __ATOMIC_RELEASE);
+  }
+  pthread_mutex_unlock(&w->lock);
+}
+
+/* take back our own deque, or half of someone else's */
+static int sexp_worker_steal (sexp_mark_worker w) {
+  sexp_mark_pool pool = w->pool;
+  sexp_mark_worker v;
+  sexp_uint_t n;
+  int i, id = w - pool->workers;
+  for (i=0; i<pool->num_workers; i++) {
+    v = &pool->workers[(id + i) % pool->num_workers];
+    if (__atomic_load_n(&v->deque_len, __ATOMIC_ACQUIRE) == 0)
+      continue;
+    pthread_mutex_lock(&v->lock);
+    n = (v == w) ? v->deque_len : (v->deque_len + 1) / 2;
+    if (n > 0 && sexp_reserve_objects(&w->stack, w->stack_len, &w->stack_size, n)) {
+      memcpy(w->stack + w->stack_len, v->deque + v->deque_len - n, n*sizeof(sexp));
+      w->stack_len += n;
+      __atomic_store_n(&v->deque_len, v->deque_len - n, __ATOMIC_RELEASE);
+    } else {
+      n = 0;
+    }
+    pthread_mutex_unlock(&v->lock);
+    if (n > 0) return 1;
+  }
+  return 0;
+}
+
+static int sexp_mark_work_left (sexp_mark_pool pool) {
+  int i;
+  for (i=0; i<pool->num_workers; i++)
+    if (__atomic_load_n(&pool->workers[i].deque_len, __ATOMIC_ACQUIRE) > 0)
+      return 1;
+  return 0;
+}
+
+/* Mark until every worker is out of work.  A worker only counts as */
+/* inactive while it has nothing on its stack, so once the count */
+/* drops to zero with the deques empty nothing can be shared again. */
+static void sexp_mark_task (sexp_mark_worker w) {
+  sexp_mark_pool pool = w->pool;
+  for (;;) {
+    while (w->stack_len > 0) {
+      sexp_worker_scan(w, w->stack[--w->stack_len]);
+      if (w->stack_len >= 64
+          && __atomic_load_n(&pool->active, __ATOMIC_RELAXED) < pool->num_workers
+          && __atomic_load_n(&w->deque_len, __ATOMIC_RELAXED) == 0)
+        sexp_worker_share(w);
+    }
+    if (sexp_worker_steal(w))
+      continue;
+    __atomic_sub_fetch(&pool->active, 1, __ATOMIC_SEQ_CST);
+    for (;;) {
+      if (sexp_mark_work_left(pool)) {
+        __atomic_add_fetch(&pool->active, 1, __ATOMIC_SEQ_CST);
+        if (sexp_worker_steal(w))
+          break;
+        __atomic_sub_fetch(&pool->active, 1, __ATOMIC_SEQ_CST);
+      } else if (__atomic_load_n(&pool->active, __ATOMIC_SEQ_CST) == 0) {
+        return;
+      } else {
+        sched_yield();
+      }
+    }
+  }
+}
+
+static void* sexp_mark_thread (void *arg) {
+  sexp_mark_worker w = (sexp_mark_worker) arg;
+  sexp_mark_pool pool = w->pool;
+  pthread_mutex_lock(&pool->lock);
+  for (;;) {
+    while (pool->generation == w->generation && !pool->shutdownp)
+      pthread_cond_wait(&pool->start, &pool->lock);
+    if (pool->shutdownp)
+      break;
+    w->generation = pool->generation;
+    pthread_mutex_unlock(&pool->lock);
+    pool->task(w);
+    pthread_mutex_lock(&pool->lock);
+    if (--pool->running == 0)
+      pthread_cond_signal(&pool->done);
+  }
+  pthread_mutex_unlock(&pool->lock);
+  return NULL;
+}
+
+static void sexp_free_mark_pool (sexp_mark_pool pool) {
+  int i;
+  pthread_mutex_lock(&pool->lock);
+  pool->shutdownp = 1;
+  pthread_cond_broadcast(&pool->start);
+  pthread_mutex_unlock(&pool->lock);
+  for (i=0; i<pool->num_workers; i++) {
+    if (i > 0) pthread_join(pool->workers[i].thread, NULL);
+    pthread_mutex_destroy(&pool->workers[i].lock);
+    free(pool->workers[i].stack);
+    free(pool->workers[i].deque);
+  }
+  pthread_cond_destroy(&pool->start);
+  pthread_cond_destroy(&pool->done);
+  pthread_mutex_destroy(&pool->lock);
+  free(pool->workers);
+  free(pool);
+}
+
+/* return the heap's pool, starting it if needed, or NULL if */
+/* there's only a single thread to mark with */
+static sexp_mark_pool sexp_get_mark_pool (sexp ctx) {
+  sexp_heap h = sexp_context_heap(ctx);
+  sexp_mark_pool pool;
+  int i, n = h->mark_threads;
+  if (h->mark_pool || n == 1)
+    return h->mark_pool;
+  if (n <= 0)
+    n = sysconf(_SC_NPROCESSORS_ONLN);
+  pool = (sexp_mark_pool) calloc(1, sizeof(struct sexp_mark_pool_t));
+  if (pool && n > 1)
+    pool->workers = (sexp_mark_worker) calloc(n, sizeof(struct sexp_mark_worker_t));
+  if (!pool || !pool->workers) {
+    free(pool);
+    h->mark_threads = 1;
+    return NULL;
+  }
+  pthread_mutex_init(&pool->lock, NULL);
+  pthread_cond_init(&pool->start, NULL);
+  pthread_cond_init(&pool->done, NULL);
+  for (i=0; i<n; i++) {
+    pool->workers[i].pool = pool;
+    pthread_mutex_init(&pool->workers[i].lock, NULL);
+    pool->num_workers = i + 1;
+    if (i > 0 && pthread_create(&pool->workers[i].thread, NULL,
+                                sexp_mark_thread, &pool->workers[i])) {
+      pthread_mutex_destroy(&pool->workers[i].lock);
+      pool->num_workers = i;
+      break;
+    }
+  }
+  sexp_debug_printf("%p started %d marking threads", ctx, pool->num_workers);
+  if (pool->num_workers < 2) {
+    sexp_free_mark_pool(pool);
+    h->mark_threads = 1;
+    return NULL;
+  }
+  h->mark_threads = pool->num_workers;
+  return h->mark_pool = pool;
+}
+
+/* run task on every worker, returning once they're all done */
+static void sexp_run_mark_pool (sexp ctx, sexp_mark_pool pool,
+                                void (*task)(sexp_mark_worker w)) {
+  pthread_mutex_lock(&pool->lock);
+  pool->ctx = ctx;
+  pool->task = task;
+  pool->active = pool->num_workers;
+  pool->running = pool->num_workers - 1;
+  pool->generation++;
+  pthread_cond_broadcast(&pool->start);
+  pthread_mutex_unlock(&pool->lock);
+  task(&pool->workers[0]);
+  pthread_mutex_lock(&pool->lock);
+  while (pool->running > 0)
+    pthread_cond_wait(&pool->done, &pool->lock);
+  pthread_mutex_unlock(&pool->lock);
+}
+
+/* hand out the chunks from next_chunk up to stop_chunk one at a time */
+static sexp_heap sexp_claim_chunk (sexp_mark_pool pool) {
+  sexp_heap h;
+  pthread_mutex_lock(&pool->lock);
+  if ((h = pool->next_chunk))
+    pool->next_chunk = (h->next == pool->stop_chunk) ? NULL : h->next;
+  pthread_mutex_unlock(&pool->lock);
+  return h;
+}
+
+/* finish marking from the grey objects on the heap's mark stack, */
+/* in parallel unless there turns out to be little to mark */
+static void sexp_parallel_mark (sexp ctx) {
+  sexp_heap h = sexp_context_heap(ctx);
+  sexp_mark_pool pool;
+  sexp_mark_worker w;
+  sexp_uint_t i;
+  if (sexp_drain_mark_stack(ctx, SEXP_PARALLEL_MARK_MIN)
+      || !(pool = sexp_get_mark_pool(ctx))) {
+    sexp_drain_mark_stack(ctx, 0);
+    return;
+  }
+  for (i=0; i<h->mark_stack_len; i++) {
+    w = &pool->workers[i % pool->num_workers];
+    if (! sexp_push_object(&w->stack, &w->stack_len, &w->stack_size,
+                           h->mark_stack[i]))
+      w->overflowp = 1;
+  }
+  h->mark_stack_len = 0;
+  sexp_run_mark_pool(ctx, pool, sexp_mark_task);
+  for (i=0; i<pool->num_workers; i++) {
+    w = &pool->workers[i];
+#if SEXP_USE_LAZY_SWEEP
+    h->live_size += w->live_size;
+#endif
+    if (w->overflowp)
+      h->mark_overflowp = 1;
+    w->live_size = w->overflowp = 0;
   }
+  /* rescan for anything left grey by an overflowed worker */
+  sexp_drain_mark_stack(ctx, 0);
 }
 
+#endif
+
 #if SEXP_USE_CONSERVATIVE_GC
 
 int stack_references_pointer_p (sexp ctx, sexp x) {
@@ -277,64 +744,98 @@ void sexp_conservative_mark (sexp ctx) {
 #endif
 
 #if SEXP_USE_WEAK_REFERENCES
-void sexp_reset_weak_references(sexp ctx) {
+static void sexp_reset_weak_object (sexp ctx, sexp p) {
   int i, len, all_reset_p;
-  sexp_heap h = sexp_context_heap(ctx);
-  sexp p, t, end, *v;
-  sexp_free_list q, r;
-  for ( ; h; h=h->next) {   /* just scan the whole heap */
-    p = sexp_heap_first_block(h);
-    q = h->free_list;
-    end = sexp_heap_end(h);
-    while (p < end) {
-      /* find the preceding and succeeding free list pointers */
-      for (r=q->next; r && ((char*)r<(char*)p); q=r, r=r->next)
-        ;
-      if ((char*)r == (char*)p) { /* this is a free block, skip it */
-        p = (sexp) (((char*)p) + r->size);
-        continue;
-      }
-      if (sexp_valid_object_p(ctx, p) && sexp_markedp(p)) {
-        t = sexp_object_type(ctx, p);
-        if (sexp_type_weak_base(t) > 0) {
-          all_reset_p = 1;
-          v = (sexp*) ((char*)p + sexp_type_weak_base(t));
-          len = sexp_type_num_weak_slots_of_object(t, p);
-          for (i=0; i<len; i++) {
-            if (v[i] && sexp_pointerp(v[i]) && ! sexp_markedp(v[i])) {
-              v[i] = SEXP_FALSE;
-              sexp_brokenp(p) = 1;
-            } else {
-              all_reset_p = 0;
-            }
-          }
-          if (all_reset_p) {      /* ephemerons */
-            len += sexp_type_weak_len_extra(t);
-            for ( ; i<len; i++) v[i] = SEXP_FALSE;
-          }
-        }
+  sexp t, *v;
+  t = sexp_object_type(ctx, p);
+  if (sexp_type_weak_base(t) > 0) {
+    all_reset_p = 1;
+    v = (sexp*) ((char*)p + sexp_type_weak_base(t));
+    len = sexp_type_num_weak_slots_of_object(t, p);
+    for (i=0; i<len; i++) {
+      if (v[i] && sexp_pointerp(v[i]) && ! sexp_markedp(v[i])) {
+        v[i] = SEXP_FALSE;
+        sexp_brokenp(p) = 1;
+      } else {
+        all_reset_p = 0;
       }
-      p = (sexp) (((char*)p)+sexp_heap_align(sexp_allocated_bytes(ctx, p)));
     }
+    if (all_reset_p) {      /* ephemerons */
+      len += sexp_type_weak_len_extra(t);
+      for ( ; i<len; i++) v[i] = SEXP_FALSE;
+    }
+  }
+}
+
+static int sexp_weak_types_p (sexp ctx) {
+  sexp_sint_t i;
+  for (i=0; i<sexp_context_num_types(ctx); i++)
+    if (sexp_type_weak_base(sexp_type_by_index(ctx, i)) > 0)
+      return 1;
+  return 0;
+}
+
+static void sexp_reset_weak_chunk (sexp ctx, sexp_heap h) {
+  sexp p, end;
+  sexp_free_list q, r;
+  p = sexp_heap_first_block(h);
+  q = h->free_list;
+  end = sexp_heap_end(h);
+  while (p < end) {
+    /* find the preceding and succeeding free list pointers */
+    for (r=q->next; r && ((char*)r<(char*)p); q=r, r=r->next)
+      ;
+    if ((char*)r == (char*)p) { /* this is a free block, skip it */
+      p = (sexp) (((char*)p) + r->size);
+      continue;
+    }
+    if (sexp_valid_object_p(ctx, p) && sexp_markedp(p))
+      sexp_reset_weak_object(ctx, p);
+    p = (sexp) (((char*)p)+sexp_heap_align(sexp_allocated_bytes(ctx, p)));
+  }
+}
+
+#if SEXP_USE_PARALLEL_GC
+/* each worker takes the next unclaimed chunk until none are left */
+static void sexp_reset_weak_task (sexp_mark_worker w) {
+  sexp_heap h;
+  while ((h = sexp_claim_chunk(w->pool)))
+    sexp_reset_weak_chunk(w->pool->ctx, h);
+}
+#endif
+
+void sexp_reset_weak_references(sexp ctx) {
+  sexp_heap h = sexp_context_heap(ctx);
+  if (! sexp_weak_types_p(ctx))
+    return;
+#if SEXP_USE_PARALLEL_GC
+  if (h->mark_pool && h->next) {
+    h->mark_pool->next_chunk = h;
+    h->mark_pool->stop_chunk = NULL;
+    sexp_run_mark_pool(ctx, h->mark_pool, sexp_reset_weak_task);
+    return;
   }
+#endif
+  for ( ; h; h=h->next)     /* just scan the whole heap */
+    sexp_reset_weak_chunk(ctx, h);
 }
 #else
+#define sexp_reset_weak_object(ctx, p)
 #define sexp_reset_weak_references(ctx)
 #endif
 
-sexp sexp_finalize (sexp ctx) {
+/* finalize the unmarked objects in the chunks from h up to stop */
+static sexp sexp_finalize_chunks (sexp ctx, sexp_heap h, sexp_heap stop) {
   size_t size;
   sexp p, t, end;
   sexp_free_list q, r;
   sexp_proc2 finalizer;
   sexp_sint_t finalize_count = 0;
-  sexp_heap h = sexp_context_heap(ctx);
 #if SEXP_USE_DL
   sexp_sint_t free_dls = 0, pass = 0;
  loop:
 #endif
-  /* scan over the whole heap */
-  for ( ; h; h=h->next) {
+  for ( ; h != stop; h=h->next) {
     p = sexp_heap_first_block(h);
     q = h->free_list;
     end = sexp_heap_end(h);
@@ -369,104 +870,876 @@ sexp sexp_finalize (sexp ctx) {
   return sexp_make_fixnum(finalize_count);
 }
 
-sexp sexp_sweep (sexp ctx, size_t *sum_freed_ptr) {
-  size_t freed, max_freed=0, sum_freed=0, size;
-  sexp_heap h = sexp_context_heap(ctx);
-  sexp p, end;
-  sexp_free_list q, r, s;
-  /* scan over the whole heap */
-  for ( ; h; h=h->next) {
-    p = sexp_heap_first_block(h);
-    q = h->free_list;
-    end = sexp_heap_end(h);
-    while (p < end) {
-      /* find the preceding and succeeding free list pointers */
-      for (r=q->next; r && ((char*)r<(char*)p); q=r, r=r->next)
-        ;
-      if ((char*)r == (char*)p) { /* this is a free block, skip it */
-        p = (sexp) (((char*)p) + r->size);
-        continue;
-      }
-      size = sexp_heap_align(sexp_allocated_bytes(ctx, p));
-#if SEXP_USE_DEBUG_GC
-      if (!sexp_valid_object_p(ctx, p))
-        fprintf(stderr, SEXP_BANNER("%p sweep: invalid object at %p"), ctx, p);
-      if ((char*)q + q->size > (char*)p)
-        fprintf(stderr, SEXP_BANNER("%p sweep: bad size at %p < %p + %lu"),
-                ctx, p, q, q->size);
-      if (r && ((char*)p)+size > (char*)r)
-        fprintf(stderr, SEXP_BANNER("%p sweep: bad size at %p + %lu > %p"),
-                ctx, p, size, r);
+sexp sexp_finalize (sexp ctx) {
+  return sexp_finalize_chunks(ctx, sexp_context_heap(ctx), NULL);
+}
+
+#if SEXP_USE_SIZE_CLASSES
+static void sexp_push_free_cell (sexp_heap h, sexp p, size_t size) {
+  sexp_uint_t c = sexp_size_class_of(size);
+  memset((void*)p, 0, sexp_sizeof(bytes));
+  sexp_pointer_tag(p) = SEXP_BYTES;
+  sexp_freep(p) = 1;
+  sexp_bytes_length(p) = size - sexp_sizeof(bytes) - 1 - SEXP_GC_PAD;
+#if SEXP_USE_HEADER_MAGIC
+  sexp_pointer_magic(p) = SEXP_POINTER_MAGIC;
 #endif
-      if (!sexp_markedp(p)) {
-        /* free p */
-        sum_freed += size;
-        if (((((char*)q) + q->size) == (char*)p) && (q != h->free_list)) {
-          /* merge q with p */
-          if (r && r->size && ((((char*)p)+size) == (char*)r)) {
-            /* ... and with r */
-            q->next = r->next;
-            freed = q->size + size + r->size;
-            p = (sexp) (((char*)p) + size + r->size);
-          } else {
-            freed = q->size + size;
-            p = (sexp) (((char*)p)+size);
-          }
-          q->size = freed;
-        } else {
-          s = (sexp_free_list)p;
-          if (r && r->size && ((((char*)p)+size) == (char*)r)) {
-            /* merge p with r */
-            s->size = size + r->size;
-            s->next = r->next;
-            q->next = s;
-            freed = size + r->size;
-          } else {
-            s->size = size;
-            s->next = r;
-            q->next = s;
-            freed = size;
-          }
-          p = (sexp) (((char*)p)+freed);
-        }
-        if (freed > max_freed)
-          max_freed = freed;
-      } else {
-        sexp_markedp(p) = 0;
-        p = (sexp) (((char*)p)+size);
-      }
+  sexp_free_cell_next(p) = h->size_classes[c];
+  h->size_classes[c] = p;
+}
+
+/* move all small free chunks from the main list to the size classes */
+static void sexp_build_size_classes (sexp_heap h) {
+  sexp_free_list q, r;
+  size_t size;
+  for (q=h->free_list, r=q->next; r; r=q->next) {
+    if (r->size <= sexp_heap_align(1)*SEXP_SIZE_CLASSES) {
+      size = r->size;
+      q->next = r->next;
+      sexp_push_free_cell(h, (sexp)r, size);
+    } else {
+      q = r;
     }
   }
-  if (sum_freed_ptr) *sum_freed_ptr = sum_freed;
-  return sexp_make_fixnum(max_freed);
 }
 
-#if SEXP_USE_GLOBAL_SYMBOLS
-void sexp_mark_global_symbols(sexp ctx) {
-  int i;
-  for (i=0; i<SEXP_SYMBOL_TABLE_SIZE; i++)
-    sexp_mark(ctx, sexp_symbol_table[i]);
+static void* sexp_try_alloc_size_class (sexp_heap h, size_t size) {
+  sexp_uint_t c = sexp_size_class_of(size), i;
+  sexp res;
+  for (i=c; i<SEXP_SIZE_CLASSES; i++)
+    if ((res = h->size_classes[i])) {
+      h->size_classes[i] = sexp_free_cell_next(res);
+      if (i > c)          /* return the remainder to a smaller class */
+        sexp_push_free_cell(h, (sexp)((char*)res + size), (i-c)*sexp_heap_align(1));
+      memset((void*)res, 0, size);
+      return res;
+    }
+  return NULL;
 }
 #else
-#define sexp_mark_global_symbols(ctx)
+#define sexp_build_size_classes(h)
 #endif
 
-sexp sexp_gc (sexp ctx, size_t *sum_freed) {
-  sexp res, finalized SEXP_NO_WARN_UNUSED;
-  sexp_debug_printf("%p (heap: %p size: %lu)", ctx, sexp_context_heap(ctx),
-                    sexp_heap_total_size(sexp_context_heap(ctx)));
-  sexp_mark_global_symbols(ctx);
-  sexp_mark(ctx, ctx);
-  sexp_conservative_mark(ctx);
+/* sweep a single chunk, adding the bytes freed to sum_freed and */
+/* returning the largest free block - in the generational mode */
+/* survivors keep their marks while promoting, making them old */
+static size_t sexp_sweep_chunk (sexp ctx, sexp_heap h, size_t *sum_freed) {
+  size_t freed, max_freed=0, size;
+#if SEXP_USE_GENERATIONAL_GC
+  size_t max_free=0;
+#endif
+  sexp p, end;
+  sexp_free_list q, r, s;
+#if SEXP_USE_GENERATIONAL_GC
+  int stickyp = sexp_context_heap(ctx)->promotingp;
+#else
+  const int stickyp = 0;
+#endif
+#if SEXP_USE_LAZY_SWEEP
+  h->unsweptp = 0;
+#endif
+#if SEXP_USE_GENERATIONAL_GC
+  h->bump = NULL;
+#endif
+#if SEXP_USE_SIZE_CLASSES
+  /* all free cells are unmarked and will be swept back into the free list */
+  memset(h->size_classes, 0, sizeof(h->size_classes));
+#endif
+  p = sexp_heap_first_block(h);
+  q = h->free_list;
+  end = sexp_heap_end(h);
+  while (p < end) {
+    /* find the preceding and succeeding free list pointers */
+    for (r=q->next; r && ((char*)r<(char*)p); q=r, r=r->next)
+      ;
+    if ((char*)r == (char*)p) { /* this is a free block, skip it */
+#if SEXP_USE_GENERATIONAL_GC
+      if (r->size > max_free) max_free = r->size;
+#endif
+      p = (sexp) (((char*)p) + r->size);
+      continue;
+    }
+    size = sexp_heap_align(sexp_allocated_bytes(ctx, p));
+#if SEXP_USE_DEBUG_GC
+    if (!sexp_valid_object_p(ctx, p))
+      fprintf(stderr, SEXP_BANNER("%p sweep: invalid object at %p"), ctx, p);
+    if ((char*)q + q->size > (char*)p)
+      fprintf(stderr, SEXP_BANNER("%p sweep: bad size at %p < %p + %lu"),
+              ctx, p, q, q->size);
+    if (r && ((char*)p)+size > (char*)r)
+      fprintf(stderr, SEXP_BANNER("%p sweep: bad size at %p + %lu > %p"),
+              ctx, p, size, r);
+#endif
+    if (!sexp_markedp(p)) {
+      /* free p */
+      *sum_freed += size;
+      if (((((char*)q) + q->size) == (char*)p) && (q != h->free_list)) {
+        /* merge q with p */
+        if (r && r->size && ((((char*)p)+size) == (char*)r)) {
+          /* ... and with r */
+          q->next = r->next;
+          freed = q->size + size + r->size;
+          p = (sexp) (((char*)p) + size + r->size);
+        } else {
+          freed = q->size + size;
+          p = (sexp) (((char*)p)+size);
+        }
+        q->size = freed;
+      } else {
+        s = (sexp_free_list)p;
+        if (r && r->size && ((((char*)p)+size) == (char*)r)) {
+          /* merge p with r */
+          s->size = size + r->size;
+          s->next = r->next;
+          q->next = s;
+          freed = size + r->size;
+        } else {
+          s->size = size;
+          s->next = r;
+          q->next = s;
+          freed = size;
+        }
+        p = (sexp) (((char*)p)+freed);
+      }
+      if (freed > max_freed)
+        max_freed = freed;
+    } else {
+      if (!stickyp) sexp_markedp(p) = 0;
+      p = (sexp) (((char*)p)+size);
+    }
+  }
+  sexp_build_size_classes(h);
+#if SEXP_USE_GENERATIONAL_GC
+  h->max_free = max_free > max_freed ? max_free : max_freed;
+#endif
+  return max_freed;
+}
+
+#if SEXP_USE_PARALLEL_GC
+static void sexp_sweep_task (sexp_mark_worker w) {
+  sexp_heap h;
+  size_t freed;
+  while ((h = sexp_claim_chunk(w->pool))) {
+#if SEXP_USE_LAZY_SWEEP
+    if (w->pool->unswept_only && !h->unsweptp)
+      continue;
+#endif
+    freed = sexp_sweep_chunk(w->pool->ctx, h, &w->sum_freed);
+    if (freed > w->max_freed)
+      w->max_freed = freed;
+  }
+}
+
+/* sweep the chunks from h up to stop on the marking threads, */
+/* skipping any already swept if unswept_only is set */
+static size_t sexp_parallel_sweep (sexp ctx, sexp_heap h, sexp_heap stop,
+                                   int unswept_only, size_t *sum_freed) {
+  sexp_mark_pool pool = sexp_context_heap(ctx)->mark_pool;
+  sexp_mark_worker w;
+  size_t max_freed = 0;
+  int i;
+  pool->next_chunk = h;
+  pool->stop_chunk = stop;
+  pool->unswept_only = unswept_only;
+  sexp_run_mark_pool(ctx, pool, sexp_sweep_task);
+  for (i=0; i<pool->num_workers; i++) {
+    w = &pool->workers[i];
+    *sum_freed += w->sum_freed;
+    if (w->max_freed > max_freed)
+      max_freed = w->max_freed;
+    w->sum_freed = w->max_freed = 0;
+  }
+  return max_freed;
+}
+#endif
+
+static size_t sexp_heap_free_size (sexp_heap h) {
+  size_t res = 0;
+  sexp_free_list q;
+#if SEXP_USE_SIZE_CLASSES
+  sexp_uint_t i;
+  sexp p;
+  for (i=0; i<SEXP_SIZE_CLASSES; i++)
+    for (p=h->size_classes[i]; p; p=sexp_free_cell_next(p))
+      res += (i+1)*sexp_heap_align(1);
+#endif
+  for (q=h->free_list; q; q=q->next)
+    res += q->size;
+  return res;
+}
+
+#if ! SEXP_USE_GLOBAL_HEAP
+static int sexp_chunk_emptyp (sexp_heap h) {
+  sexp_free_list q = h->free_list->next;
+  return q && (sexp)q == sexp_heap_first_block(h) && ! q->next
+    && q->size == h->size - sexp_heap_align(sexp_free_chunk_size);
+}
+
+/* Once every chunk has been swept, give back to the OS the chunks */
+/* which have been found completely free by delay full sweeps in a */
+/* row, as long as the live data would still fill no more than */
+/* SEXP_SHRINK_HEAP_RATIO of the chunks left, so that we don't have */
+/* to grow again right away.  The first chunk, holding the state of */
+/* the whole heap, is always kept, as is the nursery.  With mmap'ed */
+/* heaps the pages of empty chunks we keep are released instead. */
+static void sexp_shrink_heap (sexp ctx, int delay) {
+  sexp_heap h = sexp_context_heap(ctx), c, prev, next;
+  size_t total_size, live_size;
+#if SEXP_USE_MMAP_GC && defined(MADV_DONTNEED)
+  char *start, *end;
+  sexp_uint_t page = sysconf(_SC_PAGESIZE);
+#endif
+#if SEXP_USE_LAZY_SWEEP
+  for (c=h; c; c=c->next)
+    if (c->unsweptp)
+      return;
+#endif
+  total_size = sexp_heap_total_size(h);
+  for (live_size=total_size, c=h; c; c=c->next)
+    live_size -= sexp_heap_free_size(c);
+  for (prev=h, c=h->next; c; c=next) {
+    next = c->next;
+#if SEXP_USE_GENERATIONAL_GC
+    if (c == h->nursery) {
+      prev = c;
+      continue;
+    }
+#endif
+    if (! sexp_chunk_emptyp(c)) {
+      c->empty_sweeps = c->releasedp = 0;
+      prev = c;
+      continue;
+    }
+    if (c->empty_sweeps < delay) c->empty_sweeps++;
+    if (c->empty_sweeps >= delay
+        && live_size <= ((total_size - c->size) * SEXP_SHRINK_HEAP_RATIO
+                         * h->grow_ratio / SEXP_GROW_HEAP_RATIO)) {
+      sexp_debug_printf("%p releasing chunk %p (size: %lu)", ctx, c, c->size);
+      prev->next = next;
+      total_size -= c->size;
+      h->released_chunks++;
+      if (! c->releasedp) h->released_bytes += c->size;
+      sexp_free_heap(c);
+      continue;
+    }
+#if SEXP_USE_MMAP_GC && defined(MADV_DONTNEED)
+    /* keep the free block header, the rest reads back as zeros */
+    start = (char*) (((sexp_uint_t)sexp_heap_first_block(c)
+                      + sexp_free_chunk_size + page - 1) / page * page);
+    end = (char*) (((sexp_uint_t)sexp_heap_end(c)) / page * page);
+    if (c->empty_sweeps >= delay && ! c->releasedp && end > start
+        && madvise(start, end - start, MADV_DONTNEED) == 0) {
+      c->releasedp = 1;
+      h->released_bytes += end - start;
+    }
+#endif
+    prev = c;
+  }
+}
+#else
+#define sexp_shrink_heap(ctx, delay)
+#endif
+
+#if SEXP_USE_COMPACT_GC
+/* Once every chunk has been swept, request a compaction if too */
+/* much of the heap is free but outside the largest free block of */
+/* its chunk, leaving it usable only for smaller objects.  So that */
+/* a heap kept fragmented by pinned objects isn't compacted over */
+/* and over, it must also have grown since the last compaction. */
+static void sexp_check_fragmentation (sexp ctx) {
+  sexp_heap h = sexp_context_heap(ctx), c;
+  sexp_free_list q;
+  size_t total_size = sexp_heap_total_size(h), frag = 0, sum, max;
+#if SEXP_USE_SIZE_CLASSES
+  sexp p;
+  int i;
+#endif
+  if (total_size <= h->compact_size)
+    return;
+#if SEXP_USE_LAZY_SWEEP
+  for (c=h; c; c=c->next)
+    if (c->unsweptp)
+      return;
+#endif
+  for (c=h; c; c=c->next) {
+    for (sum=max=0, q=c->free_list->next; q; q=q->next) {
+      sum += q->size;
+      if (q->size > max) max = q->size;
+    }
+    frag += sum - max;
+#if SEXP_USE_SIZE_CLASSES
+    for (i=0; i<SEXP_SIZE_CLASSES; i++)
+      for (p=c->size_classes[i]; p; p=sexp_free_cell_next(p))
+        frag += (i+1)*sexp_heap_align(1);
+#endif
+  }
+  if (frag*100 > total_size*SEXP_COMPACT_THRESHOLD)
+    h->gc_requested = 1;
+}
+#else
+#define sexp_check_fragmentation(ctx)
+#endif
+
+/* sweep the chunks from h up to stop, in parallel when there's */
+/* more than one and the marking threads have been started */
+static sexp sexp_sweep_chunks (sexp ctx, sexp_heap h, sexp_heap stop,
+                               size_t *sum_freed_ptr) {
+  size_t freed, max_freed=0, sum_freed=0;
+#if SEXP_USE_TIME_GC
+  sexp_uint_t start = sexp_usecs();
+#endif
+#if SEXP_USE_PARALLEL_GC
+  if (sexp_context_heap(ctx)->mark_pool && h != stop && h->next != stop)
+    max_freed = sexp_parallel_sweep(ctx, h, stop, 0, &sum_freed);
+  else
+#endif
+  for ( ; h != stop; h=h->next) {
+    freed = sexp_sweep_chunk(ctx, h, &sum_freed);
+    if (freed > max_freed)
+      max_freed = freed;
+  }
+#if SEXP_USE_TIME_GC
+  sexp_record_sweep(ctx, start);
+#endif
+  sexp_check_fragmentation(ctx);
+  if (sum_freed_ptr) *sum_freed_ptr = sum_freed;
+  return sexp_make_fixnum(max_freed);
+}
+
+sexp sexp_sweep (sexp ctx, size_t *sum_freed_ptr) {
+  sexp res = sexp_sweep_chunks(ctx, sexp_context_heap(ctx), NULL, sum_freed_ptr);
+  sexp_shrink_heap(ctx, SEXP_SHRINK_HEAP_DELAY);
+  return res;
+}
+
+#if SEXP_USE_LAZY_SWEEP
+/* the chunk's finalizers have already run when marking finished */
+static void sexp_lazy_sweep_chunk (sexp ctx, sexp_heap h) {
+  sexp_sweep_chunks(ctx, h, h->next, NULL);
+}
+
+/* sweep whatever the allocator hasn't since the last sexp_lazy_gc */
+void sexp_finish_sweep (sexp ctx) {
+  sexp_heap h;
+  int swept = 0;
+#if SEXP_USE_PARALLEL_GC
+  size_t sum_freed = 0;
+  int unswept = 0;
+#if SEXP_USE_TIME_GC
+  sexp_uint_t start;
+#endif
+  if (sexp_context_heap(ctx)->mark_pool) {
+    for (h=sexp_context_heap(ctx); h; h=h->next)
+      unswept += h->unsweptp;
+    if (unswept > 1) {
+#if SEXP_USE_TIME_GC
+      start = sexp_usecs();
+#endif
+      sexp_parallel_sweep(ctx, sexp_context_heap(ctx), NULL, 1, &sum_freed);
+#if SEXP_USE_TIME_GC
+      sexp_record_sweep(ctx, start);
+#endif
+      sexp_check_fragmentation(ctx);
+      sexp_shrink_heap(ctx, SEXP_SHRINK_HEAP_DELAY);
+      return;
+    }
+  }
+#endif
+  for (h=sexp_context_heap(ctx); h; h=h->next)
+    if (h->unsweptp) {
+      sexp_lazy_sweep_chunk(ctx, h);
+      swept = 1;
+    }
+  if (swept)
+    sexp_shrink_heap(ctx, SEXP_SHRINK_HEAP_DELAY);
+}
+
+#define sexp_ensure_swept(ctx, h) \
+  do {if ((h)->unsweptp) sexp_lazy_sweep_chunk(ctx, h);} while (0)
+#else
+#define sexp_ensure_swept(ctx, h)
+#endif
+
+#if SEXP_USE_GLOBAL_SYMBOLS
+void sexp_mark_global_symbols(sexp ctx) {
+  int i;
+  for (i=0; i<SEXP_SYMBOL_TABLE_SIZE; i++)
+    sexp_mark(ctx, sexp_symbol_table[i]);
+}
+#else
+#define sexp_mark_global_symbols(ctx)
+#endif
+
+#if SEXP_USE_GENERATIONAL_GC
+
+/* clear the sticky marks, making every object young again, or if */
+/* youngp is set adding the young objects to the remembered set */
+static void sexp_unmark_chunks (sexp ctx, int youngp) {
+  sexp_heap h = sexp_context_heap(ctx);
+  sexp_uint_t i;
+  sexp p, end;
+  sexp_free_list q, r;
+  if (!youngp) {
+    for (i=0; i<h->remembered_len; i++)
+      sexp_rememberedp(h->remembered[i]) = 0;
+    h->remembered_len = 0;
+  }
+  for ( ; h; h=h->next) {
+    p = sexp_heap_first_block(h);
+    q = h->free_list;
+    end = sexp_heap_end(h);
+    while (p < end) {
+      for (r=q->next; r && ((char*)r<(char*)p); q=r, r=r->next)
+        ;
+      if ((char*)r == (char*)p) {
+        p = (sexp) (((char*)p) + r->size);
+        continue;
+      }
+      if (youngp && !sexp_markedp(p) && !sexp_rememberedp(p))
+        sexp_remember(ctx, p);
+      sexp_markedp(p) = 0;
+      p = (sexp) (((char*)p)+sexp_heap_align(sexp_allocated_bytes(ctx, p)));
+    }
+  }
+}
+
+void sexp_unmark_heap (sexp ctx) {
+  sexp_unmark_chunks(ctx, 0);
+}
+
+/* the largest block on a chunk's main free list */
+static sexp_free_list sexp_heap_largest_free (sexp_heap h) {
+  sexp_free_list q, res = NULL;
+  for (q=h->free_list->next; q; q=q->next)
+    if (!res || q->size > res->size)
+      res = q;
+  return res;
+}
+
+/* allocate new objects from the chunk with the largest free block, */
+/* or a fresh chunk if none has room for at least half a nursery */
+static void sexp_choose_nursery (sexp ctx) {
+  sexp_heap h = sexp_context_heap(ctx), best = NULL, last = h;
+  sexp_free_list q;
+  size_t best_free = 0;
+  for ( ; h; last=h, h=h->next)
+    if (h->max_free > best_free) {
+      q = sexp_heap_largest_free(h);
+      h->max_free = q ? q->size : 0;
+      if (h->max_free > best_free) {
+        best_free = h->max_free;
+        best = h;
+      }
+    }
+  h = sexp_context_heap(ctx);
+  if (best_free < SEXP_NURSERY_SIZE/2
+      && (!h->max_size
+          || sexp_heap_total_size(h) + SEXP_NURSERY_SIZE <= h->max_size)
+      && (last->next = sexp_make_heap(sexp_heap_align(SEXP_NURSERY_SIZE),
+                                      h->max_size)))
+    best = last->next;
+  h->nursery = best;
+  h->nursery_used = 0;
+}
+
+/* rescan an object reachable from an old one for young children */
+static void sexp_rescan (sexp ctx, sexp x) {
+  if (x && sexp_pointerp(x)) {
+    sexp_markedp(x) = 0;
+    sexp_mark(ctx, x);
+  }
+}
+
+#if SEXP_USE_DEBUG_GC
+/* report old objects pointing to young ones without having gone */
+/* through the write barrier */
+static void sexp_verify_remembered (sexp ctx) {
+  sexp_heap h = sexp_context_heap(ctx);
+  sexp_sint_t i, len;
+  sexp p, t, end, *v;
+  sexp_free_list q, r;
+  for ( ; h; h=h->next) {
+    p = sexp_heap_first_block(h);
+    q = h->free_list;
+    end = sexp_heap_end(h);
+    while (p < end) {
+      for (r=q->next; r && ((char*)r<(char*)p); q=r, r=r->next)
+        ;
+      if ((char*)r == (char*)p) {
+        p = (sexp) (((char*)p) + r->size);
+        continue;
+      }
+      if (sexp_markedp(p) && !sexp_rememberedp(p)
+          && p != sexp_context_globals(ctx)
+          && p != sexp_global(ctx, SEXP_G_TYPES)
+#if ! SEXP_USE_GLOBAL_SYMBOLS
+          && p != sexp_global(ctx, SEXP_G_SYMBOLS)
+#endif
+          ) {
+        t = sexp_object_type(ctx, p);
+        len = sexp_type_num_slots_of_object(t, p);
+        v = (sexp*) ((char*)p + sexp_type_field_base(t));
+        for (i=0; i<len; i++)
+          if (v[i] && sexp_pointerp(v[i]) && !sexp_markedp(v[i]))
+            fprintf(stderr, SEXP_BANNER("%p missing write barrier: %p %s[%ld] -> %p %s"),
+                    ctx, p, sexp_string_data(sexp_object_type_name(ctx, p)), i,
+                    v[i], sexp_string_data(sexp_object_type_name(ctx, v[i])));
+      }
+      p = (sexp) (((char*)p)+sexp_heap_align(sexp_allocated_bytes(ctx, p)));
+    }
+  }
+}
+#else
+#define sexp_verify_remembered(ctx)
+#endif
+
+static void sexp_update_major_size (sexp ctx, size_t sum_freed) {
+  sexp_heap h = sexp_context_heap(ctx);
+  size_t total_size = sexp_heap_total_size(h);
+  h->major_size = 2 * (total_size > sum_freed ? total_size - sum_freed : 0);
+  if (h->major_size < total_size + SEXP_NURSERY_SIZE)
+    h->major_size = total_size + SEXP_NURSERY_SIZE;
+}
+
+/* a full collection which leaves the survivors in the old generation */
+static sexp sexp_major_gc (sexp ctx, size_t *sum_freed) {
+  sexp_heap h = sexp_context_heap(ctx);
+  sexp res, finalized SEXP_NO_WARN_UNUSED;
+  size_t freed;
+  sexp_unmark_heap(ctx);
+  h->promotingp = 1;
+  sexp_mark_global_symbols(ctx);
+  sexp_mark(ctx, ctx);
+  sexp_reset_weak_references(ctx);
+  finalized = sexp_finalize(ctx);
+  res = sexp_sweep(ctx, &freed);
+  h->promotingp = 0;
+  sexp_update_major_size(ctx, freed);
+  sexp_debug_printf("%p major (freed: %lu max_freed: %lu finalized: %lu)", ctx,
+                    freed, sexp_unbox_fixnum(res), sexp_unbox_fixnum(finalized));
+  if (sum_freed) *sum_freed = freed;
+  return res;
+}
+
+/* Collect just the nursery, using the remembered set and the */
+/* structures the C code updates without barriers as roots.  Only */
+/* safe to call from the VM when no C primitive is in progress. */
+sexp sexp_minor_gc (sexp ctx, size_t *sum_freed) {
+  sexp_heap h = sexp_context_heap(ctx), n = h->nursery;
+  sexp_uint_t i, j, len = h->remembered_len;
+  sexp res, x, finalized SEXP_NO_WARN_UNUSED;
+  sexp_free_list q;
+  h->gc_requested = 0;
+  h->nursery_used = 0;
+  if (!n || !h->major_size)
+    return sexp_major_gc(ctx, sum_freed);
+  sexp_verify_remembered(ctx);
+  h->promotingp = 1;
+  for (i=0; i<len; i++)
+    sexp_rescan(ctx, h->remembered[i]);
+  sexp_mark_global_symbols(ctx);
+  sexp_rescan(ctx, ctx);
+  sexp_rescan(ctx, sexp_context_globals(ctx));
+  sexp_rescan(ctx, sexp_global(ctx, SEXP_G_TYPES));
+#if ! SEXP_USE_GLOBAL_SYMBOLS
+  sexp_rescan(ctx, sexp_global(ctx, SEXP_G_SYMBOLS));
+#endif
+  /* any live weak object is old and therefore remembered */
+  for (i=0; i<h->remembered_len; i++)
+    if (sexp_pointer_tag(h->remembered[i]) < sexp_context_num_types(ctx))
+      sexp_reset_weak_object(ctx, h->remembered[i]);
+  finalized = sexp_finalize_chunks(ctx, n, n->next);
+  res = sexp_sweep_chunks(ctx, n, n->next, sum_freed);
+  h->promotingp = 0;
+  /* forget everything but the unbarriered objects */
+  for (i=j=0; i<h->remembered_len; i++) {
+    x = h->remembered[i];
+    if (sexp_unbarrieredp(ctx, x))
+      h->remembered[j++] = x;
+    else
+      sexp_rememberedp(x) = 0;
+  }
+  h->remembered_len = j;
+  sexp_debug_printf("%p minor (freed: %lu max_freed: %lu finalized: %lu)", ctx,
+                    (sum_freed ? *sum_freed : 0), sexp_unbox_fixnum(res),
+                    sexp_unbox_fixnum(finalized));
+  /* the heap also grows by new nurseries between safe points */
+  if (sexp_heap_total_size(h) >= h->major_size)
+    res = sexp_major_gc(ctx, sum_freed);
+  /* retire the nursery once survivors leave no room to bump */
+  /* allocate half a nursery */
+  if (!h->nursery || !(q = sexp_heap_largest_free(h->nursery))
+      || q->size < SEXP_NURSERY_SIZE/2)
+    sexp_choose_nursery(ctx);
+  return res;
+}
+
+#endif
+
+#if SEXP_USE_INCREMENTAL_GC
+
+/* the write barrier, keeps marked objects from pointing to white ones */
+void sexp_shade (sexp ctx, sexp x) {
+  if (sexp_context_heap(ctx)->markingp)
+    sexp_mark_grey(ctx, x);
+}
+
+static void sexp_grey_roots (sexp ctx) {
+#if SEXP_USE_GLOBAL_SYMBOLS
+  int i;
+  for (i=0; i<SEXP_SYMBOL_TABLE_SIZE; i++)
+    sexp_mark_grey(ctx, sexp_symbol_table[i]);
+#endif
+  sexp_mark_grey(ctx, ctx);
+}
+
+#if SEXP_USE_DEBUG_GC
+/* report marked objects pointing to unmarked ones, which the */
+/* barrier or final rescan should have caught */
+static void sexp_verify_marks (sexp ctx) {
+  sexp_heap h = sexp_context_heap(ctx);
+  sexp_sint_t i, len;
+  sexp p, t, end, *v;
+  sexp_free_list q, r;
+  for ( ; h; h=h->next) {
+    p = sexp_heap_first_block(h);
+    q = h->free_list;
+    end = sexp_heap_end(h);
+    while (p < end) {
+      for (r=q->next; r && ((char*)r<(char*)p); q=r, r=r->next)
+        ;
+      if ((char*)r == (char*)p) {
+        p = (sexp) (((char*)p) + r->size);
+        continue;
+      }
+      if (sexp_markedp(p)) {
+        t = sexp_object_type(ctx, p);
+        len = sexp_type_num_slots_of_object(t, p);
+        v = (sexp*) ((char*)p + sexp_type_field_base(t));
+        for (i=0; i<len; i++)
+          if (v[i] && sexp_pointerp(v[i]) && !sexp_markedp(v[i]))
+            fprintf(stderr, SEXP_BANNER("%p missed by incremental mark: %p %s[%ld] -> %p %s"),
+                    ctx, p, sexp_string_data(sexp_object_type_name(ctx, p)), i,
+                    v[i], sexp_string_data(sexp_object_type_name(ctx, v[i])));
+      }
+      p = (sexp) (((char*)p)+sexp_heap_align(sexp_allocated_bytes(ctx, p)));
+    }
+  }
+}
+#else
+#define sexp_verify_marks(ctx)
+#endif
+
+/* The final pause.  Rescan the roots and the objects which C code */
+/* updates without barriers, and finish marking whatever they */
+/* still reach. */
+static void sexp_finish_marking (sexp ctx) {
+  sexp_heap h = sexp_context_heap(ctx);
+  sexp_uint_t i;
+  sexp_grey_roots(ctx);
+  for (i=0; i<h->rescan_len; i++)
+    sexp_scan_slots(ctx, h->rescan[i]);
+  /* if we ran out of memory recording the unbarriered objects, */
+  /* just rescan all of the marked ones */
+  if (h->rescan_overflowp)
+    sexp_rescan_marked(ctx);
+  sexp_scan_slots(ctx, sexp_context_globals(ctx));
+  sexp_scan_slots(ctx, sexp_global(ctx, SEXP_G_TYPES));
+#if ! SEXP_USE_GLOBAL_SYMBOLS
+  sexp_scan_slots(ctx, sexp_global(ctx, SEXP_G_SYMBOLS));
+#endif
+  sexp_drain_mark_stack(ctx, 0);
+  h->markingp = 0;
+  h->rescan_len = h->mark_debt = 0;
+  h->rescan_overflowp = 0;
+  sexp_verify_marks(ctx);
+}
+
+/* start the next collection once half of the free space is used */
+static void sexp_update_mark_threshold (sexp ctx) {
+  sexp_heap h = sexp_context_heap(ctx);
+  size_t total_size = sexp_heap_total_size(h);
+  h->allocated = 0;
+  h->gc_requested = 0;
+  h->mark_threshold
+    = (total_size > h->live_size) ? (total_size - h->live_size) / 2 : 0;
+}
+
+/* One step of an incremental collection, requested by the */
+/* allocator and run from a VM safe point.  Each allocation made */
+/* while marking adds mark_budget words of work to be done here. */
+/* Before marking can start, any chunks left unswept by the last */
+/* collection are swept, one per step. */
+void sexp_mark_step (sexp ctx) {
+  sexp_heap h = sexp_context_heap(ctx);
+  sexp_uint_t budget;
+#if SEXP_USE_LAZY_SWEEP
+  sexp_heap c;
+#endif
+  h->gc_requested = 0;
+  if (!h->markingp) {
+#if SEXP_USE_LAZY_SWEEP
+    for (c=h; c; c=c->next)
+      if (c->unsweptp) {
+        sexp_lazy_sweep_chunk(ctx, c);
+        sexp_shrink_heap(ctx, SEXP_SHRINK_HEAP_DELAY);
+        h->gc_requested = 1;
+        return;
+      }
+#endif
+    sexp_debug_printf("%p incremental (heap: %p size: %lu)", ctx, h,
+                      sexp_heap_total_size(h));
+    h->markingp = 1;
+    h->live_size = 0;
+    sexp_grey_roots(ctx);
+  }
+  budget = h->mark_debt > h->mark_budget ? h->mark_debt : h->mark_budget;
+  h->mark_debt = 0;
+  if (sexp_drain_mark_stack(ctx, budget)) {
+    sexp_finish_marking(ctx);
+    sexp_reset_weak_references(ctx);
+#if SEXP_USE_LAZY_SWEEP
+    sexp_finalize(ctx);
+    for (c=h; c; c=c->next)
+      c->unsweptp = 1;
+#else
+    sexp_finalize(ctx);
+    sexp_sweep(ctx, NULL);
+#endif
+    sexp_update_mark_threshold(ctx);
+    sexp_debug_printf("%p incremental (live: %lu)", ctx, h->live_size);
+  }
+}
+
+/* drop a collection in progress, clearing all of the marks */
+void sexp_cancel_marking (sexp ctx) {
+  sexp_heap h = sexp_context_heap(ctx);
+  sexp p, end;
+  sexp_free_list q, r;
+  if (!h->markingp) return;
+  h->markingp = h->gc_requested = 0;
+  h->mark_stack_len = h->rescan_len = h->mark_debt = 0;
+  h->mark_overflowp = h->rescan_overflowp = 0;
+  for ( ; h; h=h->next) {
+    p = sexp_heap_first_block(h);
+    q = h->free_list;
+    end = sexp_heap_end(h);
+    while (p < end) {
+      for (r=q->next; r && ((char*)r<(char*)p); q=r, r=r->next)
+        ;
+      if ((char*)r == (char*)p) {
+        p = (sexp) (((char*)p) + r->size);
+        continue;
+      }
+      sexp_markedp(p) = 0;
+      p = (sexp) (((char*)p)+sexp_heap_align(sexp_allocated_bytes(ctx, p)));
+    }
+  }
+}
+
+#else
+#define sexp_update_mark_threshold(ctx)
+#endif
+
+/* mark everything reachable, completing any incremental collection */
+static void sexp_mark_roots (sexp ctx) {
+#if SEXP_USE_INCREMENTAL_GC
+  if (sexp_context_heap(ctx)->markingp) {
+    sexp_finish_marking(ctx);
+    return;
+  }
+#endif
+#if SEXP_USE_LAZY_SWEEP || SEXP_USE_INCREMENTAL_GC
+  sexp_context_heap(ctx)->live_size = 0;
+#endif
+  sexp_mark_global_symbols(ctx);
+#if SEXP_USE_PARALLEL_GC
+  sexp_mark_grey(ctx, ctx);
+  sexp_parallel_mark(ctx);
+#else
+  sexp_mark(ctx, ctx);
+#endif
+}
+
+sexp sexp_gc (sexp ctx, size_t *sum_freed) {
+  sexp res, finalized SEXP_NO_WARN_UNUSED;
+#if SEXP_USE_GENERATIONAL_GC
+  sexp_heap h = sexp_context_heap(ctx);
+  sexp_uint_t i, j;
+  size_t freed;
+#endif
+  sexp_debug_printf("%p (heap: %p size: %lu)", ctx, sexp_context_heap(ctx),
+                    sexp_heap_total_size(sexp_context_heap(ctx)));
+#if SEXP_USE_LAZY_SWEEP
+  sexp_finish_sweep(ctx);
+#endif
+#if SEXP_USE_GENERATIONAL_GC
+  /* This may run in the middle of a C primitive which isn't using */
+  /* write barriers.  Survivors are promoted, but those which were */
+  /* young, or promoted by an earlier call, stay remembered until */
+  /* the next minor gc, which only runs from the VM once the */
+  /* primitive has returned. */
+  sexp_unmark_chunks(ctx, 1);
+  h->promotingp = 1;
+  h->gc_requested = 0;
+  h->nursery_used = 0;
+#endif
+  sexp_mark_roots(ctx);
+  sexp_conservative_mark(ctx);
   sexp_reset_weak_references(ctx);
+#if SEXP_USE_GENERATIONAL_GC
+  /* forget the remembered objects which didn't survive */
+  for (i=j=0; i<h->remembered_len; i++)
+    if (sexp_markedp(h->remembered[i]))
+      h->remembered[j++] = h->remembered[i];
+  h->remembered_len = j;
+#endif
   finalized = sexp_finalize(ctx);
+#if SEXP_USE_GENERATIONAL_GC
+  res = sexp_sweep(ctx, &freed);
+  h->promotingp = 0;
+  sexp_update_major_size(ctx, freed);
+  if (sum_freed) *sum_freed = freed;
+#else
   res = sexp_sweep(ctx, sum_freed);
+#endif
+  sexp_update_mark_threshold(ctx);
   sexp_debug_printf("%p (freed: %lu max_freed: %lu finalized: %lu)", ctx,
                     (sum_freed ? *sum_freed : 0), sexp_unbox_fixnum(res),
                     sexp_unbox_fixnum(finalized));
   return res;
 }
 
+#if SEXP_USE_LAZY_SWEEP
+/* Mark and finalize, leaving each chunk to be swept the next time */
+/* we try to allocate from it.  Finalizers may read objects in other */
+/* chunks, e.g. a port's fileno, so they all run before any chunk is */
+/* swept and its memory reused.  The amount freed is estimated from */
+/* the size of the live data - we don't know the largest free block */
+/* until everything has been swept. */
+static sexp sexp_lazy_gc (sexp ctx, size_t *sum_freed) {
+  sexp_heap h = sexp_context_heap(ctx);
+  size_t total_size, freed;
+  sexp_debug_printf("%p lazy (heap: %p size: %lu)", ctx, h,
+                    sexp_heap_total_size(h));
+  sexp_finish_sweep(ctx);
+  sexp_mark_roots(ctx);
+  sexp_reset_weak_references(ctx);
+  sexp_finalize(ctx);
+  for ( ; h; h=h->next)
+    h->unsweptp = 1;
+  h = sexp_context_heap(ctx);
+  sexp_update_mark_threshold(ctx);
+  total_size = sexp_heap_total_size(h);
+  freed = (total_size > h->live_size) ? total_size - h->live_size : 0;
+  if (sum_freed) *sum_freed = freed;
+  sexp_debug_printf("%p lazy (live: %lu)", ctx, h->live_size);
+  return sexp_make_fixnum(freed);
+}
+#else
+#define sexp_lazy_gc sexp_gc
+#endif
+
 sexp_heap sexp_make_heap (size_t size, size_t max_size) {
   sexp_free_list free, next;
   sexp_heap h;
@@ -479,14 +1752,69 @@ sexp_heap sexp_make_heap (size_t size, size_t max_size) {
   if (! h) return NULL;
   h->size = size;
   h->max_size = max_size;
+  h->grow_factor = SEXP_GROW_HEAP_FACTOR;
+  h->grow_ratio = SEXP_GROW_HEAP_RATIO;
   h->data = (char*) sexp_heap_align(sizeof(h->data)+(sexp_uint_t)&(h->data));
   free = h->free_list = (sexp_free_list) h->data;
   h->next = NULL;
+  h->mark_stack = NULL;
+  h->mark_stack_len = h->mark_stack_size = 0;
+  h->mark_overflowp = 0;
+#if SEXP_USE_PARALLEL_GC
+  h->mark_pool = NULL;
+  h->mark_threads = SEXP_MARK_THREADS;
+#endif
+#if SEXP_USE_TIME_GC
+  h->sweep_count = h->sweep_usecs = 0;
+#endif
+#if SEXP_USE_COMPACT_GC
+  h->compact_size = size;
+  h->compact_count = h->compact_moved = 0;
+#endif
+#if ! SEXP_USE_GLOBAL_HEAP
+  h->empty_sweeps = h->releasedp = 0;
+  h->released_chunks = h->released_bytes = 0;
+#endif
+#if SEXP_USE_IMAGE_LOADING
+  h->mappedp = 0;
+#endif
+#if SEXP_USE_SIZE_CLASSES
+  memset(h->size_classes, 0, sizeof(h->size_classes));
+#endif
+#if SEXP_USE_GENERATIONAL_GC
+  h->nursery = NULL;
+  h->bump = NULL;
+  h->remembered = NULL;
+  h->remembered_len = h->remembered_size = h->major_size = h->nursery_used = 0;
+  h->promotingp = 0;
+#endif
+#if SEXP_USE_GC_SAFEPOINTS
+  h->vm_depth = h->gc_requested = 0;
+#endif
+#if SEXP_USE_INCREMENTAL_GC
+  h->rescan = NULL;
+  h->rescan_len = h->rescan_size = 0;
+  h->rescan_overflowp = 0;
+  h->mark_budget = SEXP_MARK_BUDGET;
+  h->mark_debt = 0;
+  h->mark_threshold = size/2;
+  h->allocated = 0;
+  h->markingp = 0;
+#endif
+#if SEXP_USE_LAZY_SWEEP
+  h->unsweptp = 0;
+#endif
+#if SEXP_USE_LAZY_SWEEP || SEXP_USE_INCREMENTAL_GC
+  h->live_size = 0;
+#endif
   next = (sexp_free_list) (((char*)free)+sexp_heap_align(sexp_free_chunk_size));
   free->size = 0; /* actually sexp_heap_align(sexp_free_chunk_size) */
   free->next = next;
   next->size = size - sexp_heap_align(sexp_free_chunk_size);
   next->next = NULL;
+#if SEXP_USE_GENERATIONAL_GC
+  h->max_free = next->size;
+#endif
 #if SEXP_USE_DEBUG_GC
   fprintf(stderr, SEXP_BANNER("heap: %p-%p data: %p-%p"),
           h, ((char*)h)+sexp_heap_pad_size(size), h->data, h->data + size);
@@ -500,55 +1828,155 @@ sexp_heap sexp_make_heap (size_t size, size_t max_size) {
 
 int sexp_grow_heap (sexp ctx, size_t size) {
   size_t cur_size, new_size;
+  double factor = sexp_context_heap(ctx)->grow_factor;
   sexp_heap h = sexp_heap_last(sexp_context_heap(ctx));
   cur_size = h->size;
-  new_size = sexp_heap_align(((cur_size > size) ? cur_size : size) * 2);
-  h->next = sexp_make_heap(new_size, h->max_size);
+  new_size = sexp_heap_align((size_t)(((cur_size > size) ? cur_size : size) * factor));
+  if (new_size < size) new_size = sexp_heap_align(size);
+  h->next = sexp_make_heap(new_size, sexp_context_heap(ctx)->max_size);
   return (h->next != NULL);
 }
 
-void* sexp_try_alloc (sexp ctx, size_t size) {
+static void* sexp_try_alloc_chunk (sexp_heap h, size_t size) {
   sexp_free_list ls1, ls2, ls3;
-  sexp_heap h;
-  for (h=sexp_context_heap(ctx); h; h=h->next)
-    for (ls1=h->free_list, ls2=ls1->next; ls2; ls1=ls2, ls2=ls2->next)
-      if (ls2->size >= size) {
+  for (ls1=h->free_list, ls2=ls1->next; ls2; ls1=ls2, ls2=ls2->next)
+    if (ls2->size >= size) {
 #if SEXP_USE_DEBUG_GC
-        ls3 = (sexp_free_list) sexp_heap_end(h);
-        if (ls2 >= ls3)
-          fprintf(stderr, "alloced %lu bytes past end of heap: %p (%lu) >= %p"
-                  " next: %p (%lu)\n", size, ls2, ls2->size, ls3, ls2->next,
-                  (ls2->next ? ls2->next->size : 0));
-#endif
-        if (ls2->size >= (size + SEXP_MINIMUM_OBJECT_SIZE)) {
-          ls3 = (sexp_free_list) (((char*)ls2)+size); /* the tail after ls2 */
-          ls3->size = ls2->size - size;
-          ls3->next = ls2->next;
-          ls1->next = ls3;
-        } else {                  /* take the whole chunk */
-          ls1->next = ls2->next;
-        }
-        memset((void*)ls2, 0, size);
-        return ls2;
+      ls3 = (sexp_free_list) sexp_heap_end(h);
+      if (ls2 >= ls3)
+        fprintf(stderr, "alloced %lu bytes past end of heap: %p (%lu) >= %p"
+                " next: %p (%lu)\n", size, ls2, ls2->size, ls3, ls2->next,
+                (ls2->next ? ls2->next->size : 0));
+#endif
+#if SEXP_USE_GENERATIONAL_GC
+      if (ls2 == h->bump) h->bump = NULL;
+#endif
+#if SEXP_USE_SIZE_CLASSES
+      /* don't leave small tails on the main list for first-fit to wade */
+      /* through, they'd never be large enough for anything reaching it */
+      if (ls2->size >= (size + SEXP_MINIMUM_OBJECT_SIZE)
+          && ls2->size - size <= sexp_heap_align(1)*SEXP_SIZE_CLASSES) {
+        ls1->next = ls2->next;
+        sexp_push_free_cell(h, (sexp)(((char*)ls2)+size), ls2->size - size);
+      } else
+#endif
+      if (ls2->size >= (size + SEXP_MINIMUM_OBJECT_SIZE)) {
+        ls3 = (sexp_free_list) (((char*)ls2)+size); /* the tail after ls2 */
+        ls3->size = ls2->size - size;
+        ls3->next = ls2->next;
+        ls1->next = ls3;
+      } else {                  /* take the whole chunk */
+        ls1->next = ls2->next;
       }
+      memset((void*)ls2, 0, size);
+      return ls2;
+    }
+  return NULL;
+}
+
+#if SEXP_USE_SIZE_CLASSES
+#define sexp_size_classp(size) \
+  ((size) <= sexp_heap_align(1)*SEXP_SIZE_CLASSES && (size) == sexp_heap_align(size))
+#endif
+
+void* sexp_try_alloc (sexp ctx, size_t size) {
+  sexp_heap h;
+  void *res;
+#if SEXP_USE_SIZE_CLASSES
+  if (sexp_size_classp(size))
+    for (h=sexp_context_heap(ctx); h; h=h->next) {
+      sexp_ensure_swept(ctx, h);
+      if ((res = sexp_try_alloc_size_class(h, size)))
+        return res;
+    }
+#endif
+  for (h=sexp_context_heap(ctx); h; h=h->next) {
+    sexp_ensure_swept(ctx, h);
+    if ((res = sexp_try_alloc_chunk(h, size)))
+      return res;
+  }
   return NULL;
 }
 
+#if SEXP_USE_GENERATIONAL_GC
+/* Small objects are bump allocated downwards from the end of the */
+/* largest free block in the nursery, which stays on the free list */
+/* so sweeps and heap walks see the unused part as free.  Once it's */
+/* used up we move on to the next largest, leaving blocks smaller */
+/* than 1/8th of a nursery to the old generation.  A minor gc is */
+/* requested from the VM once 3/4 of the nursery has been used.  If */
+/* the VM doesn't reach a safe point before it's full, e.g. while */
+/* compiling or loading, we move on to another nursery, first */
+/* running a full gc if the heap has grown enough for a major one. */
+static void* sexp_try_alloc_young (sexp ctx, size_t size) {
+  sexp_heap h = sexp_context_heap(ctx), n;
+  sexp_free_list q;
+  void *res;
+  if (size > SEXP_NURSERY_SIZE/8 || h->nursery_used >= SEXP_NURSERY_SIZE)
+    return NULL;
+  if (!h->nursery) {
+    sexp_choose_nursery(ctx);
+    sexp_update_major_size(ctx, 0);
+    if (!h->nursery) return NULL;
+  }
+  n = h->nursery;
+  q = n->bump;
+  if (!q || q->size < size + SEXP_MINIMUM_OBJECT_SIZE) {
+    q = n->bump = sexp_heap_largest_free(n);
+    if (!q || q->size < SEXP_NURSERY_SIZE/8 + SEXP_MINIMUM_OBJECT_SIZE) {
+      n->bump = NULL;
+      if (sexp_heap_total_size(h) >= h->major_size)
+        sexp_gc(ctx, NULL);
+      sexp_choose_nursery(ctx);
+      if (!(n = h->nursery) || !(q = n->bump = sexp_heap_largest_free(n))
+          || q->size < SEXP_NURSERY_SIZE/8 + SEXP_MINIMUM_OBJECT_SIZE) {
+        /* no room for a nursery, a minor gc wouldn't free any */
+        h->nursery_used = SEXP_NURSERY_SIZE;
+        return NULL;
+      }
+    }
+  }
+  q->size -= size;
+  res = (char*)q + q->size;
+  memset(res, 0, size);
+  if ((h->nursery_used += size) > SEXP_NURSERY_SIZE/4*3)
+    h->gc_requested = 1;
+  return res;
+}
+#endif
+
 void* sexp_alloc (sexp ctx, size_t size) {
   void *res;
   size_t max_freed, sum_freed, total_size;
   sexp_heap h = sexp_context_heap(ctx);
   size = sexp_heap_align(size) + SEXP_GC_PAD;
+#if SEXP_USE_GENERATIONAL_GC
+  if ((res = sexp_try_alloc_young(ctx, size)))
+    return res;
+#endif
+#if SEXP_USE_INCREMENTAL_GC
+  if (h->markingp) {
+    h->mark_debt += h->mark_budget;
+    h->gc_requested = 1;
+  } else if ((h->allocated += size) > h->mark_threshold) {
+    h->gc_requested = 1;
+  }
+#endif
   res = sexp_try_alloc(ctx, size);
   if (! res) {
-    max_freed = sexp_unbox_fixnum(sexp_gc(ctx, &sum_freed));
+    max_freed = sexp_unbox_fixnum(sexp_lazy_gc(ctx, &sum_freed));
     total_size = sexp_heap_total_size(sexp_context_heap(ctx));
     if (((max_freed < size)
          || ((total_size > sum_freed)
-             && (total_size - sum_freed) > (total_size*SEXP_GROW_HEAP_RATIO)))
+             && (total_size - sum_freed) > (total_size*h->grow_ratio)))
         && ((!h->max_size) || (total_size < h->max_size)))
       sexp_grow_heap(ctx, size);
     res = sexp_try_alloc(ctx, size);
+    /* max_freed was only an estimate with lazy sweeping, and the */
+    /* largest block may have been in a chunk we just released */
+    if (! res && ((!h->max_size) || (total_size < h->max_size))
+        && sexp_grow_heap(ctx, size))
+      res = sexp_try_alloc(ctx, size);
     if (! res) {
       res = sexp_global(ctx, SEXP_G_OOM_ERROR);
       sexp_debug_printf("ran out of memory allocating %lu bytes => %p", size, res);
@@ -557,15 +1985,472 @@ void* sexp_alloc (sexp ctx, size_t size) {
   return res;
 }
 
-#if ! SEXP_USE_GLOBAL_HEAP
+#if ! SEXP_USE_GLOBAL_HEAP || SEXP_USE_COMPACT_GC
 
-void sexp_offset_heap_pointers (sexp_heap heap, sexp_heap from_heap, sexp* types, sexp flags) {
-  sexp_sint_t i, off, len, freep, loadp;
+/* Pointers are relocated in the same way when loading a heap */
+/* image, where every pointer is offset by the same amount, and */
+/* when compacting, where each moved object has its own address. */
+typedef sexp (*sexp_relocate_proc) (sexp x, void *data);
+
+#define sexp_relocate(x, move, data) \
+  do {if ((x) && sexp_pointerp(x)) (x) = move(x, data);} while (0)
+
+static void sexp_relocate_slots (sexp t, sexp p, sexp_relocate_proc move,
+                                 void *data) {
+  sexp_sint_t i, len = sexp_type_num_slots_of_object(t, p);
+  sexp *v = (sexp*) ((char*)p + sexp_type_field_base(t));
+  for (i=0; i<len; i++)
+    sexp_relocate(v[i], move, data);
+}
+
+/* relocate the objects referenced from the operands of bytecode p */
+static void sexp_relocate_bytecode (sexp p, sexp_relocate_proc move,
+                                    void *data) {
+  sexp_sint_t i;
+  sexp *v;
+  for (i=0; i<sexp_bytecode_length(p); ) {
+    switch (sexp_bytecode_data(p)[i++]) {
+      case SEXP_OP_FCALL0:      case SEXP_OP_FCALL1:
+      case SEXP_OP_FCALL2:      case SEXP_OP_FCALL3:
+      case SEXP_OP_FCALL4:      case SEXP_OP_CALL:
+      case SEXP_OP_TAIL_CALL:   case SEXP_OP_PUSH:
+      case SEXP_OP_GLOBAL_REF:  case SEXP_OP_GLOBAL_KNOWN_REF:
+#if SEXP_USE_GREEN_THREADS
+      case SEXP_OP_PARAMETER_REF:
+#endif
+#if SEXP_USE_EXTENDED_FCALL
+      case SEXP_OP_FCALLN:
+#endif
+        v = (sexp*)(&(sexp_bytecode_data(p)[i]));
+        sexp_relocate(v[0], move, data);
+        /* ... FALLTHROUGH ... */
+      case SEXP_OP_JUMP:        case SEXP_OP_JUMP_UNLESS:
+      case SEXP_OP_LT_JUMP_UNLESS:    case SEXP_OP_LE_JUMP_UNLESS:
+      case SEXP_OP_EQN_JUMP_UNLESS:   case SEXP_OP_EQ_JUMP_UNLESS:
+      case SEXP_OP_NULLP_JUMP_UNLESS: case SEXP_OP_PAIRP_JUMP_UNLESS:
+      case SEXP_OP_STACK_REF:   case SEXP_OP_CLOSURE_REF:
+      case SEXP_OP_LOCAL_REF:   case SEXP_OP_LOCAL_SET:
+      case SEXP_OP_TYPEP:
+      case SEXP_OP_LOCAL_REF_CAR:   case SEXP_OP_LOCAL_REF_CDR:
+      case SEXP_OP_CLOSURE_REF_CDR:
+#if SEXP_USE_RESERVE_OPCODE
+      case SEXP_OP_RESERVE:
+#endif
+        i += sizeof(sexp); break;
+      case SEXP_OP_GLOBAL_KNOWN_CALL:
+        v = (sexp*)(&(sexp_bytecode_data(p)[i]));
+        sexp_relocate(v[0], move, data);
+        sexp_relocate(v[2], move, data);
+        i += 3*sizeof(sexp); break;
+      case SEXP_OP_MAKE: case SEXP_OP_SLOT_REF: case SEXP_OP_SLOT_SET:
+      case SEXP_OP_LOCAL_REF_JUMP_UNLESS: case SEXP_OP_FLONUM_ARITH:
+        i += 2*sizeof(sexp); break;
+      case SEXP_OP_MAKE_PROCEDURE:
+        v = (sexp*)(&(sexp_bytecode_data(p)[i]));
+        sexp_relocate(v[2], move, data);
+        i += 3*sizeof(sexp); break;
+    }
+  }
+}
+
+#endif
+
+#if SEXP_USE_COMPACT_GC
+
+/* Compaction starts from a full collection, after which everything */
+/* left in the heap is live, and slides the objects which may move */
+/* towards the start of the first chunk, in heap order, around the */
+/* pinned ones, which are flagged with the mark bit.  An object */
+/* only ever moves down in heap order, so once all pointers have */
+/* been updated the objects can be moved in that same order without */
+/* overwriting any not yet moved.  The old and new addresses of */
+/* each moved object are kept in a table on the side, sorted within */
+/* each chunk, and the gaps left before pinned objects and at the */
+/* end of the heap become the new free lists. */
+
+typedef struct sexp_compactor_t *sexp_compactor;
+struct sexp_compactor_t {
+  sexp ctx;
+  sexp *pinned, *moves, *gaps, *interior;
+  sexp_uint_t pinned_len, pinned_size, moves_len, moves_size,
+    gaps_len, gaps_size, interior_len, interior_size, next_pin;
+  sexp_uint_t *chunk_moves;     /* index of each chunk's first move */
+  sexp_heap dest_chunk;
+  char *dest;
+  size_t moved;
+  int failedp;
+};
+
+typedef void (*sexp_compact_proc) (sexp_compactor c, sexp p, size_t size);
+
+/* call proc on every object in chunk h, skipping free blocks */
+static void sexp_compact_chunk (sexp_compactor c, sexp_heap h,
+                                sexp_compact_proc proc) {
+  size_t size;
+  sexp p, end;
+  sexp_free_list q, r;
+  p = sexp_heap_first_block(h);
+  q = h->free_list;
+  end = sexp_heap_end(h);
+  while (p < end) {
+    for (r=q->next; r && ((char*)r<(char*)p); q=r, r=r->next)
+      ;
+    if ((char*)r == (char*)p) {
+      p = (sexp) (((char*)p) + r->size);
+      continue;
+    }
+    size = sexp_heap_align(sexp_allocated_bytes(c->ctx, p));
+    if (! sexp_free_cellp(p))
+      proc(c, p, size);
+    p = (sexp) (((char*)p)+size);
+  }
+}
+
+static void sexp_compact_heap (sexp_compactor c, sexp_compact_proc proc) {
+  sexp_heap h;
+  for (h=sexp_context_heap(c->ctx); h; h=h->next)
+    sexp_compact_chunk(c, h, proc);
+}
+
+static int sexp_compact_in_heap_p (sexp_compactor c, sexp x) {
+  sexp_heap h;
+  for (h=sexp_context_heap(c->ctx); h; h=h->next)
+    if ((char*)x >= h->data && (char*)x < (char*)sexp_heap_end(h))
+      return 1;
+  return 0;
+}
+
+static void sexp_compact_pin (sexp_compactor c, sexp x) {
+  if (x && sexp_pointerp(x) && sexp_compact_in_heap_p(c, x))
+    sexp_markedp(x) = 1;
+}
+
+/* objects which C code may refer to directly, or through pointers */
+/* into them which we can't relocate */
+static int sexp_compact_pinnedp (sexp ctx, sexp x) {
+  sexp t;
+  switch (sexp_pointer_tag(x)) {
+  case SEXP_TYPE: case SEXP_OPCODE: case SEXP_ENV: case SEXP_BYTECODE:
+  case SEXP_STACK: case SEXP_CONTEXT: case SEXP_CPOINTER: case SEXP_CORE:
+  case SEXP_IPORT: case SEXP_OPORT: case SEXP_FILENO:
+#if SEXP_USE_DL
+  case SEXP_DL:
+#endif
+    return 1;
+  }
+  t = sexp_object_type(ctx, x);
+  return sexp_type_finalize(t)
+    || (sexp_pointer_tag(x) >= SEXP_NUM_CORE_TYPES
+        && ! sexp_pairp(sexp_type_slots(t)));
+}
+
+static void sexp_compact_pin_object (sexp_compactor c, sexp p, size_t size) {
+  sexp x;
+  if (sexp_compact_pinnedp(c->ctx, p))
+    sexp_markedp(p) = 1;
+  if (sexp_portp(p)) {
+    /* string ports (and fmemopen) read from inside their strings */
+    x = sexp_port_cookie(p);
+    sexp_compact_pin(c, x);
+    if (sexp_port_buf(p)
+        && ! sexp_push_object(&c->interior, &c->interior_len,
+                              &c->interior_size, (sexp)sexp_port_buf(p)))
+      c->failedp = 1;
+    if (sexp_stringp(x) && sexp_compact_in_heap_p(c, x)
+        && ! sexp_push_object(&c->interior, &c->interior_len,
+                              &c->interior_size, (sexp)sexp_string_data(x)))
+      c->failedp = 1;
+  } else if (sexp_cpointerp(p)) {
+    sexp_compact_pin(c, sexp_cpointer_parent(p));
+  }
+}
+
+static int sexp_compact_cmp (const void *a, const void *b) {
+  return (*(char**)a < *(char**)b) ? -1 : (*(char**)a > *(char**)b);
+}
+
+static void sexp_compact_unpin (sexp_compactor c, sexp p, size_t size) {
+  sexp_markedp(p) = 0;
+}
+
+/* pin p if any of the sorted interior pointers fall inside it */
+static void sexp_compact_pin_interior (sexp_compactor c, sexp p, size_t size) {
+  sexp_uint_t lo = 0, hi = c->interior_len, mid;
+  while (lo < hi) {
+    mid = (lo + hi) / 2;
+    if ((char*)c->interior[mid] < (char*)p) lo = mid + 1; else hi = mid;
+  }
+  if (lo < c->interior_len && (char*)c->interior[lo] < (char*)p + size)
+    sexp_markedp(p) = 1;
+}
+
+/* record the free block from start up to end */
+static void sexp_compact_gap (sexp_compactor c, char *start, char *end) {
+  if (end > start
+      && ! (sexp_push_object(&c->gaps, &c->gaps_len, &c->gaps_size, (sexp)start)
+            && sexp_push_object(&c->gaps, &c->gaps_len, &c->gaps_size, (sexp)end)))
+    c->failedp = 1;
+}
+
+/* Return the address to move an object of the given size to, */
+/* advancing the destination past pinned objects and the ends of */
+/* chunks as needed.  Pinned objects are recorded in heap order as */
+/* the objects are visited, and the destination never passes the */
+/* object being placed, so any pinned object in the way is already */
+/* known.  With a size of 0 the rest of the heap is skipped. */
+static char* sexp_compact_place (sexp_compactor c, size_t size) {
+  sexp pin;
+  char *limit, *res;
+  while (c->dest_chunk) {
+    pin = (c->next_pin < c->pinned_len) ? c->pinned[c->next_pin] : NULL;
+    if (pin && (char*)pin >= c->dest
+        && (char*)pin < (char*)sexp_heap_end(c->dest_chunk)) {
+      limit = (char*)pin;
+    } else {
+      pin = NULL;
+      limit = (char*)sexp_heap_end(c->dest_chunk);
+    }
+    if (size && c->dest + size <= limit) {
+      res = c->dest;
+      c->dest += size;
+      return res;
+    }
+    sexp_compact_gap(c, c->dest, limit);
+    if (pin) {
+      c->dest = limit + sexp_heap_align(sexp_allocated_bytes(c->ctx, pin));
+      c->next_pin++;
+    } else if ((c->dest_chunk = c->dest_chunk->next)) {
+      c->dest = (char*)sexp_heap_first_block(c->dest_chunk);
+    }
+  }
+  return NULL;
+}
+
+static void sexp_compact_forward (sexp_compactor c, sexp p, size_t size) {
+  char *to;
+  if (c->failedp) return;
+  if (sexp_markedp(p)) {
+    if (! sexp_push_object(&c->pinned, &c->pinned_len, &c->pinned_size, p))
+      c->failedp = 1;
+  } else if ((to = sexp_compact_place(c, size)) != (char*)p) {
+    if (to
+        && sexp_push_object(&c->moves, &c->moves_len, &c->moves_size, p)
+        && sexp_push_object(&c->moves, &c->moves_len, &c->moves_size, (sexp)to))
+      c->moved += size;
+    else
+      c->failedp = 1;
+  }
+}
+
+/* the new address of x, or x itself if it isn't moving */
+static sexp sexp_compact_lookup (sexp x, void *data) {
+  sexp_compactor c = (sexp_compactor)data;
+  sexp_uint_t i, lo, hi, mid;
+  sexp_heap h;
+  for (i=0, h=sexp_context_heap(c->ctx); h; h=h->next, i++)
+    if ((char*)x >= h->data && (char*)x < (char*)sexp_heap_end(h)) {
+      lo = c->chunk_moves[i];
+      hi = c->chunk_moves[i+1];
+      while (lo < hi) {
+        mid = (lo + hi) / 2;
+        if ((char*)c->moves[mid*2] < (char*)x) lo = mid + 1; else hi = mid;
+      }
+      return (lo < c->chunk_moves[i+1] && c->moves[lo*2] == x)
+        ? c->moves[lo*2+1] : x;
+    }
+  return x;
+}
+
+static void sexp_compact_update (sexp_compactor c, sexp p, size_t size) {
+  sexp t = sexp_object_type(c->ctx, p);
+  struct sexp_gc_var_t *saves;
+#if SEXP_USE_WEAK_REFERENCES
+  sexp_sint_t i, len;
+  sexp *v, *slots;
+#endif
+  sexp_relocate_slots(t, p, sexp_compact_lookup, c);
+#if SEXP_USE_WEAK_REFERENCES
+  if (sexp_type_weak_base(t) > 0) {
+    /* weak slots may overlap the normal ones, don't relocate twice */
+    slots = (sexp*) ((char*)p + sexp_type_field_base(t));
+    v = (sexp*) ((char*)p + sexp_type_weak_base(t));
+    len = sexp_type_num_weak_slots_of_object(t, p) + sexp_type_weak_len_extra(t);
+    for (i=0; i<len; i++)
+      if (v+i < slots || v+i >= slots + sexp_type_num_slots_of_object(t, p))
+        sexp_relocate(v[i], sexp_compact_lookup, c);
+  }
+#endif
+  if (sexp_contextp(p)) {
+    for (saves=sexp_context_saves(p); saves; saves=saves->next)
+      if (saves->var) sexp_relocate(*(saves->var), sexp_compact_lookup, c);
+  } else if (sexp_bytecodep(p)) {
+    sexp_relocate_bytecode(p, sexp_compact_lookup, c);
+  }
+}
+
+void sexp_compact (sexp ctx) {
+  struct sexp_compactor_t c;
+  sexp_heap h = sexp_context_heap(ctx), chunk;
   sexp_free_list q;
-  sexp p, t, end, *v;
+  sexp ls;
+  sexp_uint_t i, num_chunks = 0;
+  size_t size;
+  memset(&c, 0, sizeof(c));
+  c.ctx = ctx;
+  sexp_gc(ctx, NULL);
+  h->gc_requested = 0;
+  sexp_debug_printf("%p compacting (heap: %p size: %lu)", ctx, h,
+                    sexp_heap_total_size(h));
+  for (chunk=h; chunk; chunk=chunk->next)
+    num_chunks++;
+  c.chunk_moves = malloc((num_chunks+1)*sizeof(sexp_uint_t));
+  if (! c.chunk_moves) return;
+
+  /* pin everything C code may be holding on to, including the */
+  /* globals and types needed to find object sizes as we go */
+  sexp_compact_pin(&c, sexp_context_globals(ctx));
+  sexp_compact_pin(&c, sexp_global(ctx, SEXP_G_TYPES));
+  for (ls=sexp_global(ctx, SEXP_G_PRESERVATIVES); sexp_pairp(ls); ls=sexp_cdr(ls))
+    sexp_compact_pin(&c, sexp_car(ls));
+  sexp_compact_heap(&c, sexp_compact_pin_object);
+  if (c.interior_len > 0 && ! c.failedp) {
+    qsort(c.interior, c.interior_len, sizeof(sexp), sexp_compact_cmp);
+    sexp_compact_heap(&c, sexp_compact_pin_interior);
+  }
+
+  /* assign the new addresses */
+  c.dest_chunk = h;
+  c.dest = (char*)sexp_heap_first_block(h);
+  for (i=0, chunk=h; chunk; chunk=chunk->next, i++) {
+    c.chunk_moves[i] = c.moves_len / 2;
+    if (! c.failedp) sexp_compact_chunk(&c, chunk, sexp_compact_forward);
+  }
+  c.chunk_moves[i] = c.moves_len / 2;
+  if (! c.failedp) sexp_compact_place(&c, 0);
+
+  if (c.failedp) {
+    /* out of memory for the tables, just leave the heap as it is */
+    sexp_debug_printf("%p compaction failed", ctx);
+    sexp_compact_heap(&c, sexp_compact_unpin);
+  } else {
+    /* update every pointer, then move the objects */
+    sexp_compact_heap(&c, sexp_compact_update);
+#if SEXP_USE_GLOBAL_SYMBOLS
+    for (i=0; i<SEXP_SYMBOL_TABLE_SIZE; i++)
+      sexp_relocate(sexp_symbol_table[i], sexp_compact_lookup, &c);
+#endif
+    for (i=0; i<c.moves_len; i+=2) {
+      size = sexp_heap_align(sexp_allocated_bytes(ctx, c.moves[i]));
+      memmove(c.moves[i+1], c.moves[i], size);
+    }
+    /* rebuild the free lists from the gaps */
+    for (i=0, chunk=h; chunk; chunk=chunk->next) {
+      q = chunk->free_list;
+      for ( ; i<c.gaps_len && (char*)c.gaps[i] >= chunk->data
+              && (char*)c.gaps[i] < (char*)sexp_heap_end(chunk); i+=2) {
+        q->next = (sexp_free_list)c.gaps[i];
+        q = q->next;
+        q->size = (char*)c.gaps[i+1] - (char*)c.gaps[i];
+      }
+      q->next = NULL;
+#if SEXP_USE_GENERATIONAL_GC
+      chunk->bump = NULL;
+#endif
+#if SEXP_USE_SIZE_CLASSES
+      memset(chunk->size_classes, 0, sizeof(chunk->size_classes));
+#endif
+      sexp_build_size_classes(chunk);
+    }
+    for (i=0; i<c.pinned_len; i++)
+      sexp_markedp(c.pinned[i]) = 0;
+    h->compact_count++;
+    h->compact_moved += c.moved;
+    /* the chunks emptied by sliding are given back straight away */
+    sexp_shrink_heap(ctx, 0);
+  }
+  h->compact_size = sexp_heap_total_size(h);
+  sexp_debug_printf("%p compacted (moved: %lu pinned: %lu)", ctx,
+                    c.moved, c.pinned_len);
+  free(c.pinned);
+  free(c.moves);
+  free(c.gaps);
+  free(c.interior);
+  free(c.chunk_moves);
+}
+
+#endif
+
+#if ! SEXP_USE_GLOBAL_HEAP
+
+static sexp sexp_offset_pointer (sexp x, void *off) {
+  return (sexp) ((char*)x + *(sexp_sint_t*)off);
+}
+
+/* objects whose C pointers must be looked up again in a new process */
+static int sexp_code_reference_p (sexp p) {
+#if SEXP_USE_DL
+  if (sexp_dlp(p) || (sexp_opcodep(p) && sexp_opcode_func(p)))
+    return 1;
+#endif
+  return sexp_typep(p) && sexp_type_finalize(p);
+}
+
+/* type finalizers are saved as an index into this table, or if from */
+/* a shared library as an offset from its sexp_init_library */
+static sexp_proc2 sexp_image_finalizers[] = {
+  NULL, SEXP_FINALIZE_PORT, SEXP_FINALIZE_FILENO, SEXP_FINALIZE_DL,
+#if SEXP_USE_TYPE_DEFS
+  sexp_finalize_c_type,
+#endif
+};
+
+#define SEXP_NUM_IMAGE_FINALIZERS (sizeof(sexp_image_finalizers)/sizeof(sexp_image_finalizers[0]))
+
+#if SEXP_USE_DL
+static void* sexp_dl_init_library (sexp dl) {
+  if (!sexp_dl_handle(dl))
+    sexp_dl_handle(dl) = dlopen(sexp_string_data(sexp_dl_file(dl)), RTLD_LAZY);
+  return sexp_dl_handle(dl) ? dlsym(sexp_dl_handle(dl), "sexp_init_library") : NULL;
+}
+#endif
+
+static void sexp_reload_code_reference (sexp p) {
+  sexp_uint_t i;
 #if SEXP_USE_DL
+  void *init;
   sexp name;
+  if (sexp_dlp(p)) {
+    sexp_dl_handle(p) = NULL;
+  } else if (sexp_opcodep(p)) {
+    name = (sexp_opcode_data2(p) && sexp_stringp(sexp_opcode_data2(p))) ? sexp_opcode_data2(p) : sexp_opcode_name(p);
+    if (sexp_dlp(sexp_opcode_dl(p))) {
+      /* saved as an offset from the library's init function */
+      init = sexp_dl_init_library(sexp_opcode_dl(p));
+      sexp_opcode_func(p) = init ? (sexp_proc1)((char*)init + (sexp_sint_t)sexp_opcode_func(p)) : NULL;
+    } else {
+      sexp_opcode_func(p) = dlsym(SEXP_RTLD_DEFAULT, sexp_string_data(name));
+    }
+  } else
+#endif
+  if (sexp_typep(p)) {
+    i = (sexp_uint_t)sexp_type_finalize(p);
+    if (i < SEXP_NUM_IMAGE_FINALIZERS) {
+      sexp_type_finalize(p) = sexp_image_finalizers[i];
+#if SEXP_USE_DL
+    } else if (sexp_dlp(sexp_type_dl(p))
+               && (init = sexp_dl_init_library(sexp_type_dl(p)))) {
+      sexp_type_finalize(p) = (sexp_proc2)((char*)init + (sexp_sint_t)i);
 #endif
+    } else {
+      sexp_type_finalize(p) = NULL;
+    }
+  }
+}
+
+void sexp_offset_heap_pointers (sexp_heap heap, sexp_heap from_heap, sexp* types, sexp flags) {
+  sexp_sint_t off, freep, loadp;
+  sexp_free_list q;
+  sexp p, t, end;
   freep = sexp_unbox_fixnum(flags) & sexp_unbox_fixnum(SEXP_COPY_FREEP);
   loadp = sexp_unbox_fixnum(flags) & sexp_unbox_fixnum(SEXP_COPY_LOADP);
 
@@ -573,6 +2458,47 @@ void sexp_offset_heap_pointers (sexp_heap heap, sexp_heap from_heap, sexp* types
   heap->data += off;
   end = (sexp) (heap->data + heap->size);
 
+  heap->mark_stack = NULL;
+  heap->mark_stack_len = heap->mark_stack_size = 0;
+  heap->mark_overflowp = 0;
+#if SEXP_USE_PARALLEL_GC
+  heap->mark_pool = NULL;
+#endif
+#if SEXP_USE_TIME_GC
+  heap->sweep_count = heap->sweep_usecs = 0;
+#endif
+#if SEXP_USE_COMPACT_GC
+  heap->compact_size = heap->size;
+  heap->compact_count = heap->compact_moved = 0;
+#endif
+  heap->empty_sweeps = heap->releasedp = 0;
+  heap->released_chunks = heap->released_bytes = 0;
+#if SEXP_USE_IMAGE_LOADING
+  heap->mappedp = 0;
+#endif
+#if SEXP_USE_SIZE_CLASSES
+  /* drop the size classes, the free cells are reclaimed on the next gc */
+  memset(heap->size_classes, 0, sizeof(heap->size_classes));
+#endif
+#if SEXP_USE_GENERATIONAL_GC
+  /* the copy starts out with everything young */
+  heap->nursery = NULL;
+  heap->bump = NULL;
+  heap->max_free = heap->size;
+  heap->remembered = NULL;
+  heap->remembered_len = heap->remembered_size = heap->major_size = 0;
+  heap->nursery_used = 0;
+  heap->promotingp = 0;
+#endif
+#if SEXP_USE_GC_SAFEPOINTS
+  heap->vm_depth = heap->gc_requested = 0;
+#endif
+#if SEXP_USE_INCREMENTAL_GC
+  heap->rescan = NULL;
+  heap->rescan_len = heap->rescan_size = heap->mark_debt = 0;
+  heap->markingp = heap->rescan_overflowp = 0;
+#endif
+
   /* adjust the free list */
   heap->free_list = (sexp_free_list) ((char*)heap->free_list + off);
   for (q=heap->free_list; q->next; q=q->next)
@@ -590,15 +2516,14 @@ void sexp_offset_heap_pointers (sexp_heap heap, sexp_heap from_heap, sexp* types
     } else {
       t = (sexp)((char*)(types[sexp_pointer_tag(p)])
                  + ((char*)types > (char*)p ? off : 0));
-      len = sexp_type_num_slots_of_object(t, p);
-      v = (sexp*) ((char*)p + sexp_type_field_base(t));
       /* offset any pointers in the _destination_ heap */
-      for (i=0; i<len; i++)
-        if (v[i] && sexp_pointerp(v[i]))
-          v[i] = (sexp) ((char*)v[i] + off);
+      sexp_relocate_slots(t, p, sexp_offset_pointer, &off);
       /* don't free unless specified - only the original cleans up */
       if (! freep)
         sexp_freep(p) = 0;
+#if SEXP_USE_GENERATIONAL_GC
+      sexp_markedp(p) = sexp_rememberedp(p) = 0;
+#endif
       /* adjust context heaps, don't copy saved sexp_gc_vars */
       if (sexp_contextp(p)) {
 #if SEXP_USE_GREEN_THREADS
@@ -608,39 +2533,14 @@ void sexp_offset_heap_pointers (sexp_heap heap, sexp_heap from_heap, sexp* types
         sexp_stack_top(sexp_context_stack(p)) = 0;
         sexp_context_saves(p) = NULL;
         sexp_context_heap(p) = heap;
-      } else if (sexp_bytecodep(p) && off != 0) {
-        for (i=0; i<sexp_bytecode_length(p); ) {
-          switch (sexp_bytecode_data(p)[i++]) {
-            case SEXP_OP_FCALL0:      case SEXP_OP_FCALL1:
-            case SEXP_OP_FCALL2:      case SEXP_OP_FCALL3:
-            case SEXP_OP_FCALL4:      case SEXP_OP_CALL:
-            case SEXP_OP_TAIL_CALL:   case SEXP_OP_PUSH:
-            case SEXP_OP_GLOBAL_REF:  case SEXP_OP_GLOBAL_KNOWN_REF:
-#if SEXP_USE_GREEN_THREADS
-            case SEXP_OP_PARAMETER_REF:
+      } else if (sexp_bytecodep(p)) {
+        if (off != 0)
+          sexp_relocate_bytecode(p, sexp_offset_pointer, &off);
+#if SEXP_USE_NATIVE_CODE
+        /* machine code isn't saved, recompile once hot again */
+        sexp_bytecode_native(p) = NULL;
+        sexp_bytecode_calls(p) = 0;
 #endif
-#if SEXP_USE_EXTENDED_FCALL
-            case SEXP_OP_FCALLN:
-#endif
-              v = (sexp*)(&(sexp_bytecode_data(p)[i]));
-              if (v[0] && sexp_pointerp(v[0])) v[0] = (sexp) (((char*)v[0]) + off);
-              /* ... FALLTHROUGH ... */
-            case SEXP_OP_JUMP:        case SEXP_OP_JUMP_UNLESS:
-            case SEXP_OP_STACK_REF:   case SEXP_OP_CLOSURE_REF:
-            case SEXP_OP_LOCAL_REF:   case SEXP_OP_LOCAL_SET:
-            case SEXP_OP_TYPEP:
-#if SEXP_USE_RESERVE_OPCODE
-            case SEXP_OP_RESERVE:
-#endif
-              i += sizeof(sexp); break;
-            case SEXP_OP_MAKE: case SEXP_OP_SLOT_REF: case SEXP_OP_SLOT_SET:
-              i += 2*sizeof(sexp); break;
-            case SEXP_OP_MAKE_PROCEDURE:
-              v = (sexp*)(&(sexp_bytecode_data(p)[i]));
-              if (v[2] && sexp_pointerp(v[2])) v[2] = (sexp) (((char*)v[2]) + off);
-              i += 3*sizeof(sexp); break;
-          }
-        }
       } else if (sexp_portp(p) && sexp_port_stream(p)) {
         sexp_port_stream(p) = 0;
         sexp_port_openp(p) = 0;
@@ -665,36 +2565,330 @@ void sexp_offset_heap_pointers (sexp_heap heap, sexp_heap from_heap, sexp* types
       if ((char*)q == (char*)p) { /* this is a free block, skip it */
         p = (sexp) (((char*)p) + q->size);
       } else {
+        /* shared libraries were already closed on the first pass */
 #if SEXP_USE_DL
-        if (sexp_opcodep(p) && sexp_opcode_func(p)) {
-          name = (sexp_opcode_data2(p) && sexp_stringp(sexp_opcode_data2(p))) ? sexp_opcode_data2(p) : sexp_opcode_name(p);
-          if (sexp_dlp(sexp_opcode_dl(p))) {
-            if (!sexp_dl_handle(sexp_opcode_dl(p)))
-              sexp_dl_handle(sexp_opcode_dl(p)) = dlopen(sexp_string_data(sexp_dl_file(sexp_opcode_dl(p))), RTLD_LAZY);
-            sexp_opcode_func(p) = dlsym(sexp_dl_handle(sexp_opcode_dl(p)), sexp_string_data(name));
-          } else {
-            sexp_opcode_func(p) = dlsym(SEXP_RTLD_DEFAULT, sexp_string_data(name));
-          }
-        } else
+        if (sexp_code_reference_p(p) && ! sexp_dlp(p))
+#else
+        if (sexp_code_reference_p(p))
 #endif
-        if (sexp_typep(p)) {
-          if (sexp_type_finalize(p)) {
-            /* TODO: handle arbitrary finalizers in images */
+          sexp_reload_code_reference(p);
+        t = types[sexp_pointer_tag(p)];
+        p = (sexp) (((char*)p)+sexp_heap_align(sexp_type_size_of_object(t, p)+SEXP_GC_PAD));
+      }
+    }
+  }
+}
+
+#if SEXP_USE_IMAGE_LOADING
+
+/* Images are saved already relocated to the address they're mapped */
+/* at, so that loading needs no pass over the heap, only over a list */
+/* of the objects referring to code, which moves between processes. */
+/* Their offsets from the heap are returned in a malloc'ed array of */
+/* length *len, with the handles of shared libraries first.  The */
+/* functions of opcodes from shared libraries are replaced with their */
+/* offsets from the library's sexp_init_library, as they have no */
+/* symbol of their own, and the finalizers of types are encoded as */
+/* described for sexp_image_finalizers. */
+static sexp_uint_t* sexp_heap_code_references (sexp_heap heap, sexp* types, sexp_uint_t *len) {
+  sexp_uint_t *res = NULL, *tmp, size = 0, i, j, k;
 #if SEXP_USE_DL
-            if (sexp_type_tag(p) == SEXP_DL)
-              sexp_type_finalize(p) = SEXP_FINALIZE_DL;
-            else
+  void *init;
 #endif
-              sexp_type_finalize(p) = SEXP_FINALIZE_PORT;
-          }
+  sexp_free_list q = heap->free_list;
+  sexp p = sexp_heap_first_block(heap), end = sexp_heap_end(heap), t;
+  *len = 0;
+  while (p < end) {
+    for ( ; q && ((char*)q < (char*)p); q=q->next)
+      ;
+    if ((char*)q == (char*)p) {
+      p = (sexp) (((char*)p) + q->size);
+      continue;
+    }
+    if (sexp_code_reference_p(p)) {
+      if (*len >= size) {
+        size = size ? size*2 : 256;
+        if (!(tmp = (sexp_uint_t*) realloc(res, size*sizeof(sexp_uint_t)))) {
+          free(res);
+          return NULL;
         }
-        t = types[sexp_pointer_tag(p)];
-        p = (sexp) (((char*)p)+sexp_heap_align(sexp_type_size_of_object(t, p)+SEXP_GC_PAD));
+        res = tmp;
+      }
+      res[(*len)++] = (char*)p - (char*)heap;
+#if SEXP_USE_DL
+      if (sexp_opcodep(p) && sexp_dlp(sexp_opcode_dl(p))) {
+        init = dlsym(sexp_dl_handle(sexp_opcode_dl(p)), "sexp_init_library");
+        sexp_opcode_func(p) = (sexp_proc1)((char*)sexp_opcode_func(p) - (char*)init);
+      }
+#endif
+      if (sexp_typep(p)) {
+        for (i=1; i < SEXP_NUM_IMAGE_FINALIZERS; i++)
+          if (sexp_image_finalizers[i] == sexp_type_finalize(p))
+            break;
+#if SEXP_USE_DL
+        if (i == SEXP_NUM_IMAGE_FINALIZERS && sexp_dlp(sexp_type_dl(p))
+            && (init = dlsym(sexp_dl_handle(sexp_type_dl(p)), "sexp_init_library")))
+          sexp_type_finalize(p) = (sexp_proc2)((char*)sexp_type_finalize(p) - (char*)init);
+        else
+#endif
+        /* unknown finalizers are dropped, leaking rather than crashing */
+        sexp_type_finalize(p) = (sexp_proc2)(i < SEXP_NUM_IMAGE_FINALIZERS ? i : 0);
       }
     }
+    t = types[sexp_pointer_tag(p)];
+    p = (sexp) (((char*)p)+sexp_heap_align(sexp_type_size_of_object(t, p)+SEXP_GC_PAD));
+  }
+#if SEXP_USE_DL
+  /* move the shared libraries to the front, keeping the order */
+  for (i=j=0; i < *len; i++)
+    if (sexp_dlp((sexp)((char*)heap + res[i]))) {
+      k = res[i];
+      memmove(res+j+1, res+j, (i-j)*sizeof(sexp_uint_t));
+      res[j++] = k;
+    }
+#endif
+  return res;
+}
+
+static void sexp_reload_code_references (sexp_heap heap, sexp_uint_t *offsets, sexp_uint_t len) {
+  sexp_uint_t i;
+  for (i=0; i < len; i++)
+    sexp_reload_code_reference((sexp)((char*)heap + offsets[i]));
+}
+
+#define SEXP_IMAGE_MAGIC "\a\achibi\n\0"
+#define SEXP_IMAGE_MAJOR_VERSION 2
+#define SEXP_IMAGE_MINOR_VERSION 0
+
+/* The heap is saved relocated to SEXP_IMAGE_BASE and mapped there */
+/* copy-on-write when loading, so that processes loading the same */
+/* image share its pages until they write to them, and only the pages */
+/* used are read.  If the address is taken the heap is relocated. */
+#ifndef SEXP_IMAGE_BASE
+#if SEXP_64_BIT
+#define SEXP_IMAGE_BASE 0x200000000000UL
+#else
+#define SEXP_IMAGE_BASE 0x20000000UL
+#endif
+#endif
+
+/* the file offset of the heap is aligned for any page size up to 64k */
+#define SEXP_IMAGE_ALIGN_BITS 16
+
+typedef struct sexp_image_header_t* sexp_image_header;
+struct sexp_image_header_t {
+  char magic[8];
+  short major, minor;
+  sexp_abi_identifier_t abi;
+  sexp_uint_t size;
+  sexp_heap base;
+  sexp context;
+  sexp_uint_t num_code_refs;    /* followed by their heap offsets */
+  sexp_uint_t heap_offset;
+};
+
+static int sexp_image_header_ok (sexp_image_header header, const char* file) {
+  if (memcmp(header->magic, SEXP_IMAGE_MAGIC, sizeof(header->magic)) != 0) {
+    fprintf(stderr, "invalid image file magic for %s: %s\n", file, header->magic);
+    return 0;
+  } else if (header->major != SEXP_IMAGE_MAJOR_VERSION
+             || header->minor > SEXP_IMAGE_MINOR_VERSION) {
+    fprintf(stderr, "unsupported image version: %d.%d\n",
+            header->major, header->minor);
+    return 0;
+  } else if (!sexp_abi_compatible(NULL, header->abi, SEXP_ABI_IDENTIFIER)) {
+    fprintf(stderr, "unsupported ABI: %s (expected %s)\n",
+            header->abi, SEXP_ABI_IDENTIFIER);
+    return 0;
+  }
+  return 1;
+}
+
+/* reserve the whole heap, at the image's address if possible */
+static sexp_heap sexp_reserve_image_heap (sexp_image_header header, sexp_uint_t heap_size) {
+  sexp_heap heap;
+  if (heap_size < header->size) heap_size = header->size;
+  heap = (sexp_heap) mmap(header->base, sexp_heap_pad_size(heap_size),
+                          PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS,
+                          -1, 0);
+  return heap == MAP_FAILED ? NULL : heap;
+}
+
+/* extend a heap holding an image to heap_size, and fix its pointers */
+static sexp sexp_finish_image (sexp_heap heap, sexp_image_header header, sexp_uint_t *code_refs, sexp_uint_t heap_size) {
+  sexp ctx, flags, *globals, *types;
+  sexp_sint_t offset;
+  sexp_free_list q;
+  offset = (sexp_sint_t)((char*)heap - (sexp_sint_t)header->base);
+  /* expand the last free chunk if necessary */
+  if (heap->size < heap_size) {
+    for (q=(sexp_free_list)(((char*)heap->free_list) + offset); q->next;
+         q=(sexp_free_list)(((char*)q->next) + offset))
+      ;
+    if ((char*)q + q->size >= (char*)heap->data + offset + heap->size) {
+      /* last free chunk at end of heap */
+      q->size += heap_size - heap->size;
+    } else {
+      /* last free chunk in the middle of the heap */
+      q->next = (sexp_free_list)((char*)heap->data + heap->size);
+      q = (sexp_free_list)(((char*)q->next) + offset);
+      q->size = heap_size - heap->size;
+      q->next = NULL;
+    }
+    heap->size += (heap_size - heap->size);
+  }
+  ctx = (sexp)(((char*)header->context) + offset);
+  if (offset == 0) {
+    sexp_reload_code_references(heap, code_refs, header->num_code_refs);
+  } else {
+    globals = sexp_vector_data((sexp)((char*)sexp_context_globals(ctx) + offset));
+    types = sexp_vector_data((sexp)((char*)(globals[SEXP_G_TYPES]) + offset));
+    flags = sexp_fx_add(SEXP_COPY_LOADP, SEXP_COPY_FREEP);
+    sexp_offset_heap_pointers(heap, header->base, types, flags);
   }
+  heap->mappedp = 1;
+  return ctx;
 }
 
+sexp sexp_load_image (const char* file, sexp_uint_t heap_size, sexp_uint_t heap_max_size) {
+  sexp ctx;
+  int fd;
+  sexp_uint_t *code_refs, len;
+  sexp_heap heap;
+  struct sexp_image_header_t header;
+  fd = open(file, O_RDONLY);
+  if (fd < 0) {
+    fprintf(stderr, "can't open image file: %s\n", file);
+    return NULL;
+  }
+  if (read(fd, &header, sizeof(header)) != sizeof(header)
+      || !sexp_image_header_ok(&header, file)) {
+    close(fd);
+    return NULL;
+  }
+  len = header.num_code_refs * sizeof(sexp_uint_t);
+  code_refs = (sexp_uint_t*) malloc(len ? len : 1);
+  if (!code_refs || read(fd, code_refs, len) != len) {
+    fprintf(stderr, "error reading image\n");
+    free(code_refs);
+    close(fd);
+    return NULL;
+  }
+  /* map the image over the start of the reserved heap */
+  heap = sexp_reserve_image_heap(&header, heap_size);
+  if (!heap
+      || mmap(heap, sexp_heap_pad_size(header.size), PROT_READ|PROT_WRITE,
+              MAP_PRIVATE|MAP_FIXED, fd, header.heap_offset) == MAP_FAILED) {
+    fprintf(stderr, "couldn't map image heap\n");
+    free(code_refs);
+    close(fd);
+    return NULL;
+  }
+  close(fd);
+  ctx = sexp_finish_image(heap, &header, code_refs, heap_size);
+  free(code_refs);
+  return ctx;
+}
+
+/* As above, for an image already in memory, such as one compiled */
+/* into the program.  The heap is copied, and may be cut short of */
+/* trailing zeros in the data, which are left to the fresh mapping. */
+sexp sexp_load_image_data (const char* data, sexp_uint_t len, sexp_uint_t heap_size, sexp_uint_t heap_max_size) {
+  sexp ctx;
+  sexp_uint_t *code_refs, refs_len;
+  sexp_heap heap;
+  struct sexp_image_header_t header;
+  if (len < sizeof(header))
+    return NULL;
+  memcpy(&header, data, sizeof(header));
+  if (!sexp_image_header_ok(&header, "static image"))
+    return NULL;
+  refs_len = header.num_code_refs * sizeof(sexp_uint_t);
+  if (len < header.heap_offset
+      || len > header.heap_offset + sexp_heap_pad_size(header.size)
+      || sizeof(header) + refs_len > header.heap_offset) {
+    fprintf(stderr, "invalid image data\n");
+    return NULL;
+  }
+  code_refs = (sexp_uint_t*) malloc(refs_len ? refs_len : 1);
+  if (!code_refs) {
+    fprintf(stderr, "couldn't allocate image code references\n");
+    return NULL;
+  }
+  memcpy(code_refs, data + sizeof(header), refs_len);
+  heap = sexp_reserve_image_heap(&header, heap_size);
+  if (!heap) {
+    fprintf(stderr, "couldn't map image heap\n");
+    free(code_refs);
+    return NULL;
+  }
+  memcpy(heap, data + header.heap_offset, len - header.heap_offset);
+  ctx = sexp_finish_image(heap, &header, code_refs, heap_size);
+  free(code_refs);
+  return ctx;
+}
+
+int sexp_save_image (sexp ctx, const char* path) {
+  sexp *globals, *types;
+  sexp_sint_t offset;
+  sexp_uint_t *code_refs = NULL, size;
+  sexp_heap heap, base = (sexp_heap) SEXP_IMAGE_BASE;
+  FILE* file;
+  struct sexp_image_header_t header;
+  int res = 0;
+  sexp_gc(ctx, NULL);
+  heap = sexp_context_heap(ctx);
+  if (heap->next) {
+    fprintf(stderr, "can't save a non-contiguous heap, try a larger -h\n");
+    return 0;
+  }
+  /* relocate a copy of the heap to where it will be loaded */
+  size = sexp_heap_pad_size(heap->size);
+  base = (sexp_heap) mmap(base, size, PROT_READ|PROT_WRITE,
+                          MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+  if (base == MAP_FAILED) {
+    fprintf(stderr, "couldn't map image heap\n");
+    return 0;
+  } else if (base != (sexp_heap) SEXP_IMAGE_BASE) {
+    fprintf(stderr, "image heap address in use: %p\n", (void*)SEXP_IMAGE_BASE);
+    munmap(base, size);
+    return 0;
+  }
+  memcpy(base, heap, size);
+  offset = (char*)base - (char*)heap;
+  globals = sexp_vector_data((sexp)((char*)sexp_context_globals(ctx) + offset));
+  types = sexp_vector_data((sexp)((char*)(globals[SEXP_G_TYPES]) + offset));
+  sexp_offset_heap_pointers(base, heap, types, SEXP_COPY_FREEP);
+  memcpy(&header.magic, SEXP_IMAGE_MAGIC, sizeof(header.magic));
+  memcpy(&header.abi, SEXP_ABI_IDENTIFIER, sizeof(header.abi));
+  header.major = SEXP_IMAGE_MAJOR_VERSION;
+  header.minor = SEXP_IMAGE_MINOR_VERSION;
+  header.size = heap->size;
+  header.base = base;
+  header.context = (sexp)((char*)ctx + offset);
+  code_refs = sexp_heap_code_references(base, types, &header.num_code_refs);
+  header.heap_offset = sexp_align(sizeof(header) + header.num_code_refs*sizeof(sexp_uint_t), SEXP_IMAGE_ALIGN_BITS);
+  file = fopen(path, "w");
+  if (!file) {
+    fprintf(stderr, "couldn't open image file for writing: %s\n", path);
+  } else if (!code_refs && header.num_code_refs > 0) {
+    fprintf(stderr, "couldn't allocate image code references\n");
+  } else if (! (fwrite(&header, sizeof(header), 1, file) == 1
+                && fwrite(code_refs, sizeof(sexp_uint_t), header.num_code_refs, file) == header.num_code_refs
+                && fseek(file, header.heap_offset, SEEK_SET) == 0
+                && fwrite(base, size, 1, file) == 1)) {
+    fprintf(stderr, "error writing image file\n");
+  } else {
+    res = 1;
+  }
+  if (file) fclose(file);
+  free(code_refs);
+  munmap(base, size);
+  return res;
+}
+
+#endif
+
 sexp sexp_copy_context (sexp ctx, sexp dst, sexp flags) {
   sexp_sint_t off;
   sexp_heap to, from = sexp_context_heap(ctx);
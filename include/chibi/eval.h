@@ -67,11 +67,9 @@ SEXP_API sexp sexp_make_ref (sexp ctx, sexp name, sexp cell);
 SEXP_API void sexp_generate (sexp ctx, sexp name, sexp loc, sexp lam, sexp x);
 SEXP_API void sexp_emit (sexp ctx, unsigned char c);
 SEXP_API void sexp_emit_return (sexp ctx);
-#if SEXP_USE_NATIVE_X86
-SEXP_API void sexp_emit_enter (sexp ctx);
+#if SEXP_USE_NATIVE_CODE
 SEXP_API void sexp_bless_bytecode (sexp ctx, sexp bc);
 #else
-#define sexp_emit_enter(ctx)
 #define sexp_bless_bytecode(ctx, bc)
 #endif
 SEXP_API sexp sexp_complete_bytecode (sexp ctx);
@@ -90,10 +88,14 @@ SEXP_API sexp sexp_make_env_op (sexp context, sexp self, sexp_sint_t n);
 SEXP_API sexp sexp_make_null_env_op (sexp context, sexp self, sexp_sint_t n, sexp version);
 SEXP_API sexp sexp_env_cell_define (sexp ctx, sexp env, sexp name, sexp value, sexp* varenv);
 SEXP_API sexp sexp_make_primitive_env_op (sexp context, sexp self, sexp_sint_t n, sexp version);
+SEXP_API sexp sexp_unchecked_opcode_op (sexp context, sexp self, sexp_sint_t n, sexp name);
 SEXP_API sexp sexp_make_standard_env_op (sexp context, sexp self, sexp_sint_t n, sexp version);
 SEXP_API void sexp_set_parameter (sexp ctx, sexp env, sexp name, sexp value);
 SEXP_API sexp sexp_load_standard_ports (sexp context, sexp env, FILE* in, FILE* out, FILE* err, int no_close);
 SEXP_API sexp sexp_load_standard_env (sexp context, sexp env, sexp version);
+#if SEXP_USE_STATIC_IMAGE
+SEXP_API sexp sexp_load_static_image (sexp_uint_t heap_size, sexp_uint_t heap_max_size);
+#endif
 SEXP_API sexp sexp_find_module_file (sexp ctx, const char *file);
 SEXP_API sexp sexp_load_module_file (sexp ctx, const char *file, sexp env);
 SEXP_API sexp sexp_current_module_path_op (sexp ctx, sexp self, sexp_sint_t n, sexp x);
@@ -180,15 +182,6 @@ SEXP_API sexp sexp_expt_op(sexp ctx, sexp self, sexp_sint_t n, sexp z1, sexp z2)
 SEXP_API sexp sexp_exact_to_inexact(sexp ctx, sexp self, sexp_sint_t n, sexp i);
 SEXP_API sexp sexp_inexact_to_exact(sexp ctx, sexp self, sexp_sint_t n, sexp x);
 
-#if SEXP_USE_NATIVE_X86
-SEXP_API sexp sexp_write_char_op(sexp ctx, sexp self, sexp_sint_t n, sexp ch, sexp out);
-SEXP_API sexp sexp_newline_op(sexp ctx, sexp self, sexp_sint_t n, sexp out);
-SEXP_API sexp sexp_read_char_op(sexp ctx, sexp self, sexp_sint_t n, sexp in);
-SEXP_API sexp sexp_peek_char_op(sexp ctx, sexp self, sexp_sint_t n, sexp in);
-SEXP_API sexp sexp_char_upcase(sexp ctx, sexp self, sexp_sint_t n, sexp ch);
-SEXP_API sexp sexp_char_downcase(sexp ctx, sexp self, sexp_sint_t n, sexp ch);
-#endif
-
 #define sexp_define_foreign(c,e,s,n,f) sexp_define_foreign_aux(c,e,s,n,0,(sexp_proc1)f,NULL)
 #define sexp_define_foreign_opt(c,e,s,n,f,d) sexp_define_foreign_aux(c,e,s,n,1,(sexp_proc1)f,d)
 
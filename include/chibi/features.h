@@ -10,7 +10,12 @@
 /* uncomment this to disable interpreter-based threads */
 /* #define SEXP_USE_GREEN_THREADS 0 */
 
-/* uncomment this to enable the experimental native x86 backend */
+/* uncomment this to enable the experimental x86-64 JIT */
+/*   Bytecode called more than SEXP_NATIVE_X86_THRESHOLD times */
+/*   is translated to machine code, one template per opcode, */
+/*   which falls back to the VM for any opcode or case it doesn't */
+/*   handle.  Only on x86-64 with gcc, and ignored with */
+/*   SEXP_USE_DEBUG_VM, SEXP_USE_PROFILE_VM and SEXP_USE_AUTO_FORCE. */
 /* #define SEXP_USE_NATIVE_X86 1 */
 
 /* uncomment this to disable the module system */
@@ -33,6 +38,34 @@
 /*   to your needs. */
 /* #define SEXP_USE_STATIC_LIBS 1 */
 
+/* uncomment this to include ahead-of-time compiled libraries */
+/*   If set, this will include the aotlibs.c file generated by */
+/*   tools/chibi-aot, which translates the bytecode of the given */
+/*   modules to C, one function per procedure.  When a module is */
+/*   loaded, its procedures run as the C code wherever their */
+/*   bytecode matches that compiled, falling back to the VM for */
+/*   any opcode or case it doesn't handle.  Ignored with */
+/*   SEXP_USE_NATIVE_X86, which compiles the same code at run time. */
+/* #define SEXP_USE_AOT_LIBS 1 */
+
+/* uncomment this to compile a heap image into the library */
+/*   If set, this will include the staticimage.c file generated */
+/*   from a context with the standard environment and the */
+/*   STATIC_IMAGE_MODULES of the Makefile loaded, and provide */
+/*   sexp_load_static_image() to start such a context without */
+/*   reading init-7.scm or the source of any module.  Shared */
+/*   libraries used by the modules are still opened by the path */
+/*   they were loaded from.  Requires image loading. */
+/* #define SEXP_USE_STATIC_IMAGE 1 */
+
+/* uncomment this to disable the cache of compiled files */
+/*   If the CHIBI_FASL_CACHE environment variable names a */
+/*   directory, files loaded from source, such as the includes of */
+/*   libraries, are saved there compiled and later loads of the */
+/*   unchanged file run the saved code instead of compiling it */
+/*   again.  Without the variable nothing is cached. */
+/* #define SEXP_USE_FASL 0 */
+
 /* uncomment this to disable detailed source info for debugging */
 /*   By default Chibi will associate source info with every */
 /*   bytecode offset.  By disabling this only lambda-level source */
@@ -76,6 +109,80 @@
 /* uncomment this to allocate heaps with mmap instead of malloc */
 /* #define SEXP_USE_MMAP_GC 1 */
 
+/* uncomment this to enable the generational mode of the native GC */
+/*   New objects are bump allocated from a small nursery chunk */
+/*   which is collected on its own, with survivors promoted in */
+/*   place to the old generation.  Old objects are only rescanned */
+/*   when they've been written to, so C code which stores newly */
+/*   allocated objects into existing ones (as opposed to ones it */
+/*   just allocated itself) must call sexp_write_barrier().  Minor */
+/*   collections only run at a VM safe point in the outermost */
+/*   sexp_apply, never in the middle of a C primitive. */
+/* #define SEXP_USE_GENERATIONAL_GC 1 */
+
+/* uncomment this to enable incremental marking in the native GC */
+/*   Instead of marking the whole heap when it fills up, a */
+/*   collection is started ahead of time and each allocation adds */
+/*   SEXP_MARK_BUDGET words of marking work, which the VM performs */
+/*   from an explicit mark stack between instructions. */
+/*   Stores into already marked objects must go through */
+/*   sexp_write_barrier(), as in the generational mode, and the */
+/*   roots are rescanned in a short final pause.  Not available */
+/*   together with the generational mode. */
+/* #define SEXP_USE_INCREMENTAL_GC 1 */
+
+/* uncomment this to mark in parallel in the native GC */
+/*   Full collections share the marking between a pool of */
+/*   SEXP_MARK_THREADS pthreads, which steal work from each other's */
+/*   mark deques, and then reset weak references and sweep one */
+/*   heap chunk per thread at a time.  Finalizers still run on the */
+/*   collecting thread.  Use "make SEXP_USE_PARALLEL_GC=1" to link */
+/*   with -lpthread.  Not available with the generational or */
+/*   incremental modes. */
+/* #define SEXP_USE_PARALLEL_GC 1 */
+
+/* uncomment this to let the native GC compact the heap */
+/*   Live objects are slid towards the start of the heap, across */
+/*   chunks, when (compact-heap!) from (chibi ast) is called or */
+/*   when a sweep leaves more than SEXP_COMPACT_THRESHOLD percent */
+/*   of the heap free but outside the largest free block of its */
+/*   chunk.  Pointers are relocated as when loading a heap image. */
+/*   Compaction runs at a VM safe point in the outermost */
+/*   sexp_apply, so C code calling into the VM at that level */
+/*   must refer to any objects it still needs afterwards through */
+/*   sexp_gc_preserve'd variables.  Contexts, types, opcodes, */
+/*   bytecode, environments, stacks, ports (and the strings they */
+/*   read from), C pointers, objects of C types, and objects */
+/*   passed to sexp_preserve_object() never move.  Tables which */
+/*   hash by address, such as eq? tables from (srfi 69), rehash */
+/*   themselves after a compaction, so C code doing the same must */
+/*   check sexp_heap_compactions().  Not available with the */
+/*   generational or incremental modes. */
+/* #define SEXP_USE_COMPACT_GC 1 */
+
+/* uncomment this to disable segregated free lists in the native GC */
+/*   By default small objects (pairs, flonums, procedures and short */
+/*   vectors) are allocated from per-size free lists which are */
+/*   rebuilt on each sweep, so that allocating them doesn't require */
+/*   a first-fit search of a fragmented heap. */
+/* #define SEXP_USE_SIZE_CLASSES 0 */
+
+/* uncomment this to make the native GC sweep eagerly */
+/*   By default a collection triggered by the allocator only marks, */
+/*   and each heap chunk is swept (and its dead objects finalized) */
+/*   the first time the allocator needs to allocate from it, so the */
+/*   pause is bounded by the time to mark the live data.  Explicit */
+/*   calls to sexp_gc() still sweep the whole heap.  Ignored in the */
+/*   generational mode, where minor collections sweep the nursery. */
+/* #define SEXP_USE_LAZY_SWEEP 0 */
+
+/* uncomment this to time the sweep phase of the native GC */
+/*   The number of sweeps and the total time spent in them are kept */
+/*   in the heap, for gc-stats in (chibi heap-stats).  This costs a */
+/*   gettimeofday() call around every sweep, including each step of */
+/*   a lazy sweep. */
+/* #define SEXP_USE_TIME_GC 1 */
+
 /* uncomment this to add conservative checks to the native GC */
 /*   Please mail the author if enabling this makes a bug */
 /*   go away and you're not working on your own C extension. */
@@ -134,9 +241,13 @@
 /*   By default you can read/write +inf.0, -inf.0 and +nan.0 */
 /* #define SEXP_USE_INFINITIES 0 */
 
-/* uncomment this if you want immediate flonums */
-/*   This is experimental, enable at your own risk. */
-/* #define SEXP_USE_IMMEDIATE_FLONUMS 1 */
+/* uncomment this to always box flonums */
+/*   On 64-bit platforms flonums are by default immediate unless */
+/*   their exponent is very large or small, so most arithmetic */
+/*   results don't need to be allocated.  Infinities and NaNs are */
+/*   still boxed.  On 32-bit platforms immediate flonums are only */
+/*   single precision, experimental and off by default. */
+/* #define SEXP_USE_IMMEDIATE_FLONUMS 0 */
 
 /* uncomment this if you don't want bignum support */
 /*   Bignums are implemented with a small, custom library  */
@@ -222,6 +333,47 @@
 /*   Experts only. */
 /*   For *very* verbose output on every VM operation. */
 
+/* uncomment this to dispatch the VM with computed gotos */
+/*   Requires GCC's labels as values.  Each opcode jumps directly */
+/*   to the next one, and the thread fuel and GC safepoints are */
+/*   only checked on calls and backward jumps.  Ignored with */
+/*   SEXP_USE_DEBUG_VM and SEXP_USE_PROFILE_VM, which need to see */
+/*   every instruction.  Build with "make SEXP_USE_THREADED_VM=1" */
+/*   to also let gcc give each opcode its own dispatch jump. */
+/* #define SEXP_USE_THREADED_VM 1 */
+
+/* uncomment this to disable fused superinstructions */
+/*   By default the compiler emits single opcodes for the most */
+/*   frequent opcode pairs, e.g. a local ref followed by car or by */
+/*   a conditional jump.  The candidates come from the */
+/*   SEXP_USE_PROFILE_VM pair counts, see */
+/*   tools/vm-superinstructions.scm. */
+/* #define SEXP_USE_SUPERINSTRUCTIONS 0 */
+
+/* uncomment this to disable inline caches for global calls */
+/*   Each call to a known global procedure caches the last */
+/*   procedure it found in the global, so that while the global */
+/*   keeps the same value the call skips the procedure and arity */
+/*   checks.  Only has an effect with superinstructions enabled. */
+/* #define SEXP_USE_INLINE_CACHES 0 */
+
+/* uncomment this to always box intermediate flonum results */
+/*   By default a nested arithmetic expression such as */
+/*   (- (* a b) (* c d)) is compiled to a single opcode which, */
+/*   when the operands are all flonums, computes the whole tree */
+/*   in unboxed doubles and only allocates a flonum for the final */
+/*   result.  Any other operands take the generic path with the */
+/*   same results as the plain arithmetic opcodes. */
+/* #define SEXP_USE_UNBOXED_FLONUMS 0 */
+
+/* uncomment this to box every variable which is set! */
+/*   By default a set! variable which no inner lambda refers to is */
+/*   kept in its stack slot like any other local, unless it may be */
+/*   set! after a call which could capture a continuation, since */
+/*   continuations copy the stack and re-entering one would restore */
+/*   the slot's old value. */
+/* #define SEXP_USE_ESCAPE_ANALYSIS 0 */
+
 /* uncomment this to make the VM adhere to alignment rules */
 /*   This is required on some platforms, e.g. ARM */
 /* #define SEXP_USE_ALIGNED_BYTECODE */
@@ -250,6 +402,69 @@
 #define SEXP_GROW_HEAP_RATIO 0.75
 #endif
 
+/* each chunk added to the heap is this many times the size of */
+/* the last one */
+#ifndef SEXP_GROW_HEAP_FACTOR
+#define SEXP_GROW_HEAP_FACTOR 2
+#endif
+
+/* both of the above can be changed per heap at runtime with */
+/* grow_ratio and grow_factor */
+
+/* if after GC the live data would fit in no more than this ratio */
+/* of the heap left without an empty chunk, give that chunk back to */
+/* the OS, kept well below SEXP_GROW_HEAP_RATIO so the heap doesn't */
+/* thrash between growing and shrinking, and scaled along with the */
+/* heap's grow_ratio when that's changed - 0 never releases chunks */
+#ifndef SEXP_SHRINK_HEAP_RATIO
+#define SEXP_SHRINK_HEAP_RATIO 0.5
+#endif
+
+/* the number of full sweeps in a row which must find a chunk empty */
+/* before it's released */
+#ifndef SEXP_SHRINK_HEAP_DELAY
+#define SEXP_SHRINK_HEAP_DELAY 2
+#endif
+
+/* the number of segregated free lists for small objects, */
+/* in units of the heap alignment (32 bytes on 64-bit machines) */
+#ifndef SEXP_SIZE_CLASSES
+#define SEXP_SIZE_CLASSES 8
+#endif
+
+/* the size in bytes of the nursery in the generational GC, */
+/* objects larger than 1/8th of this are allocated directly in the */
+/* old generation */
+#ifndef SEXP_NURSERY_SIZE
+#define SEXP_NURSERY_SIZE (1024*1024)
+#endif
+
+/* the default number of words marked per allocation in the */
+/* incremental mode, can be changed per heap with mark_budget */
+#ifndef SEXP_MARK_BUDGET
+#define SEXP_MARK_BUDGET 256
+#endif
+
+/* the default number of threads to mark with in the parallel */
+/* mode, 0 for one per online CPU, can be changed per heap with */
+/* mark_threads before the first collection */
+#ifndef SEXP_MARK_THREADS
+#define SEXP_MARK_THREADS 0
+#endif
+
+/* the number of words to mark on the collecting thread before */
+/* waking up the other parallel marking threads */
+#ifndef SEXP_PARALLEL_MARK_MIN
+#define SEXP_PARALLEL_MARK_MIN 4096
+#endif
+
+/* the percentage of the heap which must be free but unusable for */
+/* large allocations before a compaction is requested, as long as */
+/* the heap has grown since the last one */
+#ifndef SEXP_COMPACT_THRESHOLD
+#define SEXP_COMPACT_THRESHOLD 25
+#endif
+
 /* the default number of opcodes to run each thread for */
 #ifndef SEXP_DEFAULT_QUANTUM
 #define SEXP_DEFAULT_QUANTUM 500
@@ -332,6 +547,14 @@
 #define SEXP_USE_STATIC_LIBS 0
 #endif
 
+#ifndef SEXP_USE_AOT_LIBS
+#define SEXP_USE_AOT_LIBS 0
+#endif
+
+#ifndef SEXP_USE_FASL
+#define SEXP_USE_FASL ! SEXP_USE_NO_FEATURES
+#endif
+
 #ifndef SEXP_USE_FULL_SOURCE_INFO
 #define SEXP_USE_FULL_SOURCE_INFO ! SEXP_USE_NO_FEATURES
 #endif
@@ -364,6 +587,34 @@
 #define SEXP_USE_DEBUG_GC 0
 #endif
 
+#ifndef SEXP_USE_GENERATIONAL_GC
+#define SEXP_USE_GENERATIONAL_GC 0
+#endif
+
+#ifndef SEXP_USE_INCREMENTAL_GC
+#define SEXP_USE_INCREMENTAL_GC 0
+#endif
+
+#ifndef SEXP_USE_PARALLEL_GC
+#define SEXP_USE_PARALLEL_GC 0
+#endif
+
+#ifndef SEXP_USE_COMPACT_GC
+#define SEXP_USE_COMPACT_GC 0
+#endif
+
+#ifndef SEXP_USE_SIZE_CLASSES
+#define SEXP_USE_SIZE_CLASSES ! SEXP_USE_NO_FEATURES
+#endif
+
+#ifndef SEXP_USE_LAZY_SWEEP
+#define SEXP_USE_LAZY_SWEEP ! SEXP_USE_NO_FEATURES
+#endif
+
+#ifndef SEXP_USE_TIME_GC
+#define SEXP_USE_TIME_GC 0
+#endif
+
 #ifndef SEXP_USE_SAFE_GC_MARK
 #define SEXP_USE_SAFE_GC_MARK SEXP_USE_DEBUG_GC > 1
 #endif
@@ -372,6 +623,45 @@
 #define SEXP_USE_CONSERVATIVE_GC 0
 #endif
 
+#if SEXP_USE_BOEHM || SEXP_USE_MALLOC || SEXP_USE_CONSERVATIVE_GC
+#undef SEXP_USE_GENERATIONAL_GC
+#define SEXP_USE_GENERATIONAL_GC 0
+#endif
+
+#if SEXP_USE_BOEHM || SEXP_USE_MALLOC || SEXP_USE_CONSERVATIVE_GC \
+  || SEXP_USE_GENERATIONAL_GC
+#undef SEXP_USE_INCREMENTAL_GC
+#define SEXP_USE_INCREMENTAL_GC 0
+#endif
+
+#if SEXP_USE_BOEHM || SEXP_USE_MALLOC || SEXP_USE_GENERATIONAL_GC \
+  || SEXP_USE_INCREMENTAL_GC
+#undef SEXP_USE_PARALLEL_GC
+#define SEXP_USE_PARALLEL_GC 0
+#endif
+
+#if SEXP_USE_BOEHM || SEXP_USE_MALLOC || SEXP_USE_CONSERVATIVE_GC \
+  || SEXP_USE_GENERATIONAL_GC || SEXP_USE_INCREMENTAL_GC
+#undef SEXP_USE_COMPACT_GC
+#define SEXP_USE_COMPACT_GC 0
+#endif
+
+#if SEXP_USE_BOEHM || SEXP_USE_MALLOC
+#undef SEXP_USE_TIME_GC
+#define SEXP_USE_TIME_GC 0
+#endif
+
+/* GC work which can't be done in the middle of C code is */
+/* deferred to a safe point in the VM */
+#define SEXP_USE_GC_SAFEPOINTS \
+  (SEXP_USE_GENERATIONAL_GC || SEXP_USE_INCREMENTAL_GC || SEXP_USE_COMPACT_GC)
+
+#if SEXP_USE_BOEHM || SEXP_USE_MALLOC || SEXP_USE_CONSERVATIVE_GC \
+  || SEXP_USE_GENERATIONAL_GC
+#undef SEXP_USE_LAZY_SWEEP
+#define SEXP_USE_LAZY_SWEEP 0
+#endif
+
 #ifndef SEXP_USE_TRACK_ALLOC_SOURCE
 #define SEXP_USE_TRACK_ALLOC_SOURCE SEXP_USE_DEBUG_GC > 2
 #endif
@@ -476,7 +766,7 @@
 #endif
 
 #ifndef SEXP_USE_IMMEDIATE_FLONUMS
-#define SEXP_USE_IMMEDIATE_FLONUMS 0
+#define SEXP_USE_IMMEDIATE_FLONUMS (SEXP_64_BIT && SEXP_USE_FLONUMS && ! SEXP_USE_NO_FEATURES)
 #endif
 
 #ifndef SEXP_USE_IEEE_EQV
@@ -556,6 +846,10 @@
 #define SEXP_USE_UNBOXED_LOCALS 0
 #endif
 
+#ifndef SEXP_USE_UNBOXED_FLONUMS
+#define SEXP_USE_UNBOXED_FLONUMS (SEXP_USE_FLONUMS && SEXP_USE_BIGNUMS && (SEXP_64_BIT || ! SEXP_USE_IMMEDIATE_FLONUMS) && ! SEXP_USE_AUTO_FORCE && ! SEXP_USE_NO_FEATURES)
+#endif
+
 #ifndef SEXP_USE_DEBUG_VM
 #define SEXP_USE_DEBUG_VM 0
 #endif
@@ -564,6 +858,42 @@
 #define SEXP_USE_PROFILE_VM 0
 #endif
 
+#ifndef SEXP_USE_THREADED_VM
+#define SEXP_USE_THREADED_VM 0
+#endif
+
+#if ! defined(__GNUC__) || SEXP_USE_DEBUG_VM || SEXP_USE_PROFILE_VM
+#undef SEXP_USE_THREADED_VM
+#define SEXP_USE_THREADED_VM 0
+#endif
+
+#if ! defined(__GNUC__) || ! defined(__x86_64__) || defined(_WIN32) || SEXP_USE_DEBUG_VM || SEXP_USE_PROFILE_VM || SEXP_USE_AUTO_FORCE
+#undef SEXP_USE_NATIVE_X86
+#define SEXP_USE_NATIVE_X86 0
+#endif
+
+/* calls before a procedure's bytecode is compiled */
+#ifndef SEXP_NATIVE_X86_THRESHOLD
+#define SEXP_NATIVE_X86_THRESHOLD 64
+#endif
+
+/* total bytes of machine code generated before the JIT gives up */
+#ifndef SEXP_NATIVE_X86_CODE_LIMIT
+#define SEXP_NATIVE_X86_CODE_LIMIT (64*1024*1024)
+#endif
+
+#ifndef SEXP_USE_SUPERINSTRUCTIONS
+#define SEXP_USE_SUPERINSTRUCTIONS ! SEXP_USE_NO_FEATURES
+#endif
+
+#ifndef SEXP_USE_INLINE_CACHES
+#define SEXP_USE_INLINE_CACHES SEXP_USE_SUPERINSTRUCTIONS
+#endif
+
+#ifndef SEXP_USE_ESCAPE_ANALYSIS
+#define SEXP_USE_ESCAPE_ANALYSIS ! SEXP_USE_NO_FEATURES
+#endif
+
 #ifndef SEXP_USE_EXTENDED_CHAR_NAMES
 #define SEXP_USE_EXTENDED_CHAR_NAMES ! SEXP_USE_NO_FEATURES
 #endif
@@ -657,6 +987,13 @@
 #define SEXP_USE_IMAGE_LOADING SEXP_USE_DL && !SEXP_USE_GLOBAL_HEAP && !SEXP_USE_BOEHM && !SEXP_USE_NO_FEATURES
 #endif
 
+#ifndef SEXP_USE_STATIC_IMAGE
+#define SEXP_USE_STATIC_IMAGE 0
+#elif ! SEXP_USE_IMAGE_LOADING
+#undef SEXP_USE_STATIC_IMAGE
+#define SEXP_USE_STATIC_IMAGE 0
+#endif
+
 #ifndef SEXP_USE_UNSAFE_PUSH
 #define SEXP_USE_UNSAFE_PUSH 0
 #endif
@@ -673,23 +1010,6 @@
 #define SEXP_USE_SEND_FILE (__linux || SEXP_BSD)
 #endif
 
-#if SEXP_USE_NATIVE_X86
-#undef SEXP_USE_BOEHM
-#define SEXP_USE_BOEHM 1
-#undef SEXP_USE_FLONUMS
-#define SEXP_USE_FLONUMS 0
-#undef SEXP_USE_BIGNUMS
-#define SEXP_USE_BIGNUMS 0
-#undef SEXP_USE_RATIOS
-#define SEXP_USE_RATIOS 0
-#undef SEXP_USE_COMPLEX
-#define SEXP_USE_COMPLEX 0
-#undef SEXP_USE_UTF8_STRINGS
-#define SEXP_USE_UTF8_STRINGS 0
-#undef SEXP_USE_SIMPLIFY
-#define SEXP_USE_SIMPLIFY 0
-#endif
-
 #ifndef SEXP_USE_ALIGNED_BYTECODE
 #if defined(__arm__)
 #define SEXP_USE_ALIGNED_BYTECODE 1
@@ -698,6 +1018,22 @@
 #endif
 #endif
 
+/* as for the JIT, and the compiled code assumes unaligned operands */
+#if SEXP_USE_NATIVE_X86 || SEXP_USE_DEBUG_VM || SEXP_USE_PROFILE_VM || SEXP_USE_AUTO_FORCE || SEXP_USE_ALIGNED_BYTECODE
+#undef SEXP_USE_AOT_LIBS
+#define SEXP_USE_AOT_LIBS 0
+#endif
+
+/* the cache walks operands as the compiled code does, and finds */
+/* parameters by their opcodes */
+#if SEXP_USE_ALIGNED_BYTECODE || ! SEXP_USE_GREEN_THREADS || defined(PLAN9) || defined(_WIN32)
+#undef SEXP_USE_FASL
+#define SEXP_USE_FASL 0
+#endif
+
+/* whether bytecode may have machine code attached */
+#define SEXP_USE_NATIVE_CODE (SEXP_USE_NATIVE_X86 || SEXP_USE_AOT_LIBS)
+
 #ifdef PLAN9
 #define strcasecmp cistrcmp
 #define strncasecmp cistrncmp
@@ -761,6 +1097,8 @@ typedef char sexp_abi_identifier_t[8];
 
 #if SEXP_USE_NATIVE_X86
 #define SEXP_ABI_BACKEND "x"
+#elif SEXP_USE_AOT_LIBS
+#define SEXP_ABI_BACKEND "a"
 #else
 #define SEXP_ABI_BACKEND "v"
 #endif
@@ -787,7 +1125,22 @@ typedef char sexp_abi_identifier_t[8];
 #define SEXP_ABI_MODULES "-"
 #endif
 
+/* upper case with immediate flonums, which libraries inline */
+#if SEXP_USE_FLONUMS && SEXP_USE_IMMEDIATE_FLONUMS
 #if (SEXP_USE_COMPLEX && SEXP_USE_RATIOS)
+#define SEXP_ABI_NUMBERS "+"
+#elif SEXP_USE_COMPLEX
+#define SEXP_ABI_NUMBERS "C"
+#elif SEXP_USE_RATIOS
+#define SEXP_ABI_NUMBERS "R"
+#elif SEXP_USE_BIGNUMS
+#define SEXP_ABI_NUMBERS "B"
+#elif SEXP_USE_INFINITIES
+#define SEXP_ABI_NUMBERS "I"
+#else
+#define SEXP_ABI_NUMBERS "F"
+#endif
+#elif (SEXP_USE_COMPLEX && SEXP_USE_RATIOS)
 #define SEXP_ABI_NUMBERS "*"
 #elif SEXP_USE_COMPLEX
 #define SEXP_ABI_NUMBERS "c"
@@ -10,6 +10,7 @@ extern "C" {
 #endif
 
 #define SEXP_MODULE_PATH_VAR "CHIBI_MODULE_PATH"
+#define SEXP_FASL_CACHE_VAR "CHIBI_FASL_CACHE"
 
 #include "chibi/features.h"
 #include "chibi/install.h"
@@ -206,6 +207,16 @@ typedef struct sexp_struct *sexp;
 #define sexp_heap_last_block(h) ((sexp)((char*)h->data + h->size - sexp_heap_align(sexp_free_chunk_size)))
 #define sexp_heap_end(h) ((sexp)((char*)h->data + h->size))
 
+/* free cells on the size class lists are formatted as dead byte */
+/* vectors so the heap can be walked without consulting the lists */
+#if SEXP_USE_SIZE_CLASSES
+#define sexp_size_class_of(size) ((size) / sexp_heap_align(1) - 1)
+#define sexp_free_cellp(x) (sexp_pointer_tag(x) == SEXP_BYTES && sexp_freep(x))
+#define sexp_free_cell_next(x) (*(sexp*)sexp_bytes_data(x))
+#else
+#define sexp_free_cellp(x) 0
+#endif
+
 #define __HALF_MAX_SIGNED(type) ((type)1 << (sizeof(type)*8-2))
 #define __MAX_SIGNED(type) (__HALF_MAX_SIGNED(type) - 1 + __HALF_MAX_SIGNED(type))
 #define __MIN_SIGNED(type) (-1 - __MAX_SIGNED(type))
@@ -246,6 +257,70 @@ typedef struct sexp_heap_t *sexp_heap;
 struct sexp_heap_t {
   sexp_uint_t size, max_size;
   sexp_free_list free_list;
+  /* the growth policy, only used in the first chunk - a new chunk */
+  /* grow_factor times the size of the last is added when more than */
+  /* grow_ratio of the heap is still live after a gc */
+  double grow_factor, grow_ratio;
+  /* grey objects waiting to be scanned, only used in the first chunk */
+  sexp *mark_stack;
+  sexp_uint_t mark_stack_len, mark_stack_size;
+  int mark_overflowp;
+#if SEXP_USE_SIZE_CLASSES
+  sexp size_classes[SEXP_SIZE_CLASSES];
+#endif
+#if SEXP_USE_GENERATIONAL_GC
+  /* the free block young objects are carved from while this chunk */
+  /* is the nursery, dropped whenever the free list is rebuilt */
+  sexp_free_list bump;
+  /* no free block is larger than this, reset by each sweep */
+  sexp_uint_t max_free;
+  /* only used in the first chunk */
+  sexp_heap nursery;
+  sexp *remembered;
+  sexp_uint_t remembered_len, remembered_size, major_size, nursery_used;
+  int promotingp;
+#endif
+#if SEXP_USE_GC_SAFEPOINTS
+  /* only used in the first chunk - nesting of vm and compiler */
+  /* frames, requested gc work only runs from the vm at depth 1 */
+  int vm_depth, gc_requested;
+#endif
+#if SEXP_USE_INCREMENTAL_GC
+  /* only used in the first chunk */
+  sexp *rescan;
+  sexp_uint_t rescan_len, rescan_size;
+  sexp_uint_t mark_budget, mark_debt, mark_threshold, allocated;
+  int markingp, rescan_overflowp;
+#endif
+#if SEXP_USE_PARALLEL_GC
+  /* only used in the first chunk, the pool is started on demand */
+  struct sexp_mark_pool_t *mark_pool;
+  int mark_threads;
+#endif
+#if SEXP_USE_TIME_GC
+  sexp_uint_t sweep_count, sweep_usecs; /* only used in the first chunk */
+#endif
+#if SEXP_USE_COMPACT_GC
+  /* only used in the first chunk - the heap size after the last */
+  /* compaction, and the number of them and bytes they've moved */
+  sexp_uint_t compact_size, compact_count, compact_moved;
+#endif
+#if ! SEXP_USE_GLOBAL_HEAP
+  /* full sweeps in a row which found this chunk empty, and whether */
+  /* its pages have already been given back to the OS */
+  int empty_sweeps, releasedp;
+  /* only used in the first chunk */
+  sexp_uint_t released_chunks, released_bytes;
+#endif
+#if SEXP_USE_IMAGE_LOADING
+  int mappedp;                  /* mmap'ed for an image */
+#endif
+#if SEXP_USE_LAZY_SWEEP
+  int unsweptp;                 /* still holds the marks of the last gc */
+#endif
+#if SEXP_USE_LAZY_SWEEP || SEXP_USE_INCREMENTAL_GC
+  sexp_uint_t live_size;        /* only used in the first chunk */
+#endif
   sexp_heap next;
   /* note this must be aligned on a proper heap boundary, */
   /* so we can't just use char data[] */
@@ -296,6 +371,7 @@ struct sexp_struct {
   unsigned int freep:1;
   unsigned int brokenp:1;
   unsigned int syntacticp:1;
+  unsigned int rememberedp:1;
 #if SEXP_USE_TRACK_ALLOC_SOURCE
   const char* source;
   void* backtrace[SEXP_BACKTRACE_SIZE];
@@ -378,6 +454,10 @@ struct sexp_struct {
     struct {
       sexp_uint_t length, max_depth;
       sexp name, literals, source;
+#if SEXP_USE_NATIVE_CODE
+      sexp_uint_t calls;
+      void *native;
+#endif
       unsigned char data[];
     } bytecode;
     struct {
@@ -523,6 +603,35 @@ void* sexp_alloc(sexp ctx, size_t size);
 #endif
 #endif
 
+/* old objects are rescanned on a minor gc only if written to, */
+/* and incremental marking shades anything stored in marked ones */
+#if SEXP_USE_GENERATIONAL_GC
+SEXP_API void sexp_remember (sexp ctx, sexp x);
+SEXP_API void sexp_unmark_heap (sexp ctx);
+SEXP_API sexp sexp_minor_gc (sexp ctx, size_t *sum_freed);
+#define sexp_write_barrier(ctx, x, y)                                   \
+  do {if (sexp_markedp(x) && !sexp_rememberedp(x) && (y)                \
+          && sexp_pointerp(y) && !sexp_markedp(y))                      \
+      sexp_remember(ctx, x);} while (0)
+#elif SEXP_USE_INCREMENTAL_GC
+SEXP_API void sexp_shade (sexp ctx, sexp x);
+SEXP_API void sexp_mark_step (sexp ctx);
+#define sexp_write_barrier(ctx, x, y)                                   \
+  do {if (sexp_markedp(x) && (y) && sexp_pointerp(y) && !sexp_markedp(y)) \
+      sexp_shade(ctx, y);} while (0)
+#else
+#define sexp_write_barrier(ctx, x, y)
+#endif
+
+/* objects may move in a compaction, anything keyed on their */
+/* addresses is stale once the count of compactions changes */
+#if SEXP_USE_COMPACT_GC
+SEXP_API void sexp_compact (sexp ctx);
+#define sexp_heap_compactions(ctx) (sexp_context_heap(ctx)->compact_count)
+#else
+#define sexp_heap_compactions(ctx) 0
+#endif
+
 #define sexp_gc_var1(x) sexp_gc_var(x, __sexp_gc_preserver1)
 #define sexp_gc_var2(x, y) sexp_gc_var1(x) sexp_gc_var(y, __sexp_gc_preserver2)
 #define sexp_gc_var3(x, y, z) sexp_gc_var2(x, y) sexp_gc_var(z, __sexp_gc_preserver3)
@@ -595,6 +704,7 @@ void* sexp_alloc(sexp ctx, size_t size);
 #define sexp_immutablep(x)       ((x)->immutablep)
 #define sexp_freep(x)            ((x)->freep)
 #define sexp_brokenp(x)          ((x)->brokenp)
+#define sexp_rememberedp(x)      ((x)->rememberedp)
 #define sexp_pointer_magic(x)    ((x)->magic)
 
 #if SEXP_USE_TRACK_ALLOC_SOURCE
@@ -610,21 +720,36 @@ void* sexp_alloc(sexp ctx, size_t size);
 
 #define sexp_isa(a, b) (sexp_pointerp(a) && sexp_typep(b) && (sexp_pointer_tag(a) == sexp_type_tag(b)))
 
-#if SEXP_USE_IMMEDIATE_FLONUMS
+#if SEXP_USE_IMMEDIATE_FLONUMS && SEXP_64_BIT
+/* Doubles whose exponent is within 2^7 of the middle of the range, */
+/* roughly 1e-38 to 1e38 in magnitude, plus both zeros, are stored */
+/* immediately: the bits are rotated left by one to put the sign at */
+/* the bottom, the exponent is rebased to fit in 8 bits and the */
+/* result is shifted over the tag.  Anything else, including the */
+/* infinities and NaNs, is boxed as usual, so every double maps to */
+/* exactly one representation and eqv? on immediates is eq?. */
+union sexp_flonum_conv {
+  double flonum;
+  sexp_uint_t bits;
+};
+#define SEXP_IFLONUM_EXP_BIAS ((sexp_uint_t)896 << 53)
+#define sexp_iflonump(x)     (((sexp_uint_t)(x) & SEXP_IMMEDIATE_MASK) == SEXP_IFLONUM_TAG)
+#define sexp_flonump(x)      (sexp_iflonump(x) || sexp_check_tag(x, SEXP_FLONUM))
+#define sexp_iflonum_rotated(r) ((r) <= 1 ? (r) : (r) + SEXP_IFLONUM_EXP_BIAS)
+#define sexp_iflonum_bits(r) (((r) >> 1) | ((r) << 63))
+#define sexp_iflonum_value(x) (((union sexp_flonum_conv)sexp_iflonum_bits(sexp_iflonum_rotated((sexp_uint_t)(x) >> SEXP_IMMEDIATE_BITS))).flonum)
+#define sexp_flonum_value(x) (sexp_iflonump(x) ? sexp_iflonum_value(x) : (x)->value.flonum)
+#define sexp_flonum_bits(f) ((f)->value.flonum_bits)
+SEXP_API sexp sexp_make_flonum(sexp ctx, double f);
+#elif SEXP_USE_IMMEDIATE_FLONUMS
 union sexp_flonum_conv {
   float flonum;
   unsigned int bits;
 };
 #define sexp_flonump(x)      (((sexp_uint_t)(x) & SEXP_IMMEDIATE_MASK) == SEXP_IFLONUM_TAG)
 SEXP_API sexp sexp_flonum_predicate (sexp ctx, sexp x);
-#if SEXP_64_BIT
-SEXP_API float sexp_flonum_value (sexp x);
-#define sexp_flonum_bits(f) ((char*)&f)
-SEXP_API sexp sexp_make_flonum(sexp ctx, float f);
-#else
 #define sexp_make_flonum(ctx, x)  ((sexp) ((((union sexp_flonum_conv)((float)(x))).bits & ~SEXP_IMMEDIATE_MASK) + SEXP_IFLONUM_TAG))
 #define sexp_flonum_value(x) (((union sexp_flonum_conv)(((unsigned int)(x)) & ~SEXP_IMMEDIATE_MASK)).flonum)
-#endif
 #else
 #define sexp_flonump(x)      (sexp_check_tag(x, SEXP_FLONUM))
 #define sexp_flonum_value(f) ((f)->value.flonum)
@@ -805,7 +930,13 @@ SEXP_API sexp sexp_make_unsigned_integer(sexp ctx, sexp_luint_t x);
   else if (sexp_fixnump(x))                             \
     x = sexp_fx_neg(x);
 
-#if SEXP_USE_IMMEDIATE_FLONUMS
+#if SEXP_USE_IMMEDIATE_FLONUMS && SEXP_64_BIT
+/* the sign is the low bit of an immediate, boxed ones are fresh */
+#define sexp_negate_flonum(x)                                           \
+  (x) = (sexp_iflonump(x)                                               \
+         ? (sexp)((sexp_uint_t)(x) ^ (1 << SEXP_IMMEDIATE_BITS))        \
+         : ((x)->value.flonum = -((x)->value.flonum), (x)))
+#elif SEXP_USE_IMMEDIATE_FLONUMS
 #define sexp_negate_flonum(x) (x) = sexp_make_flonum(NULL, -(sexp_flonum_value(x)))
 #else
 #define sexp_negate_flonum(x) sexp_flonum_value(x) = -(sexp_flonum_value(x))
@@ -952,6 +1083,10 @@ SEXP_API sexp sexp_make_unsigned_integer(sexp ctx, sexp_luint_t x);
 #define sexp_bytecode_literals(x) (sexp_field(x, bytecode, SEXP_BYTECODE, literals))
 #define sexp_bytecode_source(x)   (sexp_field(x, bytecode, SEXP_BYTECODE, source))
 #define sexp_bytecode_data(x)     (sexp_field(x, bytecode, SEXP_BYTECODE, data))
+#if SEXP_USE_NATIVE_CODE
+#define sexp_bytecode_calls(x)    (sexp_field(x, bytecode, SEXP_BYTECODE, calls))
+#define sexp_bytecode_native(x)   (sexp_field(x, bytecode, SEXP_BYTECODE, native))
+#endif
 
 #define sexp_env_cell_syntactic_p(x)   ((x)->syntacticp)
 
@@ -1377,6 +1512,7 @@ SEXP_API sexp sexp_read_error (sexp ctx, const char *msg, sexp ir, sexp port);
 SEXP_API sexp sexp_write_to_string (sexp ctx, sexp obj);
 SEXP_API sexp sexp_write_simple_object (sexp ctx, sexp self, sexp_sint_t n, sexp obj, sexp writer, sexp out);
 SEXP_API sexp sexp_finalize_port (sexp ctx, sexp self, sexp_sint_t n, sexp port);
+SEXP_API sexp sexp_finalize_fileno (sexp ctx, sexp self, sexp_sint_t n, sexp fileno);
 SEXP_API sexp sexp_make_fileno_op (sexp ctx, sexp self, sexp_sint_t n, sexp fd, sexp no_closep);
 SEXP_API sexp sexp_make_input_port (sexp ctx, FILE* in, sexp name);
 SEXP_API sexp sexp_make_output_port (sexp ctx, FILE* out, sexp name);
@@ -1470,6 +1606,12 @@ SEXP_API sexp_heap sexp_make_heap (size_t size, size_t max_size);
 SEXP_API void sexp_mark (sexp ctx, sexp x);
 SEXP_API sexp sexp_sweep (sexp ctx, size_t *sum_freed_ptr);
 SEXP_API sexp sexp_finalize (sexp ctx);
+#if SEXP_USE_LAZY_SWEEP
+SEXP_API void sexp_finish_sweep (sexp ctx);
+#endif
+#if SEXP_USE_INCREMENTAL_GC
+SEXP_API void sexp_cancel_marking (sexp ctx);
+#endif
 #endif
 
 #if SEXP_USE_GLOBAL_HEAP
@@ -1479,6 +1621,11 @@ SEXP_API sexp sexp_finalize (sexp ctx);
 SEXP_API void sexp_free_heap (sexp_heap heap);
 SEXP_API void sexp_destroy_context (sexp ctx);
 SEXP_API sexp sexp_copy_context (sexp ctx, sexp dst, sexp flags);
+#if SEXP_USE_IMAGE_LOADING
+SEXP_API sexp sexp_load_image (const char* file, sexp_uint_t heap_size, sexp_uint_t heap_max_size);
+SEXP_API sexp sexp_load_image_data (const char* data, sexp_uint_t len, sexp_uint_t heap_size, sexp_uint_t heap_max_size);
+SEXP_API int sexp_save_image (sexp ctx, const char* path);
+#endif
 #endif
 
 #if SEXP_USE_SAFE_GC_MARK
@@ -1633,9 +1780,35 @@ enum sexp_opcode_names {
   SEXP_OP_FORCE,
   SEXP_OP_RET,
   SEXP_OP_DONE,
+  SEXP_OP_LOCAL_REF_CAR,
+  SEXP_OP_LOCAL_REF_CDR,
+  SEXP_OP_CLOSURE_REF_CDR,
+  SEXP_OP_LOCAL_REF_JUMP_UNLESS,
+  SEXP_OP_GLOBAL_KNOWN_CALL,
+  SEXP_OP_LT_JUMP_UNLESS,
+  SEXP_OP_LE_JUMP_UNLESS,
+  SEXP_OP_EQN_JUMP_UNLESS,
+  SEXP_OP_EQ_JUMP_UNLESS,
+  SEXP_OP_NULLP_JUMP_UNLESS,
+  SEXP_OP_PAIRP_JUMP_UNLESS,
+  SEXP_OP_FLONUM_ARITH,
+  SEXP_OP_UNCHECKED_CAR,
+  SEXP_OP_UNCHECKED_CDR,
+  SEXP_OP_UNCHECKED_VECTOR_REF,
+  SEXP_OP_UNCHECKED_ADD,
+  SEXP_OP_UNCHECKED_SUB,
   SEXP_OP_NUM_OPCODES
 };
 
+/* SEXP_OP_FLONUM_ARITH programs are postfix sequences of 3-bit */
+/* steps, lowest first: either the next operand from the stack or */
+/* one of the binary arithmetic opcodes, starting from ADD */
+#define SEXP_FLONUM_ARITH_BITS 3
+#define SEXP_FLONUM_ARITH_MASK 7
+#define SEXP_FLONUM_ARITH_ARG 1
+#define SEXP_FLONUM_ARITH_OP(op) ((op) - SEXP_OP_ADD + 2)
+#define SEXP_FLONUM_ARITH_MAX_STEPS (sizeof(sexp_uint_t)*8/SEXP_FLONUM_ARITH_BITS)
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
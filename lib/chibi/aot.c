@@ -0,0 +1,220 @@
+/*  aot.c -- ahead-of-time compilation of bytecode to C       */
+/*  BSD-style license: http://synthcode.com/license.txt       */
+
+#include "chibi/eval.h"
+#if ! SEXP_USE_STATIC_LIBS
+#include "../../opt/opcode_names.h"
+#endif
+#include "../../opt/aot.h"
+
+#if SEXP_64_BIT
+#define SEXP_PRId "%ld"
+#else
+#define SEXP_PRId "%d"
+#endif
+
+static sexp sexp_bytecode_shape (sexp ctx, sexp self, sexp_sint_t n, sexp bc) {
+  sexp res;
+  sexp_assert_type(ctx, sexp_bytecodep, SEXP_BYTECODE, bc);
+  res = sexp_make_bytes(ctx, sexp_make_fixnum(sexp_bytecode_length(bc)),
+                        sexp_make_fixnum(0));
+  if (! sexp_exceptionp(res))
+    sexp_aot_shape(sexp_bytecode_data(bc), sexp_bytecode_length(bc),
+                   (unsigned char*)sexp_bytes_data(res));
+  return res;
+}
+
+/* adds the bytecode of x, and any it refers to, to *ls */
+static void sexp_add_bytecode (sexp ctx, sexp x, sexp *ls) {
+  unsigned char *data;
+  sexp_uint_t off, len;
+  int k, words;
+  if (sexp_procedurep(x))
+    x = sexp_procedure_code(x);
+  if (! sexp_bytecodep(x) || sexp_truep(sexp_memq(ctx, x, *ls)))
+    return;
+  *ls = sexp_cons(ctx, x, *ls);
+  data = sexp_bytecode_data(x);
+  len = sexp_bytecode_length(x);
+  for (off=0; off<len; off+=1+words*sizeof(sexp)) {
+    words = sexp_aot_operand_words(data[off]);
+    if (off + 1 + words*sizeof(sexp) > len)
+      break;
+    for (k=0; k<words; k++)
+      if (sexp_aot_object_operand_p(data[off], k))
+        sexp_add_bytecode(ctx, ((sexp*)(data+off+1))[k], ls);
+  }
+}
+
+static sexp sexp_env_bytecodes (sexp ctx, sexp self, sexp_sint_t n, sexp env) {
+  sexp ls;
+  sexp_gc_var1(res);
+  sexp_assert_type(ctx, sexp_envp, SEXP_ENV, env);
+  sexp_gc_preserve1(ctx, res);
+  res = SEXP_NULL;
+  for (ls=sexp_env_bindings(env); sexp_pairp(ls); ls=sexp_env_next_cell(ls))
+    sexp_add_bytecode(ctx, sexp_cdr(ls), &res);
+  sexp_gc_release1(ctx);
+  return res;
+}
+
+static void sexp_write_line (sexp ctx, sexp out, const char *fmt, sexp_sint_t a,
+                             sexp_sint_t b, sexp_sint_t c) {
+  char buf[128];
+  snprintf(buf, sizeof(buf), fmt, a, b, c);
+  sexp_write_string(ctx, buf, out);
+  sexp_newline(ctx, out);
+}
+
+/* Writes the instruction at off with the given operand words, */
+/* returning 0 if it's left to the VM. */
+static int sexp_write_instruction (sexp ctx, sexp out, unsigned char *data,
+                                   char *starts, sexp_sint_t len,
+                                   sexp_sint_t off, int words) {
+  sexp_sint_t w0 = words > 0 ? ((sexp_sint_t*)(data+off+1))[0] : 0,
+    w1 = words > 1 ? ((sexp_sint_t*)(data+off+1))[1] : 0, target;
+  const char *name = NULL;
+  switch (data[off]) {
+  case SEXP_OP_LOCAL_REF: name = "LOCAL_REF"; goto index;
+  case SEXP_OP_LOCAL_SET: name = "LOCAL_SET"; goto index;
+  case SEXP_OP_STACK_REF: name = "STACK_REF"; goto index;
+  case SEXP_OP_CLOSURE_REF: name = "CLOSURE_REF"; goto index;
+  case SEXP_OP_CLOSURE_REF_CDR: name = "CLOSURE_REF_CDR"; goto index;
+  case SEXP_OP_LOCAL_REF_CAR: name = "LOCAL_REF_CAR"; goto index;
+  case SEXP_OP_LOCAL_REF_CDR: name = "LOCAL_REF_CDR";
+  index:
+    sexp_write_string(ctx, "  _AOT_", out);
+    sexp_write_string(ctx, name, out);
+    sexp_write_line(ctx, out, "(" SEXP_PRId ", " SEXP_PRId ");", off, w0, 0);
+    return 1;
+  case SEXP_OP_TYPEP:
+    if (w0 == SEXP_OBJECT)
+      return 0;
+    sexp_write_line(ctx, out, "  _AOT_TYPEP(" SEXP_PRId ", " SEXP_PRId ");", off, w0, 0);
+    return 1;
+  case SEXP_OP_CALL: name = "CALL"; w1 = w0; goto call;
+  case SEXP_OP_TAIL_CALL: name = "TAIL_CALL"; w1 = w0; goto call;
+  case SEXP_OP_GLOBAL_KNOWN_CALL: name = "GLOBAL_KNOWN_CALL";
+  call:
+    /* the number of args is a fixnum */
+    sexp_write_string(ctx, "  _AOT_", out);
+    sexp_write_string(ctx, name, out);
+    sexp_write_line(ctx, out, "(" SEXP_PRId ", " SEXP_PRId ");", off,
+                    sexp_unbox_fixnum((sexp)w1), 0);
+    return 1;
+  case SEXP_OP_JUMP:
+    target = off + 1 + w0;
+    name = w0 < 0 ? "LOOP" : "JUMP";
+    goto jump;
+  case SEXP_OP_JUMP_UNLESS: name = "JUMP_UNLESS"; goto jump_unless;
+  case SEXP_OP_LT_JUMP_UNLESS: name = "LT_JUMP_UNLESS"; goto jump_unless;
+  case SEXP_OP_LE_JUMP_UNLESS: name = "LE_JUMP_UNLESS"; goto jump_unless;
+  case SEXP_OP_EQN_JUMP_UNLESS: name = "EQN_JUMP_UNLESS"; goto jump_unless;
+  case SEXP_OP_EQ_JUMP_UNLESS: name = "EQ_JUMP_UNLESS"; goto jump_unless;
+  case SEXP_OP_NULLP_JUMP_UNLESS: name = "NULLP_JUMP_UNLESS"; goto jump_unless;
+  case SEXP_OP_PAIRP_JUMP_UNLESS: name = "PAIRP_JUMP_UNLESS";
+  jump_unless:
+    target = off + 1 + w0;
+  jump:
+    if (target < 0 || target >= len || ! starts[target])
+      return 0;
+    sexp_write_string(ctx, "  _AOT_", out);
+    sexp_write_string(ctx, name, out);
+    sexp_write_line(ctx, out, "(" SEXP_PRId ", L" SEXP_PRId ");", off, target, 0);
+    return 1;
+  case SEXP_OP_LOCAL_REF_JUMP_UNLESS:
+    target = off + 1 + sizeof(sexp) + w1;
+    if (target < 0 || target >= len || ! starts[target])
+      return 0;
+    sexp_write_line(ctx, out, "  _AOT_LOCAL_REF_JUMP_UNLESS(" SEXP_PRId ", "
+                    SEXP_PRId ", L" SEXP_PRId ");", off, w0, target);
+    return 1;
+  case SEXP_OP_PUSH: name = "PUSH"; break;
+  case SEXP_OP_DROP: name = "DROP"; break;
+  case SEXP_OP_GLOBAL_REF: name = "GLOBAL_REF"; break;
+  case SEXP_OP_GLOBAL_KNOWN_REF: name = "GLOBAL_KNOWN_REF"; break;
+  case SEXP_OP_EQ: name = "EQ"; break;
+  case SEXP_OP_NULLP: name = "NULLP"; break;
+  case SEXP_OP_FIXNUMP: name = "FIXNUMP"; break;
+  case SEXP_OP_LT: name = "LT"; break;
+  case SEXP_OP_LE: name = "LE"; break;
+  case SEXP_OP_EQN: name = "EQN"; break;
+  case SEXP_OP_CAR: name = "CAR"; break;
+  case SEXP_OP_CDR: name = "CDR"; break;
+  case SEXP_OP_CONS: name = "CONS"; break;
+  case SEXP_OP_UNCHECKED_CAR: name = "UNCHECKED_CAR"; break;
+  case SEXP_OP_UNCHECKED_CDR: name = "UNCHECKED_CDR"; break;
+  case SEXP_OP_VECTOR_REF: name = "VECTOR_REF"; break;
+  case SEXP_OP_UNCHECKED_VECTOR_REF: name = "UNCHECKED_VECTOR_REF"; break;
+  case SEXP_OP_VECTOR_LENGTH: name = "VECTOR_LENGTH"; break;
+  case SEXP_OP_ADD: name = "ADD"; break;
+  case SEXP_OP_SUB: name = "SUB"; break;
+  case SEXP_OP_MUL: name = "MUL"; break;
+  case SEXP_OP_UNCHECKED_ADD: name = "UNCHECKED_ADD"; break;
+  case SEXP_OP_UNCHECKED_SUB: name = "UNCHECKED_SUB"; break;
+  case SEXP_OP_RET: name = "RET"; break;
+  default: return 0;
+  }
+  sexp_write_string(ctx, "  _AOT_", out);
+  sexp_write_string(ctx, name, out);
+  sexp_write_line(ctx, out, "(" SEXP_PRId ");", off, 0, 0);
+  return 1;
+}
+
+static sexp sexp_write_bytecode_c (sexp ctx, sexp self, sexp_sint_t n, sexp bc,
+                                   sexp name, sexp out) {
+  unsigned char *data;
+  char *starts;
+  sexp_sint_t off, len;
+  int words;
+  sexp_assert_type(ctx, sexp_bytecodep, SEXP_BYTECODE, bc);
+  sexp_assert_type(ctx, sexp_stringp, SEXP_STRING, name);
+  sexp_assert_type(ctx, sexp_oportp, SEXP_OPORT, out);
+  data = sexp_bytecode_data(bc);
+  len = sexp_bytecode_length(bc);
+  starts = (char*) calloc(len + 1, 1);
+  if (! starts)
+    return sexp_global(ctx, SEXP_G_OOM_ERROR);
+  for (off=0; off<len; off+=1+words*sizeof(sexp)) {
+    words = sexp_aot_operand_words(data[off]);
+    if (off + 1 + words*(sexp_sint_t)sizeof(sexp) > len)
+      break;
+    starts[off] = 1;
+  }
+  sexp_write_string(ctx, "static sexp_sint_t ", out);
+  sexp_write_string(ctx, sexp_string_data(name), out);
+  sexp_write_string(ctx, " (sexp_native_regs_t *regs, sexp_sint_t off) {\n", out);
+  sexp_write_string(ctx, "  _AOT_BEGIN;\n  switch (off) {\n", out);
+  for (off=0; off<len; off++)
+    if (starts[off])
+      sexp_write_line(ctx, out, "  case " SEXP_PRId ": goto L" SEXP_PRId ";", off, off, 0);
+  sexp_write_string(ctx, "  }\n  _AOT_EXIT(off);\n", out);
+  for (off=0; off<len; off+=1+words*sizeof(sexp)) {
+    if (! starts[off])
+      break;
+    words = sexp_aot_operand_words(data[off]);
+    sexp_write_line(ctx, out, " L" SEXP_PRId ":", off, 0, 0);
+    if (! sexp_write_instruction(ctx, out, data, starts, len, off, words)) {
+      sexp_write_line(ctx, out, "  _AOT_EXIT(" SEXP_PRId ");", off, 0, 0);
+      if (data[off] < SEXP_OP_NUM_OPCODES) {
+        sexp_write_string(ctx, "  /* ", out);
+        sexp_write_string(ctx, sexp_opcode_names[data[off]], out);
+        sexp_write_string(ctx, " */\n", out);
+      }
+    }
+  }
+  /* in case the last instruction falls through */
+  sexp_write_line(ctx, out, "  _AOT_EXIT(" SEXP_PRId ");\n}", off, 0, 0);
+  free(starts);
+  return SEXP_VOID;
+}
+
+sexp sexp_init_library (sexp ctx, sexp self, sexp_sint_t n, sexp env, const char* version, sexp_abi_identifier_t abi) {
+  if (!(sexp_version_compatible(ctx, version, sexp_version)
+        && sexp_abi_compatible(ctx, abi, SEXP_ABI_IDENTIFIER)))
+    return SEXP_ABI_ERROR;
+  sexp_define_foreign(ctx, env, "bytecode-shape", 1, sexp_bytecode_shape);
+  sexp_define_foreign(ctx, env, "env-bytecodes", 1, sexp_env_bytecodes);
+  sexp_define_foreign(ctx, env, "write-bytecode-c", 3, sexp_write_bytecode_c);
+  return SEXP_VOID;
+}
@@ -407,6 +407,79 @@ static sexp sexp_gc_op (sexp ctx, sexp self, sexp_sint_t n) {
   return sexp_make_unsigned_integer(ctx, sum_freed);
 }
 
+static sexp sexp_compact_heap_op (sexp ctx, sexp self, sexp_sint_t n) {
+#if SEXP_USE_COMPACT_GC
+  sexp_context_heap(ctx)->gc_requested = 1;
+  return SEXP_TRUE;
+#else
+  return SEXP_FALSE;
+#endif
+}
+
+#if ! SEXP_USE_BOEHM
+static sexp sexp_push_policy (sexp ctx, const char *name, sexp_uint_t size,
+                              double ratio, sexp ls) {
+  sexp_gc_var2(tmp, sym);
+  sexp_gc_preserve2(ctx, tmp, sym);
+  sym = sexp_intern(ctx, name, -1);
+#if SEXP_USE_FLONUMS
+  tmp = ratio ? sexp_make_flonum(ctx, ratio) : sexp_make_unsigned_integer(ctx, size);
+#else
+  tmp = sexp_make_unsigned_integer(ctx, ratio ? (sexp_uint_t)ratio : size);
+#endif
+  tmp = sexp_cons(ctx, sym, tmp);
+  ls = sexp_cons(ctx, tmp, ls);
+  sexp_gc_release2(ctx);
+  return ls;
+}
+#endif
+
+static sexp sexp_heap_policy_op (sexp ctx, sexp self, sexp_sint_t n) {
+  sexp_gc_var1(res);
+  sexp_gc_preserve1(ctx, res);
+  res = SEXP_NULL;
+#if ! SEXP_USE_BOEHM
+  res = sexp_push_policy(ctx, "grow-ratio", 0, sexp_context_heap(ctx)->grow_ratio, res);
+  res = sexp_push_policy(ctx, "grow-factor", 0, sexp_context_heap(ctx)->grow_factor, res);
+  res = sexp_push_policy(ctx, "max-size", sexp_context_heap(ctx)->max_size, 0, res);
+  res = sexp_push_policy(ctx, "initial-size", sexp_context_heap(ctx)->size, 0, res);
+#endif
+  sexp_gc_release1(ctx);
+  return res;
+}
+
+static sexp sexp_heap_policy_set_op (sexp ctx, sexp self, sexp_sint_t n, sexp name, sexp value) {
+#if ! SEXP_USE_BOEHM
+  sexp_heap h = sexp_context_heap(ctx);
+  double x;
+  sexp_assert_type(ctx, sexp_symbolp, SEXP_SYMBOL, name);
+  if (sexp_fixnump(value))
+    x = sexp_unbox_fixnum(value);
+#if SEXP_USE_FLONUMS
+  else if (sexp_flonump(value))
+    x = sexp_flonum_value(value);
+#endif
+  else
+    return sexp_type_exception(ctx, self, SEXP_NUMBER, value);
+  if (name == sexp_intern(ctx, "max-size", -1)) {
+    if (x < 0) return sexp_xtype_exception(ctx, self, "negative heap size", value);
+    h->max_size = (sexp_uint_t)x;
+  } else if (name == sexp_intern(ctx, "grow-factor", -1)) {
+    if (x < 1) return sexp_xtype_exception(ctx, self, "growth factor below 1", value);
+    h->grow_factor = x;
+  } else if (name == sexp_intern(ctx, "grow-ratio", -1)) {
+    if (x <= 0 || x >= 1)
+      return sexp_xtype_exception(ctx, self, "ratio not between 0 and 1", value);
+    h->grow_ratio = x;
+  } else {
+    return sexp_xtype_exception(ctx, self, "unknown heap policy", name);
+  }
+  return SEXP_TRUE;
+#else
+  return SEXP_FALSE;
+#endif
+}
+
 #if SEXP_USE_GREEN_THREADS
 static sexp sexp_set_atomic (sexp ctx, sexp self, sexp_sint_t n, sexp new) {
   sexp res = sexp_global(ctx, SEXP_G_ATOMIC_P);
@@ -609,6 +682,9 @@ sexp sexp_init_library (sexp ctx, sexp self, sexp_sint_t n, sexp env, const char
   sexp_define_foreign(ctx, env, "object-size", 1, sexp_object_size);
   sexp_define_foreign_opt(ctx, env, "integer->immediate", 2, sexp_integer_to_immediate, SEXP_FALSE);
   sexp_define_foreign(ctx, env, "gc", 0, sexp_gc_op);
+  sexp_define_foreign(ctx, env, "compact-heap!", 0, sexp_compact_heap_op);
+  sexp_define_foreign(ctx, env, "heap-policy", 0, sexp_heap_policy_op);
+  sexp_define_foreign(ctx, env, "heap-policy-set!", 2, sexp_heap_policy_set_op);
 #if SEXP_USE_GREEN_THREADS
   sexp_define_foreign(ctx, env, "%set-atomic!", 1, sexp_set_atomic);
 #endif
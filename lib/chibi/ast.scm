@@ -341,6 +341,29 @@
 
 ;;> Force a garbage collection.
 
+;;> \procedure{(compact-heap!)}
+
+;;> Request that the heap be compacted, moving live objects
+;;> together so that emptied heap chunks can be reused.  The
+;;> compaction runs before the next instruction of the outermost
+;;> VM.  Returns \scheme{#f} if this build can't compact the heap.
+
+;;> \procedure{(heap-policy)}
+
+;;> Returns an alist describing how the heap grows.
+;;> \scheme{initial-size} is the size of the first heap chunk and
+;;> \scheme{max-size} the size the heap can't grow past, or 0 for no
+;;> limit.  A chunk \scheme{grow-factor} times the size of the last
+;;> is added whenever more than \scheme{grow-ratio} of the heap is
+;;> still live after a collection.  Returns \scheme{'()} when using
+;;> the Boehm GC.
+
+;;> \procedure{(heap-policy-set! name value)}
+
+;;> Sets the \scheme{max-size}, \scheme{grow-factor} or
+;;> \scheme{grow-ratio} of the heap policy to \var{value}, taking
+;;> effect from the next collection.
+
 ;;> \procedure{(object-size x)}
 
 ;;> Returns the heap space directly used by \var{x}, not
@@ -80,10 +80,19 @@ static sexp disasm (sexp ctx, sexp self, sexp bc, sexp out, int depth) {
     switch (*ip++) {
     case SEXP_OP_JUMP:
     case SEXP_OP_JUMP_UNLESS:
+    case SEXP_OP_LT_JUMP_UNLESS:
+    case SEXP_OP_LE_JUMP_UNLESS:
+    case SEXP_OP_EQN_JUMP_UNLESS:
+    case SEXP_OP_EQ_JUMP_UNLESS:
+    case SEXP_OP_NULLP_JUMP_UNLESS:
+    case SEXP_OP_PAIRP_JUMP_UNLESS:
       off = ip - sexp_bytecode_data(bc) + ((sexp_sint_t*)ip)[0];
       if (off >= 0 && off < sexp_bytecode_length(bc) && labels[off] == 0)
         labels[off] = label++;
     case SEXP_OP_CALL:
+    case SEXP_OP_LOCAL_REF_CAR:
+    case SEXP_OP_LOCAL_REF_CDR:
+    case SEXP_OP_CLOSURE_REF_CDR:
     case SEXP_OP_CLOSURE_REF:
     case SEXP_OP_GLOBAL_KNOWN_REF:
     case SEXP_OP_GLOBAL_REF:
@@ -97,12 +106,18 @@ static sexp disasm (sexp ctx, sexp self, sexp bc, sexp out, int depth) {
     case SEXP_OP_TYPEP:
       ip += sizeof(sexp);
       break;
+    case SEXP_OP_LOCAL_REF_JUMP_UNLESS:
+      off = ip - sexp_bytecode_data(bc) + sizeof(sexp) + ((sexp_sint_t*)ip)[1];
+      if (off >= 0 && off < sexp_bytecode_length(bc) && labels[off] == 0)
+        labels[off] = label++;
     case SEXP_OP_SLOT_REF:
     case SEXP_OP_SLOT_SET:
     case SEXP_OP_MAKE:
+    case SEXP_OP_FLONUM_ARITH:
       ip += sizeof(sexp)*2;
       break;
     case SEXP_OP_MAKE_PROCEDURE:
+    case SEXP_OP_GLOBAL_KNOWN_CALL:
       ip += sizeof(sexp)*3;
       break;
     default:
@@ -152,11 +167,38 @@ static sexp disasm (sexp ctx, sexp self, sexp bc, sexp out, int depth) {
   case SEXP_OP_CLOSURE_REF:
   case SEXP_OP_TYPEP:
   case SEXP_OP_RESERVE:
+  case SEXP_OP_LOCAL_REF_CAR:
+  case SEXP_OP_LOCAL_REF_CDR:
+  case SEXP_OP_CLOSURE_REF_CDR:
     sexp_write_integer(ctx, ((sexp_sint_t*)ip)[0], out);
     ip += sizeof(sexp);
     break;
+  case SEXP_OP_LOCAL_REF_JUMP_UNLESS:
+    sexp_write_integer(ctx, ((sexp_sint_t*)ip)[0], out);
+    sexp_write_char(ctx, ' ', out);
+    sexp_write_integer(ctx, ((sexp_sint_t*)ip)[1], out);
+    off = ip - sexp_bytecode_data(bc) + sizeof(sexp) + ((sexp_sint_t*)ip)[1];
+    if (off >= 0 && off < sexp_bytecode_length(bc) && labels[off] > 0) {
+      sexp_write_string(ctx, " L", out);
+      sexp_write_integer(ctx, labels[off], out);
+    }
+    ip += sizeof(sexp)*2;
+    break;
+  case SEXP_OP_GLOBAL_KNOWN_CALL:
+    tmp = ((sexp*)ip)[0];
+    sexp_write(ctx, sexp_pairp(tmp) ? sexp_car(tmp) : tmp, out);
+    sexp_write_char(ctx, ' ', out);
+    sexp_write(ctx, ((sexp*)ip)[1], out);
+    ip += sizeof(sexp)*3;
+    break;
   case SEXP_OP_JUMP:
   case SEXP_OP_JUMP_UNLESS:
+  case SEXP_OP_LT_JUMP_UNLESS:
+  case SEXP_OP_LE_JUMP_UNLESS:
+  case SEXP_OP_EQN_JUMP_UNLESS:
+  case SEXP_OP_EQ_JUMP_UNLESS:
+  case SEXP_OP_NULLP_JUMP_UNLESS:
+  case SEXP_OP_PAIRP_JUMP_UNLESS:
     sexp_write_integer(ctx, ((sexp_sint_t*)ip)[0], out);
     off = ip - sexp_bytecode_data(bc) + ((sexp_sint_t*)ip)[0];
     if (off >= 0 && off < sexp_bytecode_length(bc) && labels[off] > 0) {
@@ -180,6 +222,14 @@ static sexp disasm (sexp ctx, sexp self, sexp bc, sexp out, int depth) {
   case SEXP_OP_MAKE:
     ip += sizeof(sexp)*2;
     break;
+  case SEXP_OP_FLONUM_ARITH:
+    /* the operand count and the program in postfix, e.g. xx*x+ */
+    sexp_write_integer(ctx, ((sexp_sint_t*)ip)[0], out);
+    sexp_write_char(ctx, ' ', out);
+    for (off=((sexp_sint_t*)ip)[1]; off; off >>= SEXP_FLONUM_ARITH_BITS)
+      sexp_write_char(ctx, "?x+-*/"[off & SEXP_FLONUM_ARITH_MASK], out);
+    ip += sizeof(sexp)*2;
+    break;
   case SEXP_OP_MAKE_PROCEDURE:
     sexp_write_integer(ctx, ((sexp_sint_t*)ip)[0], out);
     sexp_write_char(ctx, ' ', out);
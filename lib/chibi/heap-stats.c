@@ -81,6 +81,11 @@ static sexp sexp_heap_walk (sexp ctx, int depth, int printp) {
         p = (sexp) (((char*)p) + r->size);
         continue;
       }
+      /* free cells on the size class lists aren't really objects */
+      if (sexp_free_cellp(p)) {
+        p = (sexp) (((char*)p) + sexp_heap_align(sexp_allocated_bytes(ctx, p)));
+        continue;
+      }
       /* otherwise maybe print, then increment the stat and continue */
       if (sexp_oportp(out)) {
         sexp_print_simple(ctx, p, out, depth);
@@ -116,6 +121,46 @@ static sexp sexp_heap_dump (sexp ctx, sexp self, sexp_sint_t n, sexp depth) {
   return sexp_heap_walk(ctx, sexp_unbox_fixnum(depth), 1);
 }
 
+static sexp sexp_push_stat (sexp ctx, const char *name, sexp_uint_t value,
+                            sexp ls) {
+  sexp_gc_var2(tmp, sym);
+  sexp_gc_preserve2(ctx, tmp, sym);
+  sym = sexp_intern(ctx, name, -1);
+  tmp = sexp_make_unsigned_integer(ctx, value);
+  tmp = sexp_cons(ctx, sym, tmp);
+  ls = sexp_cons(ctx, tmp, ls);
+  sexp_gc_release2(ctx);
+  return ls;
+}
+
+static sexp sexp_gc_stats (sexp ctx, sexp self, sexp_sint_t n) {
+  sexp_heap h = sexp_context_heap(ctx);
+  sexp_uint_t chunks = 0;
+  sexp_gc_var1(res);
+  sexp_gc_preserve1(ctx, res);
+  res = SEXP_NULL;
+#if SEXP_USE_TIME_GC
+  res = sexp_push_stat(ctx, "sweep-usecs", h->sweep_usecs, res);
+  res = sexp_push_stat(ctx, "sweeps", h->sweep_count, res);
+#endif
+#if SEXP_USE_COMPACT_GC
+  res = sexp_push_stat(ctx, "compact-bytes", h->compact_moved, res);
+  res = sexp_push_stat(ctx, "compactions", h->compact_count, res);
+#endif
+#if ! SEXP_USE_GLOBAL_HEAP
+  res = sexp_push_stat(ctx, "released-bytes", h->released_bytes, res);
+  res = sexp_push_stat(ctx, "released-chunks", h->released_chunks, res);
+#endif
+#if SEXP_USE_PARALLEL_GC
+  res = sexp_push_stat(ctx, "mark-threads", h->mark_pool ? h->mark_threads : 1, res);
+#endif
+  for ( ; h; h=h->next)
+    chunks++;
+  res = sexp_push_stat(ctx, "chunks", chunks, res);
+  sexp_gc_release1(ctx);
+  return res;
+}
+
 #else
 
 static sexp sexp_heap_stats (sexp ctx, sexp self, sexp_sint_t n) {
@@ -126,6 +171,10 @@ static sexp sexp_heap_dump (sexp ctx, sexp self, sexp_sint_t n, sexp depth) {
   return SEXP_NULL;
 }
 
+static sexp sexp_gc_stats (sexp ctx, sexp self, sexp_sint_t n) {
+  return SEXP_NULL;
+}
+
 #endif
 
 sexp sexp_init_library (sexp ctx, sexp self, sexp_sint_t n, sexp env, const char* version, sexp_abi_identifier_t abi) {
@@ -134,5 +183,6 @@ sexp sexp_init_library (sexp ctx, sexp self, sexp_sint_t n, sexp env, const char
     return SEXP_ABI_ERROR;
   sexp_define_foreign(ctx, env, "heap-stats", 0, sexp_heap_stats);
   sexp_define_foreign_opt(ctx, env, "heap-dump", 1, sexp_heap_dump, SEXP_ONE);
+  sexp_define_foreign(ctx, env, "gc-stats", 0, sexp_gc_stats);
   return SEXP_VOID;
 }
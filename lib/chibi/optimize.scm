@@ -38,6 +38,45 @@
       (else
        x))))
 
+;; A reference to a new local of lam, named after the identifier
+;; id but distinct from any other variable.
+(define (fresh-local id lam)
+  (let ((name (make-syntactic-closure
+               (current-environment) '() (strip-syntactic-closures id))))
+    (lambda-locals-set! lam (cons name (lambda-locals lam)))
+    (make-ref name (cons name lam))))
+
+;; Converts the let ((f args ...)) into assignments to new locals of
+;; the enclosing lambda lam followed by the body of f, saving the
+;; call and, if f has free variables, the closure.  Variables which
+;; are set! would need fresh boxes each time the let is entered, so
+;; such lets are left alone.  The arguments are assigned right to
+;; left, the order in which the call would have evaluated them.
+(define (let->locals f args lam)
+  (and (list? (lambda-params f))
+       (= (length args) (length (lambda-params f)))
+       (null? (lambda-set-vars f))
+       (let ((subst (map (lambda (v) (cons v (fresh-local v lam)))
+                         (append (lambda-params f) (lambda-locals f)))))
+         (let rebind ((x (lambda-body f)))
+           (match x
+             (($ Ref name (_ . (? (lambda (g) (eq? g f)))))
+              (let ((new (cdr (assq name subst))))
+                (ref-name-set! x (ref-name new))
+                (ref-cell-set! x (ref-cell new))))
+             (($ Set ref value) (rebind ref) (rebind value))
+             (($ Cnd test pass fail) (rebind test) (rebind pass) (rebind fail))
+             (($ Seq ls) (for-each rebind ls))
+             (($ Lam name params body) (rebind body))
+             ((app ...) (for-each rebind app))
+             (else #f)))
+         (make-seq
+          (append (reverse
+                   (map (lambda (p a) (make-set (cdr (assq p subst)) a))
+                        (lambda-params f)
+                        args))
+                  (list (lambda-body f)))))))
+
 (define (join-seq a b)
   (make-seq (append (if (seq? a) (seq-ls a) (list a))
                     (if (seq? b) (seq-ls b) (list b)))))
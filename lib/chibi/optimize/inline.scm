@@ -0,0 +1,262 @@
+;; Calls to small known procedures are replaced with a copy of the
+;; procedure body, binding the parameters to fresh locals of the
+;; calling lambda.  A procedure is known if it's bound by a let or
+;; internal define which is never otherwise set!, or defined at the
+;; top-level of a sealed environment.  Only procedures whose bodies
+;; are at most inline-size-limit nodes and don't refer to enclosing
+;; locals are inlined, and inlining continues into the copied body
+;; up to inline-depth-limit levels deep.  A procedure is never
+;; inlined into itself, so recursion is left alone.
+
+(define inline-size-limit 24)
+(define inline-depth-limit 2)
+
+;; global cell -> (lambda . body) for procedures defined in sealed
+;; environments, and the cells which have been mutated since
+(define known-procedures (make-hash-table eq?))
+(define mutated-cells (make-hash-table eq?))
+
+(define (global-ref? x)
+  (and (ref? x) (not (lambda? (cdr (ref-cell x))))))
+
+;; The size of the body of lam, or #f if it's over the limit or
+;; refers to locals bound outside of lam.
+(define (inline-size lam)
+  (let size ((x (lambda-body lam)) (n 0) (lams (list lam)))
+    (define (size-all ls n)
+      (fold-every (lambda (x n) (size x n lams)) n ls))
+    (and
+     (<= n inline-size-limit)
+     (match x
+       (($ Ref _ (_ . (? lambda? f)))
+        (and (memq f lams) (+ n 1)))
+       (($ Set ref value)
+        (size-all (list ref value) (+ n 1)))
+       (($ Cnd test pass fail)
+        (size-all (list test pass fail) (+ n 1)))
+       (($ Seq ls)
+        (size-all ls n))
+       (($ Lam name params body)
+        (size body (+ n 1) (cons x lams)))
+       ((app ...)
+        (size-all app n))
+       (else
+        (+ n 1))))))
+
+;; Copies the body x of lam, replacing references to its parameters
+;; per the alist subst.  Inner lambdas are copied with references
+;; to their own variables rebound to the copies.
+(define (copy-body x lam subst)
+  (let copy ((x x) (lams '()))
+    (define (copy-all ls) (map (lambda (x) (copy x lams)) ls))
+    (match x
+      (($ Ref name (_ . (? lambda? f)))
+       (cond
+        ((eq? f lam)
+         (cond ((assq name subst) => cdr) (else x)))
+        ((assq f lams)
+         => (lambda (new) (make-ref name (cons name (cdr new)))))
+        (else
+         x)))
+      (($ Set ref value)
+       (make-set (copy ref lams) (copy value lams)))
+      (($ Cnd test pass fail)
+       (make-cnd (copy test lams) (copy pass lams) (copy fail lams)))
+      (($ Seq ls)
+       (make-seq (copy-all ls)))
+      (($ Lam name params body)
+       (let ((new (copy-lambda x)))
+         (lambda-body-set! new (copy body (cons (cons x new) lams)))
+         new))
+      ((app ...)
+       (copy-all app))
+      (else
+       x))))
+
+;; Returns (lambda . body) if lam can be inlined, where body is a
+;; copy of its body as yet untouched by any other optimizations.
+(define (inline-candidate lam)
+  (and (lambda? lam)
+       (list? (lambda-params lam))
+       (null? (lambda-locals lam))
+       (null? (lambda-set-vars lam))
+       (inline-size lam)
+       (cons lam (copy-body (lambda-body lam) lam '()))))
+
+;; Arguments which can be substituted for the parameter directly,
+;; constants and references to locals which are never set!.
+(define (simple-arg? x)
+  (cond
+   ((ref? x)
+    (let ((f (cdr (ref-cell x))))
+      (and (lambda? f) (not (memq (ref-name x) (lambda-set-vars f))))))
+   ((or (pair? x) (set? x) (cnd? x) (seq? x) (lambda? x)) #f)
+   (else #t)))
+
+;; Replaces the call (f args ...) with the body of the known
+;; procedure f, or returns #f if it can't be inlined here.  Other
+;; than simple arguments, each argument is bound to a fresh local
+;; of lam, right to left in the order the compiler evaluates them.
+(define (inline-call known args lam expanding depth)
+  (let ((params (lambda-params (car known))))
+    (and lam
+         (not (memq (car known) expanding))
+         (< depth inline-depth-limit)
+         (= (length params) (length args))
+         (let lp ((ps params) (as args) (subst '()) (sets '()))
+           (cond
+            ((pair? ps)
+             (if (simple-arg? (car as))
+                 (lp (cdr ps) (cdr as) (cons (cons (car ps) (car as)) subst) sets)
+                 (let ((ref (fresh-local (car ps) lam)))
+                   (lp (cdr ps) (cdr as) (cons (cons (car ps) ref) subst)
+                       (cons (make-set ref (car as)) sets)))))
+            (else
+             (let ((body (inline (copy-body (cdr known) (car known) subst)
+                                 lam
+                                 '()
+                                 (cons (car known) expanding)
+                                 (+ depth 1))))
+               (if (null? sets)
+                   body
+                   (make-seq (append sets (list body)))))))))))
+
+;; The procedures bound in lam which are never set! after being
+;; bound, either as let parameters or internal defines, as a list
+;; of (name lam . known) where known is from inline-candidate.
+(define (bound-procedures lam args)
+  (define (own-set? x)
+    (and (set? x) (eq? lam (cdr (ref-cell (set-var x))))))
+  (let* ((params
+          (if (and (pair? args) (list? (lambda-params lam))
+                   (= (length args) (length (lambda-params lam))))
+              (filter-map (lambda (p a) (and (lambda? a) (cons p a)))
+                          (lambda-params lam)
+                          args)
+              '()))
+         (defs
+          (let lp ((ls (let ((body (lambda-body lam)))
+                         (if (seq? body) (seq-ls body) (list body))))
+                   (res '()))
+            (if (and (pair? ls) (own-set? (car ls)))
+                (lp (cdr ls)
+                    (if (and (lambda? (set-value (car ls)))
+                             (memq (ref-name (set-var (car ls)))
+                                   (lambda-locals lam)))
+                        (cons (cons (ref-name (set-var (car ls)))
+                                    (set-value (car ls)))
+                              res)
+                        res))
+                res))))
+    (if (and (null? params) (null? defs))
+        '()
+        (let ((sets (let count ((x (lambda-body lam)) (res '()))
+                      (match x
+                        (($ Set ref value)
+                         (count value (if (own-set? x) (cons (ref-name ref) res) res)))
+                        (($ Cnd test pass fail)
+                         (count fail (count pass (count test res))))
+                        (($ Seq ls) (fold count res ls))
+                        (($ Lam name params body) (count body res))
+                        ((app ...) (fold count res app))
+                        (else res)))))
+          (filter-map
+           (lambda (x)
+             (let ((n (length (filter (lambda (y) (eq? y (car x))) sets))))
+               (and (= n (if (memq x params) 0 1))
+                    (cond ((inline-candidate (cdr x))
+                           => (lambda (k) (cons* (car x) lam k)))
+                          (else #f)))))
+           (append params defs))))))
+
+(define (inline x lam locals expanding depth)
+  (define (known-call f)
+    (match f
+      (($ Ref name (_ . (? lambda? f-lam)))
+       (let ((k (find (lambda (k) (and (eq? name (car k)) (eq? f-lam (cadr k))))
+                      locals)))
+         (and k (cddr k))))
+      (($ Ref name cell)
+       (and (not (hash-table-ref/default mutated-cells cell #f))
+            (hash-table-ref/default known-procedures cell #f)))
+      (else #f)))
+  (define (walk-list! ls)
+    (if (pair? ls)
+        (begin (set-car! ls (walk (car ls))) (walk-list! (cdr ls)))))
+  (define (walk x)
+    (match x
+      (($ Set ref value)
+       (set-value-set! x (walk value))
+       x)
+      (($ Cnd test pass fail)
+       (cnd-test-set! x (walk test))
+       (cnd-pass-set! x (walk pass))
+       (cnd-fail-set! x (walk fail))
+       x)
+      (($ Seq ls)
+       (walk-list! ls)
+       x)
+      (($ Lam name params body)
+       (lambda-body-set!
+        x
+        (inline body x (append (bound-procedures x '()) locals)
+                (cons x expanding) depth))
+       x)
+      (((and ($ Lam name params body) f) args ...)
+       (let ((bound (bound-procedures f args)))
+         (walk-list! (cdr x))
+         (lambda-body-set!
+          f
+          (inline body f (append bound locals) (cons f expanding) depth))
+         (or (and lam (let->locals f (cdr x) lam)) x)))
+      ((f args ...)
+       (walk-list! (cdr x))
+       (cond
+        ((known-call f)
+         => (lambda (known)
+              (or (inline-call known (cdr x) lam expanding depth) x)))
+        (else
+         (set-car! x (walk f))
+         x)))
+      (else
+       x)))
+  (walk x))
+
+;; Notes mutations of global cells so they're never inlined, and
+;; remembers top-level definitions in sealed environments.
+(define (note-definitions! ast)
+  (define (mutated! ref)
+    (if (global-ref? ref)
+        (let ((cell (ref-cell ref)))
+          (hash-table-set! mutated-cells cell #t)
+          (hash-table-delete! known-procedures cell))))
+  (let note ((x ast) (top? #t))
+    (match x
+      (($ Set ref value)
+       (cond
+        ((and top?
+              (global-ref? ref)
+              (not (hash-table-exists? known-procedures (ref-cell ref)))
+              (not (hash-table-exists? mutated-cells (ref-cell ref)))
+              (sealed-environment? (current-environment))
+              (inline-candidate value))
+         => (lambda (k) (hash-table-set! known-procedures (ref-cell ref) k)))
+        (else
+         (mutated! ref)))
+       (note value #f))
+      (($ Cnd test pass fail)
+       (note test #f) (note pass #f) (note fail #f))
+      (($ Seq ls)
+       (for-each (lambda (x) (note x top?)) ls))
+      (($ Lam name params body)
+       (note body #f))
+      ((app ...)
+       (for-each (lambda (x) (note x #f)) app))
+      (else
+       #f))))
+
+(define (optimize-inline ast)
+  (note-definitions! ast)
+  (inline ast #f '() '() 0))
+
+(register-optimization! optimize-inline 650)
@@ -0,0 +1,376 @@
+;; Local procedures which never escape, i.e. are only ever called
+;; directly with the right number of arguments, are lambda lifted:
+;; their free local variables are passed as extra arguments at
+;; each call, so that they have no free variables and compile to a
+;; constant procedure, stored in a new global cell private to the
+;; code being compiled.  This saves the closure and the box the
+;; procedure would otherwise be bound in, and named let loops and
+;; local helpers become plain calls through a known global.
+;;
+;; A free variable can only be passed by value if it's never set!,
+;; other than by an internal define binding it before any code which
+;; could call the lifted procedure runs, and procedures
+;; with more than lift-parameter-limit free variables are left as
+;; closures.  Once lifted, the lets binding them are usually free
+;; of mutable variables, and all such lets are converted into locals
+;; of the enclosing procedure, so entering a named let allocates
+;; nothing at all.
+
+(define lift-parameter-limit 8)
+
+;; A local procedure which may be lifted, bound to name in the
+;; lambda binder.
+(define-record-type Lifted
+  (make-lifted name binder lam cell free-vars deps inner)
+  lifted?
+  (name lifted-name)
+  (binder lifted-binder)
+  (lam lifted-lam)
+  (cell lifted-cell)
+  ;; list of (name . lambda) variables passed as extra arguments
+  (free-vars lifted-free-vars lifted-free-vars-set!)
+  ;; other lifted procedures this one calls
+  (deps lifted-deps lifted-deps-set!)
+  ;; this procedure's lambda and all of those nested in it
+  (inner lifted-inner lifted-inner-set!))
+
+(define (var-member name lam ls)
+  (find (lambda (v) (and (eq? name (car v)) (eq? lam (cdr v)))) ls))
+
+(define (find-lifted name lam lifted)
+  (find (lambda (l) (and (eq? name (lifted-name l)) (eq? lam (lifted-binder l))))
+        lifted))
+
+(define (body-list lam)
+  (let ((body (lambda-body lam)))
+    (if (seq? body) (seq-ls body) (list body))))
+
+;; Returns a procedure which gives the number of times each local
+;; variable is set! in ast, internal defines included.  The counts
+;; are only computed when first needed.
+(define (set-counter ast)
+  (let ((counts (make-hash-table eq?))
+        (counted? #f))
+    (define (count x)
+      (match x
+        (($ Set ($ Ref name (_ . (? lambda? f))) value)
+         (hash-table-update!/default
+          counts name
+          (lambda (ls)
+            (cond ((assq f ls) => (lambda (c) (set-cdr! c (+ (cdr c) 1)) ls))
+                  (else (cons (cons f 1) ls))))
+          '())
+         (count value))
+        (($ Set ref value) (count value))
+        (($ Cnd test pass fail) (count test) (count pass) (count fail))
+        (($ Seq ls) (for-each count ls))
+        (($ Lam name params body) (count body))
+        ((app ...) (for-each count app))
+        (else #f)))
+    (lambda (name f)
+      (if (not counted?)
+          (begin (count ast) (set! counted? #t)))
+      (cond ((assq f (hash-table-ref/default counts name '())) => cdr)
+            (else 0)))))
+
+;; The procedures bound by internal defines or let parameters which
+;; are only ever called directly, as a list of Lifted records.
+(define (lift-candidates ast set-count)
+  (define (liftable? x)
+    (and (lambda? x) (list? (lambda-params x))))
+  (define (defines lam)
+    (let lp ((ls (body-list lam)) (res '()))
+      (match ls
+        ((($ Set ($ Ref name (_ . (? (lambda (f) (eq? f lam))))) value) . rest)
+         (lp rest
+             (if (and (liftable? value)
+                      (memq name (lambda-locals lam))
+                      (= 1 (set-count name lam)))
+                 (cons (cons name value) res)
+                 res)))
+        (else res))))
+  (define (let-params f args)
+    (if (and (list? (lambda-params f))
+             (= (length args) (length (lambda-params f))))
+        (filter-map (lambda (p a)
+                      (and (liftable? a)
+                           (not (memq p (lambda-set-vars f)))
+                           (cons p a)))
+                    (lambda-params f)
+                    args)
+        '()))
+  (define (make name binder lam)
+    (make-lifted name binder lam
+                 (cons (strip-syntactic-closures name) (if #f #f))
+                 '() '() '()))
+  (let ((res '())
+        (escaped '()))
+    (let scan ((x ast))
+      (define (escape! name f)
+        (set! escaped (cons (cons name f) escaped)))
+      (match x
+        (($ Ref name (_ . (? lambda? f)))
+         (escape! name f))
+        (($ Set ref value)
+         (scan value))
+        (($ Cnd test pass fail)
+         (scan test) (scan pass) (scan fail))
+        (($ Seq ls)
+         (for-each scan ls))
+        (($ Lam name params body)
+         (for-each (lambda (d) (set! res (cons (make (car d) x (cdr d)) res)))
+                   (defines x))
+         (scan body))
+        (((and ($ Lam name params body) f) args ...)
+         (for-each (lambda (p) (set! res (cons (make (car p) f (cdr p)) res)))
+                   (let-params f args))
+         (scan f)
+         (for-each scan args))
+        ((($ Ref name (_ . (? lambda? f))) args ...)
+         (let ((l (find-lifted name f res)))
+           ;; callees are always bound outside the call, so already
+           ;; found, but the arity must match
+           (if (and l (not (= (length args) (length (lambda-params (lifted-lam l))))))
+               (escape! name f)))
+         (for-each scan args))
+        ((app ...)
+         (for-each scan app))
+        (else
+         #f)))
+    (remove (lambda (l) (var-member (lifted-name l) (lifted-binder l) escaped))
+            res)))
+
+;; Computes the variables each lifted procedure refers to which are
+;; bound outside of it, and the lifted procedures it calls.
+(define (note-free-vars! l lifted)
+  (let ((fv '()) (deps '()) (inner (list (lifted-lam l))))
+    (let walk ((x (lambda-body (lifted-lam l))))
+      (match x
+        (($ Ref name (_ . (? lambda? f)))
+         (cond
+          ((memq f inner))
+          ((find-lifted name f lifted)
+           => (lambda (d) (if (not (memq d deps)) (set! deps (cons d deps)))))
+          ((not (var-member name f fv))
+           (set! fv (cons (cons name f) fv)))))
+        (($ Set ref value) (walk ref) (walk value))
+        (($ Cnd test pass fail) (walk test) (walk pass) (walk fail))
+        (($ Seq ls) (for-each walk ls))
+        (($ Lam name params body)
+         (set! inner (cons x inner))
+         (walk body))
+        ((app ...) (for-each walk app))
+        (else #f)))
+    (lifted-free-vars-set! l (reverse fv))
+    (lifted-deps-set! l deps)
+    (lifted-inner-set! l inner)))
+
+;; A procedure needs the free variables of those it calls, less
+;; those it binds itself.
+(define (propagate-free-vars! lifted)
+  (let lp ()
+    (if (any (lambda (l)
+               (let ((new (fold
+                           (lambda (v res)
+                             (if (or (memq (cdr v) (lifted-inner l))
+                                     (var-member (car v) (cdr v) res)
+                                     (var-member (car v) (cdr v)
+                                                 (lifted-free-vars l)))
+                                 res
+                                 (cons v res)))
+                           '()
+                           (append-map lifted-free-vars (lifted-deps l)))))
+                 (and (pair? new)
+                      (begin
+                        (lifted-free-vars-set! l (append (lifted-free-vars l)
+                                                         (reverse new)))
+                        #t))))
+             lifted)
+        (lp))))
+
+;; True if the internal define of name in lam runs before anything
+;; which could call a lifted procedure, i.e. only lambdas are defined
+;; ahead of it in lam's body and its own value makes no calls.
+;; Otherwise a lifted procedure could read the variable before it's
+;; defined, and would be passed the undefined value.
+(define (defined-before-calls? name lam)
+  (define (no-calls? x)
+    (match x
+      (($ Lam name params body) #t)
+      (($ Set ref value) (no-calls? value))
+      (($ Cnd test pass fail)
+       (and (no-calls? test) (no-calls? pass) (no-calls? fail)))
+      (($ Seq ls) (every no-calls? ls))
+      ((app ...) #f)
+      (else #t)))
+  (let lp ((ls (body-list lam)))
+    (match ls
+      ((($ Set ($ Ref n (_ . (? (lambda (f) (eq? f lam))))) value) . rest)
+       (if (eq? n name)
+           (no-calls? value)
+           (and (lambda? value) (lp rest))))
+      (else #f))))
+
+;; A variable can be passed by value if it's never mutated after
+;; being bound.
+(define (pass-by-value? v set-count)
+  (or (not (memq (car v) (lambda-set-vars (cdr v))))
+      (and (memq (car v) (lambda-locals (cdr v)))
+           (= 1 (set-count (car v) (cdr v)))
+           (defined-before-calls? (car v) (cdr v)))))
+
+;; Narrows the candidates down to those whose free variables can all
+;; be passed as arguments.  Dropping one turns references to it into
+;; free variables of the others, so repeat until nothing changes.
+(define (resolve-lifted candidates set-count)
+  (let lp ((lifted candidates))
+    (for-each (lambda (l) (note-free-vars! l lifted)) lifted)
+    (propagate-free-vars! lifted)
+    (let ((ok (filter
+               (lambda (l)
+                 (and (<= (length (lifted-free-vars l)) lift-parameter-limit)
+                      (every (lambda (v) (pass-by-value? v set-count))
+                             (lifted-free-vars l))))
+               lifted)))
+      (if (= (length ok) (length lifted))
+          lifted
+          (lp ok)))))
+
+;; Rewrites ast with the procedures in lifted bound to their global
+;; cells, taking their free variables as extra parameters.
+(define (lift! ast lifted)
+  (define (cell-ref l)
+    (make-ref (car (lifted-cell l)) (lifted-cell l)))
+  (define (lam->lifted lam)
+    (find (lambda (l) (eq? lam (lifted-lam l))) lifted))
+  (let lift ((x ast) (subst '()))
+    (define (walk x) (lift x subst))
+    (define (walk-list! ls)
+      (if (pair? ls)
+          (begin (set-car! ls (walk (car ls))) (walk-list! (cdr ls)))))
+    (define (var-ref name f)
+      (walk (make-ref name (cons name f))))
+    (match x
+      (($ Ref name (_ . (? lambda? f)))
+       (cond ((find (lambda (s) (and (eq? name (caar s)) (eq? f (cdar s)))) subst)
+              => (lambda (s) (make-ref (cadr s) (cons (cadr s) (cddr s)))))
+             (else x)))
+      (($ Set ($ Ref name (_ . (? lambda? f))) value)
+       (cond
+        ((find-lifted name f lifted)
+         => (lambda (l) (set-var-set! x (cell-ref l)))))
+       (set-value-set! x (walk value))
+       x)
+      (($ Set ref value)
+       (set-value-set! x (walk value))
+       x)
+      (($ Cnd test pass fail)
+       (cnd-test-set! x (walk test))
+       (cnd-pass-set! x (walk pass))
+       (cnd-fail-set! x (walk fail))
+       x)
+      (($ Seq ls)
+       (walk-list! ls)
+       x)
+      (($ Lam name params body)
+       (cond
+        ((lam->lifted x)
+         => (lambda (l)
+              (let ((new (map (lambda (v)
+                                (make-syntactic-closure
+                                 (current-environment)
+                                 '()
+                                 (strip-syntactic-closures (car v))))
+                              (lifted-free-vars l))))
+                (lambda-params-set! x (append params new))
+                (lambda-body-set!
+                 x
+                 (lift body (map (lambda (v p) (cons v (cons p x)))
+                                 (lifted-free-vars l)
+                                 new)))
+                x)))
+        (else
+         (lambda-body-set! x (walk body))
+         x)))
+      (((and ($ Lam name params body) f) args ...)
+       (walk-list! (cdr x))
+       ;; lifted parameters are left unused, binding the cell instead
+       (let lp ((ps params) (as (cdr x)))
+         (cond
+          ((and (pair? ps) (pair? as))
+           (cond ((find-lifted (car ps) f lifted)
+                  => (lambda (l) (set-car! as (make-set (cell-ref l) (car as))))))
+           (lp (cdr ps) (cdr as)))))
+       (set-car! x (walk f))
+       x)
+      ((($ Ref name (_ . (? lambda? f))) args ...)
+       (cond
+        ((find-lifted name f lifted)
+         => (lambda (l)
+              (walk-list! (cdr x))
+              (set-car! x (cell-ref l))
+              (set-cdr! x (append (cdr x)
+                                  (map (lambda (v) (var-ref (car v) (cdr v)))
+                                       (lifted-free-vars l))))
+              x))
+        (else
+         (walk-list! x)
+         x)))
+      ((app ...)
+       (walk-list! app)
+       x)
+      (else
+       x))))
+
+;; Lifted procedures are no longer bound in their binders.
+(define (unbind-lifted! lifted)
+  (for-each
+   (lambda (l)
+     (let ((binder (lifted-binder l)))
+       (lambda-locals-set! binder (delete (lifted-name l) (lambda-locals binder) eq?))
+       (lambda-set-vars-set! binder
+                             (delete (lifted-name l) (lambda-set-vars binder) eq?))))
+   lifted))
+
+;; Converts every let free of mutable variables into locals of the
+;; enclosing procedure, innermost first.
+(define (flatten-lets! ast)
+  (let flatten ((x ast) (lam #f))
+    (define (walk-list! ls)
+      (if (pair? ls)
+          (begin (set-car! ls (flatten (car ls) lam)) (walk-list! (cdr ls)))))
+    (match x
+      (($ Set ref value)
+       (set-value-set! x (flatten value lam))
+       x)
+      (($ Cnd test pass fail)
+       (cnd-test-set! x (flatten test lam))
+       (cnd-pass-set! x (flatten pass lam))
+       (cnd-fail-set! x (flatten fail lam))
+       x)
+      (($ Seq ls)
+       (walk-list! ls)
+       x)
+      (($ Lam name params body)
+       (lambda-body-set! x (flatten body x))
+       x)
+      (((and ($ Lam name params body) f) args ...)
+       (walk-list! (cdr x))
+       (lambda-body-set! f (flatten body f))
+       (or (and lam (let->locals f (cdr x) lam)) x))
+      ((app ...)
+       (walk-list! app)
+       x)
+      (else
+       x))))
+
+(define (optimize-lift ast)
+  (let* ((set-count (set-counter ast))
+         (lifted (resolve-lifted (lift-candidates ast set-count) set-count)))
+    (if (pair? lifted)
+        (let ((res (lift! ast lifted)))
+          (unbind-lifted! lifted)
+          (flatten-lets! res))
+        (flatten-lets! ast))))
+
+(register-optimization! optimize-lift 600)
@@ -0,0 +1,15 @@
+/*  types.c -- low-level utilities for VM type check elision  */
+/*  BSD-style license: http://synthcode.com/license.txt       */
+
+#include <chibi/eval.h>
+
+/* unchecked-opcode is only bound in this library and not exported, */
+/* so the opcodes it returns are only reachable through the pass */
+
+sexp sexp_init_library (sexp ctx, sexp self, sexp_sint_t n, sexp env, const char* version, sexp_abi_identifier_t abi) {
+  if (!(sexp_version_compatible(ctx, version, sexp_version)
+        && sexp_abi_compatible(ctx, abi, SEXP_ABI_IDENTIFIER)))
+    return SEXP_ABI_ERROR;
+  sexp_define_foreign(ctx, env, "unchecked-opcode", 1, sexp_unchecked_opcode_op);
+  return SEXP_VOID;
+}
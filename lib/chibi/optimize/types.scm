@@ -0,0 +1,151 @@
+;; Opcodes whose operand types are proven are replaced with unchecked
+;; variants, which skip the type checks but not the bounds checks or
+;; fixnum overflow.  Unlike the type inference in (chibi
+;; type-inference), which infers the types a procedure requires,
+;; this only uses what is known to hold at each point: a local which
+;; is never set! is of a type within the true branch of a test with
+;; the corresponding predicate, after an opcode which checks that
+;; type has returned, or if it's bound by a let to a value of that
+;; type.  Facts about enclosing variables remain true within inner
+;; lambdas, and facts from the arguments to an application hold for
+;; the application itself but not between the arguments, whose
+;; evaluation order is unspecified.
+
+;; opcode -> unchecked opcode and the argument types it requires
+(define unchecked-opcodes
+  `((,car ,(unchecked-opcode '%unchecked-car) pair)
+    (,cdr ,(unchecked-opcode '%unchecked-cdr) pair)
+    (,vector-ref ,(unchecked-opcode '%unchecked-vector-ref) vector fixnum)
+    (,+ ,(unchecked-opcode '%unchecked-fx+) fixnum fixnum)
+    (,- ,(unchecked-opcode '%unchecked-fx-) fixnum fixnum)))
+
+;; opcode -> the argument types checked, which hold once it returns
+(define checked-opcodes
+  `((,car pair)
+    (,cdr pair)
+    (,set-car! pair #f)
+    (,set-cdr! pair #f)
+    (,vector-ref vector fixnum)
+    (,vector-set! vector fixnum #f)
+    (,vector-length vector)))
+
+;; opcodes which always return a fixnum
+(define fixnum-opcodes
+  (list vector-length string-length bytevector-length bytevector-u8-ref
+        char->integer))
+
+(define type-predicates
+  `((,pair? . pair) (,vector? . vector) (,fixnum? . fixnum)))
+
+(define (value-type x)
+  (cond ((fixnum? x) 'fixnum)
+        ((pair? x) 'pair)
+        ((vector? x) 'vector)
+        (else #f)))
+
+;; Facts are ((name . lambda) . type) for the local name bound in
+;; lambda.
+(define (fact=? a b)
+  (and (eq? (caar a) (caar b)) (eq? (cdar a) (cdar b)) (eq? (cdr a) (cdr b))))
+
+(define (fact-type facts var)
+  (cond ((find (lambda (f) (and (eq? (car var) (caar f)) (eq? (cdr var) (cdar f))))
+               facts)
+         => cdr)
+        (else #f)))
+
+;; The local variables set! anywhere in ast, as (name . lambda).
+(define (assigned-vars ast)
+  (let lp ((x ast) (res '()))
+    (match x
+      (($ Set ($ Ref name (_ . (? lambda? f))) value)
+       (lp value (cons (cons name f) res)))
+      (($ Set ref value) (lp value res))
+      (($ Cnd test pass fail) (lp fail (lp pass (lp test res))))
+      (($ Seq ls) (fold lp res ls))
+      (($ Lam name params body) (lp body res))
+      ((app ...) (fold lp res app))
+      (else res))))
+
+(define (optimize-types ast)
+  (define assigned (assigned-vars ast))
+  ;; (name . f) if the local name bound in f never changes
+  (define (tracked-var name f)
+    (and (not (memq name (lambda-set-vars f)))
+         (not (find (lambda (v) (and (eq? name (car v)) (eq? f (cdr v))))
+                    assigned))
+         (cons name f)))
+  (define (tracked x)
+    (match x
+      (($ Ref name (_ . (? lambda? f))) (tracked-var name f))
+      (else #f)))
+  (define (expr-type x facts)
+    (cond
+     ((lit? x) (value-type (lit-value x)))
+     ((ref? x) (cond ((tracked x) => (lambda (v) (fact-type facts v)))
+                     (else #f)))
+     ((pair? x) (and (memq (car x) fixnum-opcodes) 'fixnum))
+     ((fixnum? x) 'fixnum)
+     (else #f)))
+  ;; the facts which hold when the test x evaluates to true
+  (define (test-facts x)
+    (match x
+      (((? opcode? op) arg)
+       (cond ((and (assq op type-predicates) (tracked arg))
+              => (lambda (v) (list (cons v (cdr (assq op type-predicates))))))
+             (else '())))
+      (($ Cnd test pass (or #f ($ Lit #f)))
+       (append (test-facts test) (test-facts pass)))
+      (($ Seq (ls ... last))
+       (test-facts last))
+      (else '())))
+  (define (typed-facts vars types)
+    (filter-map (lambda (v t) (and v t (cons v t))) vars types))
+  (define (walk-args ls facts)
+    (fold (lambda (x res) (lset-union fact=? res (walk x facts))) facts ls))
+  ;; rewrites x, returning the facts which hold after it's evaluated
+  (define (walk x facts)
+    (match x
+      (($ Set ref value)
+       (walk value facts))
+      (($ Cnd test pass fail)
+       (let ((facts (walk test facts)))
+         (lset-intersection fact=?
+                            (walk pass (append (test-facts test) facts))
+                            (walk fail facts))))
+      (($ Seq ls)
+       (fold walk facts ls))
+      (($ Lam name params body)
+       (walk body facts)
+       facts)
+      (((and ($ Lam name (? list? params) body) f) args ...)
+       (let ((facts (walk-args args facts)))
+         (if (= (length params) (length args))
+             (walk body
+                   (append
+                    (typed-facts
+                     (map (lambda (p) (tracked-var p f)) params)
+                     (map (lambda (a) (expr-type a facts)) args))
+                    facts))
+             (begin (walk body facts) facts))))
+      (((? opcode? op) args ...)
+       (let ((facts (walk-args args facts)))
+         (cond
+          ((assq op unchecked-opcodes)
+           => (lambda (u)
+                (if (equal? (cddr u)
+                            (map (lambda (a) (expr-type a facts)) args))
+                    (set-car! x (cadr u))))))
+         (cond
+          ((assq op checked-opcodes)
+           => (lambda (c) (append (typed-facts (map tracked args) (cdr c))
+                                  facts)))
+          (else facts))))
+      ((app ...)
+       (walk-args app facts))
+      (else
+       facts)))
+  (walk ast '())
+  ast)
+
+(register-optimization! optimize-types 700)
@@ -0,0 +1,497 @@
+/* Automatically generated by chibi-ffi; version: 0.2 */
+
+#include <chibi/eval.h>
+
+#include <sys/types.h>
+
+#include <sys/wait.h>
+
+#include <signal.h>
+
+#include <unistd.h>
+
+#include "signal.c"
+
+static sexp sexp_parent_process_id_stub (sexp ctx, sexp self, sexp_sint_t n) {
+  sexp res;
+  res = sexp_make_unsigned_integer(ctx, getppid());
+  return res;
+}
+
+static sexp sexp_current_process_id_stub (sexp ctx, sexp self, sexp_sint_t n) {
+  sexp res;
+  res = sexp_make_unsigned_integer(ctx, getpid());
+  return res;
+}
+
+static sexp sexp_execute_stub (sexp ctx, sexp self, sexp_sint_t n, sexp arg0, sexp arg1) {
+  int i;
+  char* *tmp1;
+  sexp res;
+  if (! sexp_stringp(arg0))
+    return sexp_type_exception(ctx, self, SEXP_STRING, arg0);
+  for (res=arg1; sexp_pairp(res); res=sexp_cdr(res))
+    if (! sexp_stringp(sexp_car(res)))
+      return sexp_xtype_exception(ctx, self, "not a list of strings", arg1);
+  if (! sexp_nullp(res))
+    return sexp_xtype_exception(ctx, self, "not a list of strings", arg1);
+  tmp1 = (char**) calloc((sexp_unbox_fixnum(sexp_length(ctx, arg1))+1), sizeof(tmp1[0]));
+  for (i=0, res=arg1; sexp_pairp(res); res=sexp_cdr(res), i++) {
+    tmp1[i] = sexp_string_data(sexp_car(res));
+  }
+  tmp1[i] = 0;
+  res = sexp_make_integer(ctx, execvp(sexp_string_data(arg0), tmp1));
+  free(tmp1);
+  return res;
+}
+
+static sexp sexp_25_exit_stub (sexp ctx, sexp self, sexp_sint_t n, sexp arg0) {
+  sexp res;
+  if (! sexp_exact_integerp(arg0))
+    return sexp_type_exception(ctx, self, SEXP_FIXNUM, arg0);
+  res = ((exit(sexp_sint_value(arg0))), SEXP_VOID);
+  return res;
+}
+
+static sexp sexp_kill_stub (sexp ctx, sexp self, sexp_sint_t n, sexp arg0, sexp arg1) {
+  int err;
+  sexp res;
+  if (! sexp_exact_integerp(arg0))
+    return sexp_type_exception(ctx, self, SEXP_FIXNUM, arg0);
+  if (! sexp_exact_integerp(arg1))
+    return sexp_type_exception(ctx, self, SEXP_FIXNUM, arg1);
+  err = kill(sexp_sint_value(arg0), sexp_sint_value(arg1));
+  if (err) {
+  res = SEXP_FALSE;
+  } else {
+  res = SEXP_TRUE;
+  }
+  return res;
+}
+
+static sexp sexp_waitpid_stub (sexp ctx, sexp self, sexp_sint_t n, sexp arg0, sexp arg2) {
+  int tmp1;
+  sexp_gc_var2(res, res1);
+  if (! sexp_exact_integerp(arg0))
+    return sexp_type_exception(ctx, self, SEXP_FIXNUM, arg0);
+  if (! sexp_exact_integerp(arg2))
+    return sexp_type_exception(ctx, self, SEXP_FIXNUM, arg2);
+  sexp_gc_preserve2(ctx, res, res1);
+  res = sexp_make_unsigned_integer(ctx, waitpid(sexp_sint_value(arg0), &tmp1, sexp_sint_value(arg2)));
+  res1 = sexp_make_integer(ctx, tmp1);
+  res = sexp_cons(ctx, res, SEXP_NULL);
+  sexp_push(ctx, res, sexp_car(res));
+  sexp_cadr(res) = res1;
+  sexp_gc_release2(ctx);
+  return res;
+}
+
+static sexp sexp_fork_stub (sexp ctx, sexp self, sexp_sint_t n) {
+  sexp res;
+  res = sexp_make_unsigned_integer(ctx, sexp_fork_and_kill_threads(ctx));
+  return res;
+}
+
+static sexp sexp_25_fork_stub (sexp ctx, sexp self, sexp_sint_t n) {
+  sexp res;
+  res = sexp_make_unsigned_integer(ctx, fork());
+  return res;
+}
+
+static sexp sexp_sleep_stub (sexp ctx, sexp self, sexp_sint_t n, sexp arg0) {
+  sexp res;
+  if (! sexp_exact_integerp(arg0))
+    return sexp_type_exception(ctx, self, SEXP_FIXNUM, arg0);
+  res = sexp_make_unsigned_integer(ctx, sleep(sexp_uint_value(arg0)));
+  return res;
+}
+
+static sexp sexp_alarm_stub (sexp ctx, sexp self, sexp_sint_t n, sexp arg0) {
+  sexp res;
+  if (! sexp_exact_integerp(arg0))
+    return sexp_type_exception(ctx, self, SEXP_FIXNUM, arg0);
+  res = sexp_make_unsigned_integer(ctx, alarm(sexp_uint_value(arg0)));
+  return res;
+}
+
+static sexp sexp_current_signal_mask_stub (sexp ctx, sexp self, sexp_sint_t n) {
+  int err;
+  sigset_t *tmp2;
+  sexp res;
+  sexp_gc_var1(res2);
+  sexp_gc_preserve1(ctx, res2);
+  tmp2 = calloc(1, 1 + sizeof(tmp2[0]));
+  err = sigprocmask(SIG_BLOCK, NULL, tmp2);
+  if (err) {
+  res = SEXP_FALSE;
+  } else {
+  res2 = sexp_make_cpointer(ctx, sexp_unbox_fixnum(sexp_opcode_arg3_type(self)), tmp2, SEXP_FALSE, 1);
+  res = res2;
+  }
+  sexp_gc_release1(ctx);
+  return res;
+}
+
+static sexp sexp_signal_mask_set_x_stub (sexp ctx, sexp self, sexp_sint_t n, sexp arg1) {
+  int err;
+  sexp res;
+  if (! (sexp_pointerp(arg1) && (sexp_pointer_tag(arg1) == sexp_unbox_fixnum(sexp_opcode_arg2_type(self)))))
+    return sexp_type_exception(ctx, self, sexp_unbox_fixnum(sexp_opcode_arg2_type(self)), arg1);
+  err = sigprocmask(SIG_SETMASK, (sigset_t*)sexp_cpointer_value(arg1), NULL);
+  if (err) {
+  res = SEXP_FALSE;
+  } else {
+  res = SEXP_TRUE;
+  }
+  return res;
+}
+
+static sexp sexp_signal_mask_unblock_x_stub (sexp ctx, sexp self, sexp_sint_t n, sexp arg1) {
+  int err;
+  sexp res;
+  if (! (sexp_pointerp(arg1) && (sexp_pointer_tag(arg1) == sexp_unbox_fixnum(sexp_opcode_arg2_type(self)))))
+    return sexp_type_exception(ctx, self, sexp_unbox_fixnum(sexp_opcode_arg2_type(self)), arg1);
+  err = sigprocmask(SIG_UNBLOCK, (sigset_t*)sexp_cpointer_value(arg1), NULL);
+  if (err) {
+  res = SEXP_FALSE;
+  } else {
+  res = SEXP_TRUE;
+  }
+  return res;
+}
+
+static sexp sexp_signal_mask_block_x_stub (sexp ctx, sexp self, sexp_sint_t n, sexp arg1) {
+  int err;
+  sexp res;
+  if (! (sexp_pointerp(arg1) && (sexp_pointer_tag(arg1) == sexp_unbox_fixnum(sexp_opcode_arg2_type(self)))))
+    return sexp_type_exception(ctx, self, sexp_unbox_fixnum(sexp_opcode_arg2_type(self)), arg1);
+  err = sigprocmask(SIG_BLOCK, (sigset_t*)sexp_cpointer_value(arg1), NULL);
+  if (err) {
+  res = SEXP_FALSE;
+  } else {
+  res = SEXP_TRUE;
+  }
+  return res;
+}
+
+static sexp sexp_signal_set_contains_p_stub (sexp ctx, sexp self, sexp_sint_t n, sexp arg0, sexp arg1) {
+  sexp res;
+  if (! (sexp_pointerp(arg0) && (sexp_pointer_tag(arg0) == sexp_unbox_fixnum(sexp_opcode_arg1_type(self)))))
+    return sexp_type_exception(ctx, self, sexp_unbox_fixnum(sexp_opcode_arg1_type(self)), arg0);
+  if (! sexp_exact_integerp(arg1))
+    return sexp_type_exception(ctx, self, SEXP_FIXNUM, arg1);
+  res = sexp_make_boolean(sigismember((sigset_t*)sexp_cpointer_value(arg0), sexp_sint_value(arg1)));
+  return res;
+}
+
+static sexp sexp_signal_set_delete_x_stub (sexp ctx, sexp self, sexp_sint_t n, sexp arg0, sexp arg1) {
+  int err;
+  sexp res;
+  if (! (sexp_pointerp(arg0) && (sexp_pointer_tag(arg0) == sexp_unbox_fixnum(sexp_opcode_arg1_type(self)))))
+    return sexp_type_exception(ctx, self, sexp_unbox_fixnum(sexp_opcode_arg1_type(self)), arg0);
+  if (! sexp_exact_integerp(arg1))
+    return sexp_type_exception(ctx, self, SEXP_FIXNUM, arg1);
+  err = sigdelset((sigset_t*)sexp_cpointer_value(arg0), sexp_sint_value(arg1));
+  if (err) {
+  res = SEXP_FALSE;
+  } else {
+  res = SEXP_TRUE;
+  }
+  return res;
+}
+
+static sexp sexp_signal_set_add_x_stub (sexp ctx, sexp self, sexp_sint_t n, sexp arg0, sexp arg1) {
+  int err;
+  sexp res;
+  if (! (sexp_pointerp(arg0) && (sexp_pointer_tag(arg0) == sexp_unbox_fixnum(sexp_opcode_arg1_type(self)))))
+    return sexp_type_exception(ctx, self, sexp_unbox_fixnum(sexp_opcode_arg1_type(self)), arg0);
+  if (! sexp_exact_integerp(arg1))
+    return sexp_type_exception(ctx, self, SEXP_FIXNUM, arg1);
+  err = sigaddset((sigset_t*)sexp_cpointer_value(arg0), sexp_sint_value(arg1));
+  if (err) {
+  res = SEXP_FALSE;
+  } else {
+  res = SEXP_TRUE;
+  }
+  return res;
+}
+
+static sexp sexp_signal_set_fill_x_stub (sexp ctx, sexp self, sexp_sint_t n, sexp arg0) {
+  int err;
+  sexp res;
+  if (! (sexp_pointerp(arg0) && (sexp_pointer_tag(arg0) == sexp_unbox_fixnum(sexp_opcode_arg1_type(self)))))
+    return sexp_type_exception(ctx, self, sexp_unbox_fixnum(sexp_opcode_arg1_type(self)), arg0);
+  err = sigfillset((sigset_t*)sexp_cpointer_value(arg0));
+  if (err) {
+  res = SEXP_FALSE;
+  } else {
+  res = SEXP_TRUE;
+  }
+  return res;
+}
+
+static sexp sexp_make_signal_set_stub (sexp ctx, sexp self, sexp_sint_t n) {
+  int err;
+  sigset_t *tmp0;
+  sexp res;
+  sexp_gc_var1(res0);
+  sexp_gc_preserve1(ctx, res0);
+  tmp0 = calloc(1, 1 + sizeof(tmp0[0]));
+  err = sigemptyset(tmp0);
+  if (err) {
+  res = SEXP_FALSE;
+  } else {
+  res0 = sexp_make_cpointer(ctx, sexp_unbox_fixnum(sexp_opcode_arg1_type(self)), tmp0, SEXP_FALSE, 1);
+  res = res0;
+  }
+  sexp_gc_release1(ctx);
+  return res;
+}
+
+static sexp sexp_set_signal_action_x_stub (sexp ctx, sexp self, sexp_sint_t n, sexp arg2, sexp arg3) {
+  sexp res;
+  res = sexp_set_signal_action(ctx, self, arg2, arg3);
+  return res;
+}
+
+static sexp sexp_siginfo_t_get_si_signo (sexp ctx, sexp self, sexp_sint_t n, sexp x) {
+  if (! (sexp_pointerp(x) && (sexp_pointer_tag(x) == sexp_unbox_fixnum(sexp_opcode_arg1_type(self)))))
+    return sexp_type_exception(ctx, self, sexp_unbox_fixnum(sexp_opcode_arg1_type(self)), x);
+  return sexp_make_integer(ctx, (( siginfo_t*)sexp_cpointer_value(x))->si_signo);
+}
+
+static sexp sexp_siginfo_t_get_si_errno (sexp ctx, sexp self, sexp_sint_t n, sexp x) {
+  if (! (sexp_pointerp(x) && (sexp_pointer_tag(x) == sexp_unbox_fixnum(sexp_opcode_arg1_type(self)))))
+    return sexp_type_exception(ctx, self, sexp_unbox_fixnum(sexp_opcode_arg1_type(self)), x);
+  return sexp_make_integer(ctx, (( siginfo_t*)sexp_cpointer_value(x))->si_errno);
+}
+
+static sexp sexp_siginfo_t_get_si_code (sexp ctx, sexp self, sexp_sint_t n, sexp x) {
+  if (! (sexp_pointerp(x) && (sexp_pointer_tag(x) == sexp_unbox_fixnum(sexp_opcode_arg1_type(self)))))
+    return sexp_type_exception(ctx, self, sexp_unbox_fixnum(sexp_opcode_arg1_type(self)), x);
+  return sexp_make_integer(ctx, (( siginfo_t*)sexp_cpointer_value(x))->si_code);
+}
+
+static sexp sexp_siginfo_t_get_si_pid (sexp ctx, sexp self, sexp_sint_t n, sexp x) {
+  if (! (sexp_pointerp(x) && (sexp_pointer_tag(x) == sexp_unbox_fixnum(sexp_opcode_arg1_type(self)))))
+    return sexp_type_exception(ctx, self, sexp_unbox_fixnum(sexp_opcode_arg1_type(self)), x);
+  return sexp_make_unsigned_integer(ctx, (( siginfo_t*)sexp_cpointer_value(x))->si_pid);
+}
+
+static sexp sexp_siginfo_t_get_si_uid (sexp ctx, sexp self, sexp_sint_t n, sexp x) {
+  if (! (sexp_pointerp(x) && (sexp_pointer_tag(x) == sexp_unbox_fixnum(sexp_opcode_arg1_type(self)))))
+    return sexp_type_exception(ctx, self, sexp_unbox_fixnum(sexp_opcode_arg1_type(self)), x);
+  return sexp_make_unsigned_integer(ctx, (( siginfo_t*)sexp_cpointer_value(x))->si_uid);
+}
+
+static sexp sexp_siginfo_t_get_si_status (sexp ctx, sexp self, sexp_sint_t n, sexp x) {
+  if (! (sexp_pointerp(x) && (sexp_pointer_tag(x) == sexp_unbox_fixnum(sexp_opcode_arg1_type(self)))))
+    return sexp_type_exception(ctx, self, sexp_unbox_fixnum(sexp_opcode_arg1_type(self)), x);
+  return sexp_make_integer(ctx, (( siginfo_t*)sexp_cpointer_value(x))->si_status);
+}
+
+
+sexp sexp_init_library (sexp ctx, sexp self, sexp_sint_t n, sexp env, const char* version, sexp_abi_identifier_t abi) {
+  sexp sexp_sigset_t_type_obj;
+  sexp sexp_siginfo_t_type_obj;
+  sexp_gc_var3(name, tmp, op);
+  if (!(sexp_version_compatible(ctx, version, sexp_version)
+        && sexp_abi_compatible(ctx, abi, SEXP_ABI_IDENTIFIER)))
+    return SEXP_ABI_ERROR;
+  sexp_gc_preserve3(ctx, name, tmp, op);
+  name = sexp_intern(ctx, "wait/no-hang", 12);
+  sexp_env_define(ctx, env, name, tmp=sexp_make_integer(ctx, WNOHANG));
+  name = sexp_intern(ctx, "signal/tty-output", 17);
+  sexp_env_define(ctx, env, name, tmp=sexp_make_integer(ctx, SIGTTOU));
+  name = sexp_intern(ctx, "signal/tty-input", 16);
+  sexp_env_define(ctx, env, name, tmp=sexp_make_integer(ctx, SIGTTIN));
+  name = sexp_intern(ctx, "signal/tty-stop", 15);
+  sexp_env_define(ctx, env, name, tmp=sexp_make_integer(ctx, SIGTSTP));
+  name = sexp_intern(ctx, "signal/stop", 11);
+  sexp_env_define(ctx, env, name, tmp=sexp_make_integer(ctx, SIGSTOP));
+  name = sexp_intern(ctx, "signal/continue", 15);
+  sexp_env_define(ctx, env, name, tmp=sexp_make_integer(ctx, SIGCONT));
+  name = sexp_intern(ctx, "signal/child", 12);
+  sexp_env_define(ctx, env, name, tmp=sexp_make_integer(ctx, SIGCHLD));
+  name = sexp_intern(ctx, "signal/user2", 12);
+  sexp_env_define(ctx, env, name, tmp=sexp_make_integer(ctx, SIGUSR2));
+  name = sexp_intern(ctx, "signal/user1", 12);
+  sexp_env_define(ctx, env, name, tmp=sexp_make_integer(ctx, SIGUSR1));
+  name = sexp_intern(ctx, "signal/term", 11);
+  sexp_env_define(ctx, env, name, tmp=sexp_make_integer(ctx, SIGTERM));
+  name = sexp_intern(ctx, "signal/alarm", 12);
+  sexp_env_define(ctx, env, name, tmp=sexp_make_integer(ctx, SIGALRM));
+  name = sexp_intern(ctx, "signal/pipe", 11);
+  sexp_env_define(ctx, env, name, tmp=sexp_make_integer(ctx, SIGPIPE));
+  name = sexp_intern(ctx, "signal/segv", 11);
+  sexp_env_define(ctx, env, name, tmp=sexp_make_integer(ctx, SIGSEGV));
+  name = sexp_intern(ctx, "signal/kill", 11);
+  sexp_env_define(ctx, env, name, tmp=sexp_make_integer(ctx, SIGKILL));
+  name = sexp_intern(ctx, "signal/fpe", 10);
+  sexp_env_define(ctx, env, name, tmp=sexp_make_integer(ctx, SIGFPE));
+  name = sexp_intern(ctx, "signal/abort", 12);
+  sexp_env_define(ctx, env, name, tmp=sexp_make_integer(ctx, SIGABRT));
+  name = sexp_intern(ctx, "signal/illegal", 14);
+  sexp_env_define(ctx, env, name, tmp=sexp_make_integer(ctx, SIGILL));
+  name = sexp_intern(ctx, "signal/quit", 11);
+  sexp_env_define(ctx, env, name, tmp=sexp_make_integer(ctx, SIGQUIT));
+  name = sexp_intern(ctx, "signal/interrupt", 16);
+  sexp_env_define(ctx, env, name, tmp=sexp_make_integer(ctx, SIGINT));
+  name = sexp_intern(ctx, "signal/hang-up", 14);
+  sexp_env_define(ctx, env, name, tmp=sexp_make_integer(ctx, SIGHUP));
+  name = sexp_c_string(ctx, "sigset_t", -1);
+  sexp_sigset_t_type_obj = sexp_register_c_type(ctx, name, sexp_finalize_c_type);
+  tmp = sexp_string_to_symbol(ctx, name);
+  sexp_env_define(ctx, env, tmp, sexp_sigset_t_type_obj);
+  tmp = sexp_make_type_predicate(ctx, name, sexp_sigset_t_type_obj);
+  name = sexp_intern(ctx, "signal-set?", 11);
+  sexp_env_define(ctx, env, name, tmp);
+  name = sexp_c_string(ctx, "siginfo_t", -1);
+  sexp_siginfo_t_type_obj = sexp_register_c_type(ctx, name, sexp_finalize_c_type);
+  tmp = sexp_string_to_symbol(ctx, name);
+  sexp_env_define(ctx, env, tmp, sexp_siginfo_t_type_obj);
+  tmp = sexp_make_type_predicate(ctx, name, sexp_siginfo_t_type_obj);
+  name = sexp_intern(ctx, "signal-info?", 12);
+  sexp_env_define(ctx, env, name, tmp);
+  op = sexp_define_foreign(ctx, env, "signal-status", 1, (sexp_proc1)sexp_siginfo_t_get_si_status);
+  if (sexp_opcodep(op)) {
+    sexp_opcode_return_type(op) = sexp_make_fixnum(SEXP_FIXNUM);
+    sexp_opcode_arg1_type(op) = sexp_make_fixnum(sexp_type_tag(sexp_siginfo_t_type_obj));
+  }
+  op = sexp_define_foreign(ctx, env, "signal-uid", 1, (sexp_proc1)sexp_siginfo_t_get_si_uid);
+  if (sexp_opcodep(op)) {
+    sexp_opcode_return_type(op) = sexp_make_fixnum(SEXP_FIXNUM);
+    sexp_opcode_arg1_type(op) = sexp_make_fixnum(sexp_type_tag(sexp_siginfo_t_type_obj));
+  }
+  op = sexp_define_foreign(ctx, env, "signal-pid", 1, (sexp_proc1)sexp_siginfo_t_get_si_pid);
+  if (sexp_opcodep(op)) {
+    sexp_opcode_return_type(op) = sexp_make_fixnum(SEXP_FIXNUM);
+    sexp_opcode_arg1_type(op) = sexp_make_fixnum(sexp_type_tag(sexp_siginfo_t_type_obj));
+  }
+  op = sexp_define_foreign(ctx, env, "signal-code", 1, (sexp_proc1)sexp_siginfo_t_get_si_code);
+  if (sexp_opcodep(op)) {
+    sexp_opcode_return_type(op) = sexp_make_fixnum(SEXP_FIXNUM);
+    sexp_opcode_arg1_type(op) = sexp_make_fixnum(sexp_type_tag(sexp_siginfo_t_type_obj));
+  }
+  op = sexp_define_foreign(ctx, env, "signal-error-number", 1, (sexp_proc1)sexp_siginfo_t_get_si_errno);
+  if (sexp_opcodep(op)) {
+    sexp_opcode_return_type(op) = sexp_make_fixnum(SEXP_FIXNUM);
+    sexp_opcode_arg1_type(op) = sexp_make_fixnum(sexp_type_tag(sexp_siginfo_t_type_obj));
+  }
+  op = sexp_define_foreign(ctx, env, "signal-number", 1, (sexp_proc1)sexp_siginfo_t_get_si_signo);
+  if (sexp_opcodep(op)) {
+    sexp_opcode_return_type(op) = sexp_make_fixnum(SEXP_FIXNUM);
+    sexp_opcode_arg1_type(op) = sexp_make_fixnum(sexp_type_tag(sexp_siginfo_t_type_obj));
+  }
+  op = sexp_define_foreign(ctx, env, "parent-process-id", 0, (sexp_proc1)sexp_parent_process_id_stub);
+  if (sexp_opcodep(op)) {
+    sexp_opcode_return_type(op) = sexp_make_fixnum(SEXP_FIXNUM);
+  }
+  op = sexp_define_foreign(ctx, env, "current-process-id", 0, (sexp_proc1)sexp_current_process_id_stub);
+  if (sexp_opcodep(op)) {
+    sexp_opcode_return_type(op) = sexp_make_fixnum(SEXP_FIXNUM);
+  }
+  op = sexp_define_foreign(ctx, env, "execute", 2, (sexp_proc1)sexp_execute_stub);
+  if (sexp_opcodep(op)) {
+    sexp_opcode_return_type(op) = sexp_make_fixnum(SEXP_FIXNUM);
+    sexp_opcode_arg1_type(op) = sexp_make_fixnum(SEXP_STRING);
+    sexp_opcode_arg2_type(op) = sexp_make_fixnum(SEXP_STRING);
+  }
+  op = sexp_define_foreign(ctx, env, "%exit", 1, (sexp_proc1)sexp_25_exit_stub);
+  if (sexp_opcodep(op)) {
+    sexp_opcode_return_type(op) = SEXP_VOID;
+    sexp_opcode_arg1_type(op) = sexp_make_fixnum(SEXP_FIXNUM);
+  }
+  op = sexp_define_foreign(ctx, env, "kill", 2, (sexp_proc1)sexp_kill_stub);
+  if (sexp_opcodep(op)) {
+    sexp_opcode_return_type(op) = sexp_make_fixnum(SEXP_OBJECT);
+    sexp_opcode_arg1_type(op) = sexp_make_fixnum(SEXP_FIXNUM);
+    sexp_opcode_arg2_type(op) = sexp_make_fixnum(SEXP_FIXNUM);
+  }
+  op = sexp_define_foreign(ctx, env, "waitpid", 2, (sexp_proc1)sexp_waitpid_stub);
+  if (sexp_opcodep(op)) {
+    sexp_opcode_return_type(op) = sexp_make_fixnum(SEXP_FIXNUM);
+    sexp_opcode_arg1_type(op) = sexp_make_fixnum(SEXP_FIXNUM);
+    sexp_opcode_arg2_type(op) = sexp_make_fixnum(SEXP_FIXNUM);
+    sexp_opcode_arg3_type(op) = sexp_make_fixnum(SEXP_FIXNUM);
+  }
+  op = sexp_define_foreign(ctx, env, "fork", 0, (sexp_proc1)sexp_fork_stub);
+  if (sexp_opcodep(op)) {
+    sexp_opcode_return_type(op) = sexp_make_fixnum(SEXP_FIXNUM);
+  }
+  op = sexp_define_foreign(ctx, env, "%fork", 0, (sexp_proc1)sexp_25_fork_stub);
+  if (sexp_opcodep(op)) {
+    sexp_opcode_return_type(op) = sexp_make_fixnum(SEXP_FIXNUM);
+  }
+  op = sexp_define_foreign(ctx, env, "sleep", 1, (sexp_proc1)sexp_sleep_stub);
+  if (sexp_opcodep(op)) {
+    sexp_opcode_return_type(op) = sexp_make_fixnum(SEXP_FIXNUM);
+    sexp_opcode_arg1_type(op) = sexp_make_fixnum(SEXP_FIXNUM);
+  }
+  op = sexp_define_foreign(ctx, env, "alarm", 1, (sexp_proc1)sexp_alarm_stub);
+  if (sexp_opcodep(op)) {
+    sexp_opcode_return_type(op) = sexp_make_fixnum(SEXP_FIXNUM);
+    sexp_opcode_arg1_type(op) = sexp_make_fixnum(SEXP_FIXNUM);
+  }
+  op = sexp_define_foreign(ctx, env, "current-signal-mask", 0, (sexp_proc1)sexp_current_signal_mask_stub);
+  if (sexp_opcodep(op)) {
+    sexp_opcode_return_type(op) = sexp_make_fixnum(SEXP_OBJECT);
+    sexp_opcode_arg1_type(op) = sexp_make_fixnum(SEXP_FIXNUM);
+    sexp_opcode_arg2_type(op) = sexp_make_fixnum(sexp_type_tag(sexp_sigset_t_type_obj));
+    sexp_opcode_arg3_type(op) = sexp_make_fixnum(sexp_type_tag(sexp_sigset_t_type_obj));
+  }
+  op = sexp_define_foreign(ctx, env, "signal-mask-set!", 1, (sexp_proc1)sexp_signal_mask_set_x_stub);
+  if (sexp_opcodep(op)) {
+    sexp_opcode_return_type(op) = sexp_make_fixnum(SEXP_OBJECT);
+    sexp_opcode_arg1_type(op) = sexp_make_fixnum(SEXP_FIXNUM);
+    sexp_opcode_arg2_type(op) = sexp_make_fixnum(sexp_type_tag(sexp_sigset_t_type_obj));
+    sexp_opcode_arg3_type(op) = sexp_make_fixnum(sexp_type_tag(sexp_sigset_t_type_obj));
+  }
+  op = sexp_define_foreign(ctx, env, "signal-mask-unblock!", 1, (sexp_proc1)sexp_signal_mask_unblock_x_stub);
+  if (sexp_opcodep(op)) {
+    sexp_opcode_return_type(op) = sexp_make_fixnum(SEXP_OBJECT);
+    sexp_opcode_arg1_type(op) = sexp_make_fixnum(SEXP_FIXNUM);
+    sexp_opcode_arg2_type(op) = sexp_make_fixnum(sexp_type_tag(sexp_sigset_t_type_obj));
+    sexp_opcode_arg3_type(op) = sexp_make_fixnum(sexp_type_tag(sexp_sigset_t_type_obj));
+  }
+  op = sexp_define_foreign(ctx, env, "signal-mask-block!", 1, (sexp_proc1)sexp_signal_mask_block_x_stub);
+  if (sexp_opcodep(op)) {
+    sexp_opcode_return_type(op) = sexp_make_fixnum(SEXP_OBJECT);
+    sexp_opcode_arg1_type(op) = sexp_make_fixnum(SEXP_FIXNUM);
+    sexp_opcode_arg2_type(op) = sexp_make_fixnum(sexp_type_tag(sexp_sigset_t_type_obj));
+    sexp_opcode_arg3_type(op) = sexp_make_fixnum(sexp_type_tag(sexp_sigset_t_type_obj));
+  }
+  op = sexp_define_foreign(ctx, env, "signal-set-contains?", 2, (sexp_proc1)sexp_signal_set_contains_p_stub);
+  if (sexp_opcodep(op)) {
+    sexp_opcode_return_type(op) = sexp_make_fixnum(SEXP_BOOLEAN);
+    sexp_opcode_arg1_type(op) = sexp_make_fixnum(sexp_type_tag(sexp_sigset_t_type_obj));
+    sexp_opcode_arg2_type(op) = sexp_make_fixnum(SEXP_FIXNUM);
+  }
+  op = sexp_define_foreign(ctx, env, "signal-set-delete!", 2, (sexp_proc1)sexp_signal_set_delete_x_stub);
+  if (sexp_opcodep(op)) {
+    sexp_opcode_return_type(op) = sexp_make_fixnum(SEXP_OBJECT);
+    sexp_opcode_arg1_type(op) = sexp_make_fixnum(sexp_type_tag(sexp_sigset_t_type_obj));
+    sexp_opcode_arg2_type(op) = sexp_make_fixnum(SEXP_FIXNUM);
+  }
+  op = sexp_define_foreign(ctx, env, "signal-set-add!", 2, (sexp_proc1)sexp_signal_set_add_x_stub);
+  if (sexp_opcodep(op)) {
+    sexp_opcode_return_type(op) = sexp_make_fixnum(SEXP_OBJECT);
+    sexp_opcode_arg1_type(op) = sexp_make_fixnum(sexp_type_tag(sexp_sigset_t_type_obj));
+    sexp_opcode_arg2_type(op) = sexp_make_fixnum(SEXP_FIXNUM);
+  }
+  op = sexp_define_foreign(ctx, env, "signal-set-fill!", 1, (sexp_proc1)sexp_signal_set_fill_x_stub);
+  if (sexp_opcodep(op)) {
+    sexp_opcode_return_type(op) = sexp_make_fixnum(SEXP_OBJECT);
+    sexp_opcode_arg1_type(op) = sexp_make_fixnum(sexp_type_tag(sexp_sigset_t_type_obj));
+  }
+  op = sexp_define_foreign(ctx, env, "make-signal-set", 0, (sexp_proc1)sexp_make_signal_set_stub);
+  if (sexp_opcodep(op)) {
+    sexp_opcode_return_type(op) = sexp_make_fixnum(SEXP_OBJECT);
+    sexp_opcode_arg1_type(op) = sexp_make_fixnum(sexp_type_tag(sexp_sigset_t_type_obj));
+  }
+  op = sexp_define_foreign(ctx, env, "set-signal-action!", 2, (sexp_proc1)sexp_set_signal_action_x_stub);
+  sexp_init_signals(ctx, env);
+  sexp_gc_release3(ctx);
+  return SEXP_VOID;
+}
+
@@ -7,19 +7,48 @@
 
 (define *this-module* '())
 
-(define (make-module exports env meta) (vector exports env meta #f))
+(define (make-module exports env meta) (vector exports env meta #f '()))
 (define (%module-exports mod) (vector-ref mod 0))
 (define (module-env mod) (vector-ref mod 1))
 (define (module-env-set! mod env) (vector-set! mod 1 env))
 (define (module-meta-data mod) (vector-ref mod 2))
 (define (module-meta-data-set! mod x) (vector-set! mod 2 x))
 
+;; The source files a module was loaded from, its definition and
+;; includes, along with those of every module it imports.  Macros
+;; from any of these may be expanded into the module's code, so the
+;; compiled file cache checks them all before using an include.
+(define (module-files mod) (vector-ref mod 4))
+(define (module-files-set! mod x) (vector-set! mod 4 x))
+
+(define (module-files-add! mod files)
+  (for-each
+   (lambda (f)
+     (if (not (member f (module-files mod)))
+         (module-files-set! mod (append (module-files mod) (list f)))))
+   files))
+
+;; The files of the module whose include is being loaded, or #f.
+(define *include-dependencies* #f)
+
 (define (module-exports mod)
   (or (%module-exports mod)
       (if (module-env mod)
           (env-exports (module-env mod))
           '())))
 
+(define *sealed-environments* '())
+
+;; A sealed environment promises that its definitions won't be
+;; redefined or set! after they're made, which lets the optimizer
+;; treat them as known, e.g. for inlining.
+(define (seal-environment! env)
+  (if (not (memq env *sealed-environments*))
+      (set! *sealed-environments* (cons env *sealed-environments*))))
+
+(define (sealed-environment? env)
+  (and (memq env *sealed-environments*) #t))
+
 (define (module-name->strings ls res)
   (if (null? ls)
       res
@@ -41,7 +70,11 @@
     (lambda (name)
       (let* ((file (module-name->file name))
              (path (find-module-file file)))
-        (if path (load path meta-env))))))
+        (cond
+         (path
+          (load path meta-env)
+          (cond ((assoc name *modules*)
+                 => (lambda (x) (module-files-set! (cdr x) (list path)))))))))))
 
 (define (find-module name)
   (cond
@@ -139,7 +172,8 @@
 (define (eval-module name mod . o)
   (let ((env (if (pair? o) (car o) (make-environment)))
         (meta (module-meta-data mod))
-        (dir (module-name-prefix name)))
+        (dir (module-name-prefix name))
+        (deps *include-dependencies*))
     (define (load-modules files extension fold?)
       (for-each
        (lambda (f)
@@ -147,12 +181,15 @@
            (cond
             ((find-module-file f)
              => (lambda (path)
+                  (set! *include-dependencies* (module-files mod))
                   (cond (fold?
                          (let ((in (open-input-file path)))
                            (set-port-fold-case! in #t)
                            (load in env)))
                         (else
-                         (load path env)))))
+                         (%load path env)))
+                  (set! *include-dependencies* deps)
+                  (module-files-add! mod (list path))))
             (else (error "couldn't find include" f)))))
        files))
     ;; catch cyclic references
@@ -171,12 +208,16 @@
              (lambda (m)
                (let* ((mod2-name+imports (resolve-import m))
                       (mod2 (load-module (car mod2-name+imports))))
+                 (module-files-add! mod (module-files mod2))
                  (%import env (module-env mod2) (cdr mod2-name+imports) #t)))
-             (cdr x)))))
+             (cdr x)))
+           ((sealed)
+            (seal-environment! env))))
        meta)
       (protect
           (exn (else
                 (module-meta-data-set! mod meta)
+                (set! *include-dependencies* deps)
                 (if (not (any (lambda (x)
                                 (and (pair? x)
                                      (memq (car x) '(import import-immutable))))
@@ -323,6 +364,7 @@
 (define-meta-primitive include)
 (define-meta-primitive include-ci)
 (define-meta-primitive include-shared)
+(define-meta-primitive sealed)
 (define-meta-primitive body)
 (define-meta-primitive begin)
 
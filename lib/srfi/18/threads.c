@@ -115,6 +115,7 @@ sexp sexp_thread_start (sexp ctx, sexp self, sexp_sint_t n, sexp thread) {
   sexp_context_errorp(thread) = 0;
   cell = sexp_cons(ctx, thread, SEXP_NULL);
   if (sexp_pairp(sexp_global(ctx, SEXP_G_THREADS_BACK))) {
+    sexp_write_barrier(ctx, sexp_global(ctx, SEXP_G_THREADS_BACK), cell);
     sexp_cdr(sexp_global(ctx, SEXP_G_THREADS_BACK)) = cell;
     sexp_global(ctx, SEXP_G_THREADS_BACK) = cell;
   } else {            /* init queue */
@@ -128,7 +129,10 @@ static int sexp_delete_list (sexp ctx, int global, sexp x) {
   for ( ; sexp_pairp(ls2) && sexp_car(ls2) != x; ls1=ls2, ls2=sexp_cdr(ls2))
     ;
   if (sexp_pairp(ls2)) {
-    if (ls1) sexp_cdr(ls1) = sexp_cdr(ls2);
+    if (ls1) {
+      sexp_write_barrier(ctx, ls1, sexp_cdr(ls2));
+      sexp_cdr(ls1) = sexp_cdr(ls2);
+    }
     else     sexp_global(ctx, global) = sexp_cdr(ls2);
     return 1;
   } else {
@@ -197,8 +201,11 @@ static void sexp_insert_timed (sexp ctx, sexp thread, sexp timeout) {
       ls1=ls2, ls2=sexp_cdr(ls2);
   if (ls1 == SEXP_NULL)
     sexp_global(ctx, SEXP_G_THREADS_PAUSED) = sexp_cons(ctx, thread, ls2);
-  else
-    sexp_cdr(ls1) = sexp_cons(ctx, thread, ls2);
+  else {
+    ls2 = sexp_cons(ctx, thread, ls2);
+    sexp_write_barrier(ctx, ls1, ls2);
+    sexp_cdr(ls1) = ls2;
+  }
 }
 
 sexp sexp_thread_join (sexp ctx, sexp self, sexp_sint_t n, sexp thread, sexp timeout) {
@@ -265,8 +272,11 @@ sexp sexp_mutex_unlock (sexp ctx, sexp self, sexp_sint_t n, sexp mutex, sexp con
       if (sexp_context_event(sexp_car(ls2)) == mutex) {
         if (ls1==SEXP_NULL)
           sexp_global(ctx, SEXP_G_THREADS_PAUSED) = sexp_cdr(ls2);
-        else
+        else {
+          sexp_write_barrier(ctx, ls1, sexp_cdr(ls2));
           sexp_cdr(ls1) = sexp_cdr(ls2);
+        }
+        sexp_write_barrier(ctx, ls2, sexp_global(ctx, SEXP_G_THREADS_FRONT));
         sexp_cdr(ls2) = sexp_global(ctx, SEXP_G_THREADS_FRONT);
         sexp_global(ctx, SEXP_G_THREADS_FRONT) = ls2;
         if (! sexp_pairp(sexp_cdr(ls2)))
@@ -294,8 +304,11 @@ sexp sexp_condition_variable_signal (sexp ctx, sexp self, sexp_sint_t n, sexp co
     if (sexp_context_event(sexp_car(ls2)) == condvar) {
       if (ls1==SEXP_NULL)
         sexp_global(ctx, SEXP_G_THREADS_PAUSED) = sexp_cdr(ls2);
-      else
+      else {
+        sexp_write_barrier(ctx, ls1, sexp_cdr(ls2));
         sexp_cdr(ls1) = sexp_cdr(ls2);
+      }
+      sexp_write_barrier(ctx, ls2, sexp_global(ctx, SEXP_G_THREADS_FRONT));
       sexp_cdr(ls2) = sexp_global(ctx, SEXP_G_THREADS_FRONT);
       sexp_global(ctx, SEXP_G_THREADS_FRONT) = ls2;
       if (! sexp_pairp(sexp_cdr(ls2)))
@@ -469,14 +482,17 @@ sexp sexp_scheduler (sexp ctx, sexp self, sexp_sint_t n, sexp root_thread) {
             sexp_context_event(sexp_car(ls2)) = SEXP_FALSE;
             if (ls1==SEXP_NULL)
               sexp_global(ctx, SEXP_G_THREADS_PAUSED) = paused = sexp_cdr(ls2);
-            else
+            else {
+              sexp_write_barrier(ctx, ls1, sexp_cdr(ls2));
               sexp_cdr(ls1) = sexp_cdr(ls2);
+            }
             tmp = sexp_cdr(ls2);
             sexp_cdr(ls2) = SEXP_NULL;
             if (sexp_car(ls2) != ctx) {
               if (! sexp_pairp(sexp_global(ctx, SEXP_G_THREADS_BACK))) {
                 sexp_global(ctx, SEXP_G_THREADS_FRONT) = front = ls2;
               } else {
+                sexp_write_barrier(ctx, sexp_global(ctx, SEXP_G_THREADS_BACK), ls2);
                 sexp_cdr(sexp_global(ctx, SEXP_G_THREADS_BACK)) = ls2;
               }
               sexp_global(ctx, SEXP_G_THREADS_BACK) = ls2;
@@ -503,13 +519,16 @@ sexp sexp_scheduler (sexp ctx, sexp self, sexp_sint_t n, sexp root_thread) {
         sexp_context_timeoutp(sexp_car(ls2)) = 0;
         if (ls1==SEXP_NULL)
           sexp_global(ctx, SEXP_G_THREADS_PAUSED) = paused = sexp_cdr(ls2);
-        else
+        else {
+          sexp_write_barrier(ctx, ls1, sexp_cdr(ls2));
           sexp_cdr(ls1) = sexp_cdr(ls2);
+        }
         tmp = sexp_cdr(ls2);
         sexp_cdr(ls2) = SEXP_NULL;
         if (! sexp_pairp(sexp_global(ctx, SEXP_G_THREADS_BACK))) {
           sexp_global(ctx, SEXP_G_THREADS_FRONT) = front = ls2;
         } else {
+          sexp_write_barrier(ctx, sexp_global(ctx, SEXP_G_THREADS_BACK), ls2);
           sexp_cdr(sexp_global(ctx, SEXP_G_THREADS_BACK)) = ls2;
         }
         sexp_global(ctx, SEXP_G_THREADS_BACK) = ls2;
@@ -537,6 +556,7 @@ sexp sexp_scheduler (sexp ctx, sexp self, sexp_sint_t n, sexp root_thread) {
         if (! sexp_pairp(sexp_global(ctx, SEXP_G_THREADS_BACK))) {
           sexp_global(ctx, SEXP_G_THREADS_FRONT) = front = paused;
         } else {
+          sexp_write_barrier(ctx, sexp_global(ctx, SEXP_G_THREADS_BACK), paused);
           sexp_cdr(sexp_global(ctx, SEXP_G_THREADS_BACK)) = paused;
         }
         sexp_global(ctx, SEXP_G_THREADS_BACK) = ls1;
@@ -558,8 +578,11 @@ sexp sexp_scheduler (sexp ctx, sexp self, sexp_sint_t n, sexp root_thread) {
       paused = sexp_global(ctx, SEXP_G_THREADS_PAUSED);
     } else {
       /* swap with front of queue */
+      sexp_write_barrier(ctx, sexp_global(ctx, SEXP_G_THREADS_FRONT), ctx);
       sexp_car(sexp_global(ctx, SEXP_G_THREADS_FRONT)) = ctx;
       /* rotate front of queue to back */
+      sexp_write_barrier(ctx, sexp_global(ctx, SEXP_G_THREADS_BACK),
+                         sexp_global(ctx, SEXP_G_THREADS_FRONT));
       sexp_cdr(sexp_global(ctx, SEXP_G_THREADS_BACK))
         = sexp_global(ctx, SEXP_G_THREADS_FRONT);
       sexp_global(ctx, SEXP_G_THREADS_FRONT)
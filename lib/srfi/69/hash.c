@@ -14,6 +14,7 @@
 #define sexp_hash_table_size(x)     sexp_slot_ref(x, 1)
 #define sexp_hash_table_hash_fn(x)  sexp_slot_ref(x, 2)
 #define sexp_hash_table_eq_fn(x)    sexp_slot_ref(x, 3)
+#define sexp_hash_table_compactions(x) sexp_slot_ref(x, 4)
 
 #define sexp_hash_resize_check(n, len) (((n)*3) > ((len)>>2))
 
@@ -52,12 +53,19 @@ static sexp_uint_t hash_one (sexp ctx, sexp obj, sexp_uint_t bound, sexp_sint_t
   sexp_sint_t i, len;
   sexp t, *p;
   char *p0;
+#if SEXP_USE_FLONUMS
+  double f;
+#endif
  loop:
   if (obj) {
 #if SEXP_USE_FLONUMS
-    if (sexp_flonump(obj))
-      acc ^= (sexp_sint_t) sexp_flonum_value(obj);
-    else
+    /* hash the bits, the same whether the flonum is boxed or not */
+    if (sexp_flonump(obj)) {
+      f = sexp_flonum_value(obj);
+      for (i=0, p0=(char*)&f; i<(sexp_sint_t)sizeof(f); i++) {
+        acc *= FNV_PRIME; acc ^= p0[i];
+      }
+    } else
 #endif
     if (sexp_pointerp(obj)) {
       if (depth > 0) {
@@ -164,9 +172,9 @@ static sexp sexp_scan_bucket (sexp ctx, sexp ls, sexp obj, sexp eq_fn) {
   return res;
 }
 
-static void sexp_regrow_hash_table (sexp ctx, sexp ht, sexp oldbuckets, sexp hash_fn) {
+static void sexp_rehash_table (sexp ctx, sexp ht, sexp oldbuckets, sexp hash_fn, int scale) {
   sexp ls, *oldvec, *newvec;
-  int i, j, oldsize=sexp_vector_length(oldbuckets), newsize=oldsize*2;
+  int i, j, oldsize=sexp_vector_length(oldbuckets), newsize=oldsize*scale;
   sexp_gc_var1(newbuckets);
   sexp_gc_preserve1(ctx, newbuckets);
   newbuckets = sexp_make_vector(ctx, sexp_make_fixnum(newsize), SEXP_NULL);
@@ -179,11 +187,24 @@ static void sexp_regrow_hash_table (sexp ctx, sexp ht, sexp oldbuckets, sexp has
         sexp_push(ctx, newvec[j], sexp_car(ls));
       }
     }
+    sexp_write_barrier(ctx, ht, newbuckets);
     sexp_hash_table_buckets(ht) = newbuckets;
   }
   sexp_gc_release1(ctx);
 }
 
+/* identity hashes change when the heap is compacted, so rehash into */
+/* new buckets of the same size the first time the table is used */
+/* after a compaction, leaving the old ones to any walk in progress */
+static void sexp_rehash_if_moved (sexp ctx, sexp ht) {
+  if (sexp_hash_table_hash_fn(ht) == SEXP_ONE
+      && (sexp_hash_table_compactions(ht)
+          != sexp_make_fixnum(sexp_heap_compactions(ctx)))) {
+    sexp_hash_table_compactions(ht) = sexp_make_fixnum(sexp_heap_compactions(ctx));
+    sexp_rehash_table(ctx, ht, sexp_hash_table_buckets(ht), SEXP_ONE, 1);
+  }
+}
+
 static sexp sexp_hash_table_cell (sexp ctx, sexp self, sexp_sint_t n, sexp ht, sexp obj, sexp createp) {
   sexp buckets, eq_fn, hash_fn, i;
   sexp_uint_t size;
@@ -191,6 +212,7 @@ static sexp sexp_hash_table_cell (sexp ctx, sexp self, sexp_sint_t n, sexp ht, s
   /* extra check - exact type should be checked by the calling procedure */
   if (! sexp_pointerp(ht))
     return sexp_xtype_exception(ctx, self, "not a Hash-Table", ht);
+  sexp_rehash_if_moved(ctx, ht);
   buckets = sexp_hash_table_buckets(ht);
   eq_fn = sexp_hash_table_eq_fn(ht);
   hash_fn = sexp_hash_table_hash_fn(ht);
@@ -202,12 +224,15 @@ static sexp sexp_hash_table_cell (sexp ctx, sexp self, sexp_sint_t n, sexp ht, s
     sexp_gc_preserve1(ctx, res);
     size = sexp_unbox_fixnum(sexp_hash_table_size(ht));
     if (sexp_hash_resize_check(size, sexp_vector_length(buckets))) {
-      sexp_regrow_hash_table(ctx, ht, buckets, hash_fn);
+      sexp_rehash_table(ctx, ht, buckets, hash_fn, 2);
       buckets = sexp_hash_table_buckets(ht);
       i = sexp_get_bucket(ctx, buckets, hash_fn, obj);
     }
     res = sexp_cons(ctx, obj, createp);
-    sexp_vector_set(buckets, i, sexp_cons(ctx, res, sexp_vector_ref(buckets, i)));
+    res = sexp_cons(ctx, res, sexp_vector_ref(buckets, i));
+    sexp_write_barrier(ctx, buckets, res);
+    sexp_vector_set(buckets, i, res);
+    res = sexp_car(res);
     sexp_hash_table_size(ht) = sexp_make_fixnum(size+1);
     sexp_gc_release1(ctx);
   }
@@ -218,6 +243,7 @@ static sexp sexp_hash_table_delete (sexp ctx, sexp self, sexp_sint_t n, sexp ht,
   sexp buckets, eq_fn, hash_fn, i, p, res;
   if (!(sexp_pointerp(ht) && strcmp(sexp_string_data(sexp_object_type_name(ctx, ht)), "Hash-Table") == 0))
     return sexp_xtype_exception(ctx, self, "not a Hash-Table", ht);
+  sexp_rehash_if_moved(ctx, ht);
   buckets = sexp_hash_table_buckets(ht);
   eq_fn = sexp_hash_table_eq_fn(ht);
   hash_fn = sexp_hash_table_hash_fn(ht);
@@ -226,10 +252,12 @@ static sexp sexp_hash_table_delete (sexp ctx, sexp self, sexp_sint_t n, sexp ht,
   if (sexp_pairp(res)) {
     sexp_hash_table_size(ht) = sexp_fx_sub(sexp_hash_table_size(ht), SEXP_ONE);
     if (res == sexp_vector_ref(buckets, i)) {
+      sexp_write_barrier(ctx, buckets, sexp_cdr(res));
       sexp_vector_set(buckets, i, sexp_cdr(res));
     } else {
       for (p=sexp_vector_ref(buckets, i); sexp_cdr(p)!=res; p=sexp_cdr(p))
         ;
+      sexp_write_barrier(ctx, p, sexp_cdr(res));
       sexp_cdr(p) = sexp_cdr(res);
     }
   }
@@ -19,7 +19,8 @@
        (make-vector 23 '())
        0
        (if (eq? hash-fn hash-by-identity) 1 (if (eq? hash-fn hash) 2 hash-fn))
-       (if (eq? eq-fn eq?) 1 (if (eq? eq-fn equal?) 2 eq-fn)))))))
+       (if (eq? eq-fn eq?) 1 (if (eq? eq-fn equal?) 2 eq-fn))
+       0)))))
 
 (define (hash-table-hash-function table)
   (let ((f (%hash-table-hash-function table)))
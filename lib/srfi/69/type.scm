@@ -3,10 +3,11 @@
 ;; BSD-style license: http://synthcode.com/license.txt
 
 (define-record-type Hash-Table
-  (%make-hash-table buckets size hash-fn eq-fn)
+  (%make-hash-table buckets size hash-fn eq-fn compactions)
   hash-table?
   (buckets hash-table-buckets hash-table-buckets-set!)
   (size hash-table-size hash-table-size-set!)
   (hash-fn %hash-table-hash-function)
-  (eq-fn %hash-table-equivalence-function))
+  (eq-fn %hash-table-equivalence-function)
+  (compactions %hash-table-compactions))
 
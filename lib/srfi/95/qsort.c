@@ -60,8 +60,21 @@ static int sexp_isymbol_compare (sexp ctx, sexp a, sexp b) {
 
 static int sexp_object_compare (sexp ctx, sexp a, sexp b) {
   int res;
+#if SEXP_USE_FLONUMS
+  double x, y;
+#endif
   if (a == b)
     return 0;
+#if SEXP_USE_FLONUMS
+  /* flonums may be immediate or boxed, and compare with fixnums */
+  if ((sexp_flonump(a) || sexp_flonump(b))
+      && (sexp_flonump(a) || sexp_fixnump(a))
+      && (sexp_flonump(b) || sexp_fixnump(b))) {
+    x = sexp_flonump(a) ? sexp_flonum_value(a) : sexp_fixnum_to_double(a);
+    y = sexp_flonump(b) ? sexp_flonum_value(b) : sexp_fixnum_to_double(b);
+    return x > y ? 1 : x < y ? -1 : 0;
+  }
+#endif
   if (sexp_pointerp(a)) {
     if (sexp_pointerp(b)) {
       if (sexp_pointer_tag(a) != sexp_pointer_tag(b)) {
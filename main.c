@@ -34,6 +34,7 @@ void sexp_usage(int err) {
          "  -V           - print version information\n"
 #if ! SEXP_USE_BOEHM
          "  -h <size>    - specify the initial heap size\n"
+         "  -g <factor>[/<ratio>] - specify the heap growth factor and ratio\n"
 #endif
 #if SEXP_USE_MODULES
          "  -A <dir>     - append a module search directory\n"
@@ -57,123 +58,6 @@ void sexp_usage(int err) {
 #define sexp_usage(err) (err ? exit_failure() : exit_success())
 #endif
 
-#if SEXP_USE_IMAGE_LOADING
-
-#include <sys/types.h>
-#include <sys/uio.h>
-#include <unistd.h>
-#include <fcntl.h>
-
-#define SEXP_IMAGE_MAGIC "\a\achibi\n\0"
-#define SEXP_IMAGE_MAJOR_VERSION 1
-#define SEXP_IMAGE_MINOR_VERSION 1
-
-typedef struct sexp_image_header_t* sexp_image_header;
-struct sexp_image_header_t {
-  char magic[8];
-  short major, minor;
-  sexp_abi_identifier_t abi;
-  sexp_uint_t size;
-  sexp_heap base;
-  sexp context;
-};
-
-sexp sexp_gc (sexp ctx, size_t *sum_freed);
-void sexp_offset_heap_pointers (sexp_heap heap, sexp_heap from_heap, sexp* types, sexp flags);
-
-static sexp sexp_load_image (const char* file, sexp_uint_t heap_size, sexp_uint_t heap_max_size) {
-  sexp ctx, flags, *globals, *types;
-  int fd;
-  sexp_sint_t offset;
-  sexp_heap heap;
-  sexp_free_list q;
-  struct sexp_image_header_t header;
-  fd = open(file, O_RDONLY);
-  if (fd < 0) {
-    fprintf(stderr, "can't open image file: %s\n", file);
-    return NULL;
-  }
-  if (read(fd, &header, sizeof(header)) != sizeof(header))
-    return NULL;
-  if (memcmp(header.magic, SEXP_IMAGE_MAGIC, sizeof(header.magic)) != 0) {
-    fprintf(stderr, "invalid image file magic for %s: %s\n", file, header.magic);
-    return NULL;
-  } else if (header.major != SEXP_IMAGE_MAJOR_VERSION
-             || header.major < SEXP_IMAGE_MINOR_VERSION) {
-    fprintf(stderr, "unsupported image version: %d.%d\n",
-            header.major, header.minor);
-    return NULL;
-  } else if (!sexp_abi_compatible(NULL, header.abi, SEXP_ABI_IDENTIFIER)) {
-    fprintf(stderr, "unsupported ABI: %s (expected %s)\n",
-            header.abi, SEXP_ABI_IDENTIFIER);
-    return NULL;
-  }
-  if (heap_size < header.size) heap_size = header.size;
-  heap = (sexp_heap)malloc(sexp_heap_pad_size(heap_size));
-  if (!heap) {
-    fprintf(stderr, "couldn't malloc heap\n");
-    return NULL;
-  }
-  if (read(fd, heap, header.size) != header.size) {
-    fprintf(stderr, "error reading image\n");
-    return NULL;
-  }
-  offset = (sexp_sint_t)((char*)heap - (sexp_sint_t)header.base);
-  /* expand the last free chunk if necessary */
-  if (heap->size < heap_size) {
-    for (q=(sexp_free_list)(((char*)heap->free_list) + offset); q->next;
-         q=(sexp_free_list)(((char*)q->next) + offset))
-      ;
-    if ((char*)q + q->size >= (char*)heap->data + heap->size) {
-      /* last free chunk at end of heap */
-      q->size += heap_size - heap->size;
-    } else {
-      /* last free chunk in the middle of the heap */
-      q->next = (sexp_free_list)((char*)heap->data + heap->size);
-      q = (sexp_free_list)(((char*)q->next) + offset);
-      q->size = heap_size - heap->size;
-      q->next = NULL;
-    }
-    heap->size += (heap_size - heap->size);
-  }
-  ctx = (sexp)(((char*)header.context) + offset);
-  globals = sexp_vector_data((sexp)((char*)sexp_context_globals(ctx) + offset));
-  types = sexp_vector_data((sexp)((char*)(globals[SEXP_G_TYPES]) + offset));
-  flags = sexp_fx_add(SEXP_COPY_LOADP, SEXP_COPY_FREEP);
-  sexp_offset_heap_pointers(heap, header.base, types, flags);
-  close(fd);
-  return ctx;
-}
-
-static int sexp_save_image (sexp ctx, const char* path) {
-  sexp_heap heap;
-  FILE* file;
-  struct sexp_image_header_t header;
-  file = fopen(path, "w");
-  if (!file) {
-    fprintf(stderr, "couldn't open image file for writing: %s\n", path);
-    return 0;
-  }
-  heap = sexp_context_heap(ctx);
-  memcpy(&header.magic, SEXP_IMAGE_MAGIC, sizeof(header.magic));
-  memcpy(&header.abi, SEXP_ABI_IDENTIFIER, sizeof(header.abi));
-  header.major = SEXP_IMAGE_MAJOR_VERSION;
-  header.minor = SEXP_IMAGE_MINOR_VERSION;
-  header.size = heap->size;
-  header.base = heap;
-  header.context = ctx;
-  sexp_gc(ctx, NULL);
-  if (! (fwrite(&header, sizeof(header), 1, file) == 1
-         && fwrite(heap, heap->size, 1, file) == 1)) {
-    fprintf(stderr, "error writing image file\n");
-    return 0;
-  }
-  fclose(file);
-  return 1;
-}
-
-#endif
-
 #if SEXP_USE_GREEN_THREADS
 static void sexp_make_unblocking (sexp ctx, sexp port) {
   if (!(sexp_portp(port) && sexp_port_fileno(port) >= 0))
@@ -340,13 +224,22 @@ static sexp sexp_load_standard_repl_env (sexp ctx, sexp env, sexp k, int bootp)
   return e;
 }
 
+static void set_heap_policy (sexp ctx, double grow_factor, double grow_ratio) {
+#if ! SEXP_USE_BOEHM
+  if (grow_factor > 0) sexp_context_heap(ctx)->grow_factor = grow_factor;
+  if (grow_ratio > 0) sexp_context_heap(ctx)->grow_ratio = grow_ratio;
+#endif
+}
+
 static void do_init_context (sexp* ctx, sexp* env, sexp_uint_t heap_size,
-                             sexp_uint_t heap_max_size, sexp_sint_t fold_case) {
+                             sexp_uint_t heap_max_size, double grow_factor,
+                             double grow_ratio, sexp_sint_t fold_case) {
   *ctx = sexp_make_eval_context(NULL, NULL, NULL, heap_size, heap_max_size);
   if (! *ctx) {
     fprintf(stderr, "chibi-scheme: out of memory\n");
     exit_failure();
   }
+  set_heap_policy(*ctx, grow_factor, grow_ratio);
 #if SEXP_USE_FOLD_CASE_SYMS
   sexp_global(*ctx, SEXP_G_FOLD_CASE_P) = sexp_make_boolean(fold_case);
 #endif
@@ -354,7 +247,8 @@ static void do_init_context (sexp* ctx, sexp* env, sexp_uint_t heap_size,
 }
 
 #define init_context() if (! ctx) do {                                  \
-      do_init_context(&ctx, &env, heap_size, heap_max_size, fold_case); \
+      do_init_context(&ctx, &env, heap_size, heap_max_size,           \
+                      grow_factor, grow_ratio, fold_case);              \
       sexp_gc_preserve4(ctx, tmp, sym, args, env);                      \
     } while (0)
 
@@ -372,6 +266,7 @@ void run_main (int argc, char **argv) {
   sexp_sint_t i, j, c, quit=0, print=0, init_loaded=0, mods_loaded=0,
     no_script=0, fold_case=SEXP_DEFAULT_FOLD_CASE_SYMS;
   sexp_uint_t heap_size=0, heap_max_size=SEXP_MAXIMUM_HEAP_SIZE;
+  double grow_factor=0, grow_ratio=0;
   sexp out=SEXP_FALSE, ctx=NULL;
   sexp_gc_var4(tmp, sym, args, env);
   args = SEXP_NULL;
@@ -475,6 +370,20 @@ void run_main (int argc, char **argv) {
         heap_max_size = strtoul(arg+1, &arg, 0);
         if (sexp_isalpha((unsigned char)*arg)) heap_max_size *= multiplier(*arg++);
       }
+#endif
+      break;
+    case 'g':
+      arg = ((argv[i][2] == '\0') ? argv[++i] : argv[i]+2);
+      check_nonull_arg('g', arg);
+#if ! SEXP_USE_BOEHM
+      grow_factor = strtod(arg, &arg);
+      if (*arg == '/')
+        grow_ratio = strtod(arg+1, &arg);
+      if (*arg || grow_factor < 1 || grow_ratio < 0 || grow_ratio >= 1) {
+        fprintf(stderr, "-g <factor>[/<ratio>]: invalid heap growth policy\n");
+        exit_failure();
+      }
+      if (ctx) set_heap_policy(ctx, grow_factor, grow_ratio);
 #endif
       break;
 #if SEXP_USE_IMAGE_LOADING
@@ -489,6 +398,7 @@ void run_main (int argc, char **argv) {
         fprintf(stderr, "-:i <file>: couldn't open file for reading: %s\n", arg);
         exit_failure();
       }
+      set_heap_policy(ctx, grow_factor, grow_ratio);
       env = sexp_load_standard_params(ctx, sexp_context_env(ctx));
       init_loaded++;
       break;
@@ -0,0 +1,304 @@
+/* Support for libraries compiled ahead of time to C by */
+/* tools/chibi-aot.  Each procedure's bytecode becomes one C */
+/* function, a label per instruction, built from the templates */
+/* below, which keep the stack exactly as the VM would.  As with */
+/* the JIT, only the fast paths of the common opcodes are compiled, */
+/* and for anything else the function returns to the VM the offset */
+/* of the instruction to resume at, before that instruction has */
+/* changed any state.  C can't jump between functions, so calls */
+/* and returns update the VM registers and return the complement */
+/* of the offset to continue at in the new procedure, and the VM */
+/* enters its compiled code directly if it has any. */
+/* */
+/* Each compiled library registers its functions by the shape of */
+/* the bytecode they were compiled from (see aot.h), and bytecode */
+/* is matched against them the first time it's called. */
+
+#include "aot.h"
+
+#define SEXP_NATIVE_THRESHOLD 1
+
+struct sexp_aot_proc_t {
+  const unsigned char *shape;
+  sexp_uint_t length;
+  sexp_native_proc proc;
+  sexp_uint_t hash;             /* filled in when registered */
+};
+
+struct sexp_aot_library_t {
+  struct sexp_aot_proc_t *procs;
+  struct sexp_aot_library_t *next;
+  int registeredp;
+};
+
+/* generated in aotlibs.c */
+extern struct sexp_library_entry_t sexp_aot_libraries[];
+
+static struct sexp_aot_library_t *sexp_aot_registered;
+
+/******************************* templates ********************************/
+
+#define _AOT_BEGIN                                                      \
+  sexp *top = regs->top, *fp = regs->fp, cp = regs->cp, tmp, tmp2;      \
+  unsigned char *data = regs->data;                                     \
+  sexp_sint_t n;                                                        \
+  (void)fp; (void)cp; (void)tmp; (void)tmp2; (void)data; (void)n
+
+#define _AOT_EXIT(off) do {regs->top = top; return (off);} while (0)
+#define _AOT_WORD(off, k) (((sexp*)(data+(off)+1))[k])
+#define _AOT_LOCAL(i) (fp[-1-(i)])
+#define _AOT_PUSH_VALUE(x) (*top++ = (x))
+
+#define _AOT_CHECK_FIXNUMS(off, x, y)                                   \
+  if (! (sexp_fixnump(x) && sexp_fixnump(y))) _AOT_EXIT(off)
+
+#define _AOT_CHECK_ARITY(off, proc, nargs)                              \
+  if (! sexp_procedurep(proc) || sexp_procedure_variadic_p(proc)        \
+      || sexp_procedure_num_args(proc) != (nargs)) _AOT_EXIT(off)
+
+/* as sexp_ensure_stack(max_depth+64) with the frame on top, which */
+/* is left to the VM, and a checkpoint */
+#define _AOT_CHECK_CALL(off, proc)                                      \
+  if (top + sexp_bytecode_max_depth(sexp_procedure_code(proc)) + 64 + 4 \
+      >= regs->end || --regs->fuel <= 0) _AOT_EXIT(off)
+
+#define _AOT_LOCAL_REF(off, i) _AOT_PUSH_VALUE(_AOT_LOCAL(i))
+#define _AOT_LOCAL_SET(off, i) (_AOT_LOCAL(i) = *--top)
+#define _AOT_STACK_REF(off, i) do {tmp = top[-(i)]; _AOT_PUSH_VALUE(tmp);} while (0)
+#define _AOT_CLOSURE_REF(off, i) _AOT_PUSH_VALUE(sexp_vector_data(cp)[i])
+#define _AOT_CLOSURE_REF_CDR(off, i) _AOT_PUSH_VALUE(sexp_cdr(sexp_vector_data(cp)[i]))
+#define _AOT_PUSH(off) _AOT_PUSH_VALUE(_AOT_WORD(off, 0))
+#define _AOT_DROP(off) (--top)
+#define _AOT_GLOBAL_KNOWN_REF(off) _AOT_PUSH_VALUE(sexp_cdr(_AOT_WORD(off, 0)))
+#define _AOT_GLOBAL_REF(off)                                            \
+  do {tmp = sexp_cdr(_AOT_WORD(off, 0));                                \
+    if (tmp == SEXP_UNDEF) _AOT_EXIT(off);                              \
+    _AOT_PUSH_VALUE(tmp);} while (0)
+
+#define _AOT_JUMP(off, label) goto label
+#define _AOT_LOOP(off, label)                                           \
+  do {if (--regs->fuel <= 0) _AOT_EXIT(off); goto label;} while (0)
+#define _AOT_JUMP_UNLESS(off, label)                                    \
+  do {if (*--top == SEXP_FALSE) goto label;} while (0)
+#define _AOT_LOCAL_REF_JUMP_UNLESS(off, i, label)                       \
+  do {if (_AOT_LOCAL(i) == SEXP_FALSE) goto label;} while (0)
+#define _AOT_NUM_CMP_JUMP_UNLESS(off, cmp, label)                       \
+  do {_AOT_CHECK_FIXNUMS(off, top[-1], top[-2]);                        \
+    top -= 2;                                                           \
+    if (! ((sexp_sint_t)top[1] cmp (sexp_sint_t)top[0])) goto label;} while (0)
+#define _AOT_LT_JUMP_UNLESS(off, label) _AOT_NUM_CMP_JUMP_UNLESS(off, <, label)
+#define _AOT_LE_JUMP_UNLESS(off, label) _AOT_NUM_CMP_JUMP_UNLESS(off, <=, label)
+#define _AOT_EQN_JUMP_UNLESS(off, label) _AOT_NUM_CMP_JUMP_UNLESS(off, ==, label)
+#define _AOT_EQ_JUMP_UNLESS(off, label)                                 \
+  do {top -= 2; if (top[1] != top[0]) goto label;} while (0)
+#define _AOT_NULLP_JUMP_UNLESS(off, label)                              \
+  do {if (*--top != SEXP_NULL) goto label;} while (0)
+#define _AOT_PAIRP_JUMP_UNLESS(off, label)                              \
+  do {tmp = *--top; if (! sexp_pairp(tmp)) goto label;} while (0)
+
+#define _AOT_EQ(off)                                                    \
+  do {tmp = *--top; top[-1] = sexp_make_boolean(tmp == top[-1]);} while (0)
+#define _AOT_NULLP(off) (top[-1] = sexp_make_boolean(top[-1] == SEXP_NULL))
+#define _AOT_FIXNUMP(off) (top[-1] = sexp_make_boolean(sexp_fixnump(top[-1])))
+/* objects of other core types aren't instances of any other type, */
+/* and tools/chibi-aot leaves Object to the VM */
+#define _AOT_TYPEP(off, tag)                                            \
+  do {tmp = top[-1];                                                    \
+    if (! sexp_pointerp(tmp)) top[-1] = SEXP_FALSE;                     \
+    else if (sexp_pointer_tag(tmp) == (tag)) top[-1] = SEXP_TRUE;       \
+    else if (sexp_pointer_tag(tmp) >= SEXP_NUM_CORE_TYPES) _AOT_EXIT(off); \
+    else top[-1] = SEXP_FALSE;} while (0)
+#define _AOT_NUM_CMP(off, cmp)                                          \
+  do {_AOT_CHECK_FIXNUMS(off, top[-1], top[-2]);                        \
+    top--;                                                              \
+    top[-1] = sexp_make_boolean((sexp_sint_t)top[0] cmp (sexp_sint_t)top[-1]);} while (0)
+#define _AOT_LT(off) _AOT_NUM_CMP(off, <)
+#define _AOT_LE(off) _AOT_NUM_CMP(off, <=)
+#define _AOT_EQN(off) _AOT_NUM_CMP(off, ==)
+
+#define _AOT_CAR(off)                                                   \
+  do {if (! sexp_pairp(top[-1])) _AOT_EXIT(off);                        \
+    top[-1] = sexp_car(top[-1]);} while (0)
+#define _AOT_CDR(off)                                                   \
+  do {if (! sexp_pairp(top[-1])) _AOT_EXIT(off);                        \
+    top[-1] = sexp_cdr(top[-1]);} while (0)
+#define _AOT_UNCHECKED_CAR(off) (top[-1] = sexp_car(top[-1]))
+#define _AOT_UNCHECKED_CDR(off) (top[-1] = sexp_cdr(top[-1]))
+#define _AOT_LOCAL_REF_CAR(off, i)                                      \
+  do {tmp = _AOT_LOCAL(i); if (! sexp_pairp(tmp)) _AOT_EXIT(off);       \
+    _AOT_PUSH_VALUE(sexp_car(tmp));} while (0)
+#define _AOT_LOCAL_REF_CDR(off, i)                                      \
+  do {tmp = _AOT_LOCAL(i); if (! sexp_pairp(tmp)) _AOT_EXIT(off);       \
+    _AOT_PUSH_VALUE(sexp_cdr(tmp));} while (0)
+
+/* as in the VM, allocation failure leaves the exception as the value */
+#define _AOT_CONS(off)                                                  \
+  do {sexp_context_top(regs->ctx) = top - regs->stack;                  \
+    top[-2] = sexp_cons(regs->ctx, top[-1], top[-2]);                   \
+    top--;} while (0)
+
+/* an unsigned compare also catches negative indexes */
+#define _AOT_UNCHECKED_VECTOR_REF(off)                                  \
+  do {tmp = top[-1]; n = sexp_unbox_fixnum(top[-2]);                    \
+    if ((sexp_uint_t)n >= sexp_vector_length(tmp)) _AOT_EXIT(off);      \
+    top--; top[-1] = sexp_vector_data(tmp)[n];} while (0)
+#define _AOT_VECTOR_REF(off)                                            \
+  do {if (! sexp_vectorp(top[-1]) || ! sexp_fixnump(top[-2])) _AOT_EXIT(off); \
+    _AOT_UNCHECKED_VECTOR_REF(off);} while (0)
+#define _AOT_VECTOR_LENGTH(off)                                         \
+  do {if (! sexp_vectorp(top[-1])) _AOT_EXIT(off);                      \
+    top[-1] = sexp_make_fixnum(sexp_vector_length(top[-1]));} while (0)
+
+/* any result needing a bignum is left to the VM */
+#define _AOT_UNCHECKED_ARITH(off, op)                                   \
+  do {n = sexp_unbox_fixnum(top[-1]) op sexp_unbox_fixnum(top[-2]);     \
+    if (n < SEXP_MIN_FIXNUM || n > SEXP_MAX_FIXNUM) _AOT_EXIT(off);     \
+    top--; top[-1] = sexp_make_fixnum(n);} while (0)
+#define _AOT_UNCHECKED_ADD(off) _AOT_UNCHECKED_ARITH(off, +)
+#define _AOT_UNCHECKED_SUB(off) _AOT_UNCHECKED_ARITH(off, -)
+#define _AOT_ADD(off)                                                   \
+  do {_AOT_CHECK_FIXNUMS(off, top[-1], top[-2]); _AOT_UNCHECKED_ADD(off);} while (0)
+#define _AOT_SUB(off)                                                   \
+  do {_AOT_CHECK_FIXNUMS(off, top[-1], top[-2]); _AOT_UNCHECKED_SUB(off);} while (0)
+#if SEXP_USE_BIGNUMS
+#define _AOT_MUL(off)                                                   \
+  do {sexp_lsint_t prod;                                                \
+    _AOT_CHECK_FIXNUMS(off, top[-1], top[-2]);                          \
+    prod = (sexp_lsint_t)sexp_unbox_fixnum(top[-1]) * sexp_unbox_fixnum(top[-2]); \
+    if (prod < SEXP_MIN_FIXNUM || prod > SEXP_MAX_FIXNUM) _AOT_EXIT(off); \
+    top--; top[-1] = sexp_make_fixnum(prod);} while (0)
+#else
+#define _AOT_MUL(off) _AOT_EXIT(off)
+#endif
+
+#define _AOT_CALL(off, nargs)                                           \
+  do {tmp = top[-1];                                                    \
+    _AOT_CHECK_ARITY(off, tmp, nargs);                                  \
+    _AOT_CHECK_CALL(off, tmp);                                          \
+    regs->top = top;                                                    \
+    sexp_aot_call(regs, tmp, nargs, (off)+1+sizeof(sexp));              \
+    return ~(sexp_sint_t)0;} while (0)
+#define _AOT_TAIL_CALL(off, nargs)                                      \
+  do {tmp = top[-1];                                                    \
+    _AOT_CHECK_ARITY(off, tmp, nargs);                                  \
+    _AOT_CHECK_CALL(off, tmp);                                          \
+    regs->top = top;                                                    \
+    sexp_aot_tail_call(regs, tmp, nargs);                               \
+    return ~(sexp_sint_t)0;} while (0)
+/* a cache hit has been checked for the arity already */
+#if SEXP_USE_INLINE_CACHES
+#define _AOT_CHECK_KNOWN_ARITY(off, proc, nargs)                        \
+  if ((proc) != sexp_car(_AOT_WORD(off, 2))) _AOT_EXIT(off)
+#else
+#define _AOT_CHECK_KNOWN_ARITY(off, proc, nargs) _AOT_CHECK_ARITY(off, proc, nargs)
+#endif
+#define _AOT_GLOBAL_KNOWN_CALL(off, nargs)                              \
+  do {tmp = sexp_cdr(_AOT_WORD(off, 0));                                \
+    _AOT_CHECK_KNOWN_ARITY(off, tmp, nargs);                            \
+    _AOT_CHECK_CALL(off, tmp);                                          \
+    _AOT_PUSH_VALUE(tmp);                                               \
+    regs->top = top;                                                    \
+    sexp_aot_call(regs, tmp, nargs, (off)+1+3*sizeof(sexp));            \
+    return ~(sexp_sint_t)0;} while (0)
+#define _AOT_RET(off)                                                   \
+  do {regs->top = top; return ~sexp_aot_return(regs);} while (0)
+
+/* as push_frame in the VM, with the procedure on top */
+static void sexp_aot_call (sexp_native_regs_t *regs, sexp proc,
+                           sexp_sint_t nargs, sexp_sint_t ret) {
+  sexp *top = regs->top;
+  top[-1] = sexp_make_fixnum(nargs);
+  top[0] = sexp_make_fixnum(ret);
+  top[1] = regs->self;
+  top[2] = sexp_make_fixnum(regs->fp - regs->stack);
+  regs->fp = top - 1;
+  regs->top = top + 3;
+  regs->self = proc;
+  regs->cp = sexp_procedure_vars(proc);
+}
+
+/* as TAIL_CALL, replacing the current frame */
+static void sexp_aot_tail_call (sexp_native_regs_t *regs, sexp proc,
+                                sexp_sint_t nargs) {
+  sexp *top = regs->top, *fp = regs->fp, ret = fp[1], self = fp[2],
+    old_fp = fp[3];
+  sexp_sint_t k;
+  fp -= sexp_unbox_fixnum(fp[0]);
+  /* the args only ever move down the stack */
+  for (k=0; k<nargs; k++)
+    fp[k] = top[k-nargs-1];
+  fp += nargs;
+  fp[0] = sexp_make_fixnum(nargs);
+  fp[1] = ret;
+  fp[2] = self;
+  fp[3] = old_fp;
+  regs->fp = fp;
+  regs->top = fp + 4;
+  regs->self = proc;
+  regs->cp = sexp_procedure_vars(proc);
+}
+
+/* returns the offset to continue at in the caller */
+static sexp_sint_t sexp_aot_return (sexp_native_regs_t *regs) {
+  sexp *fp = regs->fp, *base = fp - sexp_unbox_fixnum(fp[0]);
+  base[0] = regs->top[-1];
+  regs->top = base + 1;
+  regs->self = fp[2];
+  regs->cp = sexp_procedure_vars(regs->self);
+  regs->fp = regs->stack + sexp_unbox_fixnum(fp[3]);
+  return sexp_unbox_fixnum(fp[1]);
+}
+
+/****************************** registration ******************************/
+
+static sexp_uint_t sexp_aot_hash (const unsigned char *shape, sexp_uint_t len) {
+  sexp_uint_t i, res = 2166136261u;
+  for (i=0; i<len; i++)
+    res = (res ^ shape[i]) * 16777619u;
+  return res;
+}
+
+static void sexp_aot_register (struct sexp_aot_library_t *lib) {
+  struct sexp_aot_proc_t *p;
+  if (lib->registeredp)
+    return;
+  for (p=lib->procs; p->shape; p++)
+    p->hash = sexp_aot_hash(p->shape, p->length);
+  lib->next = sexp_aot_registered;
+  sexp_aot_registered = lib;
+  lib->registeredp = 1;
+}
+
+/* Runs the inits of all the compiled libraries, which register */
+/* their procedures.  Bytecode is only matched by shape, so this */
+/* needn't wait for the libraries themselves to be loaded. */
+static void sexp_aot_register_libraries (sexp ctx) {
+  struct sexp_library_entry_t *entry;
+  for (entry = &sexp_aot_libraries[0]; entry->name; entry++)
+    entry->init(ctx, NULL, 3, sexp_context_env(ctx), sexp_version,
+                SEXP_ABI_IDENTIFIER);
+}
+
+/* attaches the compiled code for bytecode of the same shape as bc */
+static int sexp_native_compile (sexp ctx, sexp bc) {
+  struct sexp_aot_library_t *lib;
+  struct sexp_aot_proc_t *p;
+  sexp_uint_t len = sexp_bytecode_length(bc), hash;
+  unsigned char *shape;
+  int res = 0;
+  if (! sexp_aot_registered)
+    sexp_aot_register_libraries(ctx);
+  if (! sexp_aot_registered || ! (shape = (unsigned char*) malloc(len)))
+    return 0;
+  sexp_aot_shape(sexp_bytecode_data(bc), len, shape);
+  hash = sexp_aot_hash(shape, len);
+  for (lib=sexp_aot_registered; lib && ! res; lib=lib->next)
+    for (p=lib->procs; p->shape; p++)
+      if (p->hash == hash && p->length == len && ! memcmp(p->shape, shape, len)) {
+        sexp_bytecode_native(bc) = (void*) p->proc;
+        res = 1;
+        break;
+      }
+  free(shape);
+  return res;
+}
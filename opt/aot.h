@@ -0,0 +1,88 @@
+/* The C code compiled for a procedure is found again in another */
+/* process by the shape of its bytecode, the data with every */
+/* operand referring to a heap object zeroed, since only those */
+/* differ between runs.  The C code reads such operands from the */
+/* bytecode at run time, so it serves any bytecode of the same */
+/* shape, with whatever literals and globals it refers to. */
+
+/* the number of operand words following each opcode */
+static int sexp_aot_operand_words (int op) {
+  switch (op) {
+  case SEXP_OP_FCALL0:      case SEXP_OP_FCALL1:
+  case SEXP_OP_FCALL2:      case SEXP_OP_FCALL3:
+  case SEXP_OP_FCALL4:      case SEXP_OP_CALL:
+  case SEXP_OP_TAIL_CALL:   case SEXP_OP_PUSH:
+  case SEXP_OP_GLOBAL_REF:  case SEXP_OP_GLOBAL_KNOWN_REF:
+#if SEXP_USE_GREEN_THREADS
+  case SEXP_OP_PARAMETER_REF:
+#endif
+#if SEXP_USE_EXTENDED_FCALL
+  case SEXP_OP_FCALLN:
+#endif
+  case SEXP_OP_JUMP:        case SEXP_OP_JUMP_UNLESS:
+  case SEXP_OP_LT_JUMP_UNLESS:    case SEXP_OP_LE_JUMP_UNLESS:
+  case SEXP_OP_EQN_JUMP_UNLESS:   case SEXP_OP_EQ_JUMP_UNLESS:
+  case SEXP_OP_NULLP_JUMP_UNLESS: case SEXP_OP_PAIRP_JUMP_UNLESS:
+  case SEXP_OP_STACK_REF:   case SEXP_OP_CLOSURE_REF:
+  case SEXP_OP_LOCAL_REF:   case SEXP_OP_LOCAL_SET:
+  case SEXP_OP_TYPEP:
+  case SEXP_OP_LOCAL_REF_CAR:   case SEXP_OP_LOCAL_REF_CDR:
+  case SEXP_OP_CLOSURE_REF_CDR:
+#if SEXP_USE_RESERVE_OPCODE
+  case SEXP_OP_RESERVE:
+#endif
+    return 1;
+  case SEXP_OP_MAKE: case SEXP_OP_SLOT_REF: case SEXP_OP_SLOT_SET:
+  case SEXP_OP_LOCAL_REF_JUMP_UNLESS: case SEXP_OP_FLONUM_ARITH:
+    return 2;
+  case SEXP_OP_GLOBAL_KNOWN_CALL: case SEXP_OP_MAKE_PROCEDURE:
+    return 3;
+  }
+  return 0;
+}
+
+/* whether operand word k of op may refer to a heap object, as */
+/* relocated by the gc */
+static int sexp_aot_object_operand_p (int op, int k) {
+  switch (op) {
+  case SEXP_OP_GLOBAL_KNOWN_CALL:
+    return k == 0 || k == 2;
+  case SEXP_OP_MAKE_PROCEDURE:
+    return k == 2;
+  case SEXP_OP_FCALL0:      case SEXP_OP_FCALL1:
+  case SEXP_OP_FCALL2:      case SEXP_OP_FCALL3:
+  case SEXP_OP_FCALL4:      case SEXP_OP_CALL:
+  case SEXP_OP_TAIL_CALL:   case SEXP_OP_PUSH:
+  case SEXP_OP_GLOBAL_REF:  case SEXP_OP_GLOBAL_KNOWN_REF:
+#if SEXP_USE_GREEN_THREADS
+  case SEXP_OP_PARAMETER_REF:
+#endif
+#if SEXP_USE_EXTENDED_FCALL
+  case SEXP_OP_FCALLN:
+#endif
+    return k == 0;
+  }
+  return 0;
+}
+
+/* writes the shape of the len bytes of bytecode data to shape */
+static void sexp_aot_shape (const unsigned char *data, sexp_uint_t len,
+                            unsigned char *shape) {
+  sexp_uint_t off, pos;
+  int k, words;
+  sexp x;
+  memcpy(shape, data, len);
+  for (off=0; off<len; off+=1+words*sizeof(sexp)) {
+    words = sexp_aot_operand_words(data[off]);
+    if (off + 1 + words*sizeof(sexp) > len)
+      break;
+    for (k=0; k<words; k++) {
+      if (sexp_aot_object_operand_p(data[off], k)) {
+        pos = off + 1 + k*sizeof(sexp);
+        memcpy(&x, data + pos, sizeof(sexp));
+        if (x && sexp_pointerp(x))
+          memset(shape + pos, 0, sizeof(sexp));
+      }
+    }
+  }
+}
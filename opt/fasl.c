@@ -0,0 +1,1204 @@
+/* An on-disk cache of compiled files, used by sexp_load_op when */
+/* the CHIBI_FASL_CACHE environment variable names a directory. */
+/* Each top-level form of a file loaded from source is compiled */
+/* and written to the cache before it's run, and later loads of the */
+/* same file, unchanged by size and content hash, read the compiled */
+/* thunks back in place of reading, expanding and compiling the */
+/* source. */
+/* */
+/* The cache file holds one entry per form, with the form itself */
+/* and its compiled thunk unless that can't be saved, in which case */
+/* the form is evaluated as usual.  A thunk isn't saved if compiling */
+/* the form defined syntax, a side effect of the compiler which */
+/* running the thunk wouldn't repeat, or if it refers to an object */
+/* which can't be written.  Objects are written in pre-order with */
+/* back references, so shared structure and cycles are kept. */
+/* Global cells, and objects such as opcodes which are written as */
+/* the binding they're found in, are written by name along with */
+/* where they were found: the environment loaded into, a loaded */
+/* module, or the meta environment.  They're looked up again as */
+/* each entry is read, just before it's run, so bindings made by */
+/* earlier forms are found as they were when compiling. */
+/* */
+/* Besides the file itself, the cache records the size and hash of */
+/* the files it depends on, since their macros were expanded into */
+/* the saved thunks, and isn't used if any of them changed.  For an */
+/* include of a library these are the files of the library and */
+/* every library it imports, from *include-dependencies* in the */
+/* meta environment, and for any other file those of all libraries */
+/* loaded when it finished loading. */
+
+#include <time.h>
+#include "aot.h"
+
+#define SEXP_FASL_MAGIC "chibi-fasl\n"
+#define SEXP_FASL_VERSION 2
+
+enum sexp_fasl_tags {
+  SEXP_FASL_IMMEDIATE,
+  SEXP_FASL_BACKREF,
+  SEXP_FASL_LIST,
+  SEXP_FASL_VECTOR,
+  SEXP_FASL_STRING,
+  SEXP_FASL_BYTES,
+  SEXP_FASL_SYMBOL,
+  SEXP_FASL_FLONUM,
+  SEXP_FASL_BIGNUM,
+  SEXP_FASL_RATIO,
+  SEXP_FASL_COMPLEX,
+  SEXP_FASL_CELL,
+  SEXP_FASL_VALUE,
+  SEXP_FASL_BYTECODE,
+  SEXP_FASL_PROCEDURE
+};
+
+/* where a cell or value was found, by name */
+enum sexp_fasl_places {
+  SEXP_FASL_OWN,                /* defined in the load environment */
+  SEXP_FASL_VISIBLE,            /* visible from the load environment */
+  SEXP_FASL_MODULE,             /* visible from a loaded module */
+  SEXP_FASL_META                /* visible from the meta environment */
+};
+
+/* entry kinds */
+#define SEXP_FASL_END 0
+#define SEXP_FASL_SOURCE 1
+#define SEXP_FASL_COMPILED 2
+
+struct sexp_fasl_buf {
+  unsigned char *data;
+  sexp_uint_t len, size;
+  int failedp;
+};
+
+/* the index of each object written so far in the current section */
+struct sexp_fasl_table {
+  sexp *keys;
+  sexp_uint_t *vals;
+  sexp_uint_t size, count;
+};
+
+struct sexp_fasl_writer_t {
+  char *path;
+  sexp env;
+  sexp_uint_t len, hash, num_deps;
+  struct sexp_fasl_buf deps, out, sec;
+  struct sexp_fasl_table seen;
+};
+
+typedef struct sexp_fasl_writer_t *sexp_fasl_writer;
+
+struct sexp_fasl_reader_t {
+  const unsigned char *p, *end;
+  sexp env, *table;             /* a gc preserved vector of the objects */
+  sexp_uint_t count;
+  int failedp;
+};
+
+/******************************** utils *********************************/
+
+static sexp_uint_t sexp_fasl_hash (const unsigned char *p, sexp_uint_t len) {
+  sexp_uint_t h = (sexp_uint_t)14695981039346656037ULL;
+  while (len-- > 0)
+    h = (h ^ *p++) * (sexp_uint_t)1099511628211ULL;
+  return h;
+}
+
+/* reads the whole file into a malloced buffer, or returns NULL */
+static unsigned char* sexp_fasl_slurp (const char *path, sexp_uint_t *len) {
+  FILE *in = fopen(path, "rb");
+  unsigned char *res;
+  struct stat st;
+  if (!in) return NULL;
+  if (fstat(fileno(in), &st) != 0
+      || !(res = (unsigned char*) malloc(st.st_size + 1))) {
+    fclose(in);
+    return NULL;
+  }
+  if (fread(res, 1, st.st_size, in) != (size_t)st.st_size) {
+    free(res);
+    res = NULL;
+  }
+  *len = st.st_size;
+  fclose(in);
+  return res;
+}
+
+/* the size and hash of each dependency read so far, which are only */
+/* read again if its size or modification time changes, or if it was */
+/* modified in the same second it was read, as a second change in */
+/* that second wouldn't show in the time */
+struct sexp_fasl_file_id {
+  char *path;
+  sexp_uint_t size, hash, mark;
+  time_t mtime, checked;
+  struct sexp_fasl_file_id *next;
+};
+
+#define SEXP_FASL_FILE_ID_BUCKETS 256
+
+static struct sexp_fasl_file_id *sexp_fasl_file_ids[SEXP_FASL_FILE_ID_BUCKETS];
+static sexp_uint_t sexp_fasl_file_mark;
+
+static struct sexp_fasl_file_id* sexp_fasl_file_id (const char *path) {
+  struct sexp_fasl_file_id *id, **bucket;
+  struct stat st;
+  unsigned char *text;
+  sexp_uint_t len;
+  if (stat(path, &st) != 0)
+    return NULL;
+  bucket = &sexp_fasl_file_ids[sexp_fasl_hash((const unsigned char*)path, strlen(path))
+                               % SEXP_FASL_FILE_ID_BUCKETS];
+  for (id=*bucket; id; id=id->next)
+    if (strcmp(id->path, path) == 0)
+      break;
+  if (id && id->size == (sexp_uint_t)st.st_size && id->mtime == st.st_mtime
+      && id->mtime < id->checked)
+    return id;
+  if (!(text = sexp_fasl_slurp(path, &len)))
+    return NULL;
+  if (!id) {
+    id = (struct sexp_fasl_file_id*) calloc(1, sizeof(struct sexp_fasl_file_id));
+    if (id && !(id->path = strdup(path))) {
+      free(id);
+      id = NULL;
+    }
+    if (!id) {
+      free(text);
+      return NULL;
+    }
+    id->next = *bucket;
+    *bucket = id;
+  }
+  id->size = len;
+  id->hash = sexp_fasl_hash(text, len);
+  id->mtime = st.st_mtime;
+  id->checked = time(NULL);
+  free(text);
+  return id;
+}
+
+/* the cache file for source in dir, the absolute path of source */
+/* with each / written as ! and ! as !! */
+static char* sexp_fasl_cache_path (const char *dir, const char *source) {
+  char *real, *res, *p, *s;
+  if (!(real = realpath(source, NULL)))
+    return NULL;
+  res = (char*) malloc(strlen(dir) + 2*strlen(real) + 8);
+  if (res) {
+    strcpy(res, dir);
+    p = res + strlen(res);
+    *p++ = '/';
+    for (s=real; *s; s++) {
+      if (*s == '/' || *s == '!') *p++ = '!';
+      if (*s != '/') *p++ = *s;
+    }
+    strcpy(p, ".fasl");
+  }
+  free(real);
+  return res;
+}
+
+/* a hash of the syntactic bindings of env itself, which changes if */
+/* compiling a form defines syntax */
+static sexp_uint_t sexp_fasl_syntax_hash (sexp env) {
+  sexp ls;
+  sexp_uint_t h = 0;
+  for (ls=sexp_env_bindings(env); sexp_pairp(ls); ls=sexp_env_next_cell(ls))
+    if (sexp_syntacticp(sexp_cdr(ls)))
+      h = h*31 + ((sexp_uint_t)ls ^ (sexp_uint_t)sexp_cdr(ls));
+#if SEXP_USE_RENAME_BINDINGS
+  for (ls=sexp_env_renames(env); sexp_pairp(ls); ls=sexp_env_next_cell(ls))
+    if (sexp_pairp(sexp_cdr(ls)) && sexp_syntacticp(sexp_cddr(ls)))
+      h = h*31 + ((sexp_uint_t)sexp_car(ls) ^ (sexp_uint_t)sexp_cddr(ls));
+#endif
+  return h;
+}
+
+static sexp sexp_fasl_modules (sexp ctx) {
+  sexp meta = sexp_global(ctx, SEXP_G_META_ENV);
+  if (!sexp_envp(meta))
+    return SEXP_NULL;
+  return sexp_env_ref(ctx, meta, sexp_intern(ctx, "*modules*", -1), SEXP_NULL);
+}
+
+/* the environment of a module entry (name . #(exports env meta ast files)) */
+static sexp sexp_fasl_module_env (sexp entry) {
+  if (sexp_pairp(entry) && sexp_vectorp(sexp_cdr(entry))
+      && sexp_vector_length(sexp_cdr(entry)) > 1
+      && sexp_envp(sexp_vector_ref(sexp_cdr(entry), SEXP_ONE)))
+    return sexp_vector_ref(sexp_cdr(entry), SEXP_ONE);
+  return NULL;
+}
+
+/* the source files of a module entry, see module-files in meta-7.scm */
+static sexp sexp_fasl_module_files (sexp entry) {
+  if (sexp_pairp(entry) && sexp_vectorp(sexp_cdr(entry))
+      && sexp_vector_length(sexp_cdr(entry)) > 4)
+    return sexp_vector_ref(sexp_cdr(entry), sexp_make_fixnum(4));
+  return SEXP_NULL;
+}
+
+/* the name by which env sees cell, or NULL */
+static sexp sexp_fasl_cell_name (sexp ctx, sexp env, sexp cell) {
+#if SEXP_USE_RENAME_BINDINGS
+  sexp e, ls;
+#endif
+  if (sexp_symbolp(sexp_car(cell))
+      && sexp_env_cell(ctx, env, sexp_car(cell), 0) == cell)
+    return sexp_car(cell);
+#if SEXP_USE_RENAME_BINDINGS
+  for (e=env; e && sexp_envp(e); e=sexp_env_parent(e))
+    for (ls=sexp_env_renames(e); sexp_pairp(ls); ls=sexp_env_next_cell(ls))
+      if (sexp_cdr(ls) == cell && sexp_symbolp(sexp_car(ls))
+          && sexp_env_cell(ctx, env, sexp_car(ls), 0) == cell)
+        return sexp_car(ls);
+#endif
+  return NULL;
+}
+
+/* the name of a binding of x visible from env, or NULL */
+static sexp sexp_fasl_value_name (sexp ctx, sexp env, sexp x) {
+  sexp e, ls;
+  for (e=env; e && sexp_envp(e); e=sexp_env_parent(e)) {
+    for (ls=sexp_env_bindings(e); sexp_pairp(ls); ls=sexp_env_next_cell(ls))
+      if (sexp_cdr(ls) == x && sexp_symbolp(sexp_car(ls))
+          && sexp_env_cell(ctx, env, sexp_car(ls), 0) == ls)
+        return sexp_car(ls);
+#if SEXP_USE_RENAME_BINDINGS
+    for (ls=sexp_env_renames(e); sexp_pairp(ls); ls=sexp_env_next_cell(ls))
+      if (sexp_pairp(sexp_cdr(ls)) && sexp_cddr(ls) == x
+          && sexp_symbolp(sexp_car(ls))
+          && sexp_env_cell(ctx, env, sexp_car(ls), 0) == sexp_cdr(ls))
+        return sexp_car(ls);
+#endif
+  }
+  return NULL;
+}
+
+/******************************** writer ********************************/
+
+static void sexp_fasl_reserve (struct sexp_fasl_buf *b, sexp_uint_t n) {
+  sexp_uint_t size;
+  unsigned char *tmp;
+  if (b->len + n <= b->size)
+    return;
+  size = b->size ? b->size : 1024;
+  while (size < b->len + n)
+    size *= 2;
+  tmp = (unsigned char*) realloc(b->data, size);
+  if (tmp) {
+    b->data = tmp;
+    b->size = size;
+  } else {
+    b->failedp = 1;
+  }
+}
+
+static void sexp_fasl_put_bytes (struct sexp_fasl_buf *b, const void *p,
+                                 sexp_uint_t n) {
+  sexp_fasl_reserve(b, n);
+  if (!b->failedp) {
+    memcpy(b->data + b->len, p, n);
+    b->len += n;
+  }
+}
+
+static void sexp_fasl_put_byte (struct sexp_fasl_buf *b, int c) {
+  unsigned char ch = c;
+  sexp_fasl_put_bytes(b, &ch, 1);
+}
+
+static void sexp_fasl_put_uint (struct sexp_fasl_buf *b, sexp_uint_t n) {
+  do {
+    sexp_fasl_put_byte(b, (n & 0x7F) | (n > 0x7F ? 0x80 : 0));
+    n >>= 7;
+  } while (n);
+}
+
+static void sexp_fasl_put_string (struct sexp_fasl_buf *b, const char *s) {
+  sexp_fasl_put_uint(b, strlen(s));
+  sexp_fasl_put_bytes(b, s, strlen(s));
+}
+
+#define sexp_fasl_table_index(t, x) (((sexp_uint_t)(x) >> 3) & ((t)->size - 1))
+
+static sexp_uint_t sexp_fasl_table_ref (struct sexp_fasl_table *t, sexp x) {
+  sexp_uint_t i;
+  if (!t->size) return 0;
+  for (i=sexp_fasl_table_index(t, x); t->keys[i]; i=(i+1)&(t->size-1))
+    if (t->keys[i] == x)
+      return t->vals[i];
+  return 0;
+}
+
+static int sexp_fasl_table_set (struct sexp_fasl_table *t, sexp x,
+                                sexp_uint_t v) {
+  sexp_uint_t i, size = t->size;
+  sexp *keys = t->keys;
+  sexp_uint_t *vals = t->vals;
+  if ((t->count+1)*2 > size) {
+    t->size = size ? size*2 : 256;
+    t->keys = (sexp*) calloc(t->size, sizeof(sexp));
+    t->vals = (sexp_uint_t*) malloc(t->size * sizeof(sexp_uint_t));
+    if (!t->keys || !t->vals) {
+      free(t->keys);
+      free(t->vals);
+      t->keys = keys, t->vals = vals, t->size = size;
+      return 0;
+    }
+    t->count = 0;
+    for (i=0; i<size; i++)
+      if (keys[i])
+        sexp_fasl_table_set(t, keys[i], vals[i]);
+    free(keys);
+    free(vals);
+  }
+  for (i=sexp_fasl_table_index(t, x); t->keys[i]; i=(i+1)&(t->size-1))
+    ;
+  t->keys[i] = x;
+  t->vals[i] = v;
+  t->count++;
+  return 1;
+}
+
+static void sexp_fasl_table_clear (struct sexp_fasl_table *t) {
+  if (t->size) memset(t->keys, 0, t->size * sizeof(sexp));
+  t->count = 0;
+}
+
+/* records x as the next object of the section, by 1-based index */
+static void sexp_fasl_note (sexp_fasl_writer w, sexp x) {
+  if (!sexp_fasl_table_set(&w->seen, x, w->seen.count + 1))
+    w->sec.failedp = 1;
+}
+
+/* writes where x was found, either a cell or the value of one */
+static int sexp_fasl_write_place (sexp ctx, sexp_fasl_writer w, sexp x,
+                                  int cellp);
+
+static void sexp_fasl_write (sexp ctx, sexp_fasl_writer w, sexp x, int directp);
+
+static void sexp_fasl_write_bytecode (sexp ctx, sexp_fasl_writer w, sexp bc) {
+  sexp_uint_t off, pos, len = sexp_bytecode_length(bc), idx;
+  unsigned char *data = sexp_bytecode_data(bc), *copy;
+  int k, op, words;
+  sexp x;
+  sexp_fasl_put_byte(&w->sec, SEXP_FASL_BYTECODE);
+  sexp_fasl_note(w, bc);
+  sexp_fasl_put_uint(&w->sec, len);
+  sexp_fasl_put_uint(&w->sec, sexp_bytecode_max_depth(bc));
+  /* names renamed by macros are only kept for display */
+  for (x=sexp_bytecode_name(bc); sexp_synclop(x); x=sexp_synclo_expr(x))
+    ;
+  sexp_fasl_write(ctx, w, x, 0);
+  sexp_fasl_write(ctx, w, sexp_bytecode_source(bc), 0);
+  /* the data with object operands zeroed, each written after it */
+  if (!(copy = (unsigned char*) malloc(len ? len : 1))) {
+    w->sec.failedp = 1;
+    return;
+  }
+  sexp_aot_shape(data, len, copy);
+  for (off=0; off<len; off+=1+words*sizeof(sexp)) {
+    op = data[off];
+    words = sexp_aot_operand_words(op);
+    if (off + 1 + words*sizeof(sexp) > len) break;
+    if (op == SEXP_OP_TYPEP || op == SEXP_OP_MAKE
+        || op == SEXP_OP_SLOT_REF || op == SEXP_OP_SLOT_SET) {
+      /* the indices of record types depend on the order defined */
+      memcpy(&idx, data + off + 1, sizeof(sexp));
+      if (idx >= SEXP_NUM_CORE_TYPES)
+        memset(copy + off + 1, 0, sizeof(sexp));
+    }
+  }
+  sexp_fasl_put_bytes(&w->sec, copy, len);
+  free(copy);
+  for (off=0; off<len && !w->sec.failedp; off+=1+words*sizeof(sexp)) {
+    op = data[off];
+    words = sexp_aot_operand_words(op);
+    if (off + 1 + words*sizeof(sexp) > len) break;
+    for (k=0; k<words; k++) {
+      pos = off + 1 + k*sizeof(sexp);
+      memcpy(&x, data + pos, sizeof(sexp));
+      if (sexp_aot_object_operand_p(op, k)) {
+        if (x && sexp_pointerp(x))
+          sexp_fasl_write(ctx, w, x, 1);
+      } else if (k == 0 && (op == SEXP_OP_TYPEP || op == SEXP_OP_MAKE
+                            || op == SEXP_OP_SLOT_REF || op == SEXP_OP_SLOT_SET)
+                 && (sexp_uint_t)x >= SEXP_NUM_CORE_TYPES) {
+        x = sexp_type_by_index(ctx, (sexp_uint_t)x);
+        if (!sexp_fasl_write_place(ctx, w, x, 0))
+          w->sec.failedp = 1;
+      }
+    }
+  }
+  sexp_fasl_write(ctx, w, sexp_bytecode_literals(bc), 1);
+}
+
+static int sexp_fasl_write_place (sexp ctx, sexp_fasl_writer w, sexp x,
+                                  int cellp) {
+  sexp ls, name, env, mods;
+  int place = -1;
+  name = mods = NULL;
+  if (cellp) {
+    for (ls=sexp_env_bindings(w->env); sexp_pairp(ls); ls=sexp_env_next_cell(ls))
+      if (ls == x) {
+        if (sexp_symbolp(sexp_car(x)))
+          name = sexp_car(x), place = SEXP_FASL_OWN;
+        break;
+      }
+  }
+  if (!name) {
+    name = cellp ? sexp_fasl_cell_name(ctx, w->env, x)
+      : sexp_fasl_value_name(ctx, w->env, x);
+    place = SEXP_FASL_VISIBLE;
+  }
+  if (!name) {
+    for (ls=sexp_fasl_modules(ctx); sexp_pairp(ls); ls=sexp_cdr(ls))
+      if ((env = sexp_fasl_module_env(sexp_car(ls)))) {
+        name = cellp ? sexp_fasl_cell_name(ctx, env, x)
+          : sexp_fasl_value_name(ctx, env, x);
+        if (name) {
+          mods = sexp_caar(ls);
+          place = SEXP_FASL_MODULE;
+          break;
+        }
+      }
+  }
+  if (!name && sexp_envp(env=sexp_global(ctx, SEXP_G_META_ENV))) {
+    name = cellp ? sexp_fasl_cell_name(ctx, env, x)
+      : sexp_fasl_value_name(ctx, env, x);
+    place = SEXP_FASL_META;
+  }
+  if (!name)
+    return 0;
+  sexp_fasl_put_byte(&w->sec, cellp ? SEXP_FASL_CELL : SEXP_FASL_VALUE);
+  sexp_fasl_note(w, x);
+  sexp_fasl_put_byte(&w->sec, place);
+  sexp_fasl_write(ctx, w, name, 0);
+  if (place == SEXP_FASL_MODULE)
+    sexp_fasl_write(ctx, w, mods, 0);
+  return 1;
+}
+
+/* writes x to the current section, where directp means x is */
+/* referred to directly by bytecode and so may be a global cell */
+static void sexp_fasl_write (sexp ctx, sexp_fasl_writer w, sexp x, int directp) {
+  sexp_uint_t i, len;
+  sexp ls;
+#if SEXP_USE_FLONUMS
+  double d;
+#endif
+  if (w->sec.failedp)
+    return;
+  if (!x || !sexp_pointerp(x)) {
+    sexp_fasl_put_byte(&w->sec, SEXP_FASL_IMMEDIATE);
+    sexp_fasl_put_bytes(&w->sec, &x, sizeof(sexp));
+    return;
+  }
+  if ((i = sexp_fasl_table_ref(&w->seen, x))) {
+    sexp_fasl_put_byte(&w->sec, SEXP_FASL_BACKREF);
+    sexp_fasl_put_uint(&w->sec, i - 1);
+    return;
+  }
+  switch (sexp_pointer_tag(x)) {
+  case SEXP_PAIR:
+    if (directp && sexp_symbolp(sexp_car(x))
+        && sexp_fasl_write_place(ctx, w, x, 1))
+      break;
+    /* each pair as flags, source and car, then 1 if another pair */
+    /* follows or 0 then the tail */
+    sexp_fasl_put_byte(&w->sec, SEXP_FASL_LIST);
+    for (ls=x; ; ls=sexp_cdr(ls)) {
+      sexp_fasl_note(w, ls);
+      sexp_fasl_put_byte(&w->sec, sexp_immutablep(ls));
+      sexp_fasl_write(ctx, w, sexp_pair_source(ls), 0);
+      sexp_fasl_write(ctx, w, sexp_car(ls), 0);
+      if (!(sexp_pairp(sexp_cdr(ls))
+            && !sexp_fasl_table_ref(&w->seen, sexp_cdr(ls))))
+        break;
+      sexp_fasl_put_byte(&w->sec, 1);
+    }
+    sexp_fasl_put_byte(&w->sec, 0);
+    sexp_fasl_write(ctx, w, sexp_cdr(ls), 0);
+    break;
+  case SEXP_VECTOR:
+    sexp_fasl_put_byte(&w->sec, SEXP_FASL_VECTOR);
+    sexp_fasl_note(w, x);
+    sexp_fasl_put_byte(&w->sec, sexp_immutablep(x));
+    len = sexp_vector_length(x);
+    sexp_fasl_put_uint(&w->sec, len);
+    for (i=0; i<len; i++)
+      sexp_fasl_write(ctx, w, sexp_vector_data(x)[i], 0);
+    break;
+  case SEXP_STRING:
+    sexp_fasl_put_byte(&w->sec, SEXP_FASL_STRING);
+    sexp_fasl_note(w, x);
+    sexp_fasl_put_byte(&w->sec, sexp_immutablep(x));
+    sexp_fasl_put_uint(&w->sec, sexp_string_size(x));
+    sexp_fasl_put_bytes(&w->sec, sexp_string_data(x), sexp_string_size(x));
+    break;
+  case SEXP_BYTES:
+    sexp_fasl_put_byte(&w->sec, SEXP_FASL_BYTES);
+    sexp_fasl_note(w, x);
+    sexp_fasl_put_byte(&w->sec, sexp_immutablep(x));
+    sexp_fasl_put_uint(&w->sec, sexp_bytes_length(x));
+    sexp_fasl_put_bytes(&w->sec, sexp_bytes_data(x), sexp_bytes_length(x));
+    break;
+  case SEXP_SYMBOL:
+    sexp_fasl_put_byte(&w->sec, SEXP_FASL_SYMBOL);
+    sexp_fasl_note(w, x);
+    sexp_fasl_put_uint(&w->sec, sexp_lsymbol_length(x));
+    sexp_fasl_put_bytes(&w->sec, sexp_lsymbol_data(x), sexp_lsymbol_length(x));
+    break;
+#if SEXP_USE_FLONUMS
+  case SEXP_FLONUM:
+    sexp_fasl_put_byte(&w->sec, SEXP_FASL_FLONUM);
+    sexp_fasl_note(w, x);
+    d = sexp_flonum_value(x);
+    sexp_fasl_put_bytes(&w->sec, &d, sizeof(double));
+    break;
+#endif
+#if SEXP_USE_BIGNUMS
+  case SEXP_BIGNUM:
+    sexp_fasl_put_byte(&w->sec, SEXP_FASL_BIGNUM);
+    sexp_fasl_note(w, x);
+    sexp_fasl_put_byte(&w->sec, sexp_bignum_sign(x) < 0);
+    sexp_fasl_put_uint(&w->sec, sexp_bignum_length(x));
+    sexp_fasl_put_bytes(&w->sec, sexp_bignum_data(x),
+                        sexp_bignum_length(x)*sizeof(sexp_uint_t));
+    break;
+#endif
+#if SEXP_USE_RATIOS
+  case SEXP_RATIO:
+    sexp_fasl_put_byte(&w->sec, SEXP_FASL_RATIO);
+    sexp_fasl_note(w, x);
+    sexp_fasl_write(ctx, w, sexp_ratio_numerator(x), 0);
+    sexp_fasl_write(ctx, w, sexp_ratio_denominator(x), 0);
+    break;
+#endif
+#if SEXP_USE_COMPLEX
+  case SEXP_COMPLEX:
+    sexp_fasl_put_byte(&w->sec, SEXP_FASL_COMPLEX);
+    sexp_fasl_note(w, x);
+    sexp_fasl_write(ctx, w, sexp_complex_real(x), 0);
+    sexp_fasl_write(ctx, w, sexp_complex_imag(x), 0);
+    break;
+#endif
+  case SEXP_BYTECODE:
+    sexp_fasl_write_bytecode(ctx, w, x);
+    break;
+  case SEXP_SYNCLO:
+    /* quoted data is stripped of syntactic closures, so the only */
+    /* ones in compiled code are the names given to boxed variables */
+    sexp_fasl_write(ctx, w, sexp_synclo_expr(x), directp);
+    break;
+  case SEXP_PROCEDURE:
+    /* a global procedure is referred to where it's bound, otherwise */
+    /* only constant procedures, without free variables, are copied */
+    if (sexp_fasl_write_place(ctx, w, x, 0))
+      break;
+    ls = sexp_procedure_vars(x);
+    if (!(sexp_not(ls) || sexp_nullp(ls) || ls == SEXP_VOID
+          || (sexp_vectorp(ls) && sexp_vector_length(ls) == 0))) {
+      w->sec.failedp = 1;
+      break;
+    }
+    sexp_fasl_put_byte(&w->sec, SEXP_FASL_PROCEDURE);
+    sexp_fasl_note(w, x);
+    sexp_fasl_put_byte(&w->sec, sexp_procedure_flags(x));
+    sexp_fasl_put_uint(&w->sec, sexp_procedure_num_args(x));
+    sexp_fasl_write(ctx, w, sexp_procedure_code(x), 0);
+    sexp_fasl_write(ctx, w, ls, 0);
+    break;
+  default:
+    if (!sexp_fasl_write_place(ctx, w, x, 0))
+      w->sec.failedp = 1;
+    break;
+  }
+}
+
+/* writes x as a section, the count of objects and length in bytes */
+/* then the objects, returning 0 if it couldn't be written */
+static int sexp_fasl_write_section (sexp ctx, sexp_fasl_writer w, sexp x) {
+  w->sec.len = 0;
+  w->sec.failedp = 0;
+  sexp_fasl_table_clear(&w->seen);
+  sexp_fasl_write(ctx, w, x, 0);
+  if (w->sec.failedp)
+    return 0;
+  sexp_fasl_put_uint(&w->out, w->seen.count);
+  sexp_fasl_put_uint(&w->out, w->sec.len);
+  sexp_fasl_put_bytes(&w->out, w->sec.data, w->sec.len);
+  return 1;
+}
+
+/* the form and, unless NULL, the thunk it compiled to */
+static void sexp_fasl_write_entry (sexp ctx, sexp_fasl_writer w,
+                                   sexp form, sexp thunk) {
+  sexp_uint_t start = w->out.len;
+  sexp_fasl_put_byte(&w->out, thunk ? SEXP_FASL_COMPILED : SEXP_FASL_SOURCE);
+  if (thunk && !sexp_fasl_write_section(ctx, w, thunk)) {
+    w->out.data[start] = SEXP_FASL_SOURCE;
+    w->out.len = start + 1;
+  }
+  if (!sexp_fasl_write_section(ctx, w, form))
+    w->out.failedp = 1;
+}
+
+/* adds each file in ls not yet added since the last mark */
+static void sexp_fasl_add_dependencies (sexp_fasl_writer w, sexp ls) {
+  struct sexp_fasl_file_id *id;
+  for ( ; sexp_pairp(ls); ls=sexp_cdr(ls)) {
+    if (!sexp_stringp(sexp_car(ls)))
+      continue;
+    if (!(id = sexp_fasl_file_id(sexp_string_data(sexp_car(ls))))) {
+      w->out.failedp = 1;
+    } else if (id->mark != sexp_fasl_file_mark) {
+      id->mark = sexp_fasl_file_mark;
+      sexp_fasl_put_string(&w->deps, id->path);
+      sexp_fasl_put_uint(&w->deps, id->size);
+      sexp_fasl_put_uint(&w->deps, id->hash);
+      w->num_deps++;
+    }
+  }
+}
+
+/* records the files whose macros may have been used by the cached */
+/* file, as described at the top */
+static void sexp_fasl_write_dependencies (sexp ctx, sexp_fasl_writer w) {
+  sexp ls, meta = sexp_global(ctx, SEXP_G_META_ENV);
+  ls = sexp_envp(meta) ? sexp_env_ref(ctx, meta, sexp_intern(ctx, "*include-dependencies*", -1), SEXP_FALSE) : SEXP_FALSE;
+  sexp_fasl_file_mark++;
+  if (sexp_listp(ctx, ls) == SEXP_TRUE) {
+    sexp_fasl_add_dependencies(w, ls);
+  } else {
+    for (ls=sexp_fasl_modules(ctx); sexp_pairp(ls); ls=sexp_cdr(ls))
+      sexp_fasl_add_dependencies(w, sexp_fasl_module_files(sexp_car(ls)));
+  }
+}
+
+/* returns a writer for the cache of source, or NULL if not caching */
+static sexp_fasl_writer sexp_fasl_open (sexp ctx, sexp source, sexp env) {
+  const char *dir = getenv(SEXP_FASL_CACHE_VAR);
+  unsigned char *text;
+  sexp_uint_t len;
+  sexp_fasl_writer w;
+  if (!dir || !*dir)
+    return NULL;
+  if (!(text = sexp_fasl_slurp(sexp_string_data(source), &len)))
+    return NULL;
+  w = (sexp_fasl_writer) calloc(1, sizeof(struct sexp_fasl_writer_t));
+  if (w && !(w->path = sexp_fasl_cache_path(dir, sexp_string_data(source)))) {
+    free(w);
+    w = NULL;
+  }
+  if (w) {
+    w->env = env;
+    w->len = len;
+    w->hash = sexp_fasl_hash(text, len);
+  }
+  free(text);
+  return w;
+}
+
+/* writes the cache file if completep, and frees the writer */
+static void sexp_fasl_close (sexp ctx, sexp_fasl_writer w, int completep) {
+  struct sexp_fasl_buf head;
+  char *tmp;
+  FILE *out;
+  memset(&head, 0, sizeof(head));
+  sexp_fasl_put_byte(&w->out, SEXP_FASL_END);
+  if (completep)
+    sexp_fasl_write_dependencies(ctx, w);
+  sexp_fasl_put_bytes(&head, SEXP_FASL_MAGIC, strlen(SEXP_FASL_MAGIC));
+  sexp_fasl_put_uint(&head, SEXP_FASL_VERSION);
+  sexp_fasl_put_string(&head, sexp_version);
+  sexp_fasl_put_string(&head, SEXP_ABI_IDENTIFIER);
+  sexp_fasl_put_uint(&head, w->len);
+  sexp_fasl_put_uint(&head, w->hash);
+  sexp_fasl_put_uint(&head, w->num_deps);
+  if (completep && !w->out.failedp && !w->deps.failedp && !head.failedp
+      && (tmp = (char*) malloc(strlen(w->path) + 32))) {
+    /* written under a temporary name and renamed, so a concurrent */
+    /* load never sees a partial file */
+    sprintf(tmp, "%s.%ld", w->path, (long)getpid());
+    mkdir(getenv(SEXP_FASL_CACHE_VAR), 0777);
+    if ((out = fopen(tmp, "wb"))) {
+      if (fwrite(head.data, 1, head.len, out) == head.len
+          && (w->deps.len == 0
+              || fwrite(w->deps.data, 1, w->deps.len, out) == w->deps.len)
+          && fwrite(w->out.data, 1, w->out.len, out) == w->out.len
+          && fclose(out) == 0)
+        rename(tmp, w->path);
+      else
+        remove(tmp);
+    }
+    free(tmp);
+  }
+  free(head.data);
+  free(w->deps.data);
+  free(w->out.data);
+  free(w->sec.data);
+  free(w->seen.keys);
+  free(w->seen.vals);
+  free(w->path);
+  free(w);
+}
+
+/* compiles and runs x as sexp_eval does, also saving it to w */
+static sexp sexp_fasl_eval (sexp ctx, sexp_fasl_writer w, sexp x, sexp env) {
+  sexp_sint_t top;
+  sexp_uint_t h;
+  sexp ctx2;
+  sexp_gc_var3(res, tmp, params);
+  sexp_gc_preserve3(ctx, res, tmp, params);
+  top = sexp_context_top(ctx);
+  params = sexp_context_params(ctx);
+  sexp_context_params(ctx) = SEXP_NULL;
+  ctx2 = sexp_make_eval_context(ctx, NULL, env, 0, 0);
+  tmp = sexp_context_child(ctx);
+  sexp_context_child(ctx) = ctx2;
+  h = sexp_fasl_syntax_hash(env);
+  res = sexp_exceptionp(ctx2) ? ctx2 : sexp_compile_op(ctx2, NULL, 2, x, env);
+  if (! sexp_exceptionp(res)) {
+    sexp_fasl_write_entry(ctx2, w, x,
+                          h == sexp_fasl_syntax_hash(env) ? res : NULL);
+    res = sexp_apply(ctx2, res, SEXP_NULL);
+  }
+  sexp_context_child(ctx) = tmp;
+  sexp_context_params(ctx) = params;
+  sexp_context_top(ctx) = top;
+  sexp_context_last_fp(ctx) = sexp_context_last_fp(ctx2);
+  sexp_gc_release3(ctx);
+  return res;
+}
+
+/******************************** reader ********************************/
+
+static int sexp_fasl_get_byte (struct sexp_fasl_reader_t *r) {
+  if (r->p >= r->end) {
+    r->failedp = 1;
+    return 0;
+  }
+  return *r->p++;
+}
+
+static sexp_uint_t sexp_fasl_get_uint (struct sexp_fasl_reader_t *r) {
+  sexp_uint_t res = 0;
+  int c, shift = 0;
+  do {
+    c = sexp_fasl_get_byte(r);
+    if (shift < (int)(8*sizeof(sexp_uint_t)))
+      res |= (sexp_uint_t)(c & 0x7F) << shift;
+    shift += 7;
+  } while ((c & 0x80) && !r->failedp);
+  return res;
+}
+
+/* returns a pointer to the next n bytes, or NULL */
+static const unsigned char* sexp_fasl_get_bytes (struct sexp_fasl_reader_t *r,
+                                                 sexp_uint_t n) {
+  const unsigned char *res = r->p;
+  if (r->failedp || n > (sexp_uint_t)(r->end - r->p)) {
+    r->failedp = 1;
+    return NULL;
+  }
+  r->p += n;
+  return res;
+}
+
+static int sexp_fasl_get_string_eq (struct sexp_fasl_reader_t *r,
+                                    const char *s) {
+  sexp_uint_t len = sexp_fasl_get_uint(r);
+  const unsigned char *p = sexp_fasl_get_bytes(r, len);
+  return p && len == strlen(s) && memcmp(p, s, len) == 0;
+}
+
+/* whether each dependency recorded by sexp_fasl_write_dependencies */
+/* is unchanged */
+static int sexp_fasl_get_dependencies (struct sexp_fasl_reader_t *r) {
+  sexp_uint_t i, n = sexp_fasl_get_uint(r), len, size;
+  const unsigned char *p;
+  struct sexp_fasl_file_id *id;
+  char *path;
+  for (i=0; i < n && !r->failedp; i++) {
+    len = sexp_fasl_get_uint(r);
+    if (!(p = sexp_fasl_get_bytes(r, len)) || !(path = (char*) malloc(len + 1)))
+      return 0;
+    memcpy(path, p, len);
+    path[len] = '\0';
+    id = sexp_fasl_file_id(path);
+    free(path);
+    size = sexp_fasl_get_uint(r);
+    if (!id || id->size != size || id->hash != sexp_fasl_get_uint(r))
+      return 0;
+  }
+  return !r->failedp;
+}
+
+/* records x as the next object of the section */
+static sexp sexp_fasl_register (struct sexp_fasl_reader_t *r, sexp x) {
+  if (sexp_exceptionp(x) || r->count >= sexp_vector_length(*r->table)) {
+    r->failedp = 1;
+    return x;
+  }
+  sexp_vector_set(*r->table, sexp_make_fixnum(r->count++), x);
+  return x;
+}
+
+static sexp sexp_fasl_read (sexp ctx, struct sexp_fasl_reader_t *r);
+
+/* finds a cell, or the value of one, written by sexp_fasl_write_place */
+static sexp sexp_fasl_read_place (sexp ctx, struct sexp_fasl_reader_t *r,
+                                  int cellp) {
+  sexp_uint_t i = r->count;
+  sexp ls, env = NULL, res = NULL, name, mods;
+  int place;
+  sexp_fasl_register(r, SEXP_FALSE);
+  place = sexp_fasl_get_byte(r);
+  name = sexp_fasl_read(ctx, r);
+  if (r->failedp || !sexp_symbolp(name))
+    return NULL;
+  switch (place) {
+  case SEXP_FASL_OWN:
+    for (ls=sexp_env_bindings(r->env); sexp_pairp(ls); ls=sexp_env_next_cell(ls))
+      if (sexp_car(ls) == name) {
+        res = ls;
+        break;
+      }
+    if (!res)
+      res = sexp_env_cell_define(ctx, r->env, name, SEXP_UNDEF, NULL);
+    break;
+  case SEXP_FASL_VISIBLE:
+    env = r->env;
+    break;
+  case SEXP_FASL_MODULE:
+    mods = sexp_fasl_read(ctx, r);
+    if (r->failedp)
+      return NULL;
+    for (ls=sexp_fasl_modules(ctx); sexp_pairp(ls); ls=sexp_cdr(ls))
+      if (sexp_pairp(sexp_car(ls))
+          && sexp_truep(sexp_equalp(ctx, sexp_caar(ls), mods))) {
+        env = sexp_fasl_module_env(sexp_car(ls));
+        break;
+      }
+    break;
+  case SEXP_FASL_META:
+    env = sexp_global(ctx, SEXP_G_META_ENV);
+    break;
+  }
+  if (env && sexp_envp(env))
+    res = sexp_env_cell(ctx, env, name, 0);
+  if (!res || sexp_exceptionp(res)) {
+    r->failedp = 1;
+    return NULL;
+  }
+  if (!cellp) res = sexp_cdr(res);
+  sexp_vector_set(*r->table, sexp_make_fixnum(i), res);
+  return res;
+}
+
+static sexp sexp_fasl_read_bytecode (sexp ctx, struct sexp_fasl_reader_t *r) {
+  sexp_uint_t off, pos, len = sexp_fasl_get_uint(r);
+  const unsigned char *data;
+  int k, op, words;
+  sexp bc, x;
+  if (r->failedp || len > (sexp_uint_t)(r->end - r->p))
+    return NULL;
+  bc = sexp_alloc_bytecode(ctx, len);
+  if (sexp_exceptionp(bc))
+    return sexp_fasl_register(r, bc);
+  sexp_bytecode_name(bc) = sexp_bytecode_literals(bc) = SEXP_FALSE;
+  sexp_bytecode_source(bc) = SEXP_FALSE;
+  sexp_bytecode_length(bc) = len;
+  sexp_fasl_register(r, bc);
+  sexp_bytecode_max_depth(bc) = sexp_fasl_get_uint(r);
+  x = sexp_fasl_read(ctx, r);
+  sexp_bytecode_name(bc) = x;
+  x = sexp_fasl_read(ctx, r);
+  sexp_bytecode_source(bc) = x;
+  if (!(data = sexp_fasl_get_bytes(r, len)))
+    return NULL;
+  memcpy(sexp_bytecode_data(bc), data, len);
+  for (off=0; off<len && !r->failedp; off+=1+words*sizeof(sexp)) {
+    op = data[off];
+    words = sexp_aot_operand_words(op);
+    if (off + 1 + words*sizeof(sexp) > len) break;
+    for (k=0; k<words; k++) {
+      pos = off + 1 + k*sizeof(sexp);
+      memcpy(&x, data + pos, sizeof(sexp));
+      if (x) continue;
+      if (sexp_aot_object_operand_p(op, k)) {
+        x = sexp_fasl_read(ctx, r);
+      } else if (k == 0 && (op == SEXP_OP_TYPEP || op == SEXP_OP_MAKE
+                            || op == SEXP_OP_SLOT_REF || op == SEXP_OP_SLOT_SET)) {
+        x = sexp_fasl_read(ctx, r);
+        if (!r->failedp && !sexp_typep(x))
+          r->failedp = 1;
+        if (!r->failedp)
+          x = (sexp) (sexp_uint_t) sexp_type_tag(x);
+      } else {
+        continue;
+      }
+      if (r->failedp)
+        return NULL;
+      memcpy(sexp_bytecode_data(bc) + pos, &x, sizeof(sexp));
+    }
+  }
+  x = sexp_fasl_read(ctx, r);
+  sexp_bytecode_literals(bc) = x;
+  sexp_bless_bytecode(ctx, bc);
+  return bc;
+}
+
+static sexp sexp_fasl_read (sexp ctx, struct sexp_fasl_reader_t *r) {
+  sexp_uint_t i, len;
+  const unsigned char *data;
+  sexp res = NULL, ls, x;
+#if SEXP_USE_FLONUMS
+  double d;
+#endif
+  int flags, tag = sexp_fasl_get_byte(r);
+  if (r->failedp)
+    return NULL;
+  switch (tag) {
+  case SEXP_FASL_IMMEDIATE:
+    if ((data = sexp_fasl_get_bytes(r, sizeof(sexp))))
+      memcpy(&res, data, sizeof(sexp));
+    break;
+  case SEXP_FASL_BACKREF:
+    i = sexp_fasl_get_uint(r);
+    if (i < r->count)
+      res = sexp_vector_ref(*r->table, sexp_make_fixnum(i));
+    else
+      r->failedp = 1;
+    break;
+  case SEXP_FASL_LIST:
+    for (ls=NULL; ; ) {
+      x = sexp_fasl_register(r, sexp_cons(ctx, SEXP_FALSE, SEXP_NULL));
+      if (r->failedp) break;
+      if (ls) sexp_cdr(ls) = x; else res = x;
+      ls = x;
+      sexp_immutablep(ls) = sexp_fasl_get_byte(r);
+      x = sexp_fasl_read(ctx, r);
+      sexp_pair_source(ls) = x;
+      x = sexp_fasl_read(ctx, r);
+      sexp_car(ls) = x;
+      if (r->failedp || !sexp_fasl_get_byte(r)) break;
+    }
+    if (r->failedp) break;
+    x = sexp_fasl_read(ctx, r);
+    sexp_cdr(ls) = x;
+    break;
+  case SEXP_FASL_VECTOR:
+    flags = sexp_fasl_get_byte(r);
+    len = sexp_fasl_get_uint(r);
+    if (r->failedp || len > (sexp_uint_t)(r->end - r->p)) break;
+    res = sexp_make_vector(ctx, sexp_make_fixnum(len), SEXP_FALSE);
+    sexp_fasl_register(r, res);
+    for (i=0; i<len && !r->failedp; i++) {
+      x = sexp_fasl_read(ctx, r);
+      sexp_vector_data(res)[i] = x;
+    }
+    if (!r->failedp) sexp_immutablep(res) = flags;
+    break;
+  case SEXP_FASL_STRING:
+  case SEXP_FASL_BYTES:
+    flags = sexp_fasl_get_byte(r);
+    len = sexp_fasl_get_uint(r);
+    if (!(data = sexp_fasl_get_bytes(r, len))) break;
+    if (tag == SEXP_FASL_STRING) {
+      res = sexp_c_string(ctx, (const char*)data, len);
+    } else {
+      res = sexp_make_bytes(ctx, sexp_make_fixnum(len), SEXP_ZERO);
+      if (!sexp_exceptionp(res)) memcpy(sexp_bytes_data(res), data, len);
+    }
+    sexp_fasl_register(r, res);
+    if (!r->failedp) sexp_immutablep(res) = flags;
+    break;
+  case SEXP_FASL_SYMBOL:
+    len = sexp_fasl_get_uint(r);
+    if ((data = sexp_fasl_get_bytes(r, len)))
+      res = sexp_fasl_register(r, sexp_intern(ctx, (const char*)data, len));
+    break;
+#if SEXP_USE_FLONUMS
+  case SEXP_FASL_FLONUM:
+    if ((data = sexp_fasl_get_bytes(r, sizeof(double)))) {
+      memcpy(&d, data, sizeof(double));
+      res = sexp_fasl_register(r, sexp_make_flonum(ctx, d));
+    }
+    break;
+#endif
+#if SEXP_USE_BIGNUMS
+  case SEXP_FASL_BIGNUM:
+    flags = sexp_fasl_get_byte(r);
+    len = sexp_fasl_get_uint(r);
+    if (!(data = sexp_fasl_get_bytes(r, len*sizeof(sexp_uint_t)))) break;
+    res = sexp_fasl_register(r, sexp_make_bignum(ctx, len));
+    if (r->failedp) break;
+    sexp_bignum_sign(res) = flags ? -1 : 1;
+    memcpy(sexp_bignum_data(res), data, len*sizeof(sexp_uint_t));
+    break;
+#endif
+#if SEXP_USE_RATIOS
+  case SEXP_FASL_RATIO:
+    res = sexp_fasl_register(r, sexp_make_ratio(ctx, SEXP_ZERO, SEXP_ONE));
+    if (r->failedp) break;
+    x = sexp_fasl_read(ctx, r);
+    sexp_ratio_numerator(res) = x;
+    x = sexp_fasl_read(ctx, r);
+    sexp_ratio_denominator(res) = x;
+    break;
+#endif
+#if SEXP_USE_COMPLEX
+  case SEXP_FASL_COMPLEX:
+    res = sexp_fasl_register(r, sexp_make_complex(ctx, SEXP_ZERO, SEXP_ZERO));
+    if (r->failedp) break;
+    x = sexp_fasl_read(ctx, r);
+    sexp_complex_real(res) = x;
+    x = sexp_fasl_read(ctx, r);
+    sexp_complex_imag(res) = x;
+    break;
+#endif
+  case SEXP_FASL_CELL:
+  case SEXP_FASL_VALUE:
+    res = sexp_fasl_read_place(ctx, r, tag == SEXP_FASL_CELL);
+    break;
+  case SEXP_FASL_BYTECODE:
+    res = sexp_fasl_read_bytecode(ctx, r);
+    break;
+  case SEXP_FASL_PROCEDURE:
+    flags = sexp_fasl_get_byte(r);
+    len = sexp_fasl_get_uint(r);
+    if (r->failedp) break;
+    res = sexp_make_procedure(ctx, SEXP_ZERO, sexp_make_fixnum(len),
+                              SEXP_FALSE, SEXP_FALSE);
+    sexp_fasl_register(r, res);
+    if (r->failedp) break;
+    sexp_procedure_flags(res) = flags;
+    x = sexp_fasl_read(ctx, r);
+    sexp_procedure_code(res) = x;
+    x = sexp_fasl_read(ctx, r);
+    sexp_procedure_vars(res) = x;
+    if (!r->failedp && !sexp_bytecodep(sexp_procedure_code(res)))
+      r->failedp = 1;
+    break;
+  default:
+    r->failedp = 1;
+    break;
+  }
+  return r->failedp ? NULL : res;
+}
+
+/* reads the section at r->p, returning NULL if it can't be read, */
+/* and leaves r->p after the section in any case */
+static sexp sexp_fasl_read_section (sexp ctx, struct sexp_fasl_reader_t *r) {
+  sexp_uint_t count = sexp_fasl_get_uint(r), len = sexp_fasl_get_uint(r);
+  const unsigned char *end = r->end, *start = sexp_fasl_get_bytes(r, len);
+  sexp res;
+  if (!start || count > len)
+    return NULL;
+  *r->table = sexp_make_vector(ctx, sexp_make_fixnum(count), SEXP_FALSE);
+  if (sexp_exceptionp(*r->table))
+    return NULL;
+  r->count = 0;
+  r->end = r->p;
+  r->p = start;
+  res = sexp_fasl_read(ctx, r);
+  r->p = r->end;
+  r->end = end;
+  if (r->failedp) {
+    r->failedp = 0;
+    res = NULL;
+  }
+  *r->table = SEXP_FALSE;
+  return res;
+}
+
+/* runs a compiled thunk as sexp_eval would */
+static sexp sexp_fasl_apply (sexp ctx, sexp thunk, sexp env) {
+  sexp_sint_t top;
+  sexp ctx2;
+  sexp_gc_var3(res, tmp, params);
+  sexp_gc_preserve3(ctx, res, tmp, params);
+  top = sexp_context_top(ctx);
+  params = sexp_context_params(ctx);
+  sexp_context_params(ctx) = SEXP_NULL;
+  ctx2 = sexp_make_eval_context(ctx, NULL, env, 0, 0);
+  tmp = sexp_context_child(ctx);
+  sexp_context_child(ctx) = ctx2;
+  res = sexp_exceptionp(ctx2) ? ctx2 : sexp_apply(ctx2, thunk, SEXP_NULL);
+  sexp_context_child(ctx) = tmp;
+  sexp_context_params(ctx) = params;
+  sexp_context_top(ctx) = top;
+  sexp_context_last_fp(ctx) = sexp_context_last_fp(ctx2);
+  sexp_gc_release3(ctx);
+  return res;
+}
+
+/* loads source from its cache file, returning #f if not caching */
+/* or there's no valid cache file, before anything was run */
+static sexp sexp_fasl_load (sexp ctx, sexp source, sexp env) {
+  const char *dir = getenv(SEXP_FASL_CACHE_VAR);
+  char *path;
+  unsigned char *text, *fasl = NULL;
+  sexp_uint_t len, fasl_len;
+  struct sexp_fasl_reader_t r;
+  int kind;
+  sexp_gc_var4(res, thunk, form, table);
+  if (!dir || !*dir)
+    return SEXP_FALSE;
+  if (!(text = sexp_fasl_slurp(sexp_string_data(source), &len)))
+    return SEXP_FALSE;
+  if ((path = sexp_fasl_cache_path(dir, sexp_string_data(source)))) {
+    fasl = sexp_fasl_slurp(path, &fasl_len);
+    free(path);
+  }
+  memset(&r, 0, sizeof(r));
+  if (fasl) {
+    r.p = fasl;
+    r.end = fasl + fasl_len;
+    if (!(fasl_len > strlen(SEXP_FASL_MAGIC)
+          && memcmp(fasl, SEXP_FASL_MAGIC, strlen(SEXP_FASL_MAGIC)) == 0
+          && (r.p += strlen(SEXP_FASL_MAGIC))
+          && sexp_fasl_get_uint(&r) == SEXP_FASL_VERSION
+          && sexp_fasl_get_string_eq(&r, sexp_version)
+          && sexp_fasl_get_string_eq(&r, SEXP_ABI_IDENTIFIER)
+          && sexp_fasl_get_uint(&r) == len
+          && sexp_fasl_get_uint(&r) == sexp_fasl_hash(text, len)
+          && sexp_fasl_get_dependencies(&r)
+          && !r.failedp)) {
+      free(fasl);
+      fasl = NULL;
+    }
+  }
+  free(text);
+  if (!fasl)
+    return SEXP_FALSE;
+  sexp_gc_preserve4(ctx, res, thunk, form, table);
+  r.env = env;
+  r.table = &table;
+  res = SEXP_VOID;
+  while ((kind = sexp_fasl_get_byte(&r)) != SEXP_FASL_END && !r.failedp) {
+    thunk = NULL;
+    if (kind == SEXP_FASL_COMPILED)
+      thunk = sexp_fasl_read_section(ctx, &r);
+    form = sexp_fasl_read_section(ctx, &r);
+    if (!form) {
+      res = sexp_user_exception(ctx, SEXP_FALSE, "broken compiled file cache", source);
+      break;
+    }
+    if (thunk && sexp_procedurep(thunk))
+      res = sexp_fasl_apply(ctx, thunk, env);
+    else
+      res = sexp_eval(ctx, form, env);
+    if (sexp_exceptionp(res))
+      break;
+  }
+  if (!sexp_exceptionp(res))
+    res = SEXP_VOID;
+  sexp_gc_release4(ctx);
+  free(fasl);
+  return res;
+}
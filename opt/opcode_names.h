@@ -19,6 +19,12 @@ static const char* sexp_opcode_names_[] =
    "CHAR->INTEGER", "INTEGER->CHAR", "CHAR-UPCASE", "CHAR-DOWNCASE",
    "WRITE-CHAR", "WRITE-STRING", "READ-CHAR", "PEEK-CHAR",
    "YIELD", "FORCE", "RET", "DONE",
+   "LOCAL-REF-CAR", "LOCAL-REF-CDR", "CLOSURE-REF-CDR",
+   "LOCAL-REF-JUMP-UNLESS", "GLOBAL-KNOWN-CALL",
+   "LT-JUMP-UNLESS", "LE-JUMP-UNLESS", "EQN-JUMP-UNLESS", "EQ-JUMP-UNLESS",
+   "NULL?-JUMP-UNLESS", "PAIR?-JUMP-UNLESS", "FLONUM-ARITH",
+   "UNCHECKED-CAR", "UNCHECKED-CDR", "UNCHECKED-VECTOR-REF",
+   "UNCHECKED-ADD", "UNCHECKED-SUB",
   };
 
 const char** sexp_opcode_names = sexp_opcode_names_;
@@ -0,0 +1,897 @@
+/* A template JIT from bytecode to x86-64 machine code.  Once a */
+/* procedure's bytecode has been called SEXP_NATIVE_X86_THRESHOLD */
+/* times each instruction is translated, in order, to a fixed */
+/* sequence of machine code which keeps the VM state in registers */
+/* and leaves the stack exactly as the VM would: rbx holds the */
+/* sexp_native_regs_t, r12 the bytecode data, r13 &stack[top], r14 */
+/* &stack[fp] and r15 the closure vars.  Only the fast paths of */
+/* the common opcodes are compiled, including calls and returns */
+/* between compiled procedures with the exact number of arguments. */
+/* For anything else, an unsupported opcode, a failed type check, */
+/* fixnum overflow, a call to a procedure not yet compiled, or */
+/* running out of fuel, the machine code returns to the VM the */
+/* offset of the instruction to resume at, before that instruction */
+/* has changed any state, so the VM runs it with the full checks */
+/* and then enters the machine code again.  The machine code only */
+/* reads operands from the bytecode at run time, except for */
+/* immediates, so the GC can still relocate the literals.  Code */
+/* memory is never freed, so the JIT stops compiling after */
+/* SEXP_NATIVE_X86_CODE_LIMIT bytes. */
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#define SEXP_NATIVE_THRESHOLD SEXP_NATIVE_X86_THRESHOLD
+
+#define SEXP_NATIVE_X86_CHUNK_SIZE (1024*1024)
+
+enum x86_reg {
+  X86_RAX, X86_RCX, X86_RDX, X86_RBX, X86_RSP, X86_RBP, X86_RSI, X86_RDI,
+  X86_R8, X86_R9, X86_R10, X86_R11, X86_R12, X86_R13, X86_R14, X86_R15
+};
+
+#define X86_REGS X86_RBX
+#define X86_DATA X86_R12
+#define X86_TOP  X86_R13
+#define X86_FP   X86_R14
+#define X86_CP   X86_R15
+
+enum x86_cc {
+  X86_O = 0, X86_NO, X86_B, X86_AE, X86_E, X86_NE, X86_BE, X86_A,
+  X86_S, X86_NS, X86_P, X86_NP, X86_L, X86_GE, X86_LE, X86_G
+};
+
+/* the /digit extensions of the group 1 immediate opcodes */
+enum x86_alu {X86_ADD = 0, X86_OR = 1, X86_AND = 4, X86_SUB = 5, X86_CMP = 7};
+
+#define X86_SHL 4
+#define X86_SAR 7
+
+#define x86_regs_off(field) ((sexp_sint_t)offsetof(sexp_native_regs_t, field))
+#define x86_value_off(field) ((sexp_sint_t)offsetof(struct sexp_struct, value.field))
+
+/* a jump to patch once the code for its target is known */
+struct x86_fixup {
+  sexp_uint_t pos;              /* of the rel32 */
+  sexp_sint_t target;           /* bytecode offset */
+  int exitp;                    /* to the exit for target, not its code */
+};
+
+struct x86_buf {
+  unsigned char *code;
+  sexp_uint_t len, size;
+  struct x86_fixup *fixups;
+  sexp_uint_t num_fixups, fixups_size;
+  sexp_sint_t *labels, *exits;  /* code positions by bytecode offset */
+  sexp_uint_t common_exit, dynamic_exit;
+  int error;
+};
+
+/************************** instruction encoding **************************/
+
+static void x86_byte (struct x86_buf *b, int c) {
+  unsigned char *tmp;
+  if (b->len >= b->size) {
+    tmp = (unsigned char*) realloc(b->code, b->size*2);
+    if (! tmp) {
+      b->error = 1;
+      b->len = 0;
+      return;
+    }
+    b->code = tmp;
+    b->size *= 2;
+  }
+  b->code[b->len++] = c;
+}
+
+static void x86_int32 (struct x86_buf *b, sexp_sint_t x) {
+  x86_byte(b, x & 0xFF);
+  x86_byte(b, (x >> 8) & 0xFF);
+  x86_byte(b, (x >> 16) & 0xFF);
+  x86_byte(b, (x >> 24) & 0xFF);
+}
+
+static void x86_patch32 (struct x86_buf *b, sexp_uint_t pos, sexp_sint_t x) {
+  b->code[pos] = x & 0xFF;
+  b->code[pos+1] = (x >> 8) & 0xFF;
+  b->code[pos+2] = (x >> 16) & 0xFF;
+  b->code[pos+3] = (x >> 24) & 0xFF;
+}
+
+#define x86_int8p(x) (-128 <= (x) && (x) <= 127)
+#define x86_int32p(x) (-2147483647L-1 <= (x) && (x) <= 2147483647L)
+
+static void x86_rex (struct x86_buf *b, int w, int reg, int index, int base) {
+  int rex = 0x40 | (w ? 8 : 0) | ((reg & 8) ? 4 : 0)
+    | ((index & 8) ? 2 : 0) | ((base & 8) ? 1 : 0);
+  if (rex != 0x40) x86_byte(b, rex);
+}
+
+static void x86_opcode (struct x86_buf *b, int op) {
+  if (op > 0xFF) x86_byte(b, op >> 8);
+  x86_byte(b, op & 0xFF);
+}
+
+/* [base+disp], always with a displacement so that rbp and r13 */
+/* as the base don't mean rip-relative */
+static void x86_mem (struct x86_buf *b, int reg, int base, sexp_sint_t disp) {
+  int mod = x86_int8p(disp) ? 1 : 2;
+  x86_byte(b, (mod << 6) | ((reg & 7) << 3) | (base & 7));
+  if ((base & 7) == X86_RSP) x86_byte(b, 0x24);
+  if (mod == 1) x86_byte(b, disp & 0xFF); else x86_int32(b, disp);
+}
+
+/* [base+index*scale+disp] */
+static void x86_mem_index (struct x86_buf *b, int reg, int base, int index,
+                           int scale, sexp_sint_t disp) {
+  int mod = x86_int8p(disp) ? 1 : 2;
+  int ss = scale == 8 ? 3 : scale == 4 ? 2 : scale == 2 ? 1 : 0;
+  x86_byte(b, (mod << 6) | ((reg & 7) << 3) | 4);
+  x86_byte(b, (ss << 6) | ((index & 7) << 3) | (base & 7));
+  if (mod == 1) x86_byte(b, disp & 0xFF); else x86_int32(b, disp);
+}
+
+static void x86_op_mem (struct x86_buf *b, int w, int op, int reg, int base,
+                        sexp_sint_t disp) {
+  x86_rex(b, w, reg, 0, base);
+  x86_opcode(b, op);
+  x86_mem(b, reg, base, disp);
+}
+
+static void x86_op_index (struct x86_buf *b, int w, int op, int reg, int base,
+                          int index, int scale, sexp_sint_t disp) {
+  x86_rex(b, w, reg, index, base);
+  x86_opcode(b, op);
+  x86_mem_index(b, reg, base, index, scale, disp);
+}
+
+static void x86_op_reg (struct x86_buf *b, int w, int op, int reg, int rm) {
+  x86_rex(b, w, reg, 0, rm);
+  x86_opcode(b, op);
+  x86_byte(b, 0xC0 | ((reg & 7) << 3) | (rm & 7));
+}
+
+#define x86_load(b, dst, base, disp) x86_op_mem(b, 1, 0x8B, dst, base, disp)
+#define x86_store(b, base, disp, src) x86_op_mem(b, 1, 0x89, src, base, disp)
+#define x86_lea(b, dst, base, disp) x86_op_mem(b, 1, 0x8D, dst, base, disp)
+#define x86_lea32(b, dst, base, disp) x86_op_mem(b, 0, 0x8D, dst, base, disp)
+#define x86_mov(b, dst, src) x86_op_reg(b, 1, 0x89, src, dst)
+#define x86_add(b, dst, src) x86_op_reg(b, 1, 0x03, dst, src)
+#define x86_sub(b, dst, src) x86_op_reg(b, 1, 0x2B, dst, src)
+#define x86_or32(b, dst, src) x86_op_reg(b, 0, 0x0B, dst, src)
+#define x86_cmp(b, x, y) x86_op_reg(b, 1, 0x3B, x, y)
+#define x86_cmp_mem(b, x, base, disp) x86_op_mem(b, 1, 0x3B, x, base, disp)
+#define x86_test(b, x, y) x86_op_reg(b, 1, 0x85, y, x)
+#define x86_imul(b, dst, src) x86_op_reg(b, 1, 0x0FAF, dst, src)
+#define x86_cmov(b, cc, dst, src) x86_op_reg(b, 0, 0x0F40 | (cc), dst, src)
+#define x86_neg(b, r) x86_op_reg(b, 1, 0xF7, 3, r)
+#define x86_jmp_reg(b, r) x86_op_reg(b, 0, 0xFF, 4, r)
+#define x86_dec_mem(b, base, disp) x86_op_mem(b, 1, 0xFF, 1, base, disp)
+
+static void x86_alu_imm (struct x86_buf *b, int w, int ext, int rm, sexp_sint_t imm) {
+  x86_op_reg(b, w, x86_int8p(imm) ? 0x83 : 0x81, ext, rm);
+  if (x86_int8p(imm)) x86_byte(b, imm & 0xFF); else x86_int32(b, imm);
+}
+
+static void x86_alu_imm_mem (struct x86_buf *b, int ext, int base,
+                             sexp_sint_t disp, sexp_sint_t imm) {
+  x86_op_mem(b, 1, x86_int8p(imm) ? 0x83 : 0x81, ext, base, disp);
+  if (x86_int8p(imm)) x86_byte(b, imm & 0xFF); else x86_int32(b, imm);
+}
+
+static void x86_shift (struct x86_buf *b, int ext, int r, int n) {
+  x86_op_reg(b, 1, 0xC1, ext, r);
+  x86_byte(b, n);
+}
+
+/* test the low byte of rax, rcx, rdx or rbx */
+static void x86_test8 (struct x86_buf *b, int r, int imm) {
+  x86_op_reg(b, 0, 0xF6, 0, r);
+  x86_byte(b, imm);
+}
+
+static void x86_mov_imm (struct x86_buf *b, int r, sexp_sint_t imm) {
+  if (0 <= imm && imm <= 0xFFFFFFFFL) {
+    x86_rex(b, 0, 0, 0, r);
+    x86_byte(b, 0xB8 + (r & 7));
+    x86_int32(b, imm);
+  } else if (x86_int32p(imm)) {
+    x86_op_reg(b, 1, 0xC7, 0, r);
+    x86_int32(b, imm);
+  } else {
+    x86_rex(b, 1, 0, 0, r);
+    x86_byte(b, 0xB8 + (r & 7));
+    x86_int32(b, imm);
+    x86_int32(b, imm >> 32);
+  }
+}
+
+static void x86_store_imm (struct x86_buf *b, int base, sexp_sint_t disp,
+                           sexp_sint_t imm) {
+  x86_op_mem(b, 1, 0xC7, 0, base, disp);
+  x86_int32(b, imm);
+}
+
+static void x86_push (struct x86_buf *b, int r) {
+  x86_rex(b, 0, 0, 0, r);
+  x86_byte(b, 0x50 + (r & 7));
+}
+
+static void x86_pop (struct x86_buf *b, int r) {
+  x86_rex(b, 0, 0, 0, r);
+  x86_byte(b, 0x58 + (r & 7));
+}
+
+/* ecx = the type tag of the object in r */
+static void x86_load_tag (struct x86_buf *b, int r) {
+  if (sizeof(sexp_tag_t) == 2)
+    x86_op_mem(b, 0, 0x0FB7, X86_RCX, r, offsetof(struct sexp_struct, tag));
+  else
+    x86_op_mem(b, 0, 0x8B, X86_RCX, r, offsetof(struct sexp_struct, tag));
+}
+
+/***************************** jumps and exits ****************************/
+
+static void x86_fixup (struct x86_buf *b, sexp_sint_t target, int exitp) {
+  struct x86_fixup *tmp;
+  if (b->num_fixups >= b->fixups_size) {
+    tmp = (struct x86_fixup*) realloc(b->fixups, 2*b->fixups_size*sizeof(*tmp));
+    if (! tmp) {
+      b->error = 1;
+      return;
+    }
+    b->fixups = tmp;
+    b->fixups_size *= 2;
+  }
+  b->fixups[b->num_fixups].pos = b->len;
+  b->fixups[b->num_fixups].target = target;
+  b->fixups[b->num_fixups].exitp = exitp;
+  b->num_fixups++;
+  x86_int32(b, 0);
+}
+
+static void x86_jmp_pos (struct x86_buf *b, sexp_uint_t pos) {
+  x86_byte(b, 0xE9);
+  x86_int32(b, pos - (b->len + 4));
+}
+
+/* jumps to the code for the instruction at bytecode offset target */
+static void x86_jmp (struct x86_buf *b, sexp_sint_t target) {
+  x86_byte(b, 0xE9);
+  x86_fixup(b, target, 0);
+}
+
+static void x86_jcc (struct x86_buf *b, int cc, sexp_sint_t target) {
+  x86_byte(b, 0x0F);
+  x86_byte(b, 0x80 | cc);
+  x86_fixup(b, target, 0);
+}
+
+/* a short forward jump, or jmp if cc is negative, to patch below */
+static sexp_uint_t x86_jcc8 (struct x86_buf *b, int cc) {
+  x86_byte(b, cc < 0 ? 0xEB : 0x70 | cc);
+  x86_byte(b, 0);
+  return b->len;
+}
+
+static void x86_patch8 (struct x86_buf *b, sexp_uint_t pos) {
+  if (! b->error) b->code[pos-1] = b->len - pos;
+}
+
+/* returns to the VM to run the instruction at off itself */
+static void x86_exit_cc (struct x86_buf *b, int cc, sexp_sint_t off) {
+  x86_byte(b, 0x0F);
+  x86_byte(b, 0x80 | cc);
+  x86_fixup(b, off, 1);
+}
+
+static void x86_exit_stub (struct x86_buf *b, sexp_sint_t off) {
+  x86_mov_imm(b, X86_RAX, off);
+  x86_jmp_pos(b, b->common_exit);
+}
+
+/* exits to off unless the two regs both hold fixnums */
+static void x86_check_fixnums (struct x86_buf *b, int x, int y, sexp_sint_t off) {
+  x86_lea32(b, X86_RDX, x, -SEXP_FIXNUM_TAG);
+  x86_lea32(b, X86_RSI, y, -SEXP_FIXNUM_TAG);
+  x86_or32(b, X86_RDX, X86_RSI);
+  x86_test8(b, X86_RDX, SEXP_FIXNUM_MASK);
+  x86_exit_cc(b, X86_NE, off);
+}
+
+/* exits to off unless r holds an object with the type tag */
+static void x86_check_tag (struct x86_buf *b, int r, int tag, sexp_sint_t off) {
+  x86_test8(b, r, SEXP_FIXNUM_MASK);
+  x86_exit_cc(b, X86_NE, off);
+  x86_load_tag(b, r);
+  x86_alu_imm(b, 0, X86_CMP, X86_RCX, tag);
+  x86_exit_cc(b, X86_NE, off);
+}
+
+/* rax = #t if the flags are cc, #f otherwise */
+static void x86_boolean (struct x86_buf *b, int cc) {
+  x86_mov_imm(b, X86_RAX, (sexp_sint_t)SEXP_FALSE);
+  x86_mov_imm(b, X86_RCX, (sexp_sint_t)SEXP_TRUE);
+  x86_cmov(b, cc, X86_RAX, X86_RCX);
+}
+
+static void x86_fuel (struct x86_buf *b, sexp_sint_t off) {
+  x86_dec_mem(b, X86_REGS, x86_regs_off(fuel));
+  x86_exit_cc(b, X86_LE, off);
+}
+
+/* jumps into the compiled code in r8 at the offset in rsi */
+static void x86_dispatch (struct x86_buf *b) {
+  x86_op_mem(b, 1, 0x63, X86_RAX, X86_R8, -8);
+  x86_add(b, X86_RAX, X86_R8);
+  x86_op_index(b, 1, 0x63, X86_RCX, X86_RAX, X86_RSI, 4, 0);
+  x86_add(b, X86_RAX, X86_RCX);
+  x86_jmp_reg(b, X86_RAX);
+}
+
+/********************************* calls **********************************/
+
+/* Exits to off unless rax holds a procedure taking exactly n args */
+/* whose bytecode is compiled, and there's room on the stack and */
+/* fuel for the call.  Leaves the bytecode in rdx and its compiled */
+/* code in r8. */
+static void x86_check_call (struct x86_buf *b, sexp_sint_t n, int checkp,
+                            sexp_sint_t off) {
+  if (checkp) {
+    x86_check_tag(b, X86_RAX, SEXP_PROCEDURE, off);
+    x86_op_mem(b, 0, 0x0FBE, X86_RCX, X86_RAX, x86_value_off(procedure.flags));
+    x86_test8(b, X86_RCX, SEXP_PROC_VARIADIC << SEXP_FIXNUM_BITS);
+    x86_exit_cc(b, X86_NE, off);
+    if (sizeof(sexp_proc_num_args_t) == 2)
+      x86_op_mem(b, 0, 0x0FBF, X86_RCX, X86_RAX, x86_value_off(procedure.num_args));
+    else
+      x86_op_mem(b, 0, 0x8B, X86_RCX, X86_RAX, x86_value_off(procedure.num_args));
+    x86_alu_imm(b, 0, X86_CMP, X86_RCX, n);
+    x86_exit_cc(b, X86_NE, off);
+  }
+  x86_load(b, X86_RDX, X86_RAX, x86_value_off(procedure.bc));
+  x86_load(b, X86_R8, X86_RDX, x86_value_off(bytecode.native));
+  x86_test(b, X86_R8, X86_R8);
+  x86_exit_cc(b, X86_E, off);
+  /* as sexp_ensure_stack(max_depth+64), with the frame on top */
+  x86_load(b, X86_RCX, X86_RDX, x86_value_off(bytecode.max_depth));
+  x86_op_index(b, 1, 0x8D, X86_RCX, X86_TOP, X86_RCX, 8, (64+4)*sizeof(sexp));
+  x86_cmp_mem(b, X86_RCX, X86_REGS, x86_regs_off(end));
+  x86_exit_cc(b, X86_AE, off);
+  x86_fuel(b, off);
+}
+
+/* enters the procedure in rax, with bytecode in rdx and code in r8 */
+static void x86_enter (struct x86_buf *b) {
+  x86_store(b, X86_REGS, x86_regs_off(self), X86_RAX);
+  x86_load(b, X86_CP, X86_RAX, x86_value_off(procedure.vars));
+  x86_lea(b, X86_DATA, X86_RDX, x86_value_off(bytecode.data));
+  x86_op_mem(b, 1, 0x63, X86_RCX, X86_R8, -4);
+  x86_add(b, X86_RCX, X86_R8);
+  x86_jmp_reg(b, X86_RCX);
+}
+
+/* as push_frame in the VM, with the procedure in rax on top */
+static void x86_call (struct x86_buf *b, sexp_sint_t n, sexp_sint_t ret) {
+  x86_store_imm(b, X86_TOP, -8, (sexp_sint_t)sexp_make_fixnum(n));
+  x86_store_imm(b, X86_TOP, 0, (sexp_sint_t)sexp_make_fixnum(ret));
+  x86_load(b, X86_RCX, X86_REGS, x86_regs_off(self));
+  x86_store(b, X86_TOP, 8, X86_RCX);
+  /* the fixnum fp is the byte offset of the frame, shifted */
+  x86_mov(b, X86_RCX, X86_FP);
+  x86_op_mem(b, 1, 0x2B, X86_RCX, X86_REGS, x86_regs_off(stack));
+  x86_shift(b, X86_SAR, X86_RCX, 3 - SEXP_FIXNUM_BITS);
+  x86_alu_imm(b, 1, X86_OR, X86_RCX, SEXP_FIXNUM_TAG);
+  x86_store(b, X86_TOP, 16, X86_RCX);
+  x86_lea(b, X86_FP, X86_TOP, -8);
+  x86_lea(b, X86_TOP, X86_TOP, 24);
+  x86_enter(b);
+}
+
+/* as TAIL_CALL, replacing the current frame */
+static void x86_tail_call (struct x86_buf *b, sexp_sint_t n) {
+  sexp_sint_t k;
+  x86_load(b, X86_RCX, X86_FP, 0);
+  x86_load(b, X86_R9, X86_FP, 8);
+  x86_load(b, X86_R10, X86_FP, 16);
+  x86_load(b, X86_R11, X86_FP, 24);
+  x86_shift(b, X86_SAR, X86_RCX, SEXP_FIXNUM_BITS);
+  x86_neg(b, X86_RCX);
+  x86_op_index(b, 1, 0x8D, X86_RSI, X86_FP, X86_RCX, 8, 0);
+  /* the args only ever move down the stack */
+  for (k=0; k<n; k++) {
+    x86_load(b, X86_RCX, X86_TOP, -8*(n+1-k));
+    x86_store(b, X86_RSI, 8*k, X86_RCX);
+  }
+  x86_lea(b, X86_FP, X86_RSI, 8*n);
+  x86_store_imm(b, X86_FP, 0, (sexp_sint_t)sexp_make_fixnum(n));
+  x86_store(b, X86_FP, 8, X86_R9);
+  x86_store(b, X86_FP, 16, X86_R10);
+  x86_store(b, X86_FP, 24, X86_R11);
+  x86_lea(b, X86_TOP, X86_FP, 32);
+  x86_enter(b);
+}
+
+static void x86_return (struct x86_buf *b) {
+  x86_load(b, X86_RAX, X86_TOP, -8);
+  x86_load(b, X86_RCX, X86_FP, 0);
+  x86_shift(b, X86_SAR, X86_RCX, SEXP_FIXNUM_BITS);
+  x86_neg(b, X86_RCX);
+  x86_op_index(b, 1, 0x8D, X86_RDX, X86_FP, X86_RCX, 8, 0);
+  x86_store(b, X86_RDX, 0, X86_RAX);
+  x86_lea(b, X86_TOP, X86_RDX, 8);
+  x86_load(b, X86_RSI, X86_FP, 8);
+  x86_shift(b, X86_SAR, X86_RSI, SEXP_FIXNUM_BITS);
+  x86_load(b, X86_RAX, X86_FP, 16);
+  x86_load(b, X86_RCX, X86_FP, 24);
+  x86_shift(b, X86_SAR, X86_RCX, SEXP_FIXNUM_BITS);
+  x86_load(b, X86_RDX, X86_REGS, x86_regs_off(stack));
+  x86_op_index(b, 1, 0x8D, X86_FP, X86_RDX, X86_RCX, 8, 0);
+  x86_store(b, X86_REGS, x86_regs_off(self), X86_RAX);
+  x86_load(b, X86_CP, X86_RAX, x86_value_off(procedure.vars));
+  x86_load(b, X86_RDX, X86_RAX, x86_value_off(procedure.bc));
+  x86_lea(b, X86_DATA, X86_RDX, x86_value_off(bytecode.data));
+  x86_load(b, X86_R8, X86_RDX, x86_value_off(bytecode.native));
+  x86_test(b, X86_R8, X86_R8);
+  x86_byte(b, 0x0F);
+  x86_byte(b, 0x80 | X86_E);
+  x86_int32(b, b->dynamic_exit - (b->len + 4));
+  x86_dispatch(b);
+}
+
+/******************************* templates ********************************/
+
+/* pushes rax */
+static void x86_push_rax (struct x86_buf *b) {
+  x86_store(b, X86_TOP, 0, X86_RAX);
+  x86_lea(b, X86_TOP, X86_TOP, 8);
+}
+
+#define x86_local(n) (-8 - 8*(n))
+#define x86_closure(n) (x86_value_off(vector.data) + 8*(n))
+
+/* Emits the code for the instruction at off with the given number */
+/* of operand words, returning 0 if it's left to the VM. */
+static int x86_instruction (struct x86_buf *b, unsigned char *data,
+                            sexp_sint_t off, int words) {
+  sexp_sint_t w0 = words > 0 ? ((sexp_sint_t*)(data+off+1))[0] : 0,
+    w1 = words > 1 ? ((sexp_sint_t*)(data+off+1))[1] : 0;
+  sexp_uint_t done, done2, match;
+  int cc;
+  switch (data[off]) {
+  case SEXP_OP_LOCAL_REF:
+    x86_load(b, X86_RAX, X86_FP, x86_local(w0));
+    x86_push_rax(b);
+    return 1 + sizeof(sexp);
+  case SEXP_OP_LOCAL_SET:
+    x86_load(b, X86_RAX, X86_TOP, -8);
+    x86_store(b, X86_FP, x86_local(w0), X86_RAX);
+    x86_lea(b, X86_TOP, X86_TOP, -8);
+    return 1 + sizeof(sexp);
+  case SEXP_OP_STACK_REF:
+    x86_load(b, X86_RAX, X86_TOP, -8*w0);
+    x86_push_rax(b);
+    return 1 + sizeof(sexp);
+  case SEXP_OP_CLOSURE_REF:
+    x86_load(b, X86_RAX, X86_CP, x86_closure(w0));
+    x86_push_rax(b);
+    return 1 + sizeof(sexp);
+  case SEXP_OP_CLOSURE_REF_CDR:
+    x86_load(b, X86_RAX, X86_CP, x86_closure(w0));
+    x86_load(b, X86_RAX, X86_RAX, x86_value_off(pair.cdr));
+    x86_push_rax(b);
+    return 1 + sizeof(sexp);
+  case SEXP_OP_PUSH:
+    if (! sexp_pointerp((sexp)w0) && x86_int32p(w0)) {
+      x86_store_imm(b, X86_TOP, 0, w0);
+      x86_lea(b, X86_TOP, X86_TOP, 8);
+    } else {
+      x86_load(b, X86_RAX, X86_DATA, off+1);
+      x86_push_rax(b);
+    }
+    return 1 + sizeof(sexp);
+  case SEXP_OP_DROP:
+    x86_lea(b, X86_TOP, X86_TOP, -8);
+    return 1;
+  case SEXP_OP_GLOBAL_REF:
+  case SEXP_OP_GLOBAL_KNOWN_REF:
+    x86_load(b, X86_RAX, X86_DATA, off+1);
+    x86_load(b, X86_RAX, X86_RAX, x86_value_off(pair.cdr));
+    if (data[off] == SEXP_OP_GLOBAL_REF) {
+      x86_alu_imm(b, 1, X86_CMP, X86_RAX, (sexp_sint_t)SEXP_UNDEF);
+      x86_exit_cc(b, X86_E, off);
+    }
+    x86_push_rax(b);
+    return 1 + sizeof(sexp);
+  case SEXP_OP_JUMP:
+    if (w0 < 0) x86_fuel(b, off);
+    x86_jmp(b, off+1+w0);
+    return 1 + sizeof(sexp);
+  case SEXP_OP_JUMP_UNLESS:
+    x86_lea(b, X86_TOP, X86_TOP, -8);
+    x86_alu_imm_mem(b, X86_CMP, X86_TOP, 0, (sexp_sint_t)SEXP_FALSE);
+    x86_jcc(b, X86_E, off+1+w0);
+    return 1 + sizeof(sexp);
+  case SEXP_OP_LOCAL_REF_JUMP_UNLESS:
+    x86_alu_imm_mem(b, X86_CMP, X86_FP, x86_local(w0), (sexp_sint_t)SEXP_FALSE);
+    x86_jcc(b, X86_E, off+1+sizeof(sexp)+w1);
+    return 1 + 2*sizeof(sexp);
+  case SEXP_OP_LT_JUMP_UNLESS: cc = X86_GE; goto num_cmp_jump_unless;
+  case SEXP_OP_LE_JUMP_UNLESS: cc = X86_G; goto num_cmp_jump_unless;
+  case SEXP_OP_EQN_JUMP_UNLESS: cc = X86_NE;
+  num_cmp_jump_unless:
+    x86_load(b, X86_RAX, X86_TOP, -8);
+    x86_load(b, X86_RCX, X86_TOP, -16);
+    x86_check_fixnums(b, X86_RAX, X86_RCX, off);
+    x86_lea(b, X86_TOP, X86_TOP, -16);
+    x86_cmp(b, X86_RAX, X86_RCX);
+    x86_jcc(b, cc, off+1+w0);
+    return 1 + sizeof(sexp);
+  case SEXP_OP_EQ_JUMP_UNLESS:
+    x86_load(b, X86_RAX, X86_TOP, -8);
+    x86_lea(b, X86_TOP, X86_TOP, -16);
+    x86_cmp_mem(b, X86_RAX, X86_TOP, 0);
+    x86_jcc(b, X86_NE, off+1+w0);
+    return 1 + sizeof(sexp);
+  case SEXP_OP_NULLP_JUMP_UNLESS:
+    x86_lea(b, X86_TOP, X86_TOP, -8);
+    x86_alu_imm_mem(b, X86_CMP, X86_TOP, 0, (sexp_sint_t)SEXP_NULL);
+    x86_jcc(b, X86_NE, off+1+w0);
+    return 1 + sizeof(sexp);
+  case SEXP_OP_PAIRP_JUMP_UNLESS:
+    x86_lea(b, X86_TOP, X86_TOP, -8);
+    x86_load(b, X86_RAX, X86_TOP, 0);
+    x86_test8(b, X86_RAX, SEXP_FIXNUM_MASK);
+    x86_jcc(b, X86_NE, off+1+w0);
+    x86_load_tag(b, X86_RAX);
+    x86_alu_imm(b, 0, X86_CMP, X86_RCX, SEXP_PAIR);
+    x86_jcc(b, X86_NE, off+1+w0);
+    return 1 + sizeof(sexp);
+  case SEXP_OP_EQ:
+    x86_load(b, X86_RDX, X86_TOP, -8);
+    x86_cmp_mem(b, X86_RDX, X86_TOP, -16);
+    x86_boolean(b, X86_E);
+    x86_lea(b, X86_TOP, X86_TOP, -8);
+    x86_store(b, X86_TOP, -8, X86_RAX);
+    return 1;
+  case SEXP_OP_NULLP:
+    x86_alu_imm_mem(b, X86_CMP, X86_TOP, -8, (sexp_sint_t)SEXP_NULL);
+    x86_boolean(b, X86_E);
+    x86_store(b, X86_TOP, -8, X86_RAX);
+    return 1;
+  case SEXP_OP_FIXNUMP:
+    x86_load(b, X86_RDX, X86_TOP, -8);
+    x86_lea32(b, X86_RDX, X86_RDX, -SEXP_FIXNUM_TAG);
+    x86_test8(b, X86_RDX, SEXP_FIXNUM_MASK);
+    x86_boolean(b, X86_E);
+    x86_store(b, X86_TOP, -8, X86_RAX);
+    return 1;
+  case SEXP_OP_TYPEP:
+    /* objects of other core types aren't instances of any other */
+    /* type, except Object, leave anything else to the VM */
+    if (w0 == SEXP_OBJECT) return 0;
+    x86_load(b, X86_RDX, X86_TOP, -8);
+    x86_mov_imm(b, X86_RAX, (sexp_sint_t)SEXP_FALSE);
+    x86_test8(b, X86_RDX, SEXP_FIXNUM_MASK);
+    done = x86_jcc8(b, X86_NE);
+    x86_load_tag(b, X86_RDX);
+    x86_alu_imm(b, 0, X86_CMP, X86_RCX, w0);
+    match = x86_jcc8(b, X86_E);
+    x86_alu_imm(b, 0, X86_CMP, X86_RCX, SEXP_NUM_CORE_TYPES);
+    x86_exit_cc(b, X86_AE, off);
+    done2 = x86_jcc8(b, -1);
+    x86_patch8(b, match);
+    x86_mov_imm(b, X86_RAX, (sexp_sint_t)SEXP_TRUE);
+    x86_patch8(b, done);
+    x86_patch8(b, done2);
+    x86_store(b, X86_TOP, -8, X86_RAX);
+    return 1 + sizeof(sexp);
+  case SEXP_OP_LT: cc = X86_L; goto num_cmp;
+  case SEXP_OP_LE: cc = X86_LE; goto num_cmp;
+  case SEXP_OP_EQN: cc = X86_E;
+  num_cmp:
+    x86_load(b, X86_RAX, X86_TOP, -8);
+    x86_load(b, X86_RCX, X86_TOP, -16);
+    x86_check_fixnums(b, X86_RAX, X86_RCX, off);
+    x86_cmp(b, X86_RAX, X86_RCX);
+    x86_boolean(b, cc);
+    x86_lea(b, X86_TOP, X86_TOP, -8);
+    x86_store(b, X86_TOP, -8, X86_RAX);
+    return 1;
+  case SEXP_OP_CAR:
+  case SEXP_OP_CDR:
+    x86_load(b, X86_RAX, X86_TOP, -8);
+    x86_check_tag(b, X86_RAX, SEXP_PAIR, off);
+    /* ... FALLTHROUGH ... */
+  case SEXP_OP_UNCHECKED_CAR:
+  case SEXP_OP_UNCHECKED_CDR:
+    if (data[off] == SEXP_OP_UNCHECKED_CAR || data[off] == SEXP_OP_UNCHECKED_CDR)
+      x86_load(b, X86_RAX, X86_TOP, -8);
+    x86_load(b, X86_RAX, X86_RAX,
+             (data[off] == SEXP_OP_CAR || data[off] == SEXP_OP_UNCHECKED_CAR)
+             ? x86_value_off(pair.car) : x86_value_off(pair.cdr));
+    x86_store(b, X86_TOP, -8, X86_RAX);
+    return 1;
+  case SEXP_OP_LOCAL_REF_CAR:
+  case SEXP_OP_LOCAL_REF_CDR:
+    x86_load(b, X86_RAX, X86_FP, x86_local(w0));
+    x86_check_tag(b, X86_RAX, SEXP_PAIR, off);
+    x86_load(b, X86_RAX, X86_RAX, data[off] == SEXP_OP_LOCAL_REF_CAR
+             ? x86_value_off(pair.car) : x86_value_off(pair.cdr));
+    x86_push_rax(b);
+    return 1 + sizeof(sexp);
+  case SEXP_OP_VECTOR_REF:
+  case SEXP_OP_UNCHECKED_VECTOR_REF:
+    x86_load(b, X86_RAX, X86_TOP, -8);
+    if (data[off] == SEXP_OP_VECTOR_REF)
+      x86_check_tag(b, X86_RAX, SEXP_VECTOR, off);
+    x86_load(b, X86_RCX, X86_TOP, -16);
+    if (data[off] == SEXP_OP_VECTOR_REF) {
+      x86_lea32(b, X86_RDX, X86_RCX, -SEXP_FIXNUM_TAG);
+      x86_test8(b, X86_RDX, SEXP_FIXNUM_MASK);
+      x86_exit_cc(b, X86_NE, off);
+    }
+    /* an unsigned compare also catches negative indexes */
+    x86_shift(b, X86_SAR, X86_RCX, SEXP_FIXNUM_BITS);
+    x86_cmp_mem(b, X86_RCX, X86_RAX, x86_value_off(vector.length));
+    x86_exit_cc(b, X86_AE, off);
+    x86_op_index(b, 1, 0x8B, X86_RAX, X86_RAX, X86_RCX, 8, x86_value_off(vector.data));
+    x86_lea(b, X86_TOP, X86_TOP, -8);
+    x86_store(b, X86_TOP, -8, X86_RAX);
+    return 1;
+  case SEXP_OP_VECTOR_LENGTH:
+    x86_load(b, X86_RAX, X86_TOP, -8);
+    x86_check_tag(b, X86_RAX, SEXP_VECTOR, off);
+    x86_load(b, X86_RAX, X86_RAX, x86_value_off(vector.length));
+    x86_shift(b, X86_SHL, X86_RAX, SEXP_FIXNUM_BITS);
+    x86_alu_imm(b, 1, X86_OR, X86_RAX, SEXP_FIXNUM_TAG);
+    x86_store(b, X86_TOP, -8, X86_RAX);
+    return 1;
+  case SEXP_OP_ADD:
+  case SEXP_OP_SUB:
+  case SEXP_OP_MUL:
+  case SEXP_OP_UNCHECKED_ADD:
+  case SEXP_OP_UNCHECKED_SUB:
+    /* tagged fixnums overflow exactly when the word does, so any */
+    /* result needing a bignum is left to the VM */
+    x86_load(b, X86_RAX, X86_TOP, -8);
+    x86_load(b, X86_RCX, X86_TOP, -16);
+    if (data[off] != SEXP_OP_UNCHECKED_ADD && data[off] != SEXP_OP_UNCHECKED_SUB)
+      x86_check_fixnums(b, X86_RAX, X86_RCX, off);
+    if (data[off] == SEXP_OP_MUL) {
+      x86_shift(b, X86_SAR, X86_RAX, SEXP_FIXNUM_BITS);
+      x86_lea(b, X86_RCX, X86_RCX, -SEXP_FIXNUM_TAG);
+      x86_imul(b, X86_RAX, X86_RCX);
+      x86_exit_cc(b, X86_O, off);
+      x86_alu_imm(b, 1, X86_OR, X86_RAX, SEXP_FIXNUM_TAG);
+    } else {
+      x86_lea(b, X86_RCX, X86_RCX, -SEXP_FIXNUM_TAG);
+      if (data[off] == SEXP_OP_ADD || data[off] == SEXP_OP_UNCHECKED_ADD)
+        x86_add(b, X86_RAX, X86_RCX);
+      else
+        x86_sub(b, X86_RAX, X86_RCX);
+      x86_exit_cc(b, X86_O, off);
+    }
+    x86_lea(b, X86_TOP, X86_TOP, -8);
+    x86_store(b, X86_TOP, -8, X86_RAX);
+    return 1;
+  case SEXP_OP_CALL:
+    x86_load(b, X86_RAX, X86_TOP, -8);
+    x86_check_call(b, w0, 1, off);
+    x86_call(b, w0, off+1+sizeof(sexp));
+    return 1 + sizeof(sexp);
+  case SEXP_OP_TAIL_CALL:
+    x86_load(b, X86_RAX, X86_TOP, -8);
+    x86_check_call(b, w0, 1, off);
+    x86_tail_call(b, w0);
+    return 1 + sizeof(sexp);
+  case SEXP_OP_GLOBAL_KNOWN_CALL:
+    x86_load(b, X86_RAX, X86_DATA, off+1);
+    x86_load(b, X86_RAX, X86_RAX, x86_value_off(pair.cdr));
+#if SEXP_USE_INLINE_CACHES
+    /* a cache hit has been checked for the arity already */
+    x86_load(b, X86_RCX, X86_DATA, off+1+2*sizeof(sexp));
+    x86_cmp_mem(b, X86_RAX, X86_RCX, x86_value_off(pair.car));
+    x86_exit_cc(b, X86_NE, off);
+    x86_check_call(b, sexp_unbox_fixnum((sexp)w1), 0, off);
+#else
+    x86_check_call(b, sexp_unbox_fixnum((sexp)w1), 1, off);
+#endif
+    x86_lea(b, X86_TOP, X86_TOP, 8);
+    x86_call(b, sexp_unbox_fixnum((sexp)w1), off+1+3*sizeof(sexp));
+    return 1 + 3*sizeof(sexp);
+  case SEXP_OP_RET:
+    x86_return(b);
+    return 1;
+  }
+  return 0;
+}
+
+/* the number of operand words following each opcode */
+static int x86_operand_words (int op) {
+  switch (op) {
+  case SEXP_OP_FCALL0:      case SEXP_OP_FCALL1:
+  case SEXP_OP_FCALL2:      case SEXP_OP_FCALL3:
+  case SEXP_OP_FCALL4:      case SEXP_OP_CALL:
+  case SEXP_OP_TAIL_CALL:   case SEXP_OP_PUSH:
+  case SEXP_OP_GLOBAL_REF:  case SEXP_OP_GLOBAL_KNOWN_REF:
+#if SEXP_USE_GREEN_THREADS
+  case SEXP_OP_PARAMETER_REF:
+#endif
+#if SEXP_USE_EXTENDED_FCALL
+  case SEXP_OP_FCALLN:
+#endif
+  case SEXP_OP_JUMP:        case SEXP_OP_JUMP_UNLESS:
+  case SEXP_OP_LT_JUMP_UNLESS:    case SEXP_OP_LE_JUMP_UNLESS:
+  case SEXP_OP_EQN_JUMP_UNLESS:   case SEXP_OP_EQ_JUMP_UNLESS:
+  case SEXP_OP_NULLP_JUMP_UNLESS: case SEXP_OP_PAIRP_JUMP_UNLESS:
+  case SEXP_OP_STACK_REF:   case SEXP_OP_CLOSURE_REF:
+  case SEXP_OP_LOCAL_REF:   case SEXP_OP_LOCAL_SET:
+  case SEXP_OP_TYPEP:
+  case SEXP_OP_LOCAL_REF_CAR:   case SEXP_OP_LOCAL_REF_CDR:
+  case SEXP_OP_CLOSURE_REF_CDR:
+#if SEXP_USE_RESERVE_OPCODE
+  case SEXP_OP_RESERVE:
+#endif
+    return 1;
+  case SEXP_OP_MAKE: case SEXP_OP_SLOT_REF: case SEXP_OP_SLOT_SET:
+  case SEXP_OP_LOCAL_REF_JUMP_UNLESS: case SEXP_OP_FLONUM_ARITH:
+    return 2;
+  case SEXP_OP_GLOBAL_KNOWN_CALL: case SEXP_OP_MAKE_PROCEDURE:
+    return 3;
+  }
+  return 0;
+}
+
+/***************************** code memory ********************************/
+
+/* Code is written to pages mapped read/write which are then made */
+/* read/execute, so no page is ever both writable and executable. */
+/* Each procedure starts on a fresh page, since the pages of earlier */
+/* code can't be written again. */
+
+static unsigned char *sexp_native_code_next, *sexp_native_code_end;
+static sexp_uint_t sexp_native_code_total, sexp_native_page_size;
+
+static unsigned char *sexp_native_alloc (sexp_uint_t size) {
+  unsigned char *res;
+  sexp_uint_t chunk;
+  if (! sexp_native_page_size)
+    sexp_native_page_size = sysconf(_SC_PAGESIZE);
+  size = (size + sexp_native_page_size - 1) & ~(sexp_native_page_size - 1);
+  if (sexp_native_code_total + size > SEXP_NATIVE_X86_CODE_LIMIT)
+    return NULL;
+  if (! sexp_native_code_next
+      || sexp_native_code_next + size > sexp_native_code_end) {
+    chunk = size > SEXP_NATIVE_X86_CHUNK_SIZE ? size : SEXP_NATIVE_X86_CHUNK_SIZE;
+    res = (unsigned char*) mmap(NULL, chunk, PROT_READ|PROT_WRITE,
+                                MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+    if (res == (unsigned char*) MAP_FAILED)
+      return NULL;
+    sexp_native_code_next = res;
+    sexp_native_code_end = res + chunk;
+  }
+  res = sexp_native_code_next;
+  sexp_native_code_next += size;
+  sexp_native_code_total += size;
+  return res;
+}
+
+/* make the pages of newly written code executable */
+static int sexp_native_seal (unsigned char *code, sexp_uint_t size) {
+  size = (size + sexp_native_page_size - 1) & ~(sexp_native_page_size - 1);
+  return mprotect(code, size, PROT_READ|PROT_EXEC) == 0;
+}
+
+/******************************* compiler *********************************/
+
+/* The compiled code starts with a 16 byte header holding the */
+/* offsets from the entry point of the dispatch table, which maps */
+/* each bytecode offset to the code for it, and of the code for */
+/* the first instruction, which calls from other compiled code */
+/* jump to directly. */
+static int sexp_native_compile (sexp ctx, sexp bc) {
+  struct x86_buf b;
+  unsigned char *data = sexp_bytecode_data(bc), *code;
+  sexp_sint_t off, len = sexp_bytecode_length(bc), target, table, i, pos;
+  int words, res = 0;
+  memset(&b, 0, sizeof(b));
+  b.size = 256 + 32*len;
+  b.code = (unsigned char*) malloc(b.size);
+  b.fixups_size = 16;
+  b.fixups = (struct x86_fixup*) malloc(b.fixups_size*sizeof(struct x86_fixup));
+  b.labels = (sexp_sint_t*) malloc((len+1)*sizeof(sexp_sint_t));
+  b.exits = (sexp_sint_t*) malloc((len+1)*sizeof(sexp_sint_t));
+  if (! b.code || ! b.fixups || ! b.labels || ! b.exits)
+    goto done;
+  for (i=0; i<=len; i++)
+    b.labels[i] = b.exits[i] = -1;
+  for (i=0; i<16; i++)
+    x86_byte(&b, 0);
+  /* the entry point saves the callee-saved regs and loads the state */
+  x86_push(&b, X86_RBX);
+  x86_push(&b, X86_R12);
+  x86_push(&b, X86_R13);
+  x86_push(&b, X86_R14);
+  x86_push(&b, X86_R15);
+  x86_mov(&b, X86_REGS, X86_RDI);
+  x86_load(&b, X86_DATA, X86_REGS, x86_regs_off(data));
+  x86_load(&b, X86_TOP, X86_REGS, x86_regs_off(top));
+  x86_load(&b, X86_FP, X86_REGS, x86_regs_off(fp));
+  x86_load(&b, X86_CP, X86_REGS, x86_regs_off(cp));
+  /* lea r8, [rip+entry] */
+  x86_byte(&b, 0x4C);
+  x86_byte(&b, 0x8D);
+  x86_byte(&b, 0x05);
+  x86_int32(&b, 16 - (b.len + 4));
+  x86_dispatch(&b);
+  /* the offset to resume at is in eax */
+  b.common_exit = b.len;
+  x86_store(&b, X86_REGS, x86_regs_off(data), X86_DATA);
+  x86_store(&b, X86_REGS, x86_regs_off(top), X86_TOP);
+  x86_store(&b, X86_REGS, x86_regs_off(fp), X86_FP);
+  x86_store(&b, X86_REGS, x86_regs_off(cp), X86_CP);
+  x86_pop(&b, X86_R15);
+  x86_pop(&b, X86_R14);
+  x86_pop(&b, X86_R13);
+  x86_pop(&b, X86_R12);
+  x86_pop(&b, X86_RBX);
+  x86_byte(&b, 0xC3);
+  /* and for the dispatch, in esi */
+  b.dynamic_exit = b.len;
+  x86_op_reg(&b, 0, 0x89, X86_RSI, X86_RAX);
+  x86_jmp_pos(&b, b.common_exit);
+  for (off=0; off<len; off+=1+words*sizeof(sexp)) {
+    words = x86_operand_words(data[off]);
+    if (off + 1 + words*(sexp_sint_t)sizeof(sexp) > len)
+      break;
+    b.labels[off] = b.len;
+    if (data[off] >= SEXP_OP_NUM_OPCODES || ! x86_instruction(&b, data, off, words)) {
+      b.exits[off] = b.len;
+      x86_exit_stub(&b, off);
+    }
+  }
+  /* in case the last instruction falls through */
+  x86_exit_stub(&b, off);
+  for (i=0; i<(sexp_sint_t)b.num_fixups && ! b.error; i++) {
+    target = b.fixups[i].target;
+    if (target < 0 || target >= len) {
+      b.error = 1;
+      break;
+    }
+    if (! b.fixups[i].exitp && b.labels[target] >= 0) {
+      pos = b.labels[target];
+    } else {
+      if (b.exits[target] < 0) {
+        b.exits[target] = b.len;
+        x86_exit_stub(&b, target);
+      }
+      pos = b.exits[target];
+    }
+    if (! b.error)
+      x86_patch32(&b, b.fixups[i].pos, pos - (b.fixups[i].pos + 4));
+  }
+  while (b.len & 3)
+    x86_byte(&b, 0xCC);
+  table = b.len;
+  for (i=0; i<len; i++)
+    x86_int32(&b, (b.labels[i] >= 0 ? b.labels[i] : b.dynamic_exit) - table);
+  if (b.error || b.labels[0] < 0)
+    goto done;
+  x86_patch32(&b, 8, table - 16);
+  x86_patch32(&b, 12, b.labels[0] - 16);
+  if (! (code = sexp_native_alloc(b.len)))
+    goto done;
+  memcpy(code, b.code, b.len);
+  /* if the system refuses, the procedure stays in the VM */
+  if (! sexp_native_seal(code, b.len))
+    goto done;
+  sexp_bytecode_native(bc) = code + 16;
+  res = 1;
+ done:
+  free(b.code);
+  free(b.fixups);
+  free(b.labels);
+  free(b.exits);
+  return res;
+}
@@ -112,6 +112,7 @@ sexp sexp_write_simple_object (sexp ctx, sexp self, sexp_sint_t n, sexp obj, sex
           while (--nulls) sexp_write_string(ctx, " #<null>", out);
         sexp_write_char(ctx, ' ', out);
         if (writer && sexp_applicablep(writer)) {
+          sexp_write_barrier(ctx, args, x);
           sexp_car(args) = x;
           x = sexp_apply(ctx, writer, args);
           if (sexp_exceptionp(x)) sexp_print_exception(ctx, x, out);
@@ -227,7 +228,9 @@ static struct sexp_type_struct _sexp_type_specs[] = {
   {SEXP_SET, sexp_offsetof(set, var), 3, 3, 0, 0, sexp_sizeof(set), 0, 0, 0, 0, 0, 0, 0, 0, (sexp)"Set!", SEXP_FALSE, SEXP_FALSE, NULL, SEXP_FALSE, (sexp)sexp_write_simple_object, NULL},
   {SEXP_SEQ, sexp_offsetof(seq, ls), 2, 2, 0, 0, sexp_sizeof(seq), 0, 0, 0, 0, 0, 0, 0, 0, (sexp)"Sequence", SEXP_FALSE, SEXP_FALSE, NULL, SEXP_FALSE, (sexp)sexp_write_simple_object, NULL},
   {SEXP_LIT, sexp_offsetof(lit, value), 2, 2, 0, 0, sexp_sizeof(lit), 0, 0, 0, 0, 0, 0, 0, 0, (sexp)"Literal", SEXP_FALSE, SEXP_FALSE, NULL, SEXP_FALSE, (sexp)sexp_write_simple_object, NULL},
-  {SEXP_STACK, sexp_offsetof(stack, data), 1, 1, sexp_offsetof(stack, top), 1, sexp_sizeof(stack), offsetof(struct sexp_struct, value.stack.length), sizeof(sexp), 0, 0, 0, 0, 0, 0, (sexp)"Stack", SEXP_FALSE, SEXP_FALSE, NULL, SEXP_FALSE, NULL, NULL},
+  /* only data[0..top-1] is live: pushes raise top past a slot without */
+  /* writing it, so data[top] may still hold an already collected object */
+  {SEXP_STACK, sexp_offsetof(stack, data), 0, 0, sexp_offsetof(stack, top), 1, sexp_sizeof(stack), offsetof(struct sexp_struct, value.stack.length), sizeof(sexp), 0, 0, 0, 0, 0, 0, (sexp)"Stack", SEXP_FALSE, SEXP_FALSE, NULL, SEXP_FALSE, NULL, NULL},
   {SEXP_CONTEXT, sexp_offsetof(context, stack), 12+SEXP_USE_DL, 12+SEXP_USE_DL, 0, 0, sexp_sizeof(context), 0, 0, 0, 0, 0, 0, 0, 0, (sexp)"Context", SEXP_FALSE, SEXP_FALSE, NULL, SEXP_FALSE, NULL, NULL},
   {SEXP_CPOINTER, sexp_offsetof(cpointer, parent), 1, 0, 0, 0, sexp_sizeof(cpointer), sexp_offsetof(cpointer, length), 1, 0, 0, 0, 0, 0, 0, (sexp)"Cpointer", SEXP_FALSE, SEXP_FALSE, NULL, SEXP_FALSE, NULL, NULL},
 #if SEXP_USE_AUTO_FORCE
@@ -496,6 +499,15 @@ void sexp_destroy_context (sexp ctx) {
   size_t sum_freed;
   if (sexp_context_heap(ctx)) {
     heap = sexp_context_heap(ctx);
+#if SEXP_USE_GENERATIONAL_GC
+    sexp_unmark_heap(ctx);
+#endif
+#if SEXP_USE_INCREMENTAL_GC
+    sexp_cancel_marking(ctx);
+#endif
+#if SEXP_USE_LAZY_SWEEP
+    sexp_finish_sweep(ctx);
+#endif
     sexp_markedp(ctx) = 1;
     sexp_markedp(sexp_context_globals(ctx)) = 1;
     sexp_mark(ctx, sexp_global(ctx, SEXP_G_TYPES));
@@ -758,6 +770,7 @@ sexp sexp_nreverse_op (sexp ctx, sexp self, sexp_sint_t n, sexp ls) {
   sexp_cdr(b) = SEXP_NULL;
   for ( ; sexp_pairp(a); b=a, a=tmp) {
     tmp = sexp_cdr(a);
+    sexp_write_barrier(ctx, a, b);
     sexp_cdr(a) = b;
   }
   return b;
@@ -815,7 +828,7 @@ sexp sexp_equalp_bound (sexp ctx, sexp self, sexp_sint_t n, sexp a, sexp b, sexp
   if (sexp_pointer_tag(a) == SEXP_BIGNUM)
     return !sexp_bignum_compare(a, b) ? bound : SEXP_FALSE;
 #endif
-#if SEXP_USE_FLONUMS && ! SEXP_USE_IMMEDIATE_FLONUMS
+#if SEXP_USE_FLONUMS && (! SEXP_USE_IMMEDIATE_FLONUMS || SEXP_64_BIT)
   if (sexp_pointer_tag(a) == SEXP_FLONUM)
     return sexp_flonum_eqv(a, b) ? bound : SEXP_FALSE;
 #endif
@@ -887,20 +900,25 @@ sexp sexp_make_flonum (sexp ctx, double f) {
   sexp_flonum_value(x) = f;
   return x;
 }
-#else
-#if SEXP_64_BIT
-float sexp_flonum_value (sexp x) {
-  union sexp_flonum_conv r;
-  r.bits = (sexp_uint_t)x >> 32;
-  return r.flonum;
-}
-sexp sexp_make_flonum (sexp ctx, float f) {
+#elif SEXP_64_BIT
+sexp sexp_make_flonum (sexp ctx, double f) {
   union sexp_flonum_conv x;
+  sexp_uint_t r;
+  sexp res;
   x.flonum = f;
-  return (sexp)(((sexp_uint_t)(x.bits) << 32) + SEXP_IFLONUM_TAG);
+  r = (x.bits << 1) | (x.bits >> 63);
+  if (r > 1) {
+    r -= SEXP_IFLONUM_EXP_BIAS;
+    /* exponent out of range, or colliding with the encoded zeros */
+    if (r <= 1 || (r >> (64 - SEXP_IMMEDIATE_BITS))) {
+      res = sexp_alloc_type(ctx, flonum, SEXP_FLONUM);
+      if (!sexp_exceptionp(res)) res->value.flonum = f;
+      return res;
+    }
+  }
+  return (sexp)((r << SEXP_IMMEDIATE_BITS) + SEXP_IFLONUM_TAG);
 }
 #endif
-#endif
 
 sexp sexp_make_bytes_op (sexp ctx, sexp self, sexp_sint_t n, sexp len, sexp i) {
   sexp_sint_t clen = sexp_unbox_fixnum(len);
@@ -1815,6 +1833,26 @@ static struct {const char* name; char ch;} sexp_char_names[] = {
 
 #define sexp_num_char_names (sizeof(sexp_char_names)/sizeof(sexp_char_names[0]))
 
+#if SEXP_USE_FLONUMS && (! SEXP_USE_IMMEDIATE_FLONUMS || SEXP_64_BIT)
+static void sexp_write_double (sexp ctx, double f, sexp out) {
+  char numbuf[NUMBUF_LEN];
+  int i;
+#if SEXP_USE_INFINITIES
+  if (isinf(f) || isnan(f)) {
+    numbuf[0] = (isinf(f) && f < 0 ? '-' : '+');
+    strcpy(numbuf+1, isinf(f) ? "inf.0" : "nan.0");
+  } else
+#endif
+  {
+    i = snprintf(numbuf, NUMBUF_LEN, "%.15g", f);
+    if (!strchr(numbuf, '.') && !strchr(numbuf, 'e')) {
+      numbuf[i++] = '.'; numbuf[i++] = '0'; numbuf[i++] = '\0';
+    }
+  }
+  sexp_write_string(ctx, numbuf, out);
+}
+#endif
+
 sexp sexp_apply_writer(sexp ctx, sexp writer, sexp obj, sexp out) {
   sexp res;
   sexp_gc_var1(args);
@@ -1832,7 +1870,7 @@ sexp sexp_write_one (sexp ctx, sexp obj, sexp out) {
 #endif
   unsigned long len, c;
   long i=0;
-#if SEXP_USE_FLONUMS
+#if SEXP_USE_FLONUMS && SEXP_USE_IMMEDIATE_FLONUMS && ! SEXP_64_BIT
   double f;
 #endif
   sexp x, *elts;
@@ -1871,22 +1909,9 @@ sexp sexp_write_one (sexp ctx, sexp obj, sexp out) {
       }
       break;
 #if SEXP_USE_FLONUMS
-#if ! SEXP_USE_IMMEDIATE_FLONUMS
+#if ! SEXP_USE_IMMEDIATE_FLONUMS || SEXP_64_BIT
     case SEXP_FLONUM:
-      f = sexp_flonum_value(obj);
-#if SEXP_USE_INFINITIES
-      if (isinf(f) || isnan(f)) {
-        numbuf[0] = (isinf(f) && f < 0 ? '-' : '+');
-        strcpy(numbuf+1, isinf(f) ? "inf.0" : "nan.0");
-      } else
-#endif
-      {
-        i = snprintf(numbuf, NUMBUF_LEN, "%.15g", f);
-        if (!strchr(numbuf, '.') && !strchr(numbuf, 'e')) {
-          numbuf[i++] = '.'; numbuf[i++] = '0'; numbuf[i++] = '\0';
-        }
-      }
-      sexp_write_string(ctx, numbuf, out);
+      sexp_write_double(ctx, sexp_flonum_value(obj), out);
       break;
 #endif
 #endif
@@ -2046,7 +2071,10 @@ sexp sexp_write_one (sexp ctx, sexp obj, sexp out) {
   } else if (sexp_fixnump(obj)) {
     snprintf(numbuf, NUMBUF_LEN, "%ld", (long)sexp_unbox_fixnum(obj));
     sexp_write_string(ctx, numbuf, out);
-#if SEXP_USE_IMMEDIATE_FLONUMS
+#if SEXP_USE_IMMEDIATE_FLONUMS && SEXP_64_BIT
+  } else if (sexp_iflonump(obj)) {
+    sexp_write_double(ctx, sexp_iflonum_value(obj), out);
+#elif SEXP_USE_IMMEDIATE_FLONUMS
   } else if (sexp_flonump(obj)) {
     f = sexp_flonum_value(obj);
 #if SEXP_USE_INFINITIES
@@ -2707,6 +2735,7 @@ sexp sexp_read_raw (sexp ctx, sexp in) {
           } else {
             tmp2 = res;
             res = sexp_nreverse(ctx, res);
+            sexp_write_barrier(ctx, tmp2, tmp);
             sexp_cdr(tmp2) = tmp;
           }
         }